@@ -36,3 +36,13 @@ add_custom_target(
 add_library(boost INTERFACE)
 add_dependencies(boost boost_clone)
 target_include_directories(boost INTERFACE ${CMAKE_BINARY_DIR}/boost_root)
+
+###############################################################################
+# Google Benchmark
+###############################################################################
+find_package(benchmark QUIET)
+if (benchmark_FOUND)
+  message("-- Found Google Benchmark; building perf targets")
+else ()
+  message("-- Google Benchmark not found; skipping perf targets")
+endif ()
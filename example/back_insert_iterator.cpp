@@ -4,6 +4,7 @@
 // accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
 //[ back_insert_iterator
+#include <boost/stl_interfaces/algorithm.hpp>
 #include <boost/stl_interfaces/iterator_interface.hpp>
 
 #include <algorithm>
@@ -58,6 +59,17 @@ struct back_insert_iterator : boost::stl_interfaces::iterator_interface<
     using base_type::operator++;
 
 private:
+    friend boost::stl_interfaces::access;
+
+    // boost::stl_interfaces::copy() and transform() pass whole ranges to
+    // this optional hook, so the container can grow once per range instead
+    // of once per element.
+    template<typename Iter>
+    void sink(Iter first, Iter last)
+    {
+        c_->insert(c_->end(), first, last);
+    }
+
     Container * c_;
 };
 
@@ -75,5 +87,11 @@ int main()
     std::vector<int> ints_copy;
     std::copy(ints.begin(), ints.end(), ::back_inserter(ints_copy));
     assert(ints_copy == ints);
+
+    // This calls sink() once, instead of push_back() once per element.
+    std::vector<int> ints_copy_2;
+    boost::stl_interfaces::copy(
+        ints.begin(), ints.end(), ::back_inserter(ints_copy_2));
+    assert(ints_copy_2 == ints);
 }
 //]
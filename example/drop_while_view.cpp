@@ -68,27 +68,32 @@ struct drop_while_view
     constexpr base_type base() const { return base_; }
     constexpr Pred const & pred() const noexcept { return pred_; }
 
-    // A more robust implementation should probably cache the value computed
-    // by this function, so that subsequent calls can just return the cached
-    // iterator.
+    // The search for the first element is done only once; later calls,
+    // including the ones view_interface makes in empty(), front(), etc.,
+    // return the cached iterator.
     constexpr auto begin()
     {
-        // We're forced to write this out as a raw loop, since no
-        // std::-namespace algorithms accept a sentinel.
-        auto first = base_.begin();
-        auto const last = base_.end();
-        for (; first != last; ++first) {
-            if (!pred_(*first))
-                break;
-        }
-        return first;
+        return first_.get([this] {
+            // We're forced to write this out as a raw loop, since no
+            // std::-namespace algorithms accept a sentinel.
+            auto first = base_.begin();
+            auto const last = base_.end();
+            for (; first != last; ++first) {
+                if (!pred_(*first))
+                    break;
+            }
+            return first;
+        });
     }
 
     constexpr auto end() { return base_.end(); }
 
 private:
+    using iterator = decltype(std::declval<base_type &>().begin());
+
     base_type base_;
     Pred pred_;
+    boost::stl_interfaces::cached_begin<iterator> first_;
 };
 
 // Since this is a C++14 and later library, we're not using CTAD; we therefore
@@ -23,7 +23,10 @@ struct reverse_iterator
     : boost::stl_interfaces::iterator_interface<
           reverse_iterator<BidiIter>,
 #if 201703L < __cplusplus && defined(__cpp_lib_ranges)
-          typename std::iterator_traits<BidiIter>::iterator_concept,
+          std::conditional_t<
+              std::contiguous_iterator<BidiIter>,
+              std::contiguous_iterator_tag,
+              typename std::iterator_traits<BidiIter>::iterator_category>,
 #else
           typename std::iterator_traits<BidiIter>::iterator_category,
 #endif
@@ -87,15 +87,19 @@ struct static_vector : sequence_container_interface<
     {
         this->assign(other.begin(), other.end());
     }
+    // Moves relocate the elements of other with
+    // boost::stl_interfaces::uninitialized_relocate(), which is a single
+    // memcpy for types for which
+    // boost::stl_interfaces::is_trivially_relocatable is true.
     static_vector(static_vector && other) noexcept(
-        noexcept(std::declval<static_vector>().emplace_back(
-            std::move(*other.begin())))) :
+        boost::stl_interfaces::is_trivially_relocatable<T>::value ||
+        std::is_nothrow_move_constructible<T>::value) :
         size_(0)
     {
-        for (auto & element : other) {
-            emplace_back(std::move(element));
-        }
-        other.clear();
+        boost::stl_interfaces::uninitialized_relocate(
+            other.begin(), other.end(), begin());
+        size_ = other.size_;
+        other.size_ = 0;
     }
     static_vector & operator=(static_vector const & other)
     {
@@ -103,14 +107,17 @@ struct static_vector : sequence_container_interface<
         this->assign(other.begin(), other.end());
         return *this;
     }
-    static_vector & operator=(static_vector && other) noexcept(noexcept(
-        std::declval<static_vector>().emplace_back(std::move(*other.begin()))))
+    static_vector & operator=(static_vector && other) noexcept(
+        boost::stl_interfaces::is_trivially_relocatable<T>::value ||
+        std::is_nothrow_move_constructible<T>::value)
     {
+        if (&other == this)
+            return *this;
         this->clear();
-        for (auto & element : other) {
-            emplace_back(std::move(element));
-        }
-        other.clear();
+        boost::stl_interfaces::uninitialized_relocate(
+            other.begin(), other.end(), begin());
+        size_ = other.size_;
+        other.size_ = 0;
         return *this;
     }
     ~static_vector() { this->clear(); }
@@ -175,15 +182,18 @@ struct static_vector : sequence_container_interface<
     iterator emplace(const_iterator pos, Args &&... args)
     {
         auto position = const_cast<T *>(pos);
-        bool const insert_before_end = position < end();
-        if (insert_before_end) {
-            auto last = end();
-            emplace_back(std::move(this->back()));
-            std::move_backward(position, last - 1, last);
-        }
-        new (position) T(std::forward<Args>(args)...);
-        if (!insert_before_end)
+        if (position == end()) {
+            new (position) T(std::forward<Args>(args)...);
             ++size_;
+            return position;
+        }
+        // args may refer to an element of *this, so the new element is
+        // constructed before anything is shifted.
+        T x(std::forward<Args>(args)...);
+        boost::stl_interfaces::uninitialized_relocate_backward(
+            position, end(), end() + 1);
+        new (position) T(std::move(x));
+        ++size_;
         return position;
     }
     // Note: The iterator category here was upgraded to ForwardIterator
@@ -199,9 +209,27 @@ struct static_vector : sequence_container_interface<
         auto position = const_cast<T *>(pos);
         auto const insertions = std::distance(first, last);
         assert(this->size() + insertions < capacity());
-        uninitialized_generate(end(), end() + insertions, [] { return T(); });
-        std::move_backward(position, end(), end() + insertions);
-        std::copy(first, last, position);
+        // Only the elements that land past the current end() are constructed
+        // in uninitialized storage; the rest are assigned over existing
+        // elements.  Nothing is default-constructed.
+        auto const old_end = end();
+        auto const tail = old_end - position;
+        if (insertions < tail) {
+            std::uninitialized_copy(
+                std::make_move_iterator(old_end - insertions),
+                std::make_move_iterator(old_end),
+                old_end);
+            std::move_backward(position, old_end - insertions, old_end);
+            std::copy(first, last, position);
+        } else {
+            auto const mid = std::next(first, tail);
+            std::uninitialized_copy(mid, last, old_end);
+            std::uninitialized_copy(
+                std::make_move_iterator(position),
+                std::make_move_iterator(old_end),
+                position + insertions);
+            std::copy(first, mid, position);
+        }
         size_ += insertions;
         return position;
     }
@@ -209,16 +237,24 @@ struct static_vector : sequence_container_interface<
     {
         auto first = const_cast<T *>(f);
         auto last = const_cast<T *>(l);
-        auto end_ = this->end();
-        auto it = std::move(last, end_, first);
-        for (; it != end_; ++it) {
+        for (auto it = first; it != last; ++it) {
             it->~T();
         }
+        boost::stl_interfaces::uninitialized_relocate(last, end(), first);
         size_ -= last - first;
         return first;
     }
     void swap(static_vector & other)
     {
+        if (boost::stl_interfaces::is_trivially_relocatable<T>::value) {
+            // Swapping the bytes of the live elements is equivalent to
+            // relocating each set of elements into the other's storage.
+            auto const bytes = (std::max)(size_, other.size_) * sizeof(T);
+            std::swap_ranges(buf_, buf_ + bytes, other.buf_);
+            std::swap(size_, other.size_);
+            return;
+        }
+
         size_type short_size, long_size;
         std::tie(short_size, long_size) =
             std::minmax(this->size(), other.size());
@@ -240,7 +276,7 @@ struct static_vector : sequence_container_interface<
             shorter->emplace_back(std::move(*it));
         }
 
-        longer->resize(short_size);
+        longer->erase(longer->begin() + short_size, longer->end());
         shorter->size_ = long_size;
     }
 
@@ -18,6 +18,9 @@
 // iterator writable, it needs to have a reference type that is not actually a
 // reference -- the reference type is a pair of references, std::tuple<int &,
 // int &>.
+//
+// boost/stl_interfaces/zip_iterator.hpp provides a general-purpose version
+// of this iterator, for any number of underlying iterators of any category.
 struct zip_iterator : boost::stl_interfaces::proxy_iterator_interface<
                       zip_iterator,
                       std::random_access_iterator_tag,
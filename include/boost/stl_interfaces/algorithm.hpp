@@ -0,0 +1,619 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_ALGORITHM_HPP
+#define BOOST_STL_INTERFACES_ALGORITHM_HPP
+
+#include <boost/stl_interfaces/detail/prefetch.hpp>
+#include <boost/stl_interfaces/segmented_iterator.hpp>
+#include <boost/stl_interfaces/views.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
+
+namespace boost { namespace stl_interfaces { inline namespace v1 {
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    namespace v1_dtl {
+        template<typename T>
+        struct static_const
+        {
+            static constexpr T value{};
+        };
+        template<typename T>
+        constexpr T static_const<T>::value;
+
+        // The algorithms are function objects rather than function
+        // templates, so that argument-dependent lookup never finds them.
+        // Otherwise, an unqualified call to, say, copy() that passes both
+        // an iterator_interface iterator and a std iterator would be
+        // ambiguous between this copy() and std::copy().
+
+        struct for_each_algorithm
+        {
+            template<typename Iter, typename F>
+            F operator()(Iter first, Iter last, F f) const;
+        };
+        struct for_each_segment_algorithm
+        {
+            template<typename Iter, typename F>
+            F operator()(Iter first, Iter last, F f) const;
+        };
+        struct copy_algorithm
+        {
+            template<typename InputIter, typename OutputIter>
+            OutputIter
+            operator()(InputIter first, InputIter last, OutputIter out) const;
+        };
+        struct transform_algorithm
+        {
+            template<typename InputIter, typename OutputIter, typename F>
+            OutputIter operator()(
+                InputIter first, InputIter last, OutputIter out, F f) const;
+        };
+        struct fill_algorithm
+        {
+            template<typename Iter, typename T>
+            void operator()(Iter first, Iter last, T const & x) const;
+        };
+        struct find_algorithm
+        {
+            template<typename Iter, typename T>
+            Iter operator()(Iter first, Iter last, T const & x) const;
+        };
+        struct count_algorithm
+        {
+            template<typename Iter, typename T>
+            iter_difference_t<Iter>
+            operator()(Iter first, Iter last, T const & x) const;
+        };
+        struct accumulate_algorithm
+        {
+            template<typename Iter, typename T, typename Op>
+            T operator()(Iter first, Iter last, T init, Op op) const;
+            template<typename Iter, typename T>
+            T operator()(Iter first, Iter last, T init) const;
+        };
+
+        // count(), find(), fill(), and copy() call the *_dispatch()
+        // overload found by argument-dependent lookup on algorithm_tag.  A
+        // header can add overloads for its own iterators to v1_dtl, as
+        // packed_vector.hpp does, and they are chosen over the generic ones
+        // below because they are more specialized.
+        struct algorithm_tag
+        {};
+    }
+#endif
+
+    namespace {
+        /** Equivalent to `std::for_each(first, last, f)`.  If `Iter` is a
+            segmented iterator (see `segmented_iterator_traits`), `f` is
+            applied to each segment's elements using that segment's local
+            iterators, which for a contiguous segment means a loop over raw
+            pointers.  If `Iter` (or the local iterator) has a
+            `prefetch_address()` hook (see `iterator_interface`), the
+            address it gives is prefetched before each element is visited.
+
+            Like the other algorithms in this header, `for_each` is a
+            function object, so unqualified calls never find it through
+            argument-dependent lookup. */
+        constexpr auto const & for_each =
+            v1_dtl::static_const<v1_dtl::for_each_algorithm>::value;
+
+        /** Calls `f(seg_first, seg_last)` for each nonempty, unsegmented
+            subrange of [first, last), in order.  If `Iter` is not a
+            segmented iterator, that is just `f(first, last)`.  Otherwise,
+            [first, last) is split at its segment boundaries, and each of
+            the pieces is split further if its local iterators are
+            themselves segmented.  The body of `f` is then a loop over a
+            single segment, with no segment boundaries to check for, that
+            the compiler is free to unroll or vectorize.  Returns `f`. */
+        constexpr auto const & for_each_segment =
+            v1_dtl::static_const<v1_dtl::for_each_segment_algorithm>::value;
+
+        /** Equivalent to `std::copy(first, last, out)`, except that a
+            segmented `InputIter` is copied from one segment at a time.
+            Only the input range is decomposed.  If `OutputIter` has a
+            `sink()` hook (see `iterator_interface`), each unsegmented range
+            is passed to it in one call; otherwise, `out` is advanced an
+            element at a time. */
+        constexpr auto const & copy =
+            v1_dtl::static_const<v1_dtl::copy_algorithm>::value;
+
+        /** Equivalent to `std::transform(first, last, out, f)`, except that
+            a segmented `InputIter` is transformed one segment at a time.
+            If `OutputIter` has a `sink()` hook (see `iterator_interface`),
+            each unsegmented range is passed to it in one call, as a range
+            of iterators that call `f` when dereferenced. */
+        constexpr auto const & transform =
+            v1_dtl::static_const<v1_dtl::transform_algorithm>::value;
+
+        /** Equivalent to `std::fill(first, last, x)`, except that a
+            segmented `Iter` is filled one segment at a time. */
+        constexpr auto const & fill =
+            v1_dtl::static_const<v1_dtl::fill_algorithm>::value;
+
+        /** Equivalent to `std::find(first, last, x)`, except that a
+            segmented `Iter` is searched one segment at a time, and that the
+            `prefetch_address()` hook is used as in `for_each`. */
+        constexpr auto const & find =
+            v1_dtl::static_const<v1_dtl::find_algorithm>::value;
+
+        /** Equivalent to `std::count(first, last, x)`, except that a
+            segmented `Iter` is counted one segment at a time. */
+        constexpr auto const & count =
+            v1_dtl::static_const<v1_dtl::count_algorithm>::value;
+
+        /** Equivalent to `std::accumulate(first, last, init, op)`, except
+            that a segmented `Iter` is accumulated one segment at a time,
+            and that the `prefetch_address()` hook is used as in
+            `for_each`.  `op` defaults to `std::plus<>()`. */
+        constexpr auto const & accumulate =
+            v1_dtl::static_const<v1_dtl::accumulate_algorithm>::value;
+    }
+
+    namespace v1_dtl {
+        // These visit [first, last) an element at a time.  If Iter has a
+        // prefetch_address() hook, the address it gives is prefetched
+        // before each element is visited.
+
+        template<typename Iter, typename F>
+        F prefetch_for_each(Iter first, Iter last, F f, std::false_type)
+        {
+            return std::for_each(first, last, std::move(f));
+        }
+        template<typename Iter, typename F>
+        F prefetch_for_each(Iter first, Iter last, F f, std::true_type)
+        {
+            for (; first != last; ++first) {
+                BOOST_STL_INTERFACES_PREFETCH(access::prefetch_address(first));
+                f(*first);
+            }
+            return f;
+        }
+
+        template<typename Iter, typename T>
+        Iter prefetch_find(Iter first, Iter last, T const & x, std::false_type)
+        {
+            return std::find(first, last, x);
+        }
+        template<typename Iter, typename T>
+        Iter prefetch_find(Iter first, Iter last, T const & x, std::true_type)
+        {
+            for (; first != last; ++first) {
+                BOOST_STL_INTERFACES_PREFETCH(access::prefetch_address(first));
+                if (*first == x)
+                    break;
+            }
+            return first;
+        }
+
+        template<typename Iter, typename T, typename Op>
+        T prefetch_accumulate(
+            Iter first, Iter last, T init, Op & op, std::false_type)
+        {
+            return std::accumulate(first, last, std::move(init), std::ref(op));
+        }
+        template<typename Iter, typename T, typename Op>
+        T prefetch_accumulate(
+            Iter first, Iter last, T init, Op & op, std::true_type)
+        {
+            for (; first != last; ++first) {
+                BOOST_STL_INTERFACES_PREFETCH(access::prefetch_address(first));
+                init = op(std::move(init), *first);
+            }
+            return init;
+        }
+
+        // Each of these visits [first, last) of a segmented iterator one
+        // segment at a time: the tail of first's segment, every segment in
+        // between, and the head of last's segment.  The calls on local
+        // ranges go back through the public overloads, so that a local
+        // iterator that is itself segmented is handled recursively.
+
+        template<typename Iter, typename F>
+        F for_each_impl(Iter first, Iter last, F f, std::false_type)
+        {
+            return v1_dtl::prefetch_for_each(
+                first, last, std::move(f), prefetch_hook<Iter>{});
+        }
+        template<typename Iter, typename F>
+        F for_each_impl(Iter first, Iter last, F f, std::true_type)
+        {
+            // f is passed down by reference, since many function objects
+            // (lambdas among them) cannot be assigned to.
+            std::reference_wrapper<F> g(f);
+            using traits = segmented_iterator_traits<Iter>;
+            auto seg = traits::segment(first);
+            auto const last_seg = traits::segment(last);
+            if (seg == last_seg) {
+                stl_interfaces::for_each(
+                    traits::local(first), traits::local(last), g);
+                return f;
+            }
+            stl_interfaces::for_each(traits::local(first), traits::end(seg), g);
+            for (++seg; seg != last_seg; ++seg) {
+                stl_interfaces::for_each(
+                    traits::begin(seg), traits::end(seg), g);
+            }
+            stl_interfaces::for_each(
+                traits::begin(seg), traits::local(last), g);
+            return f;
+        }
+
+        template<typename Iter, typename F>
+        F for_each_segment_impl(Iter first, Iter last, F f, std::false_type)
+        {
+            if (first != last)
+                f(first, last);
+            return f;
+        }
+        template<typename Iter, typename F>
+        F for_each_segment_impl(Iter first, Iter last, F f, std::true_type)
+        {
+            std::reference_wrapper<F> g(f);
+            using traits = segmented_iterator_traits<Iter>;
+            auto seg = traits::segment(first);
+            auto const last_seg = traits::segment(last);
+            if (seg == last_seg) {
+                stl_interfaces::for_each_segment(
+                    traits::local(first), traits::local(last), g);
+                return f;
+            }
+            stl_interfaces::for_each_segment(
+                traits::local(first), traits::end(seg), g);
+            for (++seg; seg != last_seg; ++seg) {
+                stl_interfaces::for_each_segment(
+                    traits::begin(seg), traits::end(seg), g);
+            }
+            stl_interfaces::for_each_segment(
+                traits::begin(seg), traits::local(last), g);
+            return f;
+        }
+
+        // An output iterator with a sink() hook takes each unsegmented
+        // input range in one call.
+
+        template<typename InputIter, typename OutputIter>
+        OutputIter sink_copy_impl(
+            InputIter first, InputIter last, OutputIter out, std::false_type)
+        {
+            return std::copy(first, last, out);
+        }
+        template<typename InputIter, typename OutputIter>
+        OutputIter sink_copy_impl(
+            InputIter first, InputIter last, OutputIter out, std::true_type)
+        {
+            access::sink(out, first, last);
+            return out;
+        }
+
+        template<typename InputIter, typename OutputIter>
+        OutputIter copy_impl(
+            InputIter first, InputIter last, OutputIter out, std::false_type)
+        {
+            return v1_dtl::sink_copy_impl(
+                first, last, out, sink_hook<OutputIter, InputIter>{});
+        }
+        template<typename InputIter, typename OutputIter>
+        OutputIter copy_impl(
+            InputIter first, InputIter last, OutputIter out, std::true_type)
+        {
+            using traits = segmented_iterator_traits<InputIter>;
+            auto seg = traits::segment(first);
+            auto const last_seg = traits::segment(last);
+            if (seg == last_seg) {
+                return stl_interfaces::copy(
+                    traits::local(first), traits::local(last), out);
+            }
+            out = stl_interfaces::copy(
+                traits::local(first), traits::end(seg), out);
+            for (++seg; seg != last_seg; ++seg) {
+                out = stl_interfaces::copy(
+                    traits::begin(seg), traits::end(seg), out);
+            }
+            return stl_interfaces::copy(
+                traits::begin(seg), traits::local(last), out);
+        }
+
+        // The elements of [first, last) transformed by f, as a range that
+        // can be passed to sink().
+        template<typename InputIter, typename F>
+        using sink_transform_view =
+            transform_view<subrange<InputIter>, std::reference_wrapper<F>>;
+        template<typename InputIter, typename F>
+        using sink_transform_iter =
+            typename sink_transform_view<InputIter, F>::iterator;
+
+        template<typename InputIter, typename OutputIter, typename F>
+        OutputIter sink_transform_impl(
+            InputIter first,
+            InputIter last,
+            OutputIter out,
+            F & f,
+            std::false_type)
+        {
+            return std::transform(
+                first, last, out, std::reference_wrapper<F>(f));
+        }
+        template<typename InputIter, typename OutputIter, typename F>
+        OutputIter sink_transform_impl(
+            InputIter first,
+            InputIter last,
+            OutputIter out,
+            F & f,
+            std::true_type)
+        {
+            sink_transform_view<InputIter, F> v(
+                subrange<InputIter>(first, last), std::reference_wrapper<F>(f));
+            access::sink(out, v.begin(), v.end());
+            return out;
+        }
+
+        template<typename InputIter, typename OutputIter, typename F>
+        OutputIter transform_impl(
+            InputIter first,
+            InputIter last,
+            OutputIter out,
+            F & f,
+            std::false_type)
+        {
+            return v1_dtl::sink_transform_impl(
+                first,
+                last,
+                out,
+                f,
+                sink_hook<OutputIter, sink_transform_iter<InputIter, F>>{});
+        }
+        template<typename InputIter, typename OutputIter, typename F>
+        OutputIter transform_impl(
+            InputIter first,
+            InputIter last,
+            OutputIter out,
+            F & f,
+            std::true_type)
+        {
+            std::reference_wrapper<F> g(f);
+            using traits = segmented_iterator_traits<InputIter>;
+            auto seg = traits::segment(first);
+            auto const last_seg = traits::segment(last);
+            if (seg == last_seg) {
+                return stl_interfaces::transform(
+                    traits::local(first), traits::local(last), out, g);
+            }
+            out = stl_interfaces::transform(
+                traits::local(first), traits::end(seg), out, g);
+            for (++seg; seg != last_seg; ++seg) {
+                out = stl_interfaces::transform(
+                    traits::begin(seg), traits::end(seg), out, g);
+            }
+            return stl_interfaces::transform(
+                traits::begin(seg), traits::local(last), out, g);
+        }
+
+        template<typename Iter, typename T>
+        void fill_impl(Iter first, Iter last, T const & x, std::false_type)
+        {
+            std::fill(first, last, x);
+        }
+        template<typename Iter, typename T>
+        void fill_impl(Iter first, Iter last, T const & x, std::true_type)
+        {
+            using traits = segmented_iterator_traits<Iter>;
+            auto seg = traits::segment(first);
+            auto const last_seg = traits::segment(last);
+            if (seg == last_seg) {
+                stl_interfaces::fill(
+                    traits::local(first), traits::local(last), x);
+                return;
+            }
+            stl_interfaces::fill(traits::local(first), traits::end(seg), x);
+            for (++seg; seg != last_seg; ++seg) {
+                stl_interfaces::fill(traits::begin(seg), traits::end(seg), x);
+            }
+            stl_interfaces::fill(traits::begin(seg), traits::local(last), x);
+        }
+
+        template<typename Iter, typename T>
+        Iter find_impl(Iter first, Iter last, T const & x, std::false_type)
+        {
+            return v1_dtl::prefetch_find(first, last, x, prefetch_hook<Iter>{});
+        }
+        template<typename Iter, typename T>
+        Iter find_impl(Iter first, Iter last, T const & x, std::true_type)
+        {
+            using traits = segmented_iterator_traits<Iter>;
+            auto seg = traits::segment(first);
+            auto const last_seg = traits::segment(last);
+            if (seg == last_seg) {
+                auto const local_last = traits::local(last);
+                auto const it = stl_interfaces::find(
+                    traits::local(first), local_last, x);
+                return it == local_last ? last : traits::compose(seg, it);
+            }
+            {
+                auto const local_last = traits::end(seg);
+                auto const it = stl_interfaces::find(
+                    traits::local(first), local_last, x);
+                if (it != local_last)
+                    return traits::compose(seg, it);
+            }
+            for (++seg; seg != last_seg; ++seg) {
+                auto const local_last = traits::end(seg);
+                auto const it =
+                    stl_interfaces::find(traits::begin(seg), local_last, x);
+                if (it != local_last)
+                    return traits::compose(seg, it);
+            }
+            auto const local_last = traits::local(last);
+            auto const it =
+                stl_interfaces::find(traits::begin(seg), local_last, x);
+            return it == local_last ? last : traits::compose(seg, it);
+        }
+
+        template<typename Iter, typename T>
+        iter_difference_t<Iter>
+        count_impl(Iter first, Iter last, T const & x, std::false_type)
+        {
+            return std::count(first, last, x);
+        }
+        template<typename Iter, typename T>
+        iter_difference_t<Iter>
+        count_impl(Iter first, Iter last, T const & x, std::true_type)
+        {
+            using traits = segmented_iterator_traits<Iter>;
+            using difference_type = iter_difference_t<Iter>;
+            auto seg = traits::segment(first);
+            auto const last_seg = traits::segment(last);
+            if (seg == last_seg) {
+                return difference_type(stl_interfaces::count(
+                    traits::local(first), traits::local(last), x));
+            }
+            auto result = difference_type(stl_interfaces::count(
+                traits::local(first), traits::end(seg), x));
+            for (++seg; seg != last_seg; ++seg) {
+                result += difference_type(stl_interfaces::count(
+                    traits::begin(seg), traits::end(seg), x));
+            }
+            return result + difference_type(stl_interfaces::count(
+                                traits::begin(seg), traits::local(last), x));
+        }
+
+        template<typename Iter, typename T, typename Op>
+        T accumulate_impl(
+            Iter first, Iter last, T init, Op & op, std::false_type)
+        {
+            return v1_dtl::prefetch_accumulate(
+                first, last, std::move(init), op, prefetch_hook<Iter>{});
+        }
+        template<typename Iter, typename T, typename Op>
+        T accumulate_impl(
+            Iter first, Iter last, T init, Op & op, std::true_type)
+        {
+            std::reference_wrapper<Op> g(op);
+            using traits = segmented_iterator_traits<Iter>;
+            auto seg = traits::segment(first);
+            auto const last_seg = traits::segment(last);
+            if (seg == last_seg) {
+                return stl_interfaces::accumulate(
+                    traits::local(first),
+                    traits::local(last),
+                    std::move(init),
+                    g);
+            }
+            init = stl_interfaces::accumulate(
+                traits::local(first), traits::end(seg), std::move(init), g);
+            for (++seg; seg != last_seg; ++seg) {
+                init = stl_interfaces::accumulate(
+                    traits::begin(seg), traits::end(seg), std::move(init), g);
+            }
+            return stl_interfaces::accumulate(
+                traits::begin(seg), traits::local(last), std::move(init), g);
+        }
+    }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    namespace v1_dtl {
+        template<typename Iter, typename T>
+        iter_difference_t<Iter>
+        count_dispatch(algorithm_tag, Iter first, Iter last, T const & x)
+        {
+            return v1_dtl::count_impl(
+                first, last, x, is_segmented_iterator<Iter>{});
+        }
+        template<typename Iter, typename T>
+        Iter find_dispatch(algorithm_tag, Iter first, Iter last, T const & x)
+        {
+            return v1_dtl::find_impl(
+                first, last, x, is_segmented_iterator<Iter>{});
+        }
+        template<typename Iter, typename T>
+        void fill_dispatch(algorithm_tag, Iter first, Iter last, T const & x)
+        {
+            v1_dtl::fill_impl(first, last, x, is_segmented_iterator<Iter>{});
+        }
+        template<typename InputIter, typename OutputIter>
+        OutputIter copy_dispatch(
+            algorithm_tag, InputIter first, InputIter last, OutputIter out)
+        {
+            return v1_dtl::copy_impl(
+                first, last, out, is_segmented_iterator<InputIter>{});
+        }
+
+        template<typename Iter, typename F>
+        F for_each_algorithm::operator()(Iter first, Iter last, F f) const
+        {
+            return v1_dtl::for_each_impl(
+                first, last, std::move(f), is_segmented_iterator<Iter>{});
+        }
+
+        template<typename Iter, typename F>
+        F for_each_segment_algorithm::operator()(
+            Iter first, Iter last, F f) const
+        {
+            return v1_dtl::for_each_segment_impl(
+                first, last, std::move(f), is_segmented_iterator<Iter>{});
+        }
+
+        template<typename InputIter, typename OutputIter>
+        OutputIter copy_algorithm::operator()(
+            InputIter first, InputIter last, OutputIter out) const
+        {
+            return copy_dispatch(algorithm_tag{}, first, last, out);
+        }
+
+        template<typename InputIter, typename OutputIter, typename F>
+        OutputIter transform_algorithm::operator()(
+            InputIter first, InputIter last, OutputIter out, F f) const
+        {
+            return v1_dtl::transform_impl(
+                first, last, out, f, is_segmented_iterator<InputIter>{});
+        }
+
+        template<typename Iter, typename T>
+        void
+        fill_algorithm::operator()(Iter first, Iter last, T const & x) const
+        {
+            fill_dispatch(algorithm_tag{}, first, last, x);
+        }
+
+        template<typename Iter, typename T>
+        Iter
+        find_algorithm::operator()(Iter first, Iter last, T const & x) const
+        {
+            return find_dispatch(algorithm_tag{}, first, last, x);
+        }
+
+        template<typename Iter, typename T>
+        iter_difference_t<Iter>
+        count_algorithm::operator()(Iter first, Iter last, T const & x) const
+        {
+            return count_dispatch(algorithm_tag{}, first, last, x);
+        }
+
+        template<typename Iter, typename T, typename Op>
+        T accumulate_algorithm::operator()(
+            Iter first, Iter last, T init, Op op) const
+        {
+            return v1_dtl::accumulate_impl(
+                first,
+                last,
+                std::move(init),
+                op,
+                is_segmented_iterator<Iter>{});
+        }
+        template<typename Iter, typename T>
+        T accumulate_algorithm::operator()(Iter first, Iter last, T init) const
+        {
+            return (*this)(first, last, std::move(init), std::plus<>());
+        }
+    }
+#endif
+
+}}}
+
+#endif
@@ -0,0 +1,210 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_ALLOCATOR_INTERFACE_HPP
+#define BOOST_STL_INTERFACES_ALLOCATOR_INTERFACE_HPP
+
+#include <boost/stl_interfaces/fwd.hpp>
+
+#include <boost/assert.hpp>
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+
+namespace boost { namespace stl_interfaces { namespace detail {
+
+    template<
+        typename Allocator,
+        bool Empty =
+            std::is_empty<Allocator>::value && !std::is_final<Allocator>::value>
+    struct allocator_holder : private Allocator
+    {
+        allocator_holder() = default;
+        allocator_holder(Allocator const & a) noexcept : Allocator(a) {}
+        allocator_holder(Allocator && a) noexcept : Allocator(std::move(a)) {}
+
+        Allocator & alloc() noexcept { return *this; }
+        Allocator const & alloc() const noexcept { return *this; }
+    };
+    template<typename Allocator>
+    struct allocator_holder<Allocator, false>
+    {
+        allocator_holder() = default;
+        allocator_holder(Allocator const & a) noexcept : a_(a) {}
+        allocator_holder(Allocator && a) noexcept : a_(std::move(a)) {}
+
+        Allocator & alloc() noexcept { return a_; }
+        Allocator const & alloc() const noexcept { return a_; }
+
+    private:
+        Allocator a_;
+    };
+
+}}}
+
+namespace boost { namespace stl_interfaces { inline namespace v1 {
+
+    /** A CRTP template that an allocator-aware container `Derived` may
+        publicly derive from, alongside `sequence_container_interface`.  It
+        stores the allocator (taking no space if `Allocator` is empty), and
+        provides the `allocator_type` typedef and `get_allocator()`.
+
+        The allocator-aware container requirements consist mostly of
+        constructors and special members, which no base class can provide.
+        For those, `allocator_interface` provides protected members that
+        implement the allocator half of each operation as
+        `std::allocator_traits<Allocator>` specifies: propagation on copy
+        assignment, move assignment and `swap()`, and
+        `select_on_container_copy_construction()`.  `Derived`'s
+        allocator-extended constructors need only pass the allocator along to
+        this base.
+
+        `std::uses_allocator<Derived, Alloc>` is true for any `Alloc`
+        convertible to `Allocator`, via the `allocator_type` typedef, so
+        `Derived` works with `std::pmr::polymorphic_allocator` and
+        `std::scoped_allocator_adaptor`. */
+    template<typename Derived, typename Allocator>
+    struct allocator_interface
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+        : private detail::allocator_holder<Allocator>
+#endif
+    {
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        using holder = detail::allocator_holder<Allocator>;
+#endif
+
+    public:
+        using allocator_type = Allocator;
+
+        allocator_type get_allocator() const noexcept { return alloc(); }
+
+    protected:
+        using alloc_traits = std::allocator_traits<Allocator>;
+
+        allocator_interface() = default;
+        allocator_interface(Allocator const & a) noexcept : holder(a) {}
+        allocator_interface(Allocator && a) noexcept : holder(std::move(a)) {}
+
+        /** The allocator a copy of `other` should use. */
+        static Allocator
+        select_on_container_copy_construction(Derived const & other)
+        {
+            return alloc_traits::select_on_container_copy_construction(
+                base(other).alloc());
+        }
+
+        Allocator & alloc() noexcept { return holder::alloc(); }
+        Allocator const & alloc() const noexcept { return holder::alloc(); }
+
+        /** Returns true iff copy assignment from `other` will replace this
+            container's allocator with one that cannot deallocate its current
+            storage; the derived container must release all its storage
+            before calling `copy_assign_allocator()` in that case. */
+        bool copy_assignment_changes_allocator(Derived const & other) const
+            noexcept
+        {
+            return alloc_traits::propagate_on_container_copy_assignment::
+                       value &&
+                   !alloc_traits::is_always_equal::value &&
+                   alloc() != base(other).alloc();
+        }
+        /** Copies `other`'s allocator, if
+            `propagate_on_container_copy_assignment` is true. */
+        void copy_assign_allocator(Derived const & other) noexcept
+        {
+            copy_assign_allocator_impl(
+                other,
+                typename alloc_traits::propagate_on_container_copy_assignment{});
+        }
+
+        /** Returns true iff move assignment from `other` can take ownership
+            of `other`'s storage, either because the allocator propagates, or
+            because the two allocators compare equal.  Otherwise, the derived
+            container must move the elements one at a time. */
+        bool move_assignment_steals_storage(Derived const & other) const
+            noexcept
+        {
+            return alloc_traits::propagate_on_container_move_assignment::
+                       value ||
+                   alloc_traits::is_always_equal::value ||
+                   alloc() == base(other).alloc();
+        }
+        /** Moves `other`'s allocator, if
+            `propagate_on_container_move_assignment` is true. */
+        void move_assign_allocator(Derived & other) noexcept
+        {
+            move_assign_allocator_impl(
+                other,
+                typename alloc_traits::propagate_on_container_move_assignment{});
+        }
+
+        /** Swaps the allocators, if `propagate_on_container_swap` is true.
+            Otherwise, the allocators must compare equal. */
+        void swap_allocator(Derived & other) noexcept
+        {
+            BOOST_ASSERT(
+                alloc_traits::propagate_on_container_swap::value ||
+                alloc() == base(other).alloc());
+            swap_allocator_impl(
+                other, typename alloc_traits::propagate_on_container_swap{});
+        }
+
+        typename alloc_traits::pointer
+        allocate(typename alloc_traits::size_type n)
+        {
+            return alloc_traits::allocate(alloc(), n);
+        }
+        void deallocate(
+            typename alloc_traits::pointer p,
+            typename alloc_traits::size_type n) noexcept
+        {
+            alloc_traits::deallocate(alloc(), p, n);
+        }
+        template<typename T, typename... Args>
+        void construct(T * p, Args &&... args)
+        {
+            alloc_traits::construct(alloc(), p, std::forward<Args>(args)...);
+        }
+        template<typename T>
+        void destroy(T * p) noexcept
+        {
+            alloc_traits::destroy(alloc(), p);
+        }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        static allocator_interface const & base(Derived const & d) noexcept
+        {
+            return d;
+        }
+        static allocator_interface & base(Derived & d) noexcept { return d; }
+
+        void copy_assign_allocator_impl(Derived const & other, std::true_type)
+        {
+            alloc() = base(other).alloc();
+        }
+        void copy_assign_allocator_impl(Derived const &, std::false_type) {}
+
+        void move_assign_allocator_impl(Derived & other, std::true_type)
+        {
+            alloc() = std::move(base(other).alloc());
+        }
+        void move_assign_allocator_impl(Derived &, std::false_type) {}
+
+        void swap_allocator_impl(Derived & other, std::true_type)
+        {
+            using std::swap;
+            swap(alloc(), base(other).alloc());
+        }
+        void swap_allocator_impl(Derived &, std::false_type) {}
+#endif
+    };
+
+}}}
+
+#endif
@@ -0,0 +1,518 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_ASSOCIATIVE_CONTAINER_INTERFACE_HPP
+#define BOOST_STL_INTERFACES_ASSOCIATIVE_CONTAINER_INTERFACE_HPP
+
+#include <boost/stl_interfaces/fwd.hpp>
+#include <boost/stl_interfaces/reverse_iterator.hpp>
+#include <boost/stl_interfaces/statistics.hpp>
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+
+namespace boost { namespace stl_interfaces { inline namespace v1 {
+
+    /** The type of `sorted_unique`. */
+    struct sorted_unique_t
+    {
+        explicit sorted_unique_t() = default;
+    };
+
+    /** A tag that tells an associative container's constructor or
+        `insert()` that the given elements are already sorted by key, and
+        that no two of them have equivalent keys. */
+    constexpr sorted_unique_t sorted_unique{};
+
+    /** A CRTP template that one may derive from to make it easier to define
+        sorted associative container types, such as sets and maps.
+
+        The template parameter `D` for `associative_container_interface` may
+        be an incomplete type.  Before any member of the resulting
+        specialization of `associative_container_interface` other than
+        special member functions is referenced, `D` shall be complete, and
+        shall contain the nested types `key_type`, `value_type`,
+        `key_compare`, `size_type`, `iterator`, and `const_iterator` (and
+        `mapped_type`, if `D` is a map).  `D` shall provide `begin()`,
+        `end()`, `key_comp()`, and `lower_bound(key)`; the members that
+        insert require `emplace()` and `emplace_hint()`, those that erase
+        require `erase(first, last)`, and `operator[]()` requires
+        `try_emplace()`.
+
+        The key of an element `x` is `x` itself when `key_type` and
+        `value_type` are the same type, as for a set, and
+        `std::get<0>(x)` otherwise, as for a map whose reference type is a
+        pair or tuple. */
+    template<
+        typename Derived
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+        ,
+        typename E = std::enable_if_t<
+            std::is_class<Derived>::value &&
+            std::is_same<Derived, std::remove_cv_t<Derived>>::value>
+#endif
+        >
+    struct associative_container_interface;
+
+    namespace v1_dtl {
+        template<typename D>
+        void derived_associative_container(
+            associative_container_interface<D> const &);
+
+        template<typename D>
+        using is_set = std::
+            is_same<typename D::key_type, typename D::value_type>;
+
+        template<typename Ref>
+        constexpr decltype(auto) element_key(Ref && x, std::true_type)
+        {
+            return std::forward<Ref>(x);
+        }
+        template<typename Ref>
+        constexpr decltype(auto) element_key(Ref && x, std::false_type)
+        {
+            return std::get<0>(std::forward<Ref>(x));
+        }
+
+        // Reserves room for n elements in c, if c has reserve().
+        template<typename Container, typename = void>
+        struct reserve_impl
+        {
+            static void call(Container &, std::size_t) noexcept {}
+        };
+        template<typename Container>
+        struct reserve_impl<
+            Container,
+            void_t<decltype(std::declval<Container &>().reserve(0))>>
+        {
+            static void call(Container & c, std::size_t n) { c.reserve(n); }
+        };
+        template<typename Container>
+        void reserve(Container & c, std::size_t n)
+        {
+            reserve_impl<Container>::call(c, n);
+        }
+    }
+
+    template<
+        typename Derived
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+        ,
+        typename E
+#endif
+        >
+    struct associative_container_interface
+    {
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        constexpr Derived & derived() noexcept
+        {
+            return static_cast<Derived &>(*this);
+        }
+        constexpr const Derived & derived() const noexcept
+        {
+            return static_cast<Derived const &>(*this);
+        }
+        constexpr Derived & mutable_derived() const noexcept
+        {
+            return const_cast<Derived &>(static_cast<Derived const &>(*this));
+        }
+
+        template<typename D, typename Ref>
+        static constexpr decltype(auto) key(Ref && x)
+        {
+            return v1_dtl::element_key(
+                std::forward<Ref>(x), v1_dtl::is_set<D>{});
+        }
+#endif
+
+    public:
+        template<typename D = Derived>
+        constexpr auto empty() const noexcept(noexcept(
+            std::declval<D const &>().begin() ==
+            std::declval<D const &>().end()))
+            -> decltype(
+                std::declval<D const &>().begin() ==
+                std::declval<D const &>().end())
+        {
+            return derived().begin() == derived().end();
+        }
+
+        template<typename D = Derived>
+        constexpr auto size() const noexcept(noexcept(
+            std::declval<D const &>().end() -
+            std::declval<D const &>().begin()))
+            -> decltype(typename D::size_type(
+                std::declval<D const &>().end() -
+                std::declval<D const &>().begin()))
+        {
+            return derived().end() - derived().begin();
+        }
+
+        template<typename D = Derived, typename Iter = typename D::const_iterator>
+        constexpr Iter begin() const
+            noexcept(noexcept(std::declval<D &>().begin()))
+        {
+            return Iter(mutable_derived().begin());
+        }
+        template<typename D = Derived, typename Iter = typename D::const_iterator>
+        constexpr Iter end() const noexcept(noexcept(std::declval<D &>().end()))
+        {
+            return Iter(mutable_derived().end());
+        }
+
+        template<typename D = Derived>
+        constexpr auto cbegin() const
+            noexcept(noexcept(std::declval<D const &>().begin()))
+                -> decltype(std::declval<D const &>().begin())
+        {
+            return derived().begin();
+        }
+        template<typename D = Derived>
+        constexpr auto cend() const
+            noexcept(noexcept(std::declval<D const &>().end()))
+                -> decltype(std::declval<D const &>().end())
+        {
+            return derived().end();
+        }
+
+        template<typename D = Derived>
+        constexpr auto rbegin() noexcept(noexcept(
+            stl_interfaces::make_reverse_iterator(std::declval<D &>().end())))
+        {
+            return stl_interfaces::make_reverse_iterator(derived().end());
+        }
+        template<typename D = Derived>
+        constexpr auto rend() noexcept(noexcept(
+            stl_interfaces::make_reverse_iterator(std::declval<D &>().begin())))
+        {
+            return stl_interfaces::make_reverse_iterator(derived().begin());
+        }
+        template<typename D = Derived>
+        constexpr auto rbegin() const noexcept(noexcept(
+            stl_interfaces::make_reverse_iterator(
+                std::declval<D const &>().end())))
+        {
+            return stl_interfaces::make_reverse_iterator(derived().end());
+        }
+        template<typename D = Derived>
+        constexpr auto rend() const noexcept(noexcept(
+            stl_interfaces::make_reverse_iterator(
+                std::declval<D const &>().begin())))
+        {
+            return stl_interfaces::make_reverse_iterator(derived().begin());
+        }
+        template<typename D = Derived>
+        constexpr auto crbegin() const
+            noexcept(noexcept(std::declval<D const &>().rbegin()))
+                -> decltype(std::declval<D const &>().rbegin())
+        {
+            return derived().rbegin();
+        }
+        template<typename D = Derived>
+        constexpr auto crend() const
+            noexcept(noexcept(std::declval<D const &>().rend()))
+                -> decltype(std::declval<D const &>().rend())
+        {
+            return derived().rend();
+        }
+
+        template<typename D = Derived>
+        constexpr typename D::const_iterator
+        lower_bound(typename D::key_type const & k) const
+        {
+            return typename D::const_iterator(mutable_derived().lower_bound(k));
+        }
+
+        template<typename D = Derived>
+        auto upper_bound(typename D::key_type const & k)
+            -> decltype(std::declval<D &>().lower_bound(k))
+        {
+            D & d = derived();
+            auto const comp = d.key_comp();
+            return std::upper_bound(
+                d.lower_bound(k),
+                d.end(),
+                k,
+                [&comp](typename D::key_type const & lhs, auto && x) {
+                    return comp(lhs, key<D>(x));
+                });
+        }
+        template<typename D = Derived>
+        typename D::const_iterator
+        upper_bound(typename D::key_type const & k) const
+        {
+            return typename D::const_iterator(mutable_derived().upper_bound(k));
+        }
+
+        template<typename D = Derived>
+        constexpr auto equal_range(typename D::key_type const & k) -> std::
+            pair<decltype(std::declval<D &>().lower_bound(k)),
+                 decltype(std::declval<D &>().lower_bound(k))>
+        {
+            return {derived().lower_bound(k), derived().upper_bound(k)};
+        }
+        template<typename D = Derived>
+        constexpr std::
+            pair<typename D::const_iterator, typename D::const_iterator>
+            equal_range(typename D::key_type const & k) const
+        {
+            auto const result = mutable_derived().equal_range(k);
+            return {
+                typename D::const_iterator(result.first),
+                typename D::const_iterator(result.second)};
+        }
+
+        template<typename D = Derived>
+        constexpr auto find(typename D::key_type const & k)
+            -> decltype(std::declval<D &>().lower_bound(k))
+        {
+            D & d = derived();
+            auto const it = d.lower_bound(k);
+            auto const last = d.end();
+            if (it != last && !d.key_comp()(k, key<D>(*it)))
+                return it;
+            return last;
+        }
+        template<typename D = Derived>
+        constexpr typename D::const_iterator
+        find(typename D::key_type const & k) const
+        {
+            return typename D::const_iterator(mutable_derived().find(k));
+        }
+
+        template<typename D = Derived>
+        constexpr bool contains(typename D::key_type const & k) const
+        {
+            return mutable_derived().find(k) != mutable_derived().end();
+        }
+
+        template<typename D = Derived>
+        constexpr typename D::size_type
+        count(typename D::key_type const & k) const
+        {
+            auto const range = mutable_derived().equal_range(k);
+            return typename D::size_type(
+                std::distance(range.first, range.second));
+        }
+
+        template<typename D = Derived, typename M = typename D::mapped_type>
+        constexpr M & at(typename D::key_type const & k)
+        {
+            auto const it = derived().find(k);
+            if (it == derived().end()) {
+                statistics().out_of_range();
+                throw std::out_of_range(
+                    "Key not found in associative_container_interface::at()");
+            }
+            return std::get<1>(*it);
+        }
+        template<typename D = Derived, typename M = typename D::mapped_type>
+        constexpr M const & at(typename D::key_type const & k) const
+        {
+            return mutable_derived().at(k);
+        }
+
+        template<typename D = Derived, typename M = typename D::mapped_type>
+        constexpr M & operator[](typename D::key_type const & k)
+        {
+            return std::get<1>(*derived().try_emplace(k).first);
+        }
+        template<typename D = Derived, typename M = typename D::mapped_type>
+        constexpr M & operator[](typename D::key_type && k)
+        {
+            return std::get<1>(*derived().try_emplace(std::move(k)).first);
+        }
+
+        template<typename D = Derived>
+        constexpr auto insert(typename D::value_type const & x)
+            -> decltype(std::declval<D &>().emplace(x))
+        {
+            return derived().emplace(x);
+        }
+        template<typename D = Derived>
+        constexpr auto insert(typename D::value_type && x)
+            -> decltype(std::declval<D &>().emplace(std::move(x)))
+        {
+            return derived().emplace(std::move(x));
+        }
+
+        template<typename D = Derived>
+        constexpr auto insert(
+            typename D::const_iterator hint, typename D::value_type const & x)
+            -> decltype(std::declval<D &>().emplace_hint(hint, x))
+        {
+            return derived().emplace_hint(hint, x);
+        }
+        template<typename D = Derived>
+        constexpr auto insert(
+            typename D::const_iterator hint, typename D::value_type && x)
+            -> decltype(std::declval<D &>().emplace_hint(hint, std::move(x)))
+        {
+            return derived().emplace_hint(hint, std::move(x));
+        }
+
+        template<
+            typename InputIterator,
+            typename D = Derived,
+            typename Enable = std::enable_if_t<std::is_convertible<
+                typename std::iterator_traits<
+                    InputIterator>::iterator_category,
+                std::input_iterator_tag>::value>>
+        constexpr auto insert(InputIterator first, InputIterator last)
+            -> decltype((void)std::declval<D &>().emplace(*first))
+        {
+            for (; first != last; ++first) {
+                derived().emplace(*first);
+            }
+        }
+
+        template<typename D = Derived>
+        constexpr auto insert(std::initializer_list<typename D::value_type> il)
+            -> decltype((void)std::declval<D &>().insert(il.begin(), il.end()))
+        {
+            derived().insert(il.begin(), il.end());
+        }
+        template<typename D = Derived>
+        constexpr auto insert(
+            sorted_unique_t, std::initializer_list<typename D::value_type> il)
+            -> decltype((void)std::declval<D &>().insert(
+                sorted_unique, il.begin(), il.end()))
+        {
+            derived().insert(sorted_unique, il.begin(), il.end());
+        }
+
+        template<typename D = Derived>
+        constexpr auto erase(typename D::const_iterator pos)
+            -> decltype(std::declval<D &>().erase(pos, std::next(pos)))
+        {
+            return derived().erase(pos, std::next(pos));
+        }
+
+        template<typename D = Derived>
+        constexpr auto erase(typename D::key_type const & k)
+            -> decltype(
+                (void)std::declval<D &>().erase(
+                    std::declval<typename D::const_iterator>(),
+                    std::declval<typename D::const_iterator>()),
+                typename D::size_type())
+        {
+            auto const range = derived().equal_range(k);
+            auto const n = std::distance(range.first, range.second);
+            derived().erase(range.first, range.second);
+            return typename D::size_type(n);
+        }
+
+        template<typename D = Derived>
+        constexpr auto clear() noexcept
+            -> decltype((void)std::declval<D &>().erase(
+                std::declval<D &>().begin(), std::declval<D &>().end()))
+        {
+            derived().erase(derived().begin(), derived().end());
+        }
+
+    protected:
+        /** Returns the statistics policy of `Derived` (see
+            `statistics_policy`), as `sequence_container_interface` does. */
+        template<typename D = Derived>
+        static constexpr statistics_policy_t<D> statistics() noexcept
+        {
+            return statistics_policy_t<D>();
+        }
+    };
+
+    /** Implementation of free function `swap()` for all containers derived
+        from `associative_container_interface`.
+
+        When a container's template arguments can come from namespace `std`
+        (an allocator, say), an unqualified `swap()` call finds both this and
+        `std::swap()`, and is ambiguous.  Such a container should also
+        declare a non-template friend `swap()` taking two references to
+        itself, which is preferred over both. */
+    template<typename ContainerInterface>
+    constexpr auto swap(
+        ContainerInterface & lhs,
+        ContainerInterface & rhs) noexcept(noexcept(lhs.swap(rhs)))
+        -> decltype(v1_dtl::derived_associative_container(lhs), lhs.swap(rhs))
+    {
+        return lhs.swap(rhs);
+    }
+
+    /** Implementation of `operator==()` for all containers derived from
+        `associative_container_interface`.  */
+    template<typename ContainerInterface>
+    constexpr auto
+    operator==(ContainerInterface const & lhs, ContainerInterface const & rhs)
+        -> decltype(
+            v1_dtl::derived_associative_container(lhs),
+            *lhs.begin() == *rhs.begin(),
+            true)
+    {
+        return lhs.size() == rhs.size() &&
+               std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    /** Implementation of `operator!=()` for all containers derived from
+        `associative_container_interface`.  */
+    template<typename ContainerInterface>
+    constexpr auto operator!=(
+        ContainerInterface const & lhs, ContainerInterface const & rhs)
+        -> decltype(v1_dtl::derived_associative_container(lhs), lhs == rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    /** Implementation of `operator<()` for all containers derived from
+        `associative_container_interface`.  */
+    template<typename ContainerInterface>
+    constexpr auto
+    operator<(ContainerInterface const & lhs, ContainerInterface const & rhs)
+        -> decltype(
+            v1_dtl::derived_associative_container(lhs),
+            *lhs.begin() < *rhs.begin(),
+            true)
+    {
+        return std::lexicographical_compare(
+            lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    /** Implementation of `operator<=()` for all containers derived from
+        `associative_container_interface`.  */
+    template<typename ContainerInterface>
+    constexpr auto operator<=(
+        ContainerInterface const & lhs, ContainerInterface const & rhs)
+        -> decltype(v1_dtl::derived_associative_container(lhs), lhs < rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    /** Implementation of `operator>()` for all containers derived from
+        `associative_container_interface`.  */
+    template<typename ContainerInterface>
+    constexpr auto
+    operator>(ContainerInterface const & lhs, ContainerInterface const & rhs)
+        -> decltype(v1_dtl::derived_associative_container(lhs), lhs < rhs)
+    {
+        return rhs < lhs;
+    }
+
+    /** Implementation of `operator>=()` for all containers derived from
+        `associative_container_interface`.  */
+    template<typename ContainerInterface>
+    constexpr auto operator>=(
+        ContainerInterface const & lhs, ContainerInterface const & rhs)
+        -> decltype(v1_dtl::derived_associative_container(lhs), lhs < rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+}}}
+
+#endif
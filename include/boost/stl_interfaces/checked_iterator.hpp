@@ -0,0 +1,253 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_CHECKED_ITERATOR_HPP
+#define BOOST_STL_INTERFACES_CHECKED_ITERATOR_HPP
+
+#include <boost/stl_interfaces/iterator_interface.hpp>
+
+#include <boost/assert.hpp>
+
+#include <cstddef>
+
+
+namespace boost { namespace stl_interfaces { inline namespace v1 {
+
+    /** A counter that a container bumps whenever it invalidates its
+        iterators.  Each `checked_iterator` records the count at the time it
+        was created, and is only valid while the two are equal.
+
+        Copying a generation does not copy its count, since the iterators of
+        the source container are not iterators into the copy; assigning to a
+        generation invalidates its iterators. */
+    struct iterator_generation
+    {
+        constexpr iterator_generation() noexcept : value_(0) {}
+        constexpr iterator_generation(iterator_generation const &) noexcept :
+            value_(0)
+        {}
+        constexpr iterator_generation &
+        operator=(iterator_generation const &) noexcept
+        {
+            ++value_;
+            return *this;
+        }
+
+        constexpr std::size_t value() const noexcept { return value_; }
+        constexpr void invalidate() noexcept { ++value_; }
+
+    private:
+        std::size_t value_;
+    };
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    namespace v1_dtl {
+        template<typename Iter, typename = void>
+        struct checked_iterator_concept
+        {
+            using type =
+                typename std::iterator_traits<Iter>::iterator_category;
+        };
+        template<typename Iter>
+        struct checked_iterator_concept<
+            Iter,
+            void_t<typename Iter::iterator_concept>>
+        {
+            using type = typename Iter::iterator_concept;
+        };
+        template<typename T>
+        struct checked_iterator_concept<T *>
+        {
+            using type = contiguous_iterator_tag;
+        };
+        template<typename Iter>
+        using checked_iterator_concept_t =
+            typename checked_iterator_concept<Iter>::type;
+    }
+#endif
+
+    /** An adaptor that checks, on every operation, that `Iter` has not been
+        invalidated by the container it came from, and that iterators being
+        compared or subtracted come from the same container.  Failed checks
+        are reported with `BOOST_ASSERT_MSG()`.
+
+        Containers usually name their iterators `checked_iterator_t<T *>`
+        instead of using this directly, so the checks only exist when
+        `BOOST_STL_INTERFACES_CHECKED` is defined. */
+    template<typename Iter>
+    struct checked_iterator
+        : iterator_interface<
+              checked_iterator<Iter>,
+              v1_dtl::checked_iterator_concept_t<Iter>,
+              typename std::iterator_traits<Iter>::value_type,
+              typename std::iterator_traits<Iter>::reference,
+              typename std::iterator_traits<Iter>::pointer,
+              typename std::iterator_traits<Iter>::difference_type>
+    {
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        using category = typename std::iterator_traits<Iter>::iterator_category;
+        using bidi = std::is_base_of<std::bidirectional_iterator_tag, category>;
+        using random_access =
+            std::is_base_of<std::random_access_iterator_tag, category>;
+#endif
+
+    public:
+        using difference_type =
+            typename std::iterator_traits<Iter>::difference_type;
+
+        constexpr checked_iterator() noexcept :
+            it_(), generation_(nullptr), created_(0)
+        {}
+        constexpr checked_iterator(
+            Iter it, iterator_generation const & generation) noexcept :
+            it_(it), generation_(&generation), created_(generation.value())
+        {}
+        template<
+            typename Iter2,
+            typename Enable =
+                std::enable_if_t<std::is_convertible<Iter2, Iter>::value>>
+        constexpr checked_iterator(checked_iterator<Iter2> other) noexcept :
+            it_(other.it_),
+            generation_(other.generation_),
+            created_(other.created_)
+        {}
+
+        /** Returns the underlying iterator, without any check. */
+        constexpr Iter base() const noexcept { return it_; }
+
+        /** Returns true iff `*this` came from a container, and that
+            container has not invalidated it since. */
+        constexpr bool valid() const noexcept
+        {
+            return generation_ && generation_->value() == created_;
+        }
+
+        constexpr decltype(auto) operator*() const
+        {
+            check();
+            return *it_;
+        }
+        /** Only checks validity, not dereferenceability, so that
+            `to_address()` works on an end iterator. */
+        constexpr auto operator->() const
+        {
+            check();
+            return stl_interfaces::to_address(it_);
+        }
+
+        constexpr checked_iterator & operator++()
+        {
+            check();
+            ++it_;
+            return *this;
+        }
+        template<
+            bool Bidi = bidi::value,
+            typename Enable = std::enable_if_t<Bidi>>
+        constexpr checked_iterator & operator--()
+        {
+            check();
+            --it_;
+            return *this;
+        }
+        template<
+            bool RandomAccess = random_access::value,
+            typename Enable = std::enable_if_t<RandomAccess>>
+        constexpr checked_iterator & operator+=(difference_type n)
+        {
+            check();
+            it_ += n;
+            return *this;
+        }
+        template<
+            typename Iter2,
+            typename Enable = std::enable_if_t<
+                random_access::value &&
+                (std::is_convertible<Iter2, Iter>::value ||
+                 std::is_convertible<Iter, Iter2>::value)>>
+        constexpr difference_type operator-(checked_iterator<Iter2> other) const
+        {
+            check_same(other);
+            return it_ - other.it_;
+        }
+
+        friend BOOST_STL_INTERFACES_HIDDEN_FRIEND_CONSTEXPR bool
+        operator==(checked_iterator lhs, checked_iterator rhs)
+        {
+            // Value-initialized iterators compare equal to each other.
+            if (!lhs.generation_ && !rhs.generation_)
+                return true;
+            lhs.check_same(rhs);
+            return lhs.it_ == rhs.it_;
+        }
+
+        using base_type = iterator_interface<
+            checked_iterator<Iter>,
+            v1_dtl::checked_iterator_concept_t<Iter>,
+            typename std::iterator_traits<Iter>::value_type,
+            typename std::iterator_traits<Iter>::reference,
+            typename std::iterator_traits<Iter>::pointer,
+            typename std::iterator_traits<Iter>::difference_type>;
+        using base_type::operator++;
+        using base_type::operator--;
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        template<typename Iter2>
+        friend struct checked_iterator;
+
+        constexpr void check() const
+        {
+            BOOST_ASSERT_MSG(
+                generation_, "Use of a singular (value-initialized) iterator.");
+            BOOST_ASSERT_MSG(
+                generation_->value() == created_,
+                "Use of an iterator that its container has invalidated.");
+        }
+        template<typename Iter2>
+        constexpr void check_same(checked_iterator<Iter2> const & other) const
+        {
+            check();
+            other.check();
+            BOOST_ASSERT_MSG(
+                generation_ == other.generation_,
+                "Iterators into different containers used together.");
+        }
+
+        Iter it_;
+        iterator_generation const * generation_;
+        std::size_t created_;
+#endif
+    };
+
+#if defined(BOOST_STL_INTERFACES_CHECKED) ||                                   \
+    defined(BOOST_STL_INTERFACES_DOXYGEN)
+    /** `checked_iterator<Iter>` when `BOOST_STL_INTERFACES_CHECKED` is
+        defined, and `Iter` otherwise. */
+    template<typename Iter>
+    using checked_iterator_t = checked_iterator<Iter>;
+#else
+    template<typename Iter>
+    using checked_iterator_t = Iter;
+#endif
+
+    /** Returns `it`.  This overload handles the unchecked case. */
+    template<typename Iter>
+    constexpr Iter unchecked(Iter it) noexcept
+    {
+        return it;
+    }
+
+    /** Returns `it.base()`, without checking `it`. */
+    template<typename Iter>
+    constexpr Iter unchecked(checked_iterator<Iter> it) noexcept
+    {
+        return it.base();
+    }
+
+}}}
+
+#endif
@@ -0,0 +1,480 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_CONCURRENT_RING_BUFFER_HPP
+#define BOOST_STL_INTERFACES_CONCURRENT_RING_BUFFER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+
+#ifndef BOOST_STL_INTERFACES_CACHE_LINE_SIZE
+/** The alignment used to keep the indices that different threads write on
+    separate cache lines.  Define it before including this header to
+    override the default of 64. */
+#define BOOST_STL_INTERFACES_CACHE_LINE_SIZE 64
+#endif
+
+
+namespace boost { namespace stl_interfaces { inline namespace v1 {
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    namespace v1_dtl {
+        template<typename T>
+        struct alignas(BOOST_STL_INTERFACES_CACHE_LINE_SIZE) cache_line_padded
+        {
+            T value;
+        };
+
+        struct producer_indices
+        {
+            std::atomic<std::size_t> tail;
+            std::size_t cached_head;
+        };
+
+        struct consumer_indices
+        {
+            std::atomic<std::size_t> head;
+            std::size_t cached_tail;
+        };
+
+        inline std::ptrdiff_t
+        sequence_diff(std::size_t lhs, std::size_t rhs) noexcept
+        {
+            return std::ptrdiff_t(lhs - rhs);
+        }
+    }
+#endif
+
+    /** A bounded, lock-free, first-in first-out queue of up to `N` elements
+        stored within the object itself, for handing elements from exactly
+        one producer thread to exactly one consumer thread.
+
+        The `push` family may only be called by the producer, and the `pop`
+        family only by the consumer.  The producer's and consumer's indices
+        are on separate cache lines, and each side caches the other's index,
+        so that it only reads the other side's cache line when the queue
+        looks full (or empty).  The batch overloads publish all the elements
+        they transfer with a single atomic store. */
+    template<typename T, std::size_t N>
+    struct spsc_ring_buffer
+    {
+        static_assert(0 < N, "spsc_ring_buffer requires a nonzero capacity.");
+
+        using value_type = T;
+        using size_type = std::size_t;
+
+        spsc_ring_buffer() noexcept : producer_{{{0}, 0}}, consumer_{{{0}, 0}}
+        {}
+        spsc_ring_buffer(spsc_ring_buffer const &) = delete;
+        spsc_ring_buffer & operator=(spsc_ring_buffer const &) = delete;
+        ~spsc_ring_buffer()
+        {
+            auto const tail =
+                producer_.value.tail.load(std::memory_order_relaxed);
+            auto head = consumer_.value.head.load(std::memory_order_relaxed);
+            for (; head != tail; ++head) {
+                slot(head)->~T();
+            }
+        }
+
+        static constexpr size_type capacity() noexcept { return N; }
+
+        /** Returns the number of elements in the queue.  When called
+            concurrently with the producer or consumer, the result may be
+            out of date by the time it is returned. */
+        size_type size() const noexcept
+        {
+            auto const head =
+                consumer_.value.head.load(std::memory_order_acquire);
+            auto const tail =
+                producer_.value.tail.load(std::memory_order_acquire);
+            return tail - head;
+        }
+        bool empty() const noexcept { return size() == 0; }
+
+        /** Constructs an element from `args` at the back of the queue, unless
+            the queue is full.  Returns true iff an element was pushed. */
+        template<typename... Args>
+        bool try_emplace(Args &&... args)
+        {
+            auto & p = producer_.value;
+            auto const tail = p.tail.load(std::memory_order_relaxed);
+            if (!room(tail))
+                return false;
+            ::new (static_cast<void *>(slot(tail)))
+                T(std::forward<Args>(args)...);
+            p.tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+        bool try_push(T const & x) { return try_emplace(x); }
+        bool try_push(T && x) { return try_emplace(std::move(x)); }
+
+        /** Pushes the elements of `[first, last)` until the queue is full,
+            and returns an iterator to the first element not pushed. */
+        template<
+            typename InputIterator,
+            typename Enable = std::enable_if_t<std::is_convertible<
+                typename std::iterator_traits<
+                    InputIterator>::iterator_category,
+                std::input_iterator_tag>::value>>
+        InputIterator push(InputIterator first, InputIterator last)
+        {
+            auto & p = producer_.value;
+            auto const old_tail = p.tail.load(std::memory_order_relaxed);
+            auto tail = old_tail;
+            try {
+                for (; first != last && room(tail); ++first, ++tail) {
+                    ::new (static_cast<void *>(slot(tail))) T(*first);
+                }
+            } catch (...) {
+                p.tail.store(tail, std::memory_order_release);
+                throw;
+            }
+            if (tail != old_tail)
+                p.tail.store(tail, std::memory_order_release);
+            return first;
+        }
+
+        /** Moves the front element into `x` and removes it, unless the queue
+            is empty.  Returns true iff an element was popped. */
+        bool try_pop(T & x)
+        {
+            auto & c = consumer_.value;
+            auto const head = c.head.load(std::memory_order_relaxed);
+            if (!available(head))
+                return false;
+            T * const p = slot(head);
+            x = std::move(*p);
+            p->~T();
+            c.head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        /** Moves up to `n` elements from the front of the queue to `out` and
+            removes them.  Returns the number of elements popped. */
+        template<typename OutputIterator>
+        size_type pop(OutputIterator out, size_type n = N)
+        {
+            auto & c = consumer_.value;
+            auto const old_head = c.head.load(std::memory_order_relaxed);
+            auto head = old_head;
+            try {
+                for (; head - old_head < n && available(head); ++head) {
+                    T * const p = slot(head);
+                    *out = std::move(*p);
+                    ++out;
+                    p->~T();
+                }
+            } catch (...) {
+                c.head.store(head, std::memory_order_release);
+                throw;
+            }
+            if (head != old_head)
+                c.head.store(head, std::memory_order_release);
+            return head - old_head;
+        }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        T * slot(size_type i) noexcept
+        {
+            return reinterpret_cast<T *>(buf_) + i % N;
+        }
+
+        // Only the producer calls room(), and only the consumer calls
+        // available().
+        bool room(size_type tail) noexcept
+        {
+            auto & p = producer_.value;
+            if (tail - p.cached_head < N)
+                return true;
+            p.cached_head =
+                consumer_.value.head.load(std::memory_order_acquire);
+            return tail - p.cached_head < N;
+        }
+        bool available(size_type head) noexcept
+        {
+            auto & c = consumer_.value;
+            if (head != c.cached_tail)
+                return true;
+            c.cached_tail =
+                producer_.value.tail.load(std::memory_order_acquire);
+            return head != c.cached_tail;
+        }
+
+        v1_dtl::cache_line_padded<v1_dtl::producer_indices> producer_;
+        v1_dtl::cache_line_padded<v1_dtl::consumer_indices> consumer_;
+        alignas(BOOST_STL_INTERFACES_CACHE_LINE_SIZE) alignas(
+            T) unsigned char buf_[N * sizeof(T)];
+#endif
+    };
+
+    /** A bounded, lock-free, first-in first-out queue of up to `N` elements
+        stored within the object itself, which any number of threads may
+        push to and pop from concurrently.
+
+        Each slot carries a sequence number that says whether it is ready to
+        be written or read on the current lap around the buffer, so that
+        producers and consumers only contend on their own (cache line
+        padded) index.  The batch overloads claim a run of consecutive slots
+        with a single compare-and-swap.
+
+        `T` must be nothrow move constructible and nothrow move assignable,
+        since an element whose slot has been claimed must always be made
+        available to the other side. */
+    template<typename T, std::size_t N>
+    struct mpmc_ring_buffer
+    {
+        static_assert(0 < N, "mpmc_ring_buffer requires a nonzero capacity.");
+        static_assert(
+            std::is_nothrow_move_constructible<T>::value &&
+                std::is_nothrow_move_assignable<T>::value,
+            "mpmc_ring_buffer requires that T's move operations are "
+            "noexcept.");
+
+        using value_type = T;
+        using size_type = std::size_t;
+
+        mpmc_ring_buffer() noexcept : enqueue_{{0}}, dequeue_{{0}}
+        {
+            for (size_type i = 0; i < N; ++i) {
+                cells_[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+        mpmc_ring_buffer(mpmc_ring_buffer const &) = delete;
+        mpmc_ring_buffer & operator=(mpmc_ring_buffer const &) = delete;
+        ~mpmc_ring_buffer()
+        {
+            auto const last = enqueue_.value.load(std::memory_order_relaxed);
+            for (auto pos = dequeue_.value.load(std::memory_order_relaxed);
+                 pos != last;
+                 ++pos) {
+                element(cells_[pos % N])->~T();
+            }
+        }
+
+        static constexpr size_type capacity() noexcept { return N; }
+
+        /** Returns the number of elements in the queue, including those
+            whose slots have been claimed but which are still being written
+            or read.  When called concurrently with a push or pop, the result
+            may be out of date by the time it is returned. */
+        size_type size() const noexcept
+        {
+            auto const head = dequeue_.value.load(std::memory_order_acquire);
+            auto const tail = enqueue_.value.load(std::memory_order_acquire);
+            auto const diff = v1_dtl::sequence_diff(tail, head);
+            return diff < 0 ? 0 : size_type(diff);
+        }
+        bool empty() const noexcept { return size() == 0; }
+
+        /** Constructs an element from `args` at the back of the queue, unless
+            the queue is full.  Returns true iff an element was pushed. */
+        template<typename... Args>
+        bool try_emplace(Args &&... args)
+        {
+            return try_emplace_impl(
+                std::is_nothrow_constructible<T, Args &&...>{},
+                std::forward<Args>(args)...);
+        }
+        bool try_push(T const & x) { return try_emplace(x); }
+        bool try_push(T && x) { return try_emplace(std::move(x)); }
+
+        /** Pushes the elements of `[first, last)` until the queue is full,
+            and returns an iterator to the first element not pushed.  When
+            constructing a `T` from `*first` cannot throw, the elements are
+            pushed in runs, each claimed with a single compare-and-swap. */
+        template<
+            typename ForwardIterator,
+            typename Enable = std::enable_if_t<std::is_convertible<
+                typename std::iterator_traits<
+                    ForwardIterator>::iterator_category,
+                std::forward_iterator_tag>::value>>
+        ForwardIterator push(ForwardIterator first, ForwardIterator last)
+        {
+            using reference =
+                typename std::iterator_traits<ForwardIterator>::reference;
+            return push_impl(
+                std::is_nothrow_constructible<T, reference>{}, first, last);
+        }
+
+        /** Moves the front element into `x` and removes it, unless the queue
+            is empty.  Returns true iff an element was popped. */
+        bool try_pop(T & x) noexcept
+        {
+            size_type pos;
+            if (!claim(dequeue_.value, 1, 1, pos))
+                return false;
+            cell & c = cells_[pos % N];
+            T * const p = element(c);
+            x = std::move(*p);
+            p->~T();
+            c.sequence.store(pos + N, std::memory_order_release);
+            return true;
+        }
+
+        /** Moves up to `n` elements from the front of the queue to `out` and
+            removes them, claiming them in runs of consecutive slots with a
+            single compare-and-swap each.  Returns the number of elements
+            popped.
+
+            If writing to `out` throws, the rest of the run that was claimed
+            is discarded. */
+        template<typename OutputIterator>
+        size_type pop(OutputIterator out, size_type n = N)
+        {
+            size_type popped = 0;
+            while (popped < n) {
+                size_type pos;
+                auto const run = claim(dequeue_.value, 1, n - popped, pos);
+                if (!run)
+                    break;
+                release_guard guard{this, pos, pos + run};
+                while (guard.first != guard.last) {
+                    cell & c = cells_[guard.first % N];
+                    T * const p = element(c);
+                    T x(std::move(*p));
+                    p->~T();
+                    c.sequence.store(
+                        guard.first + N, std::memory_order_release);
+                    ++guard.first;
+                    *out = std::move(x);
+                    ++out;
+                    ++popped;
+                }
+            }
+            return popped;
+        }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        struct cell
+        {
+            std::atomic<size_type> sequence;
+            alignas(T) unsigned char storage[sizeof(T)];
+        };
+
+        static T * element(cell & c) noexcept
+        {
+            return reinterpret_cast<T *>(c.storage);
+        }
+
+        // Destroys and releases the claimed slots [first, last) that were
+        // not consumed, if pop() exits early.
+        struct release_guard
+        {
+            ~release_guard()
+            {
+                for (; first != last; ++first) {
+                    cell & c = self->cells_[first % N];
+                    element(c)->~T();
+                    c.sequence.store(first + N, std::memory_order_release);
+                }
+            }
+
+            mpmc_ring_buffer * self;
+            size_type first;
+            size_type last;
+        };
+
+        // Claims a run of up to max_run slots at index, which the other side
+        // has marked ready by setting each slot's sequence number to its
+        // position plus offset (0 for producers, 1 for consumers).  Returns
+        // the length of the run, and its first position in pos; returns 0
+        // if the queue is full (or empty).
+        size_type claim(
+            std::atomic<size_type> & index,
+            size_type offset,
+            size_type max_run,
+            size_type & pos) noexcept
+        {
+            pos = index.load(std::memory_order_relaxed);
+            for (;;) {
+                size_type run = 0;
+                while (run < max_run && run < N &&
+                       cells_[(pos + run) % N].sequence.load(
+                           std::memory_order_acquire) == pos + run + offset) {
+                    ++run;
+                }
+                if (run) {
+                    if (index.compare_exchange_weak(
+                            pos, pos + run, std::memory_order_relaxed)) {
+                        return run;
+                    }
+                    continue;
+                }
+                auto const seq =
+                    cells_[pos % N].sequence.load(std::memory_order_acquire);
+                if (v1_dtl::sequence_diff(seq, pos + offset) < 0)
+                    return 0;
+                pos = index.load(std::memory_order_relaxed);
+            }
+        }
+
+        template<typename... Args>
+        bool try_emplace_impl(std::true_type, Args &&... args) noexcept
+        {
+            size_type pos;
+            if (!claim(enqueue_.value, 0, 1, pos))
+                return false;
+            cell & c = cells_[pos % N];
+            ::new (static_cast<void *>(c.storage))
+                T(std::forward<Args>(args)...);
+            c.sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+        template<typename... Args>
+        bool try_emplace_impl(std::false_type, Args &&... args)
+        {
+            // Constructing the element may throw, so it is done before a
+            // slot is claimed.
+            T x(std::forward<Args>(args)...);
+            return try_emplace_impl(std::true_type{}, std::move(x));
+        }
+
+        template<typename ForwardIterator>
+        ForwardIterator
+        push_impl(std::true_type, ForwardIterator first, ForwardIterator last)
+        {
+            auto n = size_type(std::distance(first, last));
+            while (n) {
+                size_type pos;
+                auto const run = claim(enqueue_.value, 0, n, pos);
+                if (!run)
+                    break;
+                for (auto const end = pos + run; pos != end; ++pos, ++first) {
+                    cell & c = cells_[pos % N];
+                    ::new (static_cast<void *>(c.storage)) T(*first);
+                    c.sequence.store(pos + 1, std::memory_order_release);
+                }
+                n -= run;
+            }
+            return first;
+        }
+        template<typename ForwardIterator>
+        ForwardIterator
+        push_impl(std::false_type, ForwardIterator first, ForwardIterator last)
+        {
+            for (; first != last; ++first) {
+                if (!try_emplace(*first))
+                    break;
+            }
+            return first;
+        }
+
+        v1_dtl::cache_line_padded<std::atomic<size_type>> enqueue_;
+        v1_dtl::cache_line_padded<std::atomic<size_type>> dequeue_;
+        alignas(BOOST_STL_INTERFACES_CACHE_LINE_SIZE) cell cells_[N];
+#endif
+    };
+
+}}}
+
+#endif
@@ -0,0 +1,73 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_DETAIL_BIT_OPS_HPP
+#define BOOST_STL_INTERFACES_DETAIL_BIT_OPS_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+
+namespace boost { namespace stl_interfaces { inline namespace v1 {
+    namespace v1_dtl {
+        using bitmap_word = std::uint64_t;
+        constexpr std::size_t bitmap_word_bits = 64;
+
+        // The index of the lowest set bit of x, which must be nonzero.
+        inline std::size_t lowest_bit(bitmap_word x) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return std::size_t(__builtin_ctzll(x));
+#elif defined(_MSC_VER) && defined(_M_X64)
+            unsigned long result;
+            _BitScanForward64(&result, x);
+            return result;
+#else
+            std::size_t result = 0;
+            for (; !(x & 1u); x >>= 1) {
+                ++result;
+            }
+            return result;
+#endif
+        }
+
+        // The index of the highest set bit of x, which must be nonzero.
+        inline std::size_t highest_bit(bitmap_word x) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return bitmap_word_bits - 1 - std::size_t(__builtin_clzll(x));
+#elif defined(_MSC_VER) && defined(_M_X64)
+            unsigned long result;
+            _BitScanReverse64(&result, x);
+            return result;
+#else
+            std::size_t result = 0;
+            for (; x >>= 1;) {
+                ++result;
+            }
+            return result;
+#endif
+        }
+
+        // The number of set bits in x.
+        inline std::size_t popcount(bitmap_word x) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return std::size_t(__builtin_popcountll(x));
+#else
+            x = x - ((x >> 1) & 0x5555555555555555u);
+            x = (x & 0x3333333333333333u) + ((x >> 2) & 0x3333333333333333u);
+            x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0fu;
+            return std::size_t((x * 0x0101010101010101u) >> 56);
+#endif
+        }
+    }
+}}}
+
+#endif
@@ -0,0 +1,24 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_DETAIL_PREFETCH_HPP
+#define BOOST_STL_INTERFACES_DETAIL_PREFETCH_HPP
+
+// BOOST_STL_INTERFACES_PREFETCH() is documented in fwd.hpp.
+#if !defined(BOOST_STL_INTERFACES_PREFETCH)
+
+#if defined(__GNUC__) || defined(__clang__)
+#define BOOST_STL_INTERFACES_PREFETCH(address) __builtin_prefetch(address)
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#define BOOST_STL_INTERFACES_PREFETCH(address)                                 \
+    _mm_prefetch(reinterpret_cast<char const *>(address), _MM_HINT_T0)
+#else
+#define BOOST_STL_INTERFACES_PREFETCH(address) ((void)(address))
+#endif
+
+#endif
+
+#endif
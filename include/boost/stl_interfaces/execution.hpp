@@ -0,0 +1,143 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_EXECUTION_HPP
+#define BOOST_STL_INTERFACES_EXECUTION_HPP
+
+#include <boost/stl_interfaces/sequence_container_interface.hpp>
+
+#if 201402L < __cplusplus
+#include <execution>
+#endif
+
+
+#if defined(__cpp_lib_execution) || defined(BOOST_STL_INTERFACES_DOXYGEN)
+
+namespace boost { namespace stl_interfaces { inline namespace v1 {
+
+    namespace v1_dtl {
+        template<typename ExecutionPolicy>
+        using execution_policy =
+            std::is_execution_policy<std::decay_t<ExecutionPolicy>>;
+
+        template<typename Iter>
+        using fwd_iter = std::is_convertible<
+            typename std::iterator_traits<Iter>::iterator_category,
+            std::forward_iterator_tag>;
+    }
+
+    /** Equivalent to `c.assign(first, last)`, except that the elements of
+        `c` that are overwritten are assigned using `std::copy(policy,
+        ...)`.  Elements added to or removed from the end of `c` are
+        inserted or erased as `c.assign(first, last)` would.
+
+        \pre `[first, last)` does not overlap `c`. */
+    template<
+        typename ExecutionPolicy,
+        typename Container,
+        typename ForwardIterator,
+        typename Enable = std::enable_if_t<
+            v1_dtl::execution_policy<ExecutionPolicy>::value &&
+            v1_dtl::fwd_iter<ForwardIterator>::value>>
+    auto assign(
+        ExecutionPolicy && policy,
+        Container & c,
+        ForwardIterator first,
+        ForwardIterator last)
+        -> decltype(v1_dtl::derived_container(c), void())
+    {
+        using difference_type = typename Container::difference_type;
+        difference_type const n = std::distance(first, last);
+        difference_type const size = c.size();
+        difference_type const min_size = (std::min)(n, size);
+        ForwardIterator const mid = std::next(first, min_size);
+        std::copy(
+            static_cast<ExecutionPolicy &&>(policy), first, mid, c.begin());
+        if (min_size < size)
+            c.erase(std::next(c.begin(), min_size), c.end());
+        else if (min_size < n)
+            c.insert(c.end(), mid, last);
+    }
+
+    /** Equivalent to `c.assign(n, x)`, except that the elements of `c`
+        that are overwritten are assigned using `std::fill_n(policy, ...)`.
+        Elements added to or removed from the end of `c` are inserted or
+        erased as `c.assign(n, x)` would. */
+    template<
+        typename ExecutionPolicy,
+        typename Container,
+        typename Enable = std::enable_if_t<
+            v1_dtl::execution_policy<ExecutionPolicy>::value>>
+    auto assign(
+        ExecutionPolicy && policy,
+        Container & c,
+        typename Container::size_type n,
+        typename Container::value_type const & x)
+        -> decltype(v1_dtl::derived_container(c), void())
+    {
+        if (detail::fake_capacity(c) < n) {
+            Container temp(n, x);
+            c.swap(temp);
+            return;
+        }
+        using size_type = typename Container::size_type;
+        size_type const size = c.size();
+        size_type const min_size = (std::min)(n, size);
+        auto const fill_end = std::fill_n(
+            static_cast<ExecutionPolicy &&>(policy), c.begin(), min_size, x);
+        if (min_size < size) {
+            c.erase(fill_end, c.end());
+        } else {
+            n -= min_size;
+            c.insert(
+                c.end(),
+                detail::make_n_iter(x, n),
+                detail::make_n_iter_end(x, n));
+        }
+    }
+
+    /** Returns `lhs == rhs`, with the elements compared using
+        `std::equal(policy, ...)`. */
+    template<
+        typename ExecutionPolicy,
+        typename Container,
+        typename Enable = std::enable_if_t<
+            v1_dtl::execution_policy<ExecutionPolicy>::value>>
+    auto equal(
+        ExecutionPolicy && policy, Container const & lhs, Container const & rhs)
+        -> decltype(v1_dtl::derived_container(lhs), bool())
+    {
+        return lhs.size() == rhs.size() &&
+               std::equal(
+                   static_cast<ExecutionPolicy &&>(policy),
+                   lhs.begin(),
+                   lhs.end(),
+                   rhs.begin());
+    }
+
+    /** Returns `lhs < rhs`, with the elements compared using
+        `std::lexicographical_compare(policy, ...)`. */
+    template<
+        typename ExecutionPolicy,
+        typename Container,
+        typename Enable = std::enable_if_t<
+            v1_dtl::execution_policy<ExecutionPolicy>::value>>
+    auto lexicographical_compare(
+        ExecutionPolicy && policy, Container const & lhs, Container const & rhs)
+        -> decltype(v1_dtl::derived_container(lhs), bool())
+    {
+        return std::lexicographical_compare(
+            static_cast<ExecutionPolicy &&>(policy),
+            lhs.begin(),
+            lhs.end(),
+            rhs.begin(),
+            rhs.end());
+    }
+
+}}}
+
+#endif
+
+#endif
@@ -0,0 +1,523 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_FLAT_MAP_HPP
+#define BOOST_STL_INTERFACES_FLAT_MAP_HPP
+
+#include <boost/stl_interfaces/associative_container_interface.hpp>
+#include <boost/stl_interfaces/iterator_interface.hpp>
+#include <boost/stl_interfaces/zip_iterator.hpp>
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace boost { namespace stl_interfaces { inline namespace v1 {
+
+    /** The random access proxy iterator of `flat_map`, formed from an
+        iterator into its keys and an iterator into its mapped values.  Its
+        reference type is a `std::pair` of the two underlying references, so
+        `it->first` and `it->second` work as they do for `std::map`. */
+    template<typename KeyIter, typename MappedIter>
+    struct flat_map_iterator
+        : proxy_iterator_interface<
+              flat_map_iterator<KeyIter, MappedIter>,
+              std::random_access_iterator_tag,
+              std::pair<
+                  typename std::iterator_traits<KeyIter>::value_type,
+                  typename std::iterator_traits<MappedIter>::value_type>,
+              std::pair<
+                  typename std::iterator_traits<KeyIter>::reference,
+                  typename std::iterator_traits<MappedIter>::reference>>
+    {
+        using base_type = proxy_iterator_interface<
+            flat_map_iterator<KeyIter, MappedIter>,
+            std::random_access_iterator_tag,
+            std::pair<
+                typename std::iterator_traits<KeyIter>::value_type,
+                typename std::iterator_traits<MappedIter>::value_type>,
+            std::pair<
+                typename std::iterator_traits<KeyIter>::reference,
+                typename std::iterator_traits<MappedIter>::reference>>;
+        using typename base_type::reference;
+        using typename base_type::difference_type;
+
+        constexpr flat_map_iterator() = default;
+        constexpr flat_map_iterator(KeyIter key_it, MappedIter mapped_it) :
+            key_it_(key_it), mapped_it_(mapped_it)
+        {}
+        template<
+            typename MappedIter2,
+            typename Enable = std::enable_if_t<
+                std::is_convertible<MappedIter2, MappedIter>::value>>
+        constexpr flat_map_iterator(
+            flat_map_iterator<KeyIter, MappedIter2> other) :
+            key_it_(other.key_it_), mapped_it_(other.mapped_it_)
+        {}
+
+        constexpr reference operator*() const
+        {
+            return reference(*key_it_, *mapped_it_);
+        }
+        constexpr flat_map_iterator & operator+=(difference_type n)
+        {
+            key_it_ += n;
+            mapped_it_ += n;
+            return *this;
+        }
+        constexpr difference_type operator-(flat_map_iterator other) const
+        {
+            return key_it_ - other.key_it_;
+        }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        template<typename KeyIter2, typename MappedIter2>
+        friend struct flat_map_iterator;
+
+        KeyIter key_it_;
+        MappedIter mapped_it_;
+#endif
+    };
+
+    /** A map with unique keys, stored as two random access containers of
+        the same size: the sorted keys in a `KeyContainer`, and the mapped
+        values in a `MappedContainer`, usually contiguous ones like the
+        default `std::vector`s.  Lookups are binary searches over the keys
+        alone, and `insert(first, last)` merges all the new elements in with
+        a single pass over the existing ones.
+
+        The iterators are proxy iterators whose reference type is
+        `std::pair<Key const &, T &>`.  As with `std::vector`, inserting or
+        erasing invalidates them.
+
+        `flat_map` reports its inserts, erases, element moves, reallocations,
+        and failed calls to `at()` to `statistics_policy_t<flat_map>`. */
+    template<
+        typename Key,
+        typename T,
+        typename Compare = std::less<Key>,
+        typename KeyContainer = std::vector<Key>,
+        typename MappedContainer = std::vector<T>>
+    struct flat_map
+        : associative_container_interface<
+              flat_map<Key, T, Compare, KeyContainer, MappedContainer>>
+    {
+        using key_type = Key;
+        using mapped_type = T;
+        using value_type = std::pair<Key, T>;
+        using key_compare = Compare;
+        using reference = std::pair<Key const &, T &>;
+        using const_reference = std::pair<Key const &, T const &>;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using iterator = flat_map_iterator<
+            typename KeyContainer::const_iterator,
+            typename MappedContainer::iterator>;
+        using const_iterator = flat_map_iterator<
+            typename KeyContainer::const_iterator,
+            typename MappedContainer::const_iterator>;
+        using reverse_iterator = stl_interfaces::reverse_iterator<iterator>;
+        using const_reverse_iterator =
+            stl_interfaces::reverse_iterator<const_iterator>;
+        using key_container_type = KeyContainer;
+        using mapped_container_type = MappedContainer;
+
+        /** Compares elements by their keys. */
+        struct value_compare
+        {
+            bool operator()(const_reference lhs, const_reference rhs) const
+            {
+                return comp(lhs.first, rhs.first);
+            }
+
+            Compare comp;
+        };
+
+        /** The underlying containers, as returned by `extract()`. */
+        struct containers
+        {
+            key_container_type keys;
+            mapped_container_type values;
+        };
+
+        flat_map() : flat_map(Compare()) {}
+        explicit flat_map(Compare const & comp) : comp_(comp) {}
+        /** \pre `keys.size() == values.size()` */
+        flat_map(
+            key_container_type keys,
+            mapped_container_type values,
+            Compare const & comp = Compare()) :
+            comp_(comp)
+        {
+            insert_owned(std::move(keys), std::move(values));
+        }
+        /** \pre `keys.size() == values.size()`, and `keys` is sorted by
+            `comp`, with no equivalent keys. */
+        flat_map(
+            sorted_unique_t,
+            key_container_type keys,
+            mapped_container_type values,
+            Compare const & comp = Compare()) :
+            keys_(std::move(keys)), values_(std::move(values)), comp_(comp)
+        {
+            BOOST_ASSERT(keys_.size() == values_.size());
+        }
+        template<
+            typename InputIterator,
+            typename Enable = std::enable_if_t<
+                v1_dtl::in_iter<InputIterator>::value>>
+        flat_map(
+            InputIterator first,
+            InputIterator last,
+            Compare const & comp = Compare()) :
+            comp_(comp)
+        {
+            insert(first, last);
+        }
+        template<
+            typename InputIterator,
+            typename Enable = std::enable_if_t<
+                v1_dtl::in_iter<InputIterator>::value>>
+        flat_map(
+            sorted_unique_t,
+            InputIterator first,
+            InputIterator last,
+            Compare const & comp = Compare()) :
+            comp_(comp)
+        {
+            insert(sorted_unique, first, last);
+        }
+        flat_map(
+            std::initializer_list<value_type> il,
+            Compare const & comp = Compare()) :
+            flat_map(il.begin(), il.end(), comp)
+        {}
+        flat_map(
+            sorted_unique_t,
+            std::initializer_list<value_type> il,
+            Compare const & comp = Compare()) :
+            flat_map(sorted_unique, il.begin(), il.end(), comp)
+        {}
+
+        flat_map & operator=(std::initializer_list<value_type> il)
+        {
+            this->clear();
+            insert(il.begin(), il.end());
+            return *this;
+        }
+
+        iterator begin() noexcept
+        {
+            return iterator(keys_.cbegin(), values_.begin());
+        }
+        iterator end() noexcept
+        {
+            return iterator(keys_.cend(), values_.end());
+        }
+
+        size_type size() const noexcept { return keys_.size(); }
+        size_type max_size() const noexcept
+        {
+            return (std::min)(keys_.max_size(), values_.max_size());
+        }
+
+        key_compare key_comp() const { return comp_; }
+        value_compare value_comp() const { return value_compare{comp_}; }
+
+        /** Returns the keys, in order. */
+        key_container_type const & keys() const noexcept { return keys_; }
+        /** Returns the mapped values, in the order of their keys. */
+        mapped_container_type const & values() const noexcept
+        {
+            return values_;
+        }
+
+        iterator lower_bound(key_type const & k)
+        {
+            return begin() + difference_type(lower_bound_index(k));
+        }
+
+        template<typename... Args>
+        std::pair<iterator, bool>
+        try_emplace(key_type const & k, Args &&... args)
+        {
+            return try_emplace_at(
+                lower_bound_index(k), k, std::forward<Args>(args)...);
+        }
+        template<typename... Args>
+        std::pair<iterator, bool> try_emplace(key_type && k, Args &&... args)
+        {
+            auto const i = lower_bound_index(k);
+            return try_emplace_at(i, std::move(k), std::forward<Args>(args)...);
+        }
+
+        template<typename M>
+        std::pair<iterator, bool> insert_or_assign(key_type const & k, M && obj)
+        {
+            return insert_or_assign_impl(k, std::forward<M>(obj));
+        }
+        template<typename M>
+        std::pair<iterator, bool> insert_or_assign(key_type && k, M && obj)
+        {
+            return insert_or_assign_impl(std::move(k), std::forward<M>(obj));
+        }
+
+        template<typename... Args>
+        std::pair<iterator, bool> emplace(Args &&... args)
+        {
+            value_type x(std::forward<Args>(args)...);
+            auto const i = lower_bound_index(x.first);
+            return try_emplace_at(i, std::move(x.first), std::move(x.second));
+        }
+        template<typename... Args>
+        iterator emplace_hint(const_iterator hint, Args &&... args)
+        {
+            value_type x(std::forward<Args>(args)...);
+            auto const i = size_type(hint - this->cbegin());
+            // A correct hint is the lower bound of the key, and saves the
+            // search.
+            auto const hint_ok =
+                (i == keys_.size() || !comp_(key_at(i), x.first)) &&
+                (i == 0 || comp_(key_at(i - 1), x.first));
+            return try_emplace_at(
+                       hint_ok ? i : lower_bound_index(x.first),
+                       std::move(x.first),
+                       std::move(x.second))
+                .first;
+        }
+
+        /** Inserts the elements of `[first, last)` whose keys are not
+            already in `*this`, by sorting them and then merging them in with
+            a single pass over `*this`. */
+        template<
+            typename InputIterator,
+            typename Enable = std::enable_if_t<
+                v1_dtl::in_iter<InputIterator>::value>>
+        void insert(InputIterator first, InputIterator last)
+        {
+            key_container_type keys;
+            mapped_container_type values;
+            copy_elements(first, last, keys, values);
+            insert_owned(std::move(keys), std::move(values));
+        }
+        /** Like `insert(first, last)`, but skips the sort.  Like it, this
+            copies the new elements before it moves any existing ones, so
+            that if a copy throws, `*this` is unchanged.
+
+            \pre `[first, last)` is sorted by key. */
+        template<
+            typename InputIterator,
+            typename Enable = std::enable_if_t<
+                v1_dtl::in_iter<InputIterator>::value>>
+        void insert(sorted_unique_t, InputIterator first, InputIterator last)
+        {
+            key_container_type keys;
+            mapped_container_type values;
+            copy_elements(first, last, keys, values);
+            merge_unique(std::move(keys), std::move(values));
+        }
+
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            auto const i = first - this->cbegin();
+            auto const j = last - this->cbegin();
+            keys_.erase(keys_.cbegin() + i, keys_.cbegin() + j);
+            values_.erase(values_.cbegin() + i, values_.cbegin() + j);
+            this->statistics().erase(size_type(j - i));
+            this->statistics().move(keys_.size() - size_type(i));
+            return begin() + i;
+        }
+
+        void swap(flat_map & other)
+        {
+            using std::swap;
+            swap(keys_, other.keys_);
+            swap(values_, other.values_);
+            swap(comp_, other.comp_);
+        }
+
+        friend void swap(flat_map & lhs, flat_map & rhs) { lhs.swap(rhs); }
+
+        /** Moves the underlying containers out of `*this`, leaving it
+            empty. */
+        containers extract() &&
+        {
+            containers result{std::move(keys_), std::move(values_)};
+            keys_.clear();
+            values_.clear();
+            return result;
+        }
+        /** Replaces the contents of `*this` with `keys` and `values`.
+
+            \pre `keys.size() == values.size()`, and `keys` is sorted by
+            `key_comp()`, with no equivalent keys. */
+        void
+        replace(key_container_type && keys, mapped_container_type && values)
+        {
+            BOOST_ASSERT(keys.size() == values.size());
+            keys_ = std::move(keys);
+            values_ = std::move(values);
+        }
+
+        using base_type = associative_container_interface<
+            flat_map<Key, T, Compare, KeyContainer, MappedContainer>>;
+        using base_type::begin;
+        using base_type::end;
+        using base_type::lower_bound;
+        using base_type::insert;
+        using base_type::erase;
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        key_type const & key_at(size_type i) const
+        {
+            return *(keys_.cbegin() + difference_type(i));
+        }
+
+        size_type lower_bound_index(key_type const & k) const
+        {
+            return size_type(
+                std::lower_bound(keys_.cbegin(), keys_.cend(), k, comp_) -
+                keys_.cbegin());
+        }
+
+        // i is the lower bound of k.
+        template<typename K, typename... Args>
+        std::pair<iterator, bool>
+        try_emplace_at(size_type i, K && k, Args &&... args)
+        {
+            auto const pos = difference_type(i);
+            if (i != keys_.size() && !comp_(k, key_at(i)))
+                return {begin() + pos, false};
+            keys_.insert(keys_.cbegin() + pos, std::forward<K>(k));
+            try {
+                values_.emplace(
+                    values_.cbegin() + pos, std::forward<Args>(args)...);
+            } catch (...) {
+                keys_.erase(keys_.cbegin() + pos);
+                throw;
+            }
+            this->statistics().insert(1);
+            this->statistics().move(keys_.size() - 1 - i);
+            this->statistics().grow_to(keys_.size());
+            return {begin() + pos, true};
+        }
+
+        template<typename K, typename M>
+        std::pair<iterator, bool> insert_or_assign_impl(K && k, M && obj)
+        {
+            auto const i = lower_bound_index(k);
+            if (i != keys_.size() && !comp_(k, key_at(i))) {
+                auto const it = begin() + difference_type(i);
+                it->second = std::forward<M>(obj);
+                return {it, false};
+            }
+            return try_emplace_at(i, std::forward<K>(k), std::forward<M>(obj));
+        }
+
+        template<typename InputIterator>
+        static void copy_elements(
+            InputIterator first,
+            InputIterator last,
+            key_container_type & keys,
+            mapped_container_type & values)
+        {
+            for (; first != last; ++first) {
+                value_type x(*first);
+                keys.push_back(std::move(x.first));
+                values.push_back(std::move(x.second));
+            }
+        }
+
+        // Sorts the elements by key, permuting both columns together, and
+        // merges them in.
+        void insert_owned(
+            key_container_type && keys, mapped_container_type && values)
+        {
+            BOOST_ASSERT(keys.size() == values.size());
+            auto const first =
+                stl_interfaces::make_zip_iterator(keys.begin(), values.begin());
+            auto const last =
+                stl_interfaces::make_zip_iterator(keys.end(), values.end());
+            std::stable_sort(
+                first, last, [this](auto const & lhs, auto const & rhs) {
+                    return comp_(std::get<0>(lhs), std::get<0>(rhs));
+                });
+            merge_unique(std::move(keys), std::move(values));
+        }
+
+        // Merges the elements, sorted by key, into *this in one pass.  An
+        // element whose key is equivalent to one already merged is dropped,
+        // so the existing elements win, and so does the first of several
+        // new elements with equivalent keys.
+        //
+        // The new elements have already been built by the caller, so
+        // nothing here copies or converts one.  If moving an element
+        // throws, keys_ and values_ may be left holding moved-from
+        // elements, so they are cleared instead.
+        void merge_unique(
+            key_container_type && new_keys,
+            mapped_container_type && new_values)
+        {
+            if (new_keys.empty())
+                return;
+            auto const old_size = keys_.size();
+            auto const size = old_size + new_keys.size();
+            key_container_type keys;
+            mapped_container_type values;
+            v1_dtl::reserve(keys, size);
+            v1_dtl::reserve(values, size);
+            try {
+                auto key_it = keys_.begin();
+                auto value_it = values_.begin();
+                auto const key_last = keys_.end();
+                auto new_value_it = new_values.begin();
+                for (auto & k : new_keys) {
+                    while (key_it != key_last && !comp_(k, *key_it)) {
+                        keys.push_back(std::move(*key_it));
+                        values.push_back(std::move(*value_it));
+                        ++key_it;
+                        ++value_it;
+                    }
+                    auto & v = *new_value_it++;
+                    if (!keys.empty() && !comp_(keys.back(), k))
+                        continue;
+                    keys.push_back(std::move(k));
+                    values.push_back(std::move(v));
+                }
+                for (; key_it != key_last; ++key_it, ++value_it) {
+                    keys.push_back(std::move(*key_it));
+                    values.push_back(std::move(*value_it));
+                }
+            } catch (...) {
+                keys_.clear();
+                values_.clear();
+                throw;
+            }
+            keys_ = std::move(keys);
+            values_ = std::move(values);
+            this->statistics().insert(keys_.size() - old_size);
+            this->statistics().move(old_size);
+            this->statistics().reallocate();
+            this->statistics().grow_to(keys_.size());
+        }
+
+        key_container_type keys_;
+        mapped_container_type values_;
+        Compare comp_;
+#endif
+    };
+
+}}}
+
+#endif
@@ -0,0 +1,278 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_FLAT_SET_HPP
+#define BOOST_STL_INTERFACES_FLAT_SET_HPP
+
+#include <boost/stl_interfaces/associative_container_interface.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace boost { namespace stl_interfaces { inline namespace v1 {
+
+    /** A set of unique keys, stored sorted in a random access
+        `KeyContainer`, usually a contiguous one such as the default
+        `std::vector<Key>`.  Lookups are binary searches over that
+        container, and `insert(first, last)` merges all the new keys in with
+        a single pass over the existing ones.
+
+        As with `std::vector`, inserting or erasing invalidates iterators.
+
+        `flat_set` reports its inserts, erases, element moves, and
+        reallocations to `statistics_policy_t<flat_set>`. */
+    template<
+        typename Key,
+        typename Compare = std::less<Key>,
+        typename KeyContainer = std::vector<Key>>
+    struct flat_set
+        : associative_container_interface<flat_set<Key, Compare, KeyContainer>>
+    {
+        using key_type = Key;
+        using value_type = Key;
+        using key_compare = Compare;
+        using value_compare = Compare;
+        using reference = value_type &;
+        using const_reference = value_type const &;
+        using size_type = typename KeyContainer::size_type;
+        using difference_type = typename KeyContainer::difference_type;
+        using iterator = typename KeyContainer::const_iterator;
+        using const_iterator = typename KeyContainer::const_iterator;
+        using reverse_iterator = stl_interfaces::reverse_iterator<iterator>;
+        using const_reverse_iterator =
+            stl_interfaces::reverse_iterator<const_iterator>;
+        using container_type = KeyContainer;
+
+        flat_set() : flat_set(Compare()) {}
+        explicit flat_set(Compare const & comp) : comp_(comp) {}
+        explicit flat_set(
+            container_type keys, Compare const & comp = Compare()) :
+            comp_(comp)
+        {
+            insert_owned(std::move(keys));
+        }
+        /** \pre `keys` is sorted by `comp`, and has no equivalent keys. */
+        flat_set(
+            sorted_unique_t,
+            container_type keys,
+            Compare const & comp = Compare()) :
+            keys_(std::move(keys)), comp_(comp)
+        {}
+        template<
+            typename InputIterator,
+            typename Enable = std::enable_if_t<
+                v1_dtl::in_iter<InputIterator>::value>>
+        flat_set(
+            InputIterator first,
+            InputIterator last,
+            Compare const & comp = Compare()) :
+            comp_(comp)
+        {
+            insert(first, last);
+        }
+        template<
+            typename InputIterator,
+            typename Enable = std::enable_if_t<
+                v1_dtl::in_iter<InputIterator>::value>>
+        flat_set(
+            sorted_unique_t,
+            InputIterator first,
+            InputIterator last,
+            Compare const & comp = Compare()) :
+            keys_(first, last), comp_(comp)
+        {}
+        flat_set(
+            std::initializer_list<value_type> il,
+            Compare const & comp = Compare()) :
+            flat_set(il.begin(), il.end(), comp)
+        {}
+        flat_set(
+            sorted_unique_t,
+            std::initializer_list<value_type> il,
+            Compare const & comp = Compare()) :
+            flat_set(sorted_unique, il.begin(), il.end(), comp)
+        {}
+
+        flat_set & operator=(std::initializer_list<value_type> il)
+        {
+            this->clear();
+            insert(il.begin(), il.end());
+            return *this;
+        }
+
+        iterator begin() noexcept { return keys_.cbegin(); }
+        iterator end() noexcept { return keys_.cend(); }
+
+        size_type size() const noexcept { return keys_.size(); }
+        size_type max_size() const noexcept { return keys_.max_size(); }
+
+        key_compare key_comp() const { return comp_; }
+        value_compare value_comp() const { return comp_; }
+
+        iterator lower_bound(key_type const & k)
+        {
+            return std::lower_bound(keys_.cbegin(), keys_.cend(), k, comp_);
+        }
+
+        template<typename... Args>
+        std::pair<iterator, bool> emplace(Args &&... args)
+        {
+            key_type k(std::forward<Args>(args)...);
+            auto const pos = lower_bound(k);
+            return insert_at(pos, std::move(k));
+        }
+        template<typename... Args>
+        iterator emplace_hint(const_iterator hint, Args &&... args)
+        {
+            key_type k(std::forward<Args>(args)...);
+            // A correct hint is the lower bound of k, and saves the search.
+            if ((hint == end() || !comp_(*hint, k)) &&
+                (hint == begin() || comp_(*std::prev(hint), k))) {
+                return insert_at(hint, std::move(k)).first;
+            }
+            auto const pos = lower_bound(k);
+            return insert_at(pos, std::move(k)).first;
+        }
+
+        /** Inserts the keys in `[first, last)` that are not already in
+            `*this`, by sorting them and then merging them in with a single
+            pass over `*this`. */
+        template<
+            typename InputIterator,
+            typename Enable = std::enable_if_t<
+                v1_dtl::in_iter<InputIterator>::value>>
+        void insert(InputIterator first, InputIterator last)
+        {
+            insert_owned(container_type(first, last));
+        }
+        /** Like `insert(first, last)`, but skips the sort.  Like it, this
+            copies the new elements before it moves any existing ones, so
+            that if a copy throws, `*this` is unchanged.
+
+            \pre `[first, last)` is sorted by `key_comp()`. */
+        template<
+            typename InputIterator,
+            typename Enable = std::enable_if_t<
+                v1_dtl::in_iter<InputIterator>::value>>
+        void insert(sorted_unique_t, InputIterator first, InputIterator last)
+        {
+            merge_unique(container_type(first, last));
+        }
+
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            auto const n = size_type(last - first);
+            auto const index = first - keys_.cbegin();
+            auto const result = keys_.erase(first, last);
+            this->statistics().erase(n);
+            this->statistics().move(keys_.size() - size_type(index));
+            return result;
+        }
+
+        void swap(flat_set & other)
+        {
+            using std::swap;
+            swap(keys_, other.keys_);
+            swap(comp_, other.comp_);
+        }
+
+        friend void swap(flat_set & lhs, flat_set & rhs) { lhs.swap(rhs); }
+
+        /** Moves the keys out of `*this`, leaving it empty. */
+        container_type extract() &&
+        {
+            container_type result = std::move(keys_);
+            keys_.clear();
+            return result;
+        }
+        /** Replaces the keys of `*this` with `keys`.
+
+            \pre `keys` is sorted by `key_comp()`, and has no equivalent
+            keys. */
+        void replace(container_type && keys) { keys_ = std::move(keys); }
+
+        using base_type = associative_container_interface<
+            flat_set<Key, Compare, KeyContainer>>;
+        using base_type::begin;
+        using base_type::end;
+        using base_type::lower_bound;
+        using base_type::insert;
+        using base_type::erase;
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        // pos is the lower bound of k.
+        std::pair<iterator, bool> insert_at(const_iterator pos, key_type && k)
+        {
+            if (pos != end() && !comp_(k, *pos))
+                return {pos, false};
+            auto const index = size_type(pos - keys_.cbegin());
+            auto const result = keys_.insert(pos, std::move(k));
+            this->statistics().insert(1);
+            this->statistics().move(keys_.size() - 1 - index);
+            this->statistics().grow_to(keys_.size());
+            return {result, true};
+        }
+
+        void insert_owned(container_type && keys)
+        {
+            std::stable_sort(keys.begin(), keys.end(), comp_);
+            merge_unique(std::move(keys));
+        }
+
+        // Merges the sorted keys into keys_ in one pass.  A key equivalent
+        // to one already merged is dropped, so the existing keys win, and
+        // so does the first of several equivalent new keys.
+        //
+        // The new keys have already been built by the caller, so nothing
+        // here copies or converts a key.  If moving a key throws, keys_ may
+        // be left holding moved-from keys, so it is cleared instead.
+        void merge_unique(container_type && keys)
+        {
+            if (keys.empty())
+                return;
+            auto const old_size = keys_.size();
+            container_type result;
+            v1_dtl::reserve(result, old_size + keys.size());
+            try {
+                auto it = keys_.begin();
+                auto const it_last = keys_.end();
+                for (auto & k : keys) {
+                    while (it != it_last && !comp_(k, *it)) {
+                        result.push_back(std::move(*it));
+                        ++it;
+                    }
+                    if (!result.empty() && !comp_(result.back(), k))
+                        continue;
+                    result.push_back(std::move(k));
+                }
+                for (; it != it_last; ++it) {
+                    result.push_back(std::move(*it));
+                }
+            } catch (...) {
+                keys_.clear();
+                throw;
+            }
+            keys_ = std::move(result);
+            this->statistics().insert(keys_.size() - old_size);
+            this->statistics().move(old_size);
+            this->statistics().reallocate();
+            this->statistics().grow_to(keys_.size());
+        }
+
+        container_type keys_;
+        Compare comp_;
+#endif
+    };
+
+}}}
+
+#endif
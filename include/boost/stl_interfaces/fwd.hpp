@@ -6,7 +6,11 @@
 #ifndef BOOST_STL_INTERFACES_FWD_HPP
 #define BOOST_STL_INTERFACES_FWD_HPP
 
+#include <cstddef>
+#include <cstdint>
 #include <iterator>
+#include <memory>
+#include <type_traits>
 
 #ifndef BOOST_STL_INTERFACES_DOXYGEN
 
@@ -25,6 +29,56 @@
 
 #endif
 
+#if defined(BOOST_STL_INTERFACES_CHECKED)
+#include <boost/assert.hpp>
+#endif
+
+#ifdef BOOST_STL_INTERFACES_DOXYGEN
+
+/** Define this to enable checked mode, in which `checked_iterator_t<Iter>`
+    is `checked_iterator<Iter>`, and `sequence_container_interface` checks
+    the preconditions of `operator[]()`, `front()`, `back()`, `pop_front()`,
+    and `pop_back()`.  Failed checks are reported with `BOOST_ASSERT_MSG()`,
+    so `NDEBUG` and `BOOST_ENABLE_ASSERT_HANDLER` control them as usual.
+
+    Checked mode changes the layout of containers and iterators, so it must
+    be defined (or not) consistently in every translation unit of a
+    program.  When it is not defined, none of this generates any code. */
+#define BOOST_STL_INTERFACES_CHECKED
+
+/** In checked mode, checks `condition` with `BOOST_ASSERT_MSG(condition,
+    message)`.  Otherwise, expands to nothing. */
+#define BOOST_STL_INTERFACES_CHECK(condition, message)
+
+/** Expands to `noexcept(condition)`, except in checked mode, where it
+    expands to nothing, since a failed check may throw from a user-defined
+    assertion handler. */
+#define BOOST_STL_INTERFACES_CHECKED_NOEXCEPT(condition)
+
+#elif defined(BOOST_STL_INTERFACES_CHECKED)
+
+#define BOOST_STL_INTERFACES_CHECK(condition, message)                         \
+    BOOST_ASSERT_MSG(condition, message)
+#define BOOST_STL_INTERFACES_CHECKED_NOEXCEPT(condition)
+
+#else
+
+#define BOOST_STL_INTERFACES_CHECK(condition, message)
+#define BOOST_STL_INTERFACES_CHECKED_NOEXCEPT(condition) noexcept(condition)
+
+#endif
+
+#ifdef BOOST_STL_INTERFACES_DOXYGEN
+
+/** Expands to a hint that the processor start loading the cache line that
+    holds `address`, which need not be dereferenceable, so that a later
+    read of it does not stall.  Where there is no such hint, it expands to
+    nothing that generates code.  Define it before including any header of
+    this library to override it. */
+#define BOOST_STL_INTERFACES_PREFETCH(address)
+
+#endif
+
 
 namespace boost { namespace stl_interfaces {
     inline namespace v1 {
@@ -37,6 +91,47 @@ namespace boost { namespace stl_interfaces {
             contiguous = true
         };
 
+        /** A type trait that indicates whether an object of type `T` may be
+            relocated -- move-constructed into new storage, followed by
+            destruction of the source object -- by copying its bytes, with no
+            constructor or destructor call.
+
+            This is true of all trivially copyable types.  Specialize it to
+            `std::true_type` for other types for which it is true, such as
+            types that only own a pointer to a heap allocation; containers
+            built on `sequence_container_interface` may then move whole blocks
+            of such elements with `memcpy()`. */
+        template<typename T>
+        struct is_trivially_relocatable : std::is_trivially_copyable<T>
+        {
+        };
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+        template<typename T>
+        struct is_trivially_relocatable<std::unique_ptr<T>> : std::true_type
+        {
+        };
+#endif
+
+        /** A type trait that indicates whether two objects of type `T`
+            compare equal exactly when their object representations are the
+            same, so that a contiguous sequence of them may be hashed as a
+            single block of bytes.
+
+            This is true of integral and pointer types.  Specialize it to
+            `std::true_type` for other types for which it is true, such as
+            structs of integers with no padding whose `operator==()`
+            compares each member; `hash_value()` then hashes the contents of
+            a contiguous container of them in one pass over `data()`, and
+            `operator==()` compares them with `memcmp()`. */
+        template<typename T>
+        struct is_bytewise_hashable
+            : std::integral_constant<
+                  bool,
+                  std::is_integral<T>::value || std::is_pointer<T>::value>
+        {
+        };
+
         namespace v1_dtl {
             template<typename... T>
             using void_t = void;
@@ -45,6 +140,11 @@ namespace boost { namespace stl_interfaces {
             using iter_difference_t =
                 typename std::iterator_traits<Iter>::difference_type;
 
+            template<typename Iter>
+            using in_iter = std::is_convertible<
+                typename std::iterator_traits<Iter>::iterator_category,
+                std::input_iterator_tag>;
+
             template<typename Range, typename = void>
             struct iterator;
             template<typename Range>
@@ -90,6 +190,26 @@ namespace boost { namespace stl_interfaces {
         }
 
     }
+
+    namespace detail {
+        namespace adl_range {
+            using std::begin;
+            using std::end;
+
+            template<typename Range>
+            constexpr auto adl_begin(Range && r) -> decltype(begin(r))
+            {
+                return begin(r);
+            }
+            template<typename Range>
+            constexpr auto adl_end(Range && r) -> decltype(end(r))
+            {
+                return end(r);
+            }
+        }
+        using adl_range::adl_begin;
+        using adl_range::adl_end;
+    }
 }}
 
 #endif
@@ -0,0 +1,359 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_GENERATOR_HPP
+#define BOOST_STL_INTERFACES_GENERATOR_HPP
+
+#include <boost/stl_interfaces/iterator_interface.hpp>
+#include <boost/stl_interfaces/view_interface.hpp>
+
+#include <exception>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if 201703L < __cplusplus && defined(__has_include)
+#if __has_include(<coroutine>)
+#include <coroutine>
+#endif
+#endif
+
+
+#if defined(__cpp_lib_coroutine) || defined(BOOST_STL_INTERFACES_DOXYGEN)
+
+namespace boost { namespace stl_interfaces { inline namespace v1 {
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    namespace v1_dtl {
+        // Coroutine frames are allocated as arrays of this, so that they
+        // have the alignment that operator new() would give them.
+        struct alignas(__STDCPP_DEFAULT_NEW_ALIGNMENT__) frame_block
+        {
+            unsigned char bytes[__STDCPP_DEFAULT_NEW_ALIGNMENT__];
+        };
+
+        using frame_deallocator = void (*)(void *, std::size_t) noexcept;
+
+        constexpr std::size_t
+        round_up(std::size_t n, std::size_t alignment) noexcept
+        {
+            return (n + alignment - 1) / alignment * alignment;
+        }
+
+        // A frame of size bytes is followed by the function that
+        // deallocates it, and then by the allocator it came from.  Only the
+        // allocating function knows the allocator's type, so that
+        // operator delete() can find its way back to it from the frame's
+        // size alone.
+        constexpr std::size_t deallocator_offset(std::size_t size) noexcept
+        {
+            return v1_dtl::round_up(size, alignof(frame_deallocator));
+        }
+
+        template<typename Allocator>
+        struct frame_allocator
+        {
+            using allocator_type = typename std::allocator_traits<
+                Allocator>::template rebind_alloc<frame_block>;
+            using traits = std::allocator_traits<allocator_type>;
+
+            static constexpr std::size_t
+            allocator_offset(std::size_t size) noexcept
+            {
+                return v1_dtl::round_up(
+                    v1_dtl::deallocator_offset(size) +
+                        sizeof(frame_deallocator),
+                    alignof(allocator_type));
+            }
+            static constexpr std::size_t blocks(std::size_t size) noexcept
+            {
+                return (allocator_offset(size) + sizeof(allocator_type) +
+                        sizeof(frame_block) - 1) /
+                       sizeof(frame_block);
+            }
+
+            static void * allocate(Allocator const & a, std::size_t size)
+            {
+                allocator_type alloc(a);
+                void * const frame =
+                    std::to_address(traits::allocate(alloc, blocks(size)));
+                auto const bytes = static_cast<unsigned char *>(frame);
+                ::new (bytes + v1_dtl::deallocator_offset(size))
+                    frame_deallocator(&deallocate);
+                ::new (bytes + allocator_offset(size))
+                    allocator_type(std::move(alloc));
+                return frame;
+            }
+
+            static void deallocate(void * frame, std::size_t size) noexcept
+            {
+                auto const bytes = static_cast<unsigned char *>(frame);
+                auto & stored = *std::launder(
+                    reinterpret_cast<allocator_type *>(
+                        bytes + allocator_offset(size)));
+                allocator_type alloc(std::move(stored));
+                stored.~allocator_type();
+                traits::deallocate(
+                    alloc, static_cast<frame_block *>(frame), blocks(size));
+            }
+        };
+
+        inline void deallocate_frame(void * frame, std::size_t size) noexcept
+        {
+            auto const bytes = static_cast<unsigned char *>(frame);
+            auto const deallocate = *std::launder(
+                reinterpret_cast<frame_deallocator *>(
+                    bytes + v1_dtl::deallocator_offset(size)));
+            deallocate(frame, size);
+        }
+    }
+#endif
+
+    /** A lazily-evaluated input range, produced by a coroutine that
+        `co_yield`s its elements.  This is a simplified version of C++23's
+        `std::generator`.
+
+        Each `co_yield` suspends the coroutine and exposes the yielded
+        object through the iterator's reference type, `T &`, without
+        copying it.  That includes temporaries, which live until the
+        coroutine is resumed.  The exception is a const lvalue yielded from
+        a `generator` whose `T` is not const; as with `std::generator`, a
+        copy of it is yielded instead.  A coroutine returning `generator`
+        may not `co_await`.  An exception that escapes the coroutine ends
+        the range and is rethrown from `begin()` or `operator++()`.
+
+        The coroutine frame is allocated with `std::allocator`, unless the
+        coroutine's parameters begin with `std::allocator_arg_t` and an
+        allocator (after the object parameter, for a member function), in
+        which case a copy of that allocator allocates and later deallocates
+        the frame.  This allows frames to come from a pool or an arena.
+
+        `generator` is a move-only view.  Its iterator and sentinel have the
+        same type, so it can be passed to pre-C++20 algorithms. */
+    template<typename T>
+    struct generator : view_interface<generator<T>>
+    {
+        using value_type = std::remove_cv_t<std::remove_reference_t<T>>;
+        using reference = std::remove_reference_t<T> &;
+
+        struct promise_type;
+        struct iterator;
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        using handle_type = std::coroutine_handle<promise_type>;
+        using yielded_type = std::remove_reference_t<T>;
+#endif
+
+    public:
+        struct promise_type
+        {
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+        private:
+            // Holds a copy of a yielded const lvalue; the awaiter lives in
+            // the coroutine frame until the coroutine is resumed.
+            struct copy_awaiter
+            {
+                bool await_ready() const noexcept { return false; }
+                void await_suspend(handle_type h) noexcept
+                {
+                    h.promise().value_ = std::addressof(copy_);
+                }
+                void await_resume() const noexcept {}
+
+                value_type copy_;
+            };
+
+        public:
+#endif
+            generator get_return_object() noexcept
+            {
+                return generator(handle_type::from_promise(*this));
+            }
+
+            std::suspend_always initial_suspend() const noexcept
+            {
+                return {};
+            }
+            std::suspend_always final_suspend() const noexcept { return {}; }
+
+            std::suspend_always yield_value(yielded_type & x) noexcept
+            {
+                value_ = std::addressof(x);
+                return {};
+            }
+            std::suspend_always yield_value(yielded_type && x) noexcept
+            {
+                value_ = std::addressof(x);
+                return {};
+            }
+            /** Copies `x`, which cannot be referred to through `reference`
+                otherwise, and yields the copy.  Defined only if `T` is not
+                const. */
+            template<
+                typename U = yielded_type,
+                typename Enable = std::enable_if_t<
+                    !std::is_const<U>::value &&
+                    std::is_constructible<value_type, U const &>::value>>
+            copy_awaiter yield_value(U const & x) noexcept(
+                std::is_nothrow_constructible<value_type, U const &>::value)
+            {
+                return copy_awaiter{value_type(x)};
+            }
+
+            void return_void() const noexcept {}
+
+            void unhandled_exception() noexcept
+            {
+                exception_ = std::current_exception();
+            }
+
+            template<typename U>
+            void await_transform(U &&) = delete;
+
+            static void * operator new(std::size_t size)
+            {
+                using allocator = std::allocator<v1_dtl::frame_block>;
+                return v1_dtl::frame_allocator<allocator>::allocate(
+                    allocator(), size);
+            }
+            template<typename Allocator, typename... Args>
+            static void * operator new(
+                std::size_t size,
+                std::allocator_arg_t,
+                Allocator const & alloc,
+                Args const &...)
+            {
+                return v1_dtl::frame_allocator<Allocator>::allocate(
+                    alloc, size);
+            }
+            template<typename This, typename Allocator, typename... Args>
+            static void * operator new(
+                std::size_t size,
+                This const &,
+                std::allocator_arg_t,
+                Allocator const & alloc,
+                Args const &...)
+            {
+                return v1_dtl::frame_allocator<Allocator>::allocate(
+                    alloc, size);
+            }
+            static void
+            operator delete(void * frame, std::size_t size) noexcept
+            {
+                v1_dtl::deallocate_frame(frame, size);
+            }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+        private:
+            friend generator;
+
+            void rethrow()
+            {
+                if (exception_)
+                    std::rethrow_exception(std::exchange(exception_, nullptr));
+            }
+
+            yielded_type * value_ = nullptr;
+            std::exception_ptr exception_;
+            bool started_ = false;
+#endif
+        };
+
+        struct iterator : iterator_interface<
+                              iterator,
+                              std::input_iterator_tag,
+                              value_type,
+                              reference,
+                              yielded_type *>
+        {
+            iterator() noexcept = default;
+
+            reference operator*() const noexcept
+            {
+                return *h_.promise().value_;
+            }
+            iterator & operator++()
+            {
+                h_.resume();
+                h_.promise().rethrow();
+                return *this;
+            }
+
+            /** Two iterators are equal iff both or neither are at the end,
+                since an input range has only one position that is not. */
+            friend bool operator==(iterator lhs, iterator rhs) noexcept
+            {
+                return lhs.done() == rhs.done();
+            }
+
+            using base_type = iterator_interface<
+                iterator,
+                std::input_iterator_tag,
+                value_type,
+                reference,
+                yielded_type *>;
+            using base_type::operator++;
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+        private:
+            friend generator;
+
+            explicit iterator(handle_type h) noexcept : h_(h) {}
+
+            bool done() const noexcept { return !h_ || h_.done(); }
+
+            handle_type h_;
+#endif
+        };
+
+        generator() noexcept = default;
+        generator(generator && other) noexcept :
+            h_(std::exchange(other.h_, nullptr))
+        {}
+        generator & operator=(generator && other) noexcept
+        {
+            if (&other != this) {
+                reset();
+                h_ = std::exchange(other.h_, nullptr);
+            }
+            return *this;
+        }
+        ~generator() { reset(); }
+
+        /** Runs the coroutine to its first `co_yield`, the first time it is
+            called, and returns an iterator to the current element. */
+        iterator begin()
+        {
+            if (h_ && !h_.promise().started_) {
+                h_.promise().started_ = true;
+                h_.resume();
+                h_.promise().rethrow();
+            }
+            return iterator(h_);
+        }
+        iterator end() noexcept { return iterator(); }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        explicit generator(handle_type h) noexcept : h_(h) {}
+
+        void reset() noexcept
+        {
+            if (h_)
+                h_.destroy();
+            h_ = nullptr;
+        }
+
+        handle_type h_;
+#endif
+    };
+
+}}}
+
+#endif
+
+#endif
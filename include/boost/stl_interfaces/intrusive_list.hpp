@@ -0,0 +1,445 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_INTRUSIVE_LIST_HPP
+#define BOOST_STL_INTERFACES_INTRUSIVE_LIST_HPP
+
+#include <boost/stl_interfaces/detail/prefetch.hpp>
+#include <boost/stl_interfaces/iterator_interface.hpp>
+#include <boost/stl_interfaces/sequence_container_interface.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+
+namespace boost { namespace stl_interfaces { inline namespace v1 {
+
+    template<typename T, typename Tag>
+    struct intrusive_list_iterator;
+    template<typename T, typename Tag>
+    struct intrusive_list;
+    template<typename T>
+    struct pooled_list;
+
+    /** The links that an element of an `intrusive_list<T, Tag>` holds.  `T`
+        must publicly derive from `list_hook<Tag>`; an element that is in
+        several lists at once derives from one hook per list, each with its
+        own `Tag`.
+
+        Copying a hook does not copy its links, so copying an element never
+        puts the copy in a list.  In checked mode (see
+        `BOOST_STL_INTERFACES_CHECKED`), destroying a hook that is still in a
+        list is reported. */
+    template<typename Tag = void>
+    struct list_hook
+    {
+        list_hook() noexcept : prev_(nullptr), next_(nullptr) {}
+        list_hook(list_hook const &) noexcept : list_hook() {}
+        list_hook & operator=(list_hook const &) noexcept { return *this; }
+        ~list_hook()
+        {
+            BOOST_STL_INTERFACES_CHECK(
+                !is_linked(), "Destruction of an element still in a list.");
+        }
+
+        /** Returns true iff the element is in a list. */
+        bool is_linked() const noexcept { return next_ != nullptr; }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        template<typename T, typename Tag2>
+        friend struct intrusive_list_iterator;
+        template<typename T, typename Tag2>
+        friend struct intrusive_list;
+        template<typename T>
+        friend struct pooled_list;
+
+        // Links *this in before pos.
+        void link_before(list_hook * pos) noexcept
+        {
+            prev_ = pos->prev_;
+            next_ = pos;
+            prev_->next_ = this;
+            pos->prev_ = this;
+        }
+        void unlink() noexcept
+        {
+            prev_->next_ = next_;
+            next_->prev_ = prev_;
+            prev_ = nullptr;
+            next_ = nullptr;
+        }
+        // Moves [first, last) to just before pos, which must not be in
+        // [first, last).
+        static void
+        splice(list_hook * pos, list_hook * first, list_hook * last) noexcept
+        {
+            if (first == last || pos == first || pos == last)
+                return;
+            auto const final = last->prev_;
+            first->prev_->next_ = last;
+            last->prev_ = first->prev_;
+            first->prev_ = pos->prev_;
+            final->next_ = pos;
+            pos->prev_->next_ = first;
+            pos->prev_ = final;
+        }
+        // Makes *this, an empty list's root, take over other's elements,
+        // leaving other an empty root.
+        void take_root(list_hook & other) noexcept
+        {
+            if (other.next_ == &other)
+                return;
+            next_ = other.next_;
+            prev_ = other.prev_;
+            next_->prev_ = this;
+            prev_->next_ = this;
+            other.make_root();
+        }
+        void make_root() noexcept
+        {
+            prev_ = this;
+            next_ = this;
+        }
+
+        list_hook * prev_;
+        list_hook * next_;
+#endif
+    };
+
+    /** The bidirectional iterator of `intrusive_list<std::remove_const_t<T>,
+        Tag>`.  Each increment prefetches the element after the one it moves
+        to, so that a traversal overlaps the cache miss on each node with the
+        work done on the one before it. */
+    template<typename T, typename Tag = void>
+    struct intrusive_list_iterator : iterator_interface<
+                                         intrusive_list_iterator<T, Tag>,
+                                         std::bidirectional_iterator_tag,
+                                         std::remove_const_t<T>,
+                                         T &>
+    {
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        using hook_pointer = std::conditional_t<
+            std::is_const<T>::value,
+            list_hook<Tag> const *,
+            list_hook<Tag> *>;
+#endif
+
+    public:
+        constexpr intrusive_list_iterator() noexcept : node_(nullptr) {}
+        constexpr explicit intrusive_list_iterator(hook_pointer node) noexcept :
+            node_(node)
+        {}
+        template<
+            typename U,
+            typename Enable =
+                std::enable_if_t<std::is_convertible<U *, T *>::value>>
+        constexpr intrusive_list_iterator(
+            intrusive_list_iterator<U, Tag> other) noexcept :
+            node_(other.node_)
+        {}
+
+        constexpr T & operator*() const noexcept
+        {
+            return static_cast<T &>(*node_);
+        }
+        intrusive_list_iterator & operator++() noexcept
+        {
+            node_ = node_->next_;
+            BOOST_STL_INTERFACES_PREFETCH(node_->next_);
+            return *this;
+        }
+        intrusive_list_iterator & operator--() noexcept
+        {
+            node_ = node_->prev_;
+            BOOST_STL_INTERFACES_PREFETCH(node_->prev_);
+            return *this;
+        }
+
+        friend BOOST_STL_INTERFACES_HIDDEN_FRIEND_CONSTEXPR bool operator==(
+            intrusive_list_iterator lhs, intrusive_list_iterator rhs) noexcept
+        {
+            return lhs.node_ == rhs.node_;
+        }
+
+        using base_type = iterator_interface<
+            intrusive_list_iterator<T, Tag>,
+            std::bidirectional_iterator_tag,
+            std::remove_const_t<T>,
+            T &>;
+        using base_type::operator++;
+        using base_type::operator--;
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        template<typename U, typename Tag2>
+        friend struct intrusive_list_iterator;
+        template<typename U, typename Tag2>
+        friend struct intrusive_list;
+        template<typename U>
+        friend struct pooled_list;
+
+        hook_pointer node_;
+#endif
+    };
+
+    /** A doubly-linked list of elements that it does not own.  Each element
+        carries its own links in a `list_hook<Tag>` base, so inserting and
+        erasing never allocate, and an element can be unlinked in constant
+        time given only a reference to it, via `iterator_to()`.
+
+        Erasing an element, or destroying the list, only unlinks the
+        elements; they must outlive their time in the list.  Inserting or
+        erasing never invalidates iterators to other elements.  Since
+        validity is per element, the iterators are not `checked_iterator`s,
+        even in checked mode (see `BOOST_STL_INTERFACES_CHECKED`).
+
+        `intrusive_list` reports its inserts and erases to
+        `statistics_policy_t<intrusive_list>`. */
+    template<typename T, typename Tag = void>
+    struct intrusive_list
+        : sequence_container_interface<intrusive_list<T, Tag>>
+    {
+        static_assert(
+            std::is_base_of<list_hook<Tag>, T>::value,
+            "intrusive_list<T, Tag> requires T to derive from "
+            "list_hook<Tag>.");
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        using hook_type = list_hook<Tag>;
+        using raw_iterator = intrusive_list_iterator<T, Tag>;
+        using raw_const_iterator = intrusive_list_iterator<T const, Tag>;
+#endif
+
+    public:
+        using value_type = T;
+        using pointer = T *;
+        using const_pointer = T const *;
+        using reference = value_type &;
+        using const_reference = value_type const &;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using iterator = raw_iterator;
+        using const_iterator = raw_const_iterator;
+        using reverse_iterator = stl_interfaces::reverse_iterator<iterator>;
+        using const_reverse_iterator =
+            stl_interfaces::reverse_iterator<const_iterator>;
+
+        intrusive_list() noexcept : size_(0) { root_.make_root(); }
+        intrusive_list(intrusive_list const &) = delete;
+        intrusive_list(intrusive_list && other) noexcept : intrusive_list()
+        {
+            steal(other);
+        }
+        intrusive_list & operator=(intrusive_list const &) = delete;
+        intrusive_list & operator=(intrusive_list && other) noexcept
+        {
+            if (&other != this) {
+                this->clear();
+                steal(other);
+            }
+            return *this;
+        }
+        ~intrusive_list()
+        {
+            this->clear();
+            root_.prev_ = nullptr;
+            root_.next_ = nullptr;
+        }
+
+        iterator begin() noexcept { return make(root_.next_); }
+        iterator end() noexcept { return make(&root_); }
+
+        size_type size() const noexcept { return size_; }
+        size_type max_size() const noexcept
+        {
+            return std::numeric_limits<difference_type>::max();
+        }
+
+        /** Returns an iterator to `x`.
+
+            \pre `x` is an element of `*this`. */
+        iterator iterator_to(T & x) noexcept
+        {
+            return make(static_cast<hook_type *>(std::addressof(x)));
+        }
+        /** Returns an iterator to `x`.
+
+            \pre `x` is an element of `*this`. */
+        const_iterator iterator_to(T const & x) const noexcept
+        {
+            return const_cast<intrusive_list &>(*this).iterator_to(
+                const_cast<T &>(x));
+        }
+
+        /** Links `x` in before `pos`.
+
+            \pre `x` is not in a list that uses `list_hook<Tag>`. */
+        iterator insert(const_iterator pos, T & x)
+            BOOST_STL_INTERFACES_CHECKED_NOEXCEPT(true)
+        {
+            hook_type & hook = x;
+            BOOST_STL_INTERFACES_CHECK(
+                !hook.is_linked(),
+                "intrusive_list::insert() of an element already in a list.");
+            hook.link_before(node_of(pos));
+            ++size_;
+            this->statistics().insert(1);
+            this->statistics().grow_to(size_);
+            return make(&hook);
+        }
+        void push_front(T & x) BOOST_STL_INTERFACES_CHECKED_NOEXCEPT(true)
+        {
+            insert(begin(), x);
+        }
+        void push_back(T & x) BOOST_STL_INTERFACES_CHECKED_NOEXCEPT(true)
+        {
+            insert(end(), x);
+        }
+        void pop_front() BOOST_STL_INTERFACES_CHECKED_NOEXCEPT(true)
+        {
+            BOOST_STL_INTERFACES_CHECK(
+                size_, "pop_front() called on an empty container.");
+            erase(begin());
+        }
+        void pop_back() BOOST_STL_INTERFACES_CHECKED_NOEXCEPT(true)
+        {
+            BOOST_STL_INTERFACES_CHECK(
+                size_, "pop_back() called on an empty container.");
+            erase(std::prev(end()));
+        }
+
+        /** Unlinks the element at `pos`, and returns an iterator to the one
+            after it. */
+        iterator erase(const_iterator pos)
+            BOOST_STL_INTERFACES_CHECKED_NOEXCEPT(true)
+        {
+            auto const node = node_of(pos);
+            auto const next = node->next_;
+            node->unlink();
+            --size_;
+            this->statistics().erase(1);
+            return make(next);
+        }
+        iterator erase(const_iterator first, const_iterator last)
+            BOOST_STL_INTERFACES_CHECKED_NOEXCEPT(true)
+        {
+            auto node = node_of(first);
+            auto const last_node = node_of(last);
+            size_type n = 0;
+            while (node != last_node) {
+                auto const next = node->next_;
+                node->unlink();
+                node = next;
+                ++n;
+            }
+            size_ -= n;
+            this->statistics().erase(n);
+            return make(last_node);
+        }
+
+        /** Moves every element of `other` to just before `pos`, in constant
+            time. */
+        void splice(const_iterator pos, intrusive_list & other)
+            BOOST_STL_INTERFACES_CHECKED_NOEXCEPT(true)
+        {
+            if (&other == this || !other.size_)
+                return;
+            hook_type::splice(
+                node_of(pos), other.root_.next_, &other.root_);
+            size_ += other.size_;
+            other.size_ = 0;
+        }
+        void splice(const_iterator pos, intrusive_list && other)
+            BOOST_STL_INTERFACES_CHECKED_NOEXCEPT(true)
+        {
+            splice(pos, other);
+        }
+        /** Moves the element of `other` at `it` to just before `pos`, in
+            constant time. */
+        void
+        splice(const_iterator pos, intrusive_list & other, const_iterator it)
+            BOOST_STL_INTERFACES_CHECKED_NOEXCEPT(true)
+        {
+            auto const node = other.node_of(it);
+            hook_type::splice(node_of(pos), node, node->next_);
+            --other.size_;
+            ++size_;
+        }
+        /** Moves the elements of `other` in `[first, last)` to just before
+            `pos`.  This takes constant time when `other` is `*this`, and
+            time linear in the number of elements moved otherwise.
+
+            \pre `pos` is not in `[first, last)`. */
+        void splice(
+            const_iterator pos,
+            intrusive_list & other,
+            const_iterator first,
+            const_iterator last) BOOST_STL_INTERFACES_CHECKED_NOEXCEPT(true)
+        {
+            auto const first_node = other.node_of(first);
+            auto const last_node = other.node_of(last);
+            if (&other != this) {
+                size_type n = 0;
+                for (auto node = first_node; node != last_node;
+                     node = node->next_) {
+                    ++n;
+                }
+                other.size_ -= n;
+                size_ += n;
+            }
+            hook_type::splice(node_of(pos), first_node, last_node);
+        }
+
+        void swap(intrusive_list & other) noexcept
+        {
+            if (&other == this)
+                return;
+            intrusive_list tmp(std::move(other));
+            other = std::move(*this);
+            *this = std::move(tmp);
+        }
+
+        friend void swap(intrusive_list & lhs, intrusive_list & rhs) noexcept
+        {
+            lhs.swap(rhs);
+        }
+
+        using base_type = sequence_container_interface<intrusive_list<T, Tag>>;
+        using base_type::begin;
+        using base_type::end;
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        static iterator make(hook_type * node) noexcept
+        {
+            return iterator(node);
+        }
+
+        static hook_type * node_of(const_iterator it) noexcept
+        {
+            return const_cast<hook_type *>(it.node_);
+        }
+
+        void steal(intrusive_list & other) noexcept
+        {
+            root_.take_root(other.root_);
+            size_ = other.size_;
+            other.size_ = 0;
+        }
+
+        hook_type root_;
+        size_type size_;
+#endif
+    };
+
+}}}
+
+#endif
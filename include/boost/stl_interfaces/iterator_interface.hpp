@@ -8,15 +8,38 @@
 
 #include <boost/stl_interfaces/fwd.hpp>
 
+#include <memory>
 #include <utility>
 #include <type_traits>
 #if defined(__cpp_lib_three_way_comparison)
 #include <compare>
 #endif
+#if defined(__cpp_lib_concepts)
+#include <concepts>
+#endif
 
 
 namespace boost { namespace stl_interfaces {
 
+#if 201703L < __cplusplus && defined(__cpp_lib_ranges) ||                      \
+    defined(BOOST_STL_INTERFACES_DOXYGEN)
+    /** The tag used as the `IteratorConcept` template parameter of
+        `iterator_interface` to indicate a contiguous iterator.  This is
+        `std::contiguous_iterator_tag` when that is available, and a type
+        derived from `std::random_access_iterator_tag` otherwise.
+
+        An iterator with this concept has `element_type`, so that
+        `std::pointer_traits` works for it, and it is treated as a
+        contiguous iterator by `std::to_address()`, `to_address()`, and
+        anything else that checks the C++20 `std::contiguous_iterator`
+        concept. */
+    using contiguous_iterator_tag = std::contiguous_iterator_tag;
+#else
+    struct contiguous_iterator_tag : std::random_access_iterator_tag
+    {
+    };
+#endif
+
     /** A type for granting access to the private members of an iterator
         derived from `iterator_interface`. */
     struct access
@@ -36,6 +59,70 @@ namespace boost { namespace stl_interfaces {
             return d.base_reference();
         }
 
+        // Segmented iterator hooks; see segmented_iterator_traits.
+        template<typename D>
+        static constexpr auto segment(D const & d) noexcept(
+            noexcept(d.segment())) -> decltype(d.segment())
+        {
+            return d.segment();
+        }
+        template<typename D>
+        static constexpr auto local(D const & d) noexcept(noexcept(d.local()))
+            -> decltype(d.local())
+        {
+            return d.local();
+        }
+        template<typename D, typename SegmentIter>
+        static constexpr auto local_begin(SegmentIter s) noexcept(
+            noexcept(D::local_begin(s))) -> decltype(D::local_begin(s))
+        {
+            return D::local_begin(s);
+        }
+        template<typename D, typename SegmentIter>
+        static constexpr auto local_end(SegmentIter s) noexcept(
+            noexcept(D::local_end(s))) -> decltype(D::local_end(s))
+        {
+            return D::local_end(s);
+        }
+        template<typename D, typename SegmentIter, typename LocalIter>
+        static constexpr auto compose(SegmentIter s, LocalIter l) noexcept(
+            noexcept(D::compose(s, l))) -> decltype(D::compose(s, l))
+        {
+            return D::compose(s, l);
+        }
+
+        // Constant-time distance and advance hooks; see iterator_interface.
+        template<typename D>
+        static constexpr auto
+        distance_to(D const & d, D const & other) noexcept(
+            noexcept(d.distance_to(other))) -> decltype(d.distance_to(other))
+        {
+            return d.distance_to(other);
+        }
+        template<typename D, typename DifferenceType>
+        static constexpr auto advance(D & d, DifferenceType n) noexcept(
+            noexcept(d.advance(n))) -> decltype(d.advance(n))
+        {
+            return d.advance(n);
+        }
+
+        // Bulk output hook; see copy() and transform() in algorithm.hpp.
+        template<typename D, typename Iter>
+        static constexpr auto sink(D & d, Iter first, Iter last) noexcept(
+            noexcept(d.sink(first, last))) -> decltype(d.sink(first, last))
+        {
+            return d.sink(first, last);
+        }
+
+        // Prefetch hook; see for_each(), find(), and accumulate() in
+        // algorithm.hpp.
+        template<typename D>
+        static constexpr auto prefetch_address(D const & d) noexcept(
+            noexcept(d.prefetch_address())) -> decltype(d.prefetch_address())
+        {
+            return d.prefetch_address();
+        }
+
 #endif
     };
 
@@ -87,6 +174,13 @@ namespace boost { namespace stl_interfaces {
         {
             using type = IteratorConcept;
         };
+        // contiguous_iterator_tag is not a valid iterator_category; there are
+        // no pre-C++20 algorithms that can make use of it.
+        template<>
+        struct concept_category<contiguous_iterator_tag>
+        {
+            using type = std::random_access_iterator_tag;
+        };
         template<typename IteratorConcept>
         using concept_category_t =
             typename concept_category<IteratorConcept>::type;
@@ -104,6 +198,16 @@ namespace boost { namespace stl_interfaces {
         template<typename Pointer, typename IteratorConcept>
         using pointer_t = typename pointer<Pointer, IteratorConcept>::type;
 
+        template<typename IteratorConcept, typename Reference>
+        struct element_type_base
+        {
+        };
+        template<typename Reference>
+        struct element_type_base<contiguous_iterator_tag, Reference>
+        {
+            using element_type = std::remove_reference_t<Reference>;
+        };
+
         template<typename T, typename U>
         using interoperable = std::integral_constant<
             bool,
@@ -179,7 +283,40 @@ namespace boost { namespace stl_interfaces { inline namespace v1 {
         incomplete type.  Before any member of the resulting specialization of
         `iterator_interface` other than special member functions is
         referenced, `D` shall be complete, and model
-        `std::derived_from<iterator_interface<D>>`. */
+        `std::derived_from<iterator_interface<D>>`.
+
+        If `IteratorConcept` is `contiguous_iterator_tag`, `Reference` shall
+        be an lvalue reference, and the resulting specialization has a nested
+        `element_type`.
+
+        An iterator that is not random access, but that can still compute
+        distances or advance by `n` in constant time (for instance, an
+        iterator into an indexed skip list), may say so by defining
+        `difference_type distance_to(D other) const`, which returns `other -
+        *this`, and `void advance(difference_type n)`.  These may be private
+        if `D` befriends `access`.  `iterator_interface` then implements
+        `operator-()` and `operator+=()` (and the operations built on them)
+        using these hooks, and `reverse_iterator<D>` uses them instead of
+        stepping one element at a time.
+
+        An output iterator that can append a whole range at once (for
+        instance, with a single `reserve()` and `insert()` on the container
+        it writes to) may define `template<typename Iter> void sink(Iter
+        first, Iter last)`, which writes the elements of `[first, last)` as
+        if by `*it++ = x` for each `x`.  This too may be private.  The
+        `copy()` and `transform()` algorithms in algorithm.hpp detect this
+        hook, and call it once per input range (or once per segment, for a
+        segmented input range) instead of assigning element by element.
+
+        An iterator over a linked structure whose nodes can be reached some
+        way ahead without walking the nodes in between (for instance,
+        through a jump pointer that each node keeps to the node several
+        positions after it) may define `prefetch_address() const`, which
+        returns a pointer to that node, or a null pointer if there is none.
+        This too may be private.  The `for_each()`, `find()`, and
+        `accumulate()` algorithms in algorithm.hpp prefetch the address for
+        each element before visiting it, so that the loads of the nodes
+        ahead overlap the work on the current one. */
     template<
         typename Derived,
         typename IteratorConcept,
@@ -225,6 +362,94 @@ namespace boost { namespace stl_interfaces { inline namespace v1 {
         {
         };
 
+        template<typename Iterator, typename = void>
+        struct distance_to_hook : std::false_type
+        {
+        };
+        template<typename Iterator>
+        struct distance_to_hook<
+            Iterator,
+            void_t<decltype(access::distance_to(
+                std::declval<Iterator const &>(),
+                std::declval<Iterator const &>()))>> : std::true_type
+        {
+        };
+
+        template<typename Iterator, typename DifferenceType, typename = void>
+        struct advance_hook : std::false_type
+        {
+        };
+        template<typename Iterator, typename DifferenceType>
+        struct advance_hook<
+            Iterator,
+            DifferenceType,
+            void_t<decltype(access::advance(
+                std::declval<Iterator &>(), std::declval<DifferenceType>()))>>
+            : std::true_type
+        {
+        };
+
+        template<typename Iterator, typename Iter, typename = void>
+        struct sink_hook : std::false_type
+        {
+        };
+        template<typename Iterator, typename Iter>
+        struct sink_hook<
+            Iterator,
+            Iter,
+            void_t<decltype(access::sink(
+                std::declval<Iterator &>(),
+                std::declval<Iter>(),
+                std::declval<Iter>()))>> : std::true_type
+        {
+        };
+
+        template<typename Iterator, typename = void>
+        struct prefetch_hook : std::false_type
+        {
+        };
+        template<typename Iterator>
+        struct prefetch_hook<
+            Iterator,
+            void_t<decltype(access::prefetch_address(
+                std::declval<Iterator const &>()))>> : std::true_type
+        {
+        };
+
+        template<typename Iterator, typename = void>
+        struct contiguous_iter : std::is_pointer<Iterator>
+        {
+        };
+        template<typename Iterator>
+        struct contiguous_iter<
+            Iterator,
+            void_t<typename Iterator::iterator_concept>>
+            : std::integral_constant<
+                  bool,
+                  std::is_base_of<
+                      contiguous_iterator_tag,
+                      typename Iterator::iterator_concept>::value
+#if 201703L < __cplusplus && defined(__cpp_lib_ranges)
+                      || std::contiguous_iterator<Iterator>
+#endif
+                  >
+        {
+        };
+
+        template<typename Pointer, typename = void>
+        struct pointer_traits_to_address : std::false_type
+        {
+        };
+        template<typename Pointer>
+        struct pointer_traits_to_address<
+            Pointer,
+            void_t<
+                typename Pointer::element_type,
+                decltype(std::pointer_traits<Pointer>::to_address(
+                    std::declval<Pointer const &>()))>> : std::true_type
+        {
+        };
+
         template<
             typename D,
             typename IteratorConcept,
@@ -254,6 +479,9 @@ namespace boost { namespace stl_interfaces { inline namespace v1 {
 #endif
         >
     struct iterator_interface
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+        : detail::element_type_base<IteratorConcept, Reference>
+#endif
     {
 #ifndef BOOST_STL_INTERFACES_DOXYGEN
     private:
@@ -340,7 +568,10 @@ namespace boost { namespace stl_interfaces { inline namespace v1 {
             return retval;
         }
 
-        template<typename D = Derived>
+        template<
+            typename D = Derived,
+            typename Enable = std::enable_if_t<
+                !v1_dtl::advance_hook<D, difference_type>::value>>
         constexpr auto operator+=(difference_type n) noexcept(
             noexcept(access::base(std::declval<D &>()) += n))
             -> decltype(access::base(std::declval<D &>()) += n)
@@ -348,6 +579,16 @@ namespace boost { namespace stl_interfaces { inline namespace v1 {
             return access::base(derived()) += n;
         }
 
+        template<typename D = Derived>
+        constexpr auto operator+=(difference_type n) noexcept(
+            noexcept(access::advance(std::declval<D &>(), n)))
+            -> decltype(
+                access::advance(std::declval<D &>(), n), std::declval<D &>())
+        {
+            access::advance(derived(), n);
+            return derived();
+        }
+
         template<typename D = Derived>
         constexpr auto operator+(difference_type i) const
             noexcept(noexcept(D(std::declval<D &>()), std::declval<D &>() += i))
@@ -406,7 +647,10 @@ namespace boost { namespace stl_interfaces { inline namespace v1 {
             return derived();
         }
 
-        template<typename D = Derived>
+        template<
+            typename D = Derived,
+            typename Enable =
+                std::enable_if_t<!v1_dtl::distance_to_hook<D>::value>>
         constexpr auto operator-(D other) const noexcept(noexcept(
             access::base(std::declval<D const &>()) - access::base(other)))
             -> decltype(
@@ -415,6 +659,14 @@ namespace boost { namespace stl_interfaces { inline namespace v1 {
             return access::base(derived()) - access::base(other);
         }
 
+        template<typename D = Derived>
+        constexpr auto operator-(D other) const
+            noexcept(noexcept(access::distance_to(other, other)))
+                -> decltype(access::distance_to(other, other))
+        {
+            return access::distance_to(other, derived());
+        }
+
         friend BOOST_STL_INTERFACES_HIDDEN_FRIEND_CONSTEXPR Derived
         operator-(Derived it, difference_type i) noexcept
         {
@@ -523,6 +775,43 @@ namespace boost { namespace stl_interfaces { inline namespace v1 {
     }
 
 
+    /** Returns `p`.  This is a pre-C++20 version of `std::to_address()`
+        (see [pointer.conversion] in the C++ standard). */
+    template<typename T>
+    constexpr T * to_address(T * p) noexcept
+    {
+        static_assert(!std::is_function<T>::value, "");
+        return p;
+    }
+
+    /** Returns `std::pointer_traits<Pointer>::to_address(p)` if that is
+        well-formed, and `to_address(p.operator->())` otherwise.  In
+        particular, this returns the address of `*p` for any iterator `p`
+        derived from `iterator_interface` with an `IteratorConcept` of
+        `contiguous_iterator_tag`, without dereferencing `p`. */
+    template<
+        typename Pointer,
+        typename Enable = std::enable_if_t<
+            v1_dtl::pointer_traits_to_address<Pointer>::value>>
+    constexpr auto to_address(Pointer const & p) noexcept
+        -> decltype(std::pointer_traits<Pointer>::to_address(p))
+    {
+        return std::pointer_traits<Pointer>::to_address(p);
+    }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    template<
+        typename Pointer,
+        typename Enable = std::enable_if_t<
+            !std::is_pointer<Pointer>::value &&
+            !v1_dtl::pointer_traits_to_address<Pointer>::value>>
+    constexpr auto to_address(Pointer const & p) noexcept
+        -> decltype(stl_interfaces::to_address(p.operator->()))
+    {
+        return stl_interfaces::to_address(p.operator->());
+    }
+#endif
+
     /** A template alias useful for defining proxy iterators.  \see
         `iterator_interface`. */
     template<
@@ -541,6 +830,236 @@ namespace boost { namespace stl_interfaces { inline namespace v1 {
 
 }}}
 
+#if 201703L < __cplusplus && defined(__cpp_lib_concepts) ||                    \
+    defined(BOOST_STL_INTERFACES_DOXYGEN)
+
+namespace boost { namespace stl_interfaces { namespace v2 {
+
+    namespace v2_dtl {
+        template<typename D>
+        concept base_deref = requires(D const & d) { *access::base(d); };
+
+        template<typename D>
+        concept base_incr = requires(D & d) { ++access::base(d); };
+
+        template<typename D>
+        concept base_decr = requires(D & d) { --access::base(d); };
+
+        template<typename D, typename DifferenceType>
+        concept plus_eq = requires(D & d, DifferenceType n) { d += n; };
+
+        template<typename D, typename DifferenceType>
+        concept advance_hook =
+            requires(D & d, DifferenceType n) { access::advance(d, n); };
+
+        template<typename D, typename DifferenceType>
+        concept base_plus_eq =
+            requires(D & d, DifferenceType n) { access::base(d) += n; };
+
+        template<typename D>
+        concept distance_to_hook =
+            requires(D const & d) { access::distance_to(d, d); };
+
+        template<typename D>
+        concept base_minus =
+            requires(D const & d) { access::base(d) - access::base(d); };
+
+        template<typename D>
+        concept base_eq =
+            requires(D const & d) { access::base(d) == access::base(d); };
+
+        template<typename D>
+        concept iter_minus = requires(D const & d) { d - d; };
+    }
+
+    /** A CRTP template that one may derive from to make defining iterators
+        easier.
+
+        This is a drop-in replacement for `v1::iterator_interface`, with the
+        same template parameters, the same user-defined basis operations and
+        the same `distance_to()`/`advance()` hooks.  Instead of a defaulted
+        template parameter and SFINAE on each operation, each operation is
+        an ordinary member or hidden friend constrained with a
+        `requires`-clause, so that using it does not instantiate a new
+        function template per iterator.  The comparison operators are
+        hidden friends `operator==()` and `operator<=>()`; the remaining
+        comparisons are rewritten in terms of those.
+
+        \see `v1::iterator_interface` */
+    template<
+        typename D,
+        typename IteratorConcept,
+        typename ValueType,
+        typename Reference = ValueType &,
+        typename Pointer = ValueType *,
+        typename DifferenceType = std::ptrdiff_t>
+        requires std::is_class_v<D> && std::same_as<D, std::remove_cv_t<D>>
+    struct iterator_interface
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+        : detail::element_type_base<IteratorConcept, Reference>
+#endif
+    {
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        constexpr D & derived() noexcept { return static_cast<D &>(*this); }
+        constexpr D const & derived() const noexcept
+        {
+            return static_cast<D const &>(*this);
+        }
+#endif
+
+    public:
+        using iterator_concept = IteratorConcept;
+        using iterator_category = detail::concept_category_t<iterator_concept>;
+        using value_type = ValueType;
+        using reference = Reference;
+        using pointer = detail::pointer_t<Pointer, iterator_concept>;
+        using difference_type = DifferenceType;
+
+        constexpr decltype(auto) operator*() const
+            requires v2_dtl::base_deref<D>
+        {
+            return *access::base(derived());
+        }
+
+        constexpr auto operator->() const
+            requires(!std::same_as<pointer, void>) &&
+            requires(D const & d) { *d; }
+        {
+            return detail::make_pointer<pointer>(*derived());
+        }
+
+        constexpr decltype(auto) operator[](difference_type n) const
+            requires requires(D & d) { d += n; *d; }
+        {
+            D retval = derived();
+            retval += n;
+            return *retval;
+        }
+
+        constexpr D & operator++()
+            requires v2_dtl::base_incr<D> ||
+            v2_dtl::plus_eq<D, difference_type>
+        {
+            if constexpr (v2_dtl::plus_eq<D, difference_type>)
+                derived() += difference_type(1);
+            else
+                ++access::base(derived());
+            return derived();
+        }
+        constexpr D operator++(int) requires requires(D & d) { ++d; }
+        {
+            D retval = derived();
+            ++derived();
+            return retval;
+        }
+
+        constexpr D & operator+=(difference_type n)
+            requires v2_dtl::advance_hook<D, difference_type> ||
+            v2_dtl::base_plus_eq<D, difference_type>
+        {
+            if constexpr (v2_dtl::advance_hook<D, difference_type>)
+                access::advance(derived(), n);
+            else
+                access::base(derived()) += n;
+            return derived();
+        }
+        friend constexpr D operator+(D it, difference_type n)
+            requires v2_dtl::plus_eq<D, difference_type>
+        {
+            it += n;
+            return it;
+        }
+        friend constexpr D operator+(difference_type n, D it)
+            requires v2_dtl::plus_eq<D, difference_type>
+        {
+            it += n;
+            return it;
+        }
+
+        constexpr D & operator--()
+            requires v2_dtl::base_decr<D> ||
+            v2_dtl::plus_eq<D, difference_type>
+        {
+            if constexpr (v2_dtl::plus_eq<D, difference_type>)
+                derived() += -difference_type(1);
+            else
+                --access::base(derived());
+            return derived();
+        }
+        constexpr D operator--(int) requires requires(D & d) { --d; }
+        {
+            D retval = derived();
+            --derived();
+            return retval;
+        }
+
+        constexpr D & operator-=(difference_type n)
+            requires v2_dtl::plus_eq<D, difference_type>
+        {
+            derived() += -n;
+            return derived();
+        }
+        friend constexpr D operator-(D it, difference_type n)
+            requires v2_dtl::plus_eq<D, difference_type>
+        {
+            it += -n;
+            return it;
+        }
+
+        // These three are templates only so that an operator that D
+        // declares itself is a better match.
+        template<typename D2 = D>
+            requires v2_dtl::distance_to_hook<D2> || v2_dtl::base_minus<D2>
+        friend constexpr difference_type operator-(D lhs, D rhs)
+        {
+            if constexpr (v2_dtl::distance_to_hook<D>)
+                return access::distance_to(rhs, lhs);
+            else
+                return access::base(lhs) - access::base(rhs);
+        }
+
+        template<typename D2 = D>
+            requires v2_dtl::base_eq<D2> || v2_dtl::iter_minus<D2>
+        friend constexpr bool operator==(D lhs, D rhs)
+        {
+            if constexpr (v2_dtl::base_eq<D>)
+                return access::base(lhs) == access::base(rhs);
+            else
+                return lhs - rhs == difference_type(0);
+        }
+
+        template<typename D2 = D>
+            requires std::derived_from<
+                iterator_concept,
+                std::random_access_iterator_tag> &&
+            v2_dtl::iter_minus<D2>
+        friend constexpr std::strong_ordering operator<=>(D lhs, D rhs)
+        {
+            return lhs - rhs <=> difference_type(0);
+        }
+    };
+
+    /** A template alias useful for defining proxy iterators.  \see
+        `iterator_interface`. */
+    template<
+        typename D,
+        typename IteratorConcept,
+        typename ValueType,
+        typename Reference = ValueType,
+        typename DifferenceType = std::ptrdiff_t>
+    using proxy_iterator_interface = iterator_interface<
+        D,
+        IteratorConcept,
+        ValueType,
+        Reference,
+        proxy_arrow_result<Reference>,
+        DifferenceType>;
+
+}}}
+
+#endif
+
 #ifdef BOOST_STL_INTERFACES_DOXYGEN
 
 /** `static_asserts` that type `type` models concept `concept_name`.  This is
@@ -605,9 +1124,7 @@ namespace boost { namespace stl_interfaces { inline namespace v1 {
 #define BOOST_STL_INTERFACES_STATIC_ASSERT_ITERATOR_TRAITS(                    \
     iter, category, concept, value_type, reference, pointer, difference_type)  \
     static_assert(                                                             \
-        std::is_same<                                                          \
-            typename std::iterator_traits<iter>::iterator_concept,             \
-            concept>::value,                                                   \
+        std::is_same<typename iter::iterator_concept, concept>::value,         \
         "");                                                                   \
     BOOST_STL_INTERFACES_STATIC_ASSERT_ITERATOR_TRAITS_IMPL(                   \
         iter, category, value_type, reference, pointer, difference_type)
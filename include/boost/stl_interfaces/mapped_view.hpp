@@ -0,0 +1,424 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_MAPPED_VIEW_HPP
+#define BOOST_STL_INTERFACES_MAPPED_VIEW_HPP
+
+#include <boost/stl_interfaces/iterator_interface.hpp>
+#include <boost/stl_interfaces/view_interface.hpp>
+
+#include <boost/assert.hpp>
+
+#include <cerrno>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+#if defined(_WIN32)
+// <windows.h> is included without its min() and max() macros, which would
+// break user code that calls std::min() or std::max(), and without the
+// parts that this header does not need.  Each macro that is defined here
+// is undefined afterward, so that a later #include <windows.h> in user
+// code gets what it asks for.
+#if !defined(WIN32_LEAN_AND_MEAN)
+#define WIN32_LEAN_AND_MEAN
+#define BOOST_STL_INTERFACES_DEFINED_WIN32_LEAN_AND_MEAN
+#endif
+#if !defined(NOMINMAX)
+#define NOMINMAX
+#define BOOST_STL_INTERFACES_DEFINED_NOMINMAX
+#endif
+#include <windows.h>
+#if defined(BOOST_STL_INTERFACES_DEFINED_WIN32_LEAN_AND_MEAN)
+#undef WIN32_LEAN_AND_MEAN
+#undef BOOST_STL_INTERFACES_DEFINED_WIN32_LEAN_AND_MEAN
+#endif
+#if defined(BOOST_STL_INTERFACES_DEFINED_NOMINMAX)
+#undef NOMINMAX
+#undef BOOST_STL_INTERFACES_DEFINED_NOMINMAX
+#endif
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+namespace boost { namespace stl_interfaces { inline namespace v1 {
+
+    /** The access patterns that may be passed to `mapped_file::advise()`.
+        Each is a hint to the operating system about how the mapped pages
+        will be read, and has no effect on the contents of any view. */
+    enum class access_pattern { normal, sequential, random, will_need };
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    namespace v1_dtl {
+        struct file_mapping
+        {
+            explicit file_mapping(char const * path)
+            {
+#if defined(_WIN32)
+                HANDLE const file = ::CreateFileA(
+                    path,
+                    GENERIC_READ,
+                    FILE_SHARE_READ,
+                    nullptr,
+                    OPEN_EXISTING,
+                    FILE_ATTRIBUTE_NORMAL,
+                    nullptr);
+                if (file == INVALID_HANDLE_VALUE)
+                    throw_last_error("CreateFileA");
+                LARGE_INTEGER size;
+                if (!::GetFileSizeEx(file, &size)) {
+                    auto const error = ::GetLastError();
+                    ::CloseHandle(file);
+                    throw_error(int(error), "GetFileSizeEx");
+                }
+                if (size.QuadPart) {
+                    HANDLE const mapping = ::CreateFileMappingA(
+                        file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                    if (!mapping) {
+                        auto const error = ::GetLastError();
+                        ::CloseHandle(file);
+                        throw_error(int(error), "CreateFileMappingA");
+                    }
+                    data_ = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                    auto const error = ::GetLastError();
+                    ::CloseHandle(mapping);
+                    if (!data_) {
+                        ::CloseHandle(file);
+                        throw_error(int(error), "MapViewOfFile");
+                    }
+                    size_ = std::size_t(size.QuadPart);
+                }
+                ::CloseHandle(file);
+#else
+                int const fd = ::open(path, O_RDONLY);
+                if (fd < 0)
+                    throw_error(errno, "open");
+                struct stat st;
+                if (::fstat(fd, &st) != 0) {
+                    int const error = errno;
+                    ::close(fd);
+                    throw_error(error, "fstat");
+                }
+                if (st.st_size) {
+                    void * const data = ::mmap(
+                        nullptr,
+                        std::size_t(st.st_size),
+                        PROT_READ,
+                        MAP_PRIVATE,
+                        fd,
+                        0);
+                    if (data == MAP_FAILED) {
+                        int const error = errno;
+                        ::close(fd);
+                        throw_error(error, "mmap");
+                    }
+                    data_ = data;
+                    size_ = std::size_t(st.st_size);
+                }
+                // The mapping keeps the file alive without the descriptor.
+                ::close(fd);
+#endif
+            }
+
+            file_mapping(file_mapping const &) = delete;
+            file_mapping & operator=(file_mapping const &) = delete;
+
+            ~file_mapping()
+            {
+                if (!data_)
+                    return;
+#if defined(_WIN32)
+                ::UnmapViewOfFile(data_);
+#else
+                ::munmap(data_, size_);
+#endif
+            }
+
+            void advise(access_pattern pattern) const noexcept
+            {
+#if defined(_WIN32)
+                (void)pattern;
+#else
+                if (!data_)
+                    return;
+                int advice = POSIX_MADV_NORMAL;
+                switch (pattern) {
+                case access_pattern::normal: break;
+                case access_pattern::sequential:
+                    advice = POSIX_MADV_SEQUENTIAL;
+                    break;
+                case access_pattern::random: advice = POSIX_MADV_RANDOM; break;
+                case access_pattern::will_need:
+                    advice = POSIX_MADV_WILLNEED;
+                    break;
+                }
+                // This is only a hint, so a failure is not an error.
+                ::posix_madvise(data_, size_, advice);
+#endif
+            }
+
+            void * data_ = nullptr;
+            std::size_t size_ = 0;
+
+        private:
+            [[noreturn]] static void throw_error(int error, char const * what)
+            {
+#if defined(_WIN32)
+                throw std::system_error(error, std::system_category(), what);
+#else
+                throw std::system_error(error, std::generic_category(), what);
+#endif
+            }
+#if defined(_WIN32)
+            [[noreturn]] static void throw_last_error(char const * what)
+            {
+                throw_error(int(::GetLastError()), what);
+            }
+#endif
+        };
+    }
+#endif
+
+    /** A read-only memory mapping of an entire file.
+
+        Copies of a `mapped_file` share one mapping, which is unmapped when
+        the last copy is destroyed; copying is therefore cheap, and the views
+        below hold a `mapped_file` to keep their elements alive.  A mapping
+        of an empty file has a null `data()`. */
+    struct mapped_file
+    {
+        /** Constructs an object that maps nothing. */
+        mapped_file() noexcept = default;
+
+        /** Maps the file at `path`, then applies `advise(pattern)`.
+
+            \throw std::system_error if the file cannot be opened or
+            mapped. */
+        explicit mapped_file(
+            char const * path,
+            access_pattern pattern = access_pattern::normal) :
+            mapping_(std::make_shared<v1_dtl::file_mapping const>(path))
+        {
+            if (pattern != access_pattern::normal)
+                advise(pattern);
+        }
+
+        /** Maps the file at `path`, then applies `advise(pattern)`.
+
+            \throw std::system_error if the file cannot be opened or
+            mapped. */
+        explicit mapped_file(
+            std::string const & path,
+            access_pattern pattern = access_pattern::normal) :
+            mapped_file(path.c_str(), pattern)
+        {}
+
+        unsigned char const * data() const noexcept
+        {
+            return mapping_ ? static_cast<unsigned char const *>(
+                                  mapping_->data_)
+                            : nullptr;
+        }
+        std::size_t size() const noexcept
+        {
+            return mapping_ ? mapping_->size_ : 0;
+        }
+        bool empty() const noexcept { return !size(); }
+
+        /** Tells the operating system how the mapped pages will be read.  On
+            POSIX systems this calls `posix_madvise()` on the whole mapping;
+            elsewhere it does nothing. */
+        void advise(access_pattern pattern) const noexcept
+        {
+            if (mapping_)
+                mapping_->advise(pattern);
+        }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        std::shared_ptr<v1_dtl::file_mapping const> mapping_;
+#endif
+    };
+
+    /** A read-only, contiguous view of the objects of type `T` stored
+        back-to-back in a mapped file, starting at a byte offset.  Nothing is
+        copied; elements are read directly out of the mapping, which the view
+        keeps alive.  Any trailing bytes too few to make up a whole `T` are
+        not part of the view.
+
+        A `mapped_view` may also be constructed over any other read-only
+        region of memory, in which case it does not own it. */
+    template<typename T>
+    struct mapped_view
+        : view_interface<mapped_view<T>, element_layout::contiguous>
+    {
+        static_assert(
+            std::is_trivially_copyable<T>::value,
+            "mapped_view<T> requires that T be trivially copyable.");
+
+        using value_type = T;
+        using iterator = T const *;
+
+        mapped_view() noexcept = default;
+
+        /** Constructs a view of the `T`s in `file`, starting `offset` bytes
+            from the start of the mapping.
+
+            \pre `offset <= file.size()`
+            \pre `offset % alignof(T) == 0` */
+        explicit mapped_view(mapped_file file, std::size_t offset = 0) noexcept
+            :
+            file_(std::move(file))
+        {
+            BOOST_ASSERT(offset <= file_.size());
+            BOOST_ASSERT(offset % alignof(T) == 0);
+            if (file_.empty())
+                return;
+            first_ = reinterpret_cast<T const *>(file_.data() + offset);
+            last_ = first_ + (file_.size() - offset) / sizeof(T);
+        }
+
+        /** Constructs a view of `[first, last)`, which is not owned. */
+        mapped_view(T const * first, T const * last) noexcept :
+            first_(first), last_(last)
+        {}
+
+        iterator begin() const noexcept { return first_; }
+        iterator end() const noexcept { return last_; }
+
+        /** Returns the mapping this view reads from, which has a null
+            `data()` if this view does not own its elements. */
+        mapped_file const & file() const noexcept { return file_; }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        mapped_file file_;
+        T const * first_ = nullptr;
+        T const * last_ = nullptr;
+#endif
+    };
+
+    /** A random access iterator over fixed-size records laid out
+        back-to-back in memory, that yields a `T const &` to the start of
+        each record.  The record size may be larger than `sizeof(T)`, so `T`
+        can describe just the leading fields of each record. */
+    template<typename T>
+    struct record_iterator : iterator_interface<
+                                 record_iterator<T>,
+                                 std::random_access_iterator_tag,
+                                 T,
+                                 T const &>
+    {
+        static_assert(
+            std::is_trivially_copyable<T>::value,
+            "record_iterator<T> requires that T be trivially copyable.");
+
+        constexpr record_iterator() noexcept = default;
+
+        /** \pre `sizeof(T) <= record_size`
+            \pre `record_size % alignof(T) == 0` */
+        constexpr record_iterator(
+            unsigned char const * record, std::ptrdiff_t record_size) noexcept
+            :
+            it_(record), record_size_(record_size)
+        {
+            BOOST_ASSERT(std::ptrdiff_t(sizeof(T)) <= record_size);
+            BOOST_ASSERT(record_size % std::ptrdiff_t(alignof(T)) == 0);
+        }
+
+        /** Returns a pointer to the first byte of the current record. */
+        constexpr unsigned char const * base() const noexcept { return it_; }
+
+        constexpr std::ptrdiff_t record_size() const noexcept
+        {
+            return record_size_;
+        }
+
+        T const & operator*() const noexcept
+        {
+            return *reinterpret_cast<T const *>(it_);
+        }
+        constexpr record_iterator & operator+=(std::ptrdiff_t n) noexcept
+        {
+            it_ += n * record_size_;
+            return *this;
+        }
+        constexpr auto operator-(record_iterator other) const noexcept
+        {
+            BOOST_ASSERT(record_size_ == other.record_size_);
+            return (it_ - other.it_) / record_size_;
+        }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        unsigned char const * it_ = nullptr;
+        std::ptrdiff_t record_size_ = 0;
+#endif
+    };
+
+    /** A read-only view of the fixed-size records in a mapped file, each
+        `record_size` bytes long, starting at a byte offset.  This is the
+        view to use when records carry padding or a variable-length tail that
+        `T` does not describe; when the record size is `sizeof(T)`, prefer
+        `mapped_view<T>`.  Any trailing bytes too few to make up a whole
+        record are not part of the view. */
+    template<typename T>
+    struct record_view : view_interface<record_view<T>>
+    {
+        using value_type = T;
+        using iterator = record_iterator<T>;
+
+        record_view() noexcept = default;
+
+        /** \pre `offset <= file.size()`
+            \pre `offset % alignof(T) == 0`
+            \pre `sizeof(T) <= record_size`
+            \pre `record_size % alignof(T) == 0` */
+        record_view(
+            mapped_file file,
+            std::size_t record_size,
+            std::size_t offset = 0) noexcept :
+            file_(std::move(file))
+        {
+            BOOST_ASSERT(offset <= file_.size());
+            BOOST_ASSERT(offset % alignof(T) == 0);
+            auto const stride = std::ptrdiff_t(record_size);
+            if (file_.empty()) {
+                first_ = last_ = iterator(nullptr, stride);
+                return;
+            }
+            first_ = iterator(file_.data() + offset, stride);
+            last_ = std::next(
+                first_, std::ptrdiff_t((file_.size() - offset) / record_size));
+        }
+
+        iterator begin() const noexcept { return first_; }
+        iterator end() const noexcept { return last_; }
+
+        std::size_t record_size() const noexcept
+        {
+            return std::size_t(first_.record_size());
+        }
+
+        mapped_file const & file() const noexcept { return file_; }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        mapped_file file_;
+        iterator first_;
+        iterator last_;
+#endif
+    };
+
+}}}
+
+#endif
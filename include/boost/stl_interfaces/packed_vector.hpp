@@ -0,0 +1,863 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_PACKED_VECTOR_HPP
+#define BOOST_STL_INTERFACES_PACKED_VECTOR_HPP
+
+#include <boost/stl_interfaces/algorithm.hpp>
+#include <boost/stl_interfaces/checked_iterator.hpp>
+#include <boost/stl_interfaces/detail/bit_ops.hpp>
+#include <boost/stl_interfaces/iterator_interface.hpp>
+#include <boost/stl_interfaces/sequence_container_interface.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace boost { namespace stl_interfaces { inline namespace v1 {
+
+    template<std::size_t Bits, bool Const>
+    struct packed_vector_iterator;
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    namespace v1_dtl {
+        template<std::size_t Bits>
+        using packed_value_t = std::conditional_t<
+            Bits == 1,
+            bool,
+            std::conditional_t<
+                Bits <= 8,
+                std::uint8_t,
+                std::conditional_t<
+                    Bits <= 16,
+                    std::uint16_t,
+                    std::conditional_t<
+                        Bits <= 32,
+                        std::uint32_t,
+                        std::uint64_t>>>>;
+
+        // The bits [first, last) of a word.
+        constexpr bitmap_word
+        bit_range(std::size_t first, std::size_t last) noexcept
+        {
+            return (last == bitmap_word_bits
+                        ? ~bitmap_word(0)
+                        : (bitmap_word(1) << last) - 1) &
+                   ~(first == bitmap_word_bits
+                         ? ~bitmap_word(0)
+                         : (bitmap_word(1) << first) - 1);
+        }
+
+        // Word-at-a-time operations on the Bits-wide fields of a word.
+        template<std::size_t Bits>
+        struct packed_traits
+        {
+            static constexpr std::size_t per_word = bitmap_word_bits / Bits;
+            static constexpr bitmap_word field_mask =
+                ~bitmap_word(0) >> (bitmap_word_bits - Bits);
+            // The lowest bit of every field.
+            static constexpr bitmap_word low_bits =
+                ~bitmap_word(0) / field_mask;
+
+            // A word with x in every field.
+            static constexpr bitmap_word splat(bitmap_word x) noexcept
+            {
+                return low_bits * (x & field_mask);
+            }
+
+            // The lowest bit of every field of x that is zero.
+            static bitmap_word zero_fields(bitmap_word x) noexcept
+            {
+                for (std::size_t shift = 1; shift < Bits; shift <<= 1) {
+                    x |= x >> shift;
+                }
+                return ~x & low_bits;
+            }
+
+            // The fields [first, last) of a word.
+            static constexpr bitmap_word
+            fields(std::size_t first, std::size_t last) noexcept
+            {
+                return v1_dtl::bit_range(first * Bits, last * Bits);
+            }
+
+            // Converts x to the value of a field, returning false if x
+            // compares unequal to every value a field can hold.
+            template<typename T>
+            static bool field_value(T const & x, bitmap_word & value)
+            {
+                using compare_type = std::conditional_t<
+                    std::is_arithmetic<T>::value,
+                    T,
+                    packed_value_t<Bits>>;
+                compare_type const y = x;
+                auto const v = static_cast<packed_value_t<Bits>>(y);
+                value = bitmap_word(v);
+                return compare_type(v) == y && value <= field_mask;
+            }
+        };
+
+        template<std::size_t Bits>
+        constexpr std::size_t packed_traits<Bits>::per_word;
+        template<std::size_t Bits>
+        constexpr bitmap_word packed_traits<Bits>::field_mask;
+        template<std::size_t Bits>
+        constexpr bitmap_word packed_traits<Bits>::low_bits;
+
+        // Calls f(w, mask) for each word w that holds some of the elements
+        // [first, last), where mask selects the bits of those elements,
+        // until f returns true.  Returns true iff f did.
+        template<std::size_t Bits, typename F>
+        bool for_each_packed_word(std::size_t first, std::size_t last, F f)
+        {
+            using traits = packed_traits<Bits>;
+            if (first == last)
+                return false;
+            auto w = first / traits::per_word;
+            auto const last_w = (last - 1) / traits::per_word;
+            auto mask =
+                traits::fields(first % traits::per_word, traits::per_word);
+            for (; w < last_w; ++w) {
+                if (f(w, mask))
+                    return true;
+                mask = ~bitmap_word(0);
+            }
+            mask &= traits::fields(0, (last - 1) % traits::per_word + 1);
+            return f(w, mask);
+        }
+
+        // The n <= 64 bits starting at bit i of words.
+        inline bitmap_word read_bits(
+            bitmap_word const * words, std::size_t i, std::size_t n) noexcept
+        {
+            auto const w = i / bitmap_word_bits;
+            auto const offset = i % bitmap_word_bits;
+            auto x = words[w] >> offset;
+            if (bitmap_word_bits < offset + n)
+                x |= words[w + 1] << (bitmap_word_bits - offset);
+            return x & v1_dtl::bit_range(0, n);
+        }
+
+        // Writes the low n bits of x to the n bits starting at bit i of
+        // words, which must all be in one word.
+        inline void write_bits(
+            bitmap_word * words,
+            std::size_t i,
+            std::size_t n,
+            bitmap_word x) noexcept
+        {
+            auto const offset = i % bitmap_word_bits;
+            auto const mask = v1_dtl::bit_range(offset, offset + n);
+            auto & word = words[i / bitmap_word_bits];
+            word = (word & ~mask) | ((x << offset) & mask);
+        }
+
+        // Copies n bits from bit i of from to bit j of to, a whole
+        // destination word at a time.  As with std::copy(), the ranges may
+        // overlap if j < i.
+        inline void copy_bits(
+            bitmap_word const * from,
+            std::size_t i,
+            bitmap_word * to,
+            std::size_t j,
+            std::size_t n) noexcept
+        {
+            while (n) {
+                auto const k =
+                    (std::min)(n, bitmap_word_bits - j % bitmap_word_bits);
+                v1_dtl::write_bits(to, j, k, v1_dtl::read_bits(from, i, k));
+                i += k;
+                j += k;
+                n -= k;
+            }
+        }
+
+        // Copies the n bits before bit i of from to the n bits before bit j
+        // of to, last word first.  As with std::copy_backward(), the ranges
+        // may overlap if i < j.
+        inline void copy_bits_backward(
+            bitmap_word const * from,
+            std::size_t i,
+            bitmap_word * to,
+            std::size_t j,
+            std::size_t n) noexcept
+        {
+            while (n) {
+                auto const offset = j % bitmap_word_bits;
+                auto const k =
+                    (std::min)(n, offset ? offset : bitmap_word_bits);
+                i -= k;
+                j -= k;
+                n -= k;
+                v1_dtl::write_bits(to, j, k, v1_dtl::read_bits(from, i, k));
+            }
+        }
+
+        struct packed_access
+        {
+            template<std::size_t Bits, bool Const>
+            static auto words(packed_vector_iterator<Bits, Const> it) noexcept
+            {
+                return it.words_;
+            }
+            template<std::size_t Bits, bool Const>
+            static std::size_t
+            index(packed_vector_iterator<Bits, Const> it) noexcept
+            {
+                return std::size_t(it.i_);
+            }
+        };
+    }
+#endif
+
+    /** The proxy reference type of `packed_vector<Bits>`.  It reads and
+        writes one `Bits`-wide field of a word; a value assigned through it
+        is truncated to its low `Bits` bits. */
+    template<std::size_t Bits>
+    struct packed_reference
+    {
+        using value_type = v1_dtl::packed_value_t<Bits>;
+
+        packed_reference(packed_reference const &) = default;
+
+        /** Assigns the value `other` refers to, not the reference. */
+        packed_reference & operator=(packed_reference const & other) noexcept
+        {
+            assign(value_type(other));
+            return *this;
+        }
+        packed_reference const & operator=(value_type x) const noexcept
+        {
+            assign(x);
+            return *this;
+        }
+
+        operator value_type() const noexcept
+        {
+            return value_type(
+                (*word_ >> shift_) & v1_dtl::packed_traits<Bits>::field_mask);
+        }
+
+        friend void swap(packed_reference lhs, packed_reference rhs) noexcept
+        {
+            value_type const x = lhs;
+            lhs = value_type(rhs);
+            rhs = x;
+        }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        template<std::size_t B, bool C>
+        friend struct packed_vector_iterator;
+
+        packed_reference(v1_dtl::bitmap_word * word, std::size_t shift) noexcept
+            :
+            word_(word), shift_(shift)
+        {}
+
+        void assign(value_type x) const noexcept
+        {
+            auto const mask = v1_dtl::packed_traits<Bits>::field_mask << shift_;
+            *word_ = (*word_ & ~mask) |
+                     ((v1_dtl::bitmap_word(x) << shift_) & mask);
+        }
+
+        v1_dtl::bitmap_word * word_;
+        std::size_t shift_;
+#endif
+    };
+
+    /** The random access proxy iterator of `packed_vector<Bits>`.  The
+        iterator's reference type is `packed_reference<Bits>`, and the
+        const iterator's is the value type itself. */
+    template<std::size_t Bits, bool Const>
+    struct packed_vector_iterator
+        : proxy_iterator_interface<
+              packed_vector_iterator<Bits, Const>,
+              std::random_access_iterator_tag,
+              v1_dtl::packed_value_t<Bits>,
+              std::conditional_t<
+                  Const,
+                  v1_dtl::packed_value_t<Bits>,
+                  packed_reference<Bits>>>
+    {
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        using word_pointer = std::conditional_t<
+            Const,
+            v1_dtl::bitmap_word const *,
+            v1_dtl::bitmap_word *>;
+        using traits = v1_dtl::packed_traits<Bits>;
+#endif
+
+    public:
+        using value_type = v1_dtl::packed_value_t<Bits>;
+        using reference = std::
+            conditional_t<Const, value_type, packed_reference<Bits>>;
+
+        constexpr packed_vector_iterator() noexcept : words_(nullptr), i_(0)
+        {}
+        constexpr packed_vector_iterator(
+            word_pointer words, std::ptrdiff_t i) noexcept :
+            words_(words), i_(i)
+        {}
+        template<
+            bool C = Const,
+            typename Enable = std::enable_if_t<C>>
+        constexpr packed_vector_iterator(
+            packed_vector_iterator<Bits, false> other) noexcept :
+            words_(other.words_), i_(other.i_)
+        {}
+
+        reference operator*() const noexcept
+        {
+            auto const i = std::size_t(i_);
+            return make_reference(
+                words_ + i / traits::per_word,
+                i % traits::per_word * Bits,
+                std::integral_constant<bool, Const>{});
+        }
+        constexpr packed_vector_iterator &
+        operator+=(std::ptrdiff_t n) noexcept
+        {
+            i_ += n;
+            return *this;
+        }
+        constexpr std::ptrdiff_t operator-(packed_vector_iterator other) const
+            noexcept
+        {
+            return i_ - other.i_;
+        }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        template<std::size_t B, bool C>
+        friend struct packed_vector_iterator;
+        friend v1_dtl::packed_access;
+
+        static value_type make_reference(
+            word_pointer word, std::size_t shift, std::true_type) noexcept
+        {
+            return value_type((*word >> shift) & traits::field_mask);
+        }
+        static packed_reference<Bits> make_reference(
+            word_pointer word, std::size_t shift, std::false_type) noexcept
+        {
+            return packed_reference<Bits>(word, shift);
+        }
+
+        word_pointer words_;
+        std::ptrdiff_t i_;
+#endif
+    };
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    namespace v1_dtl {
+        // The stl_interfaces::count(), find(), fill(), and copy() algorithm
+        // objects dispatch to these for packed_vector_iterators (see
+        // algorithm_tag in algorithm.hpp).
+
+        // Equivalent to std::count(first, last, x), but compares a whole
+        // word of elements at a time, and counts the matches with a
+        // population count.
+        template<std::size_t Bits, bool Const, typename T>
+        std::ptrdiff_t count_dispatch(
+            algorithm_tag,
+            packed_vector_iterator<Bits, Const> first,
+            packed_vector_iterator<Bits, Const> last,
+            T const & x)
+        {
+            using traits = v1_dtl::packed_traits<Bits>;
+            v1_dtl::bitmap_word value;
+            if (!traits::field_value(x, value))
+                return 0;
+            auto const pattern = traits::splat(value);
+            auto const words = v1_dtl::packed_access::words(first);
+            std::size_t result = 0;
+            v1_dtl::for_each_packed_word<Bits>(
+                v1_dtl::packed_access::index(first),
+                v1_dtl::packed_access::index(last),
+                [&](std::size_t w, v1_dtl::bitmap_word mask) {
+                    result += v1_dtl::popcount(
+                        traits::zero_fields(words[w] ^ pattern) & mask);
+                    return false;
+                });
+            return std::ptrdiff_t(result);
+        }
+
+        // Equivalent to std::find(first, last, x), but compares a whole
+        // word of elements at a time.
+        template<std::size_t Bits, bool Const, typename T>
+        packed_vector_iterator<Bits, Const> find_dispatch(
+            algorithm_tag,
+            packed_vector_iterator<Bits, Const> first,
+            packed_vector_iterator<Bits, Const> last,
+            T const & x)
+        {
+            using traits = v1_dtl::packed_traits<Bits>;
+            v1_dtl::bitmap_word value;
+            if (!traits::field_value(x, value))
+                return last;
+            auto const pattern = traits::splat(value);
+            auto const words = v1_dtl::packed_access::words(first);
+            auto const i = v1_dtl::packed_access::index(first);
+            auto found = v1_dtl::packed_access::index(last);
+            v1_dtl::for_each_packed_word<Bits>(
+                i, found, [&](std::size_t w, v1_dtl::bitmap_word mask) {
+                    auto const matches =
+                        traits::zero_fields(words[w] ^ pattern) & mask;
+                    if (!matches)
+                        return false;
+                    found = w * traits::per_word +
+                            v1_dtl::lowest_bit(matches) / Bits;
+                    return true;
+                });
+            return first + std::ptrdiff_t(found - i);
+        }
+
+        // Equivalent to std::fill(first, last, x), but writes a whole word
+        // of elements at a time.
+        template<std::size_t Bits, typename T>
+        void fill_dispatch(
+            algorithm_tag,
+            packed_vector_iterator<Bits, false> first,
+            packed_vector_iterator<Bits, false> last,
+            T const & x)
+        {
+            using traits = v1_dtl::packed_traits<Bits>;
+            using value_type = v1_dtl::packed_value_t<Bits>;
+            auto const pattern =
+                traits::splat(v1_dtl::bitmap_word(static_cast<value_type>(x)));
+            auto const words = v1_dtl::packed_access::words(first);
+            v1_dtl::for_each_packed_word<Bits>(
+                v1_dtl::packed_access::index(first),
+                v1_dtl::packed_access::index(last),
+                [&](std::size_t w, v1_dtl::bitmap_word mask) {
+                    words[w] = (words[w] & ~mask) | (pattern & mask);
+                    return false;
+                });
+        }
+
+        // Equivalent to std::copy(first, last, out), but copies a whole
+        // destination word of elements at a time, shifting the source words
+        // into place when the two ranges do not start at the same position
+        // within a word.
+        template<std::size_t Bits, bool Const>
+        packed_vector_iterator<Bits, false> copy_dispatch(
+            algorithm_tag,
+            packed_vector_iterator<Bits, Const> first,
+            packed_vector_iterator<Bits, Const> last,
+            packed_vector_iterator<Bits, false> out)
+        {
+            auto const n = last - first;
+            v1_dtl::copy_bits(
+                v1_dtl::packed_access::words(first),
+                v1_dtl::packed_access::index(first) * Bits,
+                v1_dtl::packed_access::words(out),
+                v1_dtl::packed_access::index(out) * Bits,
+                std::size_t(n) * Bits);
+            return out + n;
+        }
+
+        // The checked-mode counterpart of the count() overload above.
+        template<std::size_t Bits, bool Const, typename T>
+        std::ptrdiff_t count_dispatch(
+            algorithm_tag,
+            checked_iterator<packed_vector_iterator<Bits, Const>> first,
+            checked_iterator<packed_vector_iterator<Bits, Const>> last,
+            T const & x)
+        {
+            // Checks that first and last are valid iterators into one
+            // container.
+            (void)(last - first);
+            return stl_interfaces::count(first.base(), last.base(), x);
+        }
+
+        // The checked-mode counterpart of the find() overload above.
+        template<std::size_t Bits, bool Const, typename T>
+        checked_iterator<packed_vector_iterator<Bits, Const>> find_dispatch(
+            algorithm_tag,
+            checked_iterator<packed_vector_iterator<Bits, Const>> first,
+            checked_iterator<packed_vector_iterator<Bits, Const>> last,
+            T const & x)
+        {
+            (void)(last - first);
+            return first +
+                   (stl_interfaces::find(first.base(), last.base(), x) -
+                    first.base());
+        }
+
+        // The checked-mode counterpart of the fill() overload above.
+        template<std::size_t Bits, typename T>
+        void fill_dispatch(
+            algorithm_tag,
+            checked_iterator<packed_vector_iterator<Bits, false>> first,
+            checked_iterator<packed_vector_iterator<Bits, false>> last,
+            T const & x)
+        {
+            (void)(last - first);
+            stl_interfaces::fill(first.base(), last.base(), x);
+        }
+
+        // The checked-mode counterpart of the copy() overload above.
+        template<std::size_t Bits, bool Const>
+        checked_iterator<packed_vector_iterator<Bits, false>> copy_dispatch(
+            algorithm_tag,
+            checked_iterator<packed_vector_iterator<Bits, Const>> first,
+            checked_iterator<packed_vector_iterator<Bits, Const>> last,
+            checked_iterator<packed_vector_iterator<Bits, false>> out)
+        {
+            auto const result = out + (last - first);
+            stl_interfaces::copy(first.base(), last.base(), out.base());
+            return result;
+        }
+    }
+#endif
+
+    /** A `std::vector<bool>`-like sequence container of unsigned integers
+        `Bits` bits wide, packed into 64-bit words; `packed_vector<1>` is a
+        dynamic bitset.  `Bits` must be a power of two no greater than 64,
+        so that no element straddles two words.  The value type is `bool`
+        when `Bits` is 1, and otherwise the smallest unsigned integer type
+        that holds `Bits` bits.
+
+        Its iterators are proxy iterators (see `packed_vector_iterator`).
+        The `count`, `find`, `fill`, and `copy` algorithms in algorithm.hpp
+        work on a word of elements at a time for them, as do `insert()`,
+        `erase()`, and `resize()`; call them as
+        `boost::stl_interfaces::count()` and so on, since the `std`
+        algorithms go one element at a time.
+
+        As with `std::vector`, reallocation invalidates every iterator, and
+        inserting or erasing invalidates the iterators at and after the
+        point of the change; in checked mode (see
+        `BOOST_STL_INTERFACES_CHECKED`), every insert or erase other than at
+        the back invalidates all iterators.  `packed_vector` reports its
+        inserts, erases, element moves, and reallocations to
+        `statistics_policy_t<packed_vector>`. */
+    template<std::size_t Bits>
+    struct packed_vector : sequence_container_interface<packed_vector<Bits>>
+    {
+        static_assert(
+            0 < Bits && Bits <= 64 && 64 % Bits == 0,
+            "packed_vector<Bits> requires that Bits be a power of two no "
+            "greater than 64.");
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        using raw_iterator = packed_vector_iterator<Bits, false>;
+        using raw_const_iterator = packed_vector_iterator<Bits, true>;
+        using traits = v1_dtl::packed_traits<Bits>;
+        using word = v1_dtl::bitmap_word;
+#endif
+
+    public:
+        using value_type = v1_dtl::packed_value_t<Bits>;
+        using reference = packed_reference<Bits>;
+        using const_reference = value_type;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using iterator = checked_iterator_t<raw_iterator>;
+        using const_iterator = checked_iterator_t<raw_const_iterator>;
+        using reverse_iterator = stl_interfaces::reverse_iterator<iterator>;
+        using const_reverse_iterator =
+            stl_interfaces::reverse_iterator<const_iterator>;
+
+        packed_vector() noexcept : size_(0) {}
+        explicit packed_vector(size_type n) : packed_vector() { resize(n); }
+        packed_vector(size_type n, value_type x) : packed_vector()
+        {
+            resize(n, x);
+        }
+        template<
+            typename InputIterator,
+            typename Enable = std::enable_if_t<
+                v1_dtl::in_iter<InputIterator>::value>>
+        packed_vector(InputIterator first, InputIterator last) :
+            packed_vector()
+        {
+            insert(end(), first, last);
+        }
+        packed_vector(std::initializer_list<value_type> il) :
+            packed_vector(il.begin(), il.end())
+        {}
+        packed_vector(packed_vector const & other) :
+            words_(other.words_), size_(other.size_)
+        {}
+        packed_vector(packed_vector && other) noexcept :
+            words_(std::move(other.words_)), size_(other.size_)
+        {
+            other.words_.clear();
+            other.size_ = 0;
+        }
+        packed_vector & operator=(packed_vector const & other)
+        {
+            if (&other != this) {
+                words_ = other.words_;
+                size_ = other.size_;
+                this->invalidate_iterators();
+            }
+            return *this;
+        }
+        packed_vector & operator=(packed_vector && other) noexcept
+        {
+            if (&other != this) {
+                words_ = std::move(other.words_);
+                size_ = other.size_;
+                other.words_.clear();
+                other.size_ = 0;
+                this->invalidate_iterators();
+                other.invalidate_iterators();
+            }
+            return *this;
+        }
+
+        iterator begin() noexcept { return this->make_iterator(raw(0)); }
+        iterator end() noexcept { return this->make_iterator(raw(size_)); }
+
+        size_type size() const noexcept { return size_; }
+        size_type max_size() const noexcept
+        {
+            auto const words = words_.max_size();
+            auto const limit =
+                size_type((std::numeric_limits<difference_type>::max)());
+            return words < limit / traits::per_word ? words * traits::per_word
+                                                    : limit;
+        }
+        size_type capacity() const noexcept
+        {
+            return words_.capacity() * traits::per_word;
+        }
+
+        void reserve(size_type n)
+        {
+            auto const data = words_.data();
+            words_.reserve(word_count(n));
+            note_reallocation(data);
+        }
+        void shrink_to_fit()
+        {
+            auto const data = words_.data();
+            words_.shrink_to_fit();
+            note_reallocation(data);
+        }
+
+        void resize(size_type sz) { resize(sz, value_type()); }
+        void resize(size_type sz, value_type x)
+        {
+            if (sz < size_) {
+                erase(begin() + difference_type(sz), end());
+                return;
+            }
+            auto const old_size = size_;
+            grow(sz - size_);
+            // The new elements are already zero.
+            if (x)
+                stl_interfaces::fill(raw(old_size), raw(size_), x);
+        }
+
+        template<typename... Args>
+        reference emplace_back(Args &&... args)
+        {
+            value_type const x(std::forward<Args>(args)...);
+            grow(1);
+            auto const result = *raw(size_ - 1);
+            result = x;
+            return result;
+        }
+        template<typename... Args>
+        iterator emplace(const_iterator pos, Args &&... args)
+        {
+            auto const index = index_of(pos);
+            value_type const x(std::forward<Args>(args)...);
+            grow(1);
+            if (index != size_ - 1) {
+                v1_dtl::copy_bits_backward(
+                    words_.data(),
+                    (size_ - 1) * Bits,
+                    words_.data(),
+                    size_ * Bits,
+                    (size_ - 1 - index) * Bits);
+                this->invalidate_iterators();
+                this->statistics().move(size_ - 1 - index);
+            }
+            *raw(index) = x;
+            return this->make_iterator(raw(index));
+        }
+        template<
+            typename InputIterator,
+            typename Enable = std::enable_if_t<
+                v1_dtl::in_iter<InputIterator>::value>>
+        iterator
+        insert(const_iterator pos, InputIterator first, InputIterator last)
+        {
+            auto const index = index_of(pos);
+            auto const old_size = size_;
+            try {
+                for (; first != last; ++first) {
+                    emplace_back(*first);
+                }
+                if (index != old_size)
+                    rotate_to(index, old_size);
+            } catch (...) {
+                shrink_to(old_size);
+                throw;
+            }
+            return this->make_iterator(raw(index));
+        }
+        iterator erase(const_iterator f, const_iterator l)
+        {
+            auto const first = index_of(f);
+            auto const last = index_of(l);
+            if (first == last)
+                return this->make_iterator(raw(first));
+            auto const n = last - first;
+            if (last != size_) {
+                v1_dtl::copy_bits(
+                    words_.data(),
+                    last * Bits,
+                    words_.data(),
+                    first * Bits,
+                    (size_ - last) * Bits);
+                this->statistics().move(size_ - last);
+            }
+            shrink_to(size_ - n);
+            this->invalidate_iterators();
+            this->statistics().erase(n);
+            return this->make_iterator(raw(first));
+        }
+
+        void swap(packed_vector & other) noexcept
+        {
+            words_.swap(other.words_);
+            std::swap(size_, other.size_);
+            this->invalidate_iterators();
+            other.invalidate_iterators();
+        }
+
+        friend void swap(packed_vector & lhs, packed_vector & rhs) noexcept
+        {
+            lhs.swap(rhs);
+        }
+
+        /** Compares a word at a time, instead of an element at a time. */
+        friend bool
+        operator==(packed_vector const & lhs, packed_vector const & rhs)
+        {
+            return lhs.size_ == rhs.size_ && lhs.words_ == rhs.words_;
+        }
+        friend bool
+        operator!=(packed_vector const & lhs, packed_vector const & rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+        using base_type = sequence_container_interface<packed_vector<Bits>>;
+        using base_type::begin;
+        using base_type::end;
+        using base_type::insert;
+        using base_type::erase;
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        raw_iterator raw(size_type i) noexcept
+        {
+            return raw_iterator(words_.data(), difference_type(i));
+        }
+
+        size_type index_of(const_iterator it)
+        {
+            return size_type(it - const_iterator(begin()));
+        }
+
+        static size_type word_count(size_type n) noexcept
+        {
+            return (n + traits::per_word - 1) / traits::per_word;
+        }
+
+        void note_reallocation(word const * old_data) noexcept
+        {
+            if (words_.data() != old_data) {
+                this->invalidate_iterators();
+                this->statistics().reallocate();
+            }
+        }
+
+        // Appends n zero elements.
+        void grow(size_type n)
+        {
+            if (max_size() - size_ < n)
+                throw std::length_error("packed_vector grew past max_size()");
+            auto const data = words_.data();
+            words_.resize(word_count(size_ + n));
+            note_reallocation(data);
+            size_ += n;
+            this->statistics().insert(n);
+            this->statistics().grow_to(size_);
+        }
+
+        // Removes the elements at and after index sz, keeping the unused
+        // bits of the last word zero, so that operator==() can compare
+        // whole words.
+        void shrink_to(size_type sz) noexcept
+        {
+            size_ = sz;
+            words_.resize(word_count(sz));
+            if (sz % traits::per_word)
+                words_.back() &= traits::fields(0, sz % traits::per_word);
+        }
+
+        // Moves the elements [old_size, size_) to index, and the elements
+        // [index, old_size) after them.
+        void rotate_to(size_type index, size_type old_size)
+        {
+            auto const moved = old_size - index;
+            std::vector<word> tmp(word_count(moved));
+            v1_dtl::copy_bits(
+                words_.data(), index * Bits, tmp.data(), 0, moved * Bits);
+            v1_dtl::copy_bits(
+                words_.data(),
+                old_size * Bits,
+                words_.data(),
+                index * Bits,
+                (size_ - old_size) * Bits);
+            v1_dtl::copy_bits(
+                tmp.data(),
+                0,
+                words_.data(),
+                (index + size_ - old_size) * Bits,
+                moved * Bits);
+            this->invalidate_iterators();
+            this->statistics().move(moved);
+        }
+
+        std::vector<word> words_;
+        size_type size_;
+#endif
+    };
+
+}}}
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+
+namespace std {
+    template<std::size_t Bits>
+    struct hash<boost::stl_interfaces::packed_vector<Bits>>
+        : boost::stl_interfaces::container_hash<
+              boost::stl_interfaces::packed_vector<Bits>>
+    {
+    };
+}
+
+#endif
+
+#endif
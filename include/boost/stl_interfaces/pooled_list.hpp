@@ -0,0 +1,522 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_POOLED_LIST_HPP
+#define BOOST_STL_INTERFACES_POOLED_LIST_HPP
+
+#include <boost/stl_interfaces/intrusive_list.hpp>
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace boost { namespace stl_interfaces { inline namespace v1 {
+
+    /** A pool of uninitialized storage for objects of type `T`, handed out
+        one object at a time.  The storage is carved out of blocks that
+        double in size as the pool grows, and deallocated storage goes on a
+        free list for the next allocation, so that once a pool has grown to
+        its working size, allocating and deallocating no longer call
+        `operator new` or `operator delete`.  The blocks are freed when the
+        pool is destroyed. */
+    template<typename T>
+    struct node_pool
+    {
+        using value_type = T;
+        using size_type = std::size_t;
+
+        node_pool() noexcept :
+            free_(nullptr), next_(nullptr), end_(nullptr), capacity_(0)
+        {}
+        node_pool(node_pool const &) = delete;
+        node_pool & operator=(node_pool const &) = delete;
+
+        /** Returns storage for one `T`. */
+        T * allocate()
+        {
+            if (free_) {
+                auto const s = free_;
+                free_ = s->next;
+                return reinterpret_cast<T *>(s);
+            }
+            if (next_ == end_)
+                add_block(capacity_ ? capacity_ : 16);
+            return reinterpret_cast<T *>(next_++);
+        }
+        /** Returns `p` to the pool.
+
+            \pre `p` came from `allocate()`, and holds no object. */
+        void deallocate(T * p) noexcept
+        {
+            auto const s = reinterpret_cast<slot *>(p);
+            s->next = free_;
+            free_ = s;
+        }
+
+        /** Returns the number of `T`s the pool has storage for, allocated or
+            not. */
+        size_type capacity() const noexcept { return capacity_; }
+        /** Grows the pool to have storage for at least `n` `T`s. */
+        void reserve(size_type n)
+        {
+            if (capacity_ < n)
+                add_block(n - capacity_);
+        }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        union slot
+        {
+            slot * next;
+            alignas(T) unsigned char bytes[sizeof(T)];
+        };
+
+        void add_block(size_type n)
+        {
+            blocks_.reserve(blocks_.size() + 1);
+            std::unique_ptr<slot[]> block(new slot[n]);
+            // The rest of the current block is kept on the free list.
+            for (; next_ != end_; ++next_) {
+                deallocate(reinterpret_cast<T *>(next_));
+            }
+            next_ = block.get();
+            end_ = next_ + n;
+            blocks_.push_back(std::move(block));
+            capacity_ += n;
+        }
+
+        std::vector<std::unique_ptr<slot[]>> blocks_;
+        slot * free_;
+        slot * next_;
+        slot * end_;
+        size_type capacity_;
+#endif
+    };
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    namespace v1_dtl {
+        template<typename T>
+        struct pooled_list_node : list_hook<>
+        {
+            template<typename... Args>
+            explicit pooled_list_node(Args &&... args) :
+                value(std::forward<Args>(args)...)
+            {}
+
+            T value;
+        };
+    }
+#endif
+
+    /** The bidirectional iterator of `pooled_list<std::remove_const_t<T>>`.
+        It adapts the iterator `intrusive_list` uses for the list's nodes,
+        which prefetches as it goes. */
+    template<typename T>
+    struct pooled_list_iterator : iterator_interface<
+                                      pooled_list_iterator<T>,
+                                      std::bidirectional_iterator_tag,
+                                      std::remove_const_t<T>,
+                                      T &>
+    {
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        using node = v1_dtl::pooled_list_node<std::remove_const_t<T>>;
+        using node_iterator = intrusive_list_iterator<
+            std::conditional_t<std::is_const<T>::value, node const, node>>;
+#endif
+
+    public:
+        constexpr pooled_list_iterator() noexcept : it_() {}
+        constexpr explicit pooled_list_iterator(node_iterator it) noexcept :
+            it_(it)
+        {}
+        template<
+            typename U,
+            typename Enable =
+                std::enable_if_t<std::is_convertible<U *, T *>::value>>
+        constexpr pooled_list_iterator(
+            pooled_list_iterator<U> other) noexcept :
+            it_(other.it_)
+        {}
+
+        constexpr T & operator*() const noexcept { return (*it_).value; }
+        pooled_list_iterator & operator++() noexcept
+        {
+            ++it_;
+            return *this;
+        }
+        pooled_list_iterator & operator--() noexcept
+        {
+            --it_;
+            return *this;
+        }
+
+        friend BOOST_STL_INTERFACES_HIDDEN_FRIEND_CONSTEXPR bool operator==(
+            pooled_list_iterator lhs, pooled_list_iterator rhs) noexcept
+        {
+            return lhs.it_ == rhs.it_;
+        }
+
+        using base_type = iterator_interface<
+            pooled_list_iterator<T>,
+            std::bidirectional_iterator_tag,
+            std::remove_const_t<T>,
+            T &>;
+        using base_type::operator++;
+        using base_type::operator--;
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        template<typename U>
+        friend struct pooled_list_iterator;
+        template<typename U>
+        friend struct pooled_list;
+
+        node_iterator it_;
+#endif
+    };
+
+    /** A doubly-linked list whose nodes come from a `node_pool`, so that
+        inserting and erasing do not call `operator new` or `operator
+        delete` once the pool has grown to its working size.
+
+        By default each list gets its own pool, created on its first
+        insertion.  Lists constructed from the same `pool_type` share it,
+        and splicing between lists that share a pool relinks nodes in
+        constant time, as with `std::list`; splicing between lists with
+        different pools moves the elements instead.  A shared pool must
+        outlive the lists that use it.  A copy uses the same pool as its
+        source if that pool is shared.  Move assignment and `swap()`
+        exchange pools along with the elements, and copy assignment keeps
+        the destination's pool.
+
+        Inserting never invalidates iterators, and erasing only invalidates
+        those to the erased elements.  As with `intrusive_list`, the
+        iterators are not `checked_iterator`s, even in checked mode (see
+        `BOOST_STL_INTERFACES_CHECKED`).
+
+        `pooled_list` reports its inserts and erases to
+        `statistics_policy_t<pooled_list>`, and reports a reallocation
+        whenever its pool grows. */
+    template<typename T>
+    struct pooled_list : sequence_container_interface<pooled_list<T>>
+    {
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        using node = v1_dtl::pooled_list_node<T>;
+        using hook_type = list_hook<>;
+        using raw_iterator = pooled_list_iterator<T>;
+        using raw_const_iterator = pooled_list_iterator<T const>;
+#endif
+
+    public:
+        using value_type = T;
+        using pointer = T *;
+        using const_pointer = T const *;
+        using reference = value_type &;
+        using const_reference = value_type const &;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using iterator = raw_iterator;
+        using const_iterator = raw_const_iterator;
+        using reverse_iterator = stl_interfaces::reverse_iterator<iterator>;
+        using const_reverse_iterator =
+            stl_interfaces::reverse_iterator<const_iterator>;
+        /** The type of pool the nodes come from. */
+        using pool_type = node_pool<v1_dtl::pooled_list_node<T>>;
+
+        pooled_list() noexcept : pool_(nullptr), size_(0)
+        {
+            root_.make_root();
+        }
+        /** Constructs an empty list whose nodes come from `pool`. */
+        explicit pooled_list(pool_type & pool) noexcept :
+            pool_(&pool), size_(0)
+        {
+            root_.make_root();
+        }
+        explicit pooled_list(size_type n) : pooled_list() { resize(n); }
+        pooled_list(size_type n, T const & x) : pooled_list() { resize(n, x); }
+        template<
+            typename InputIterator,
+            typename Enable = std::enable_if_t<
+                v1_dtl::in_iter<InputIterator>::value>>
+        pooled_list(InputIterator first, InputIterator last) : pooled_list()
+        {
+            insert(end(), first, last);
+        }
+        pooled_list(std::initializer_list<T> il) :
+            pooled_list(il.begin(), il.end())
+        {}
+        pooled_list(pooled_list const & other) : pooled_list()
+        {
+            if (!other.own_pool_)
+                pool_ = other.pool_;
+            insert(end(), other.begin(), other.end());
+        }
+        pooled_list(pooled_list && other) noexcept : pooled_list()
+        {
+            steal(other);
+        }
+        pooled_list & operator=(pooled_list const & other)
+        {
+            if (&other == this)
+                return *this;
+            auto it = begin();
+            auto other_it = other.begin();
+            for (; it != end() && other_it != other.end();
+                 ++it, ++other_it) {
+                *it = *other_it;
+            }
+            if (other_it == other.end())
+                erase(it, end());
+            else
+                insert(end(), other_it, other.end());
+            return *this;
+        }
+        pooled_list & operator=(pooled_list && other) noexcept
+        {
+            if (&other != this) {
+                this->clear();
+                own_pool_.reset();
+                pool_ = nullptr;
+                steal(other);
+            }
+            return *this;
+        }
+        ~pooled_list()
+        {
+            this->clear();
+            root_.prev_ = nullptr;
+            root_.next_ = nullptr;
+        }
+
+        iterator begin() noexcept { return make(root_.next_); }
+        iterator end() noexcept { return make(&root_); }
+
+        size_type size() const noexcept { return size_; }
+        size_type max_size() const noexcept
+        {
+            return std::numeric_limits<difference_type>::max() / sizeof(node);
+        }
+
+        void resize(size_type sz)
+        {
+            while (sz < size_) {
+                erase(std::prev(end()));
+            }
+            while (size_ < sz) {
+                emplace_back();
+            }
+        }
+        void resize(size_type sz, T const & x)
+        {
+            while (sz < size_) {
+                erase(std::prev(end()));
+            }
+            while (size_ < sz) {
+                emplace_back(x);
+            }
+        }
+
+        template<typename... Args>
+        reference emplace_front(Args &&... args)
+        {
+            return *emplace(begin(), std::forward<Args>(args)...);
+        }
+        template<typename... Args>
+        reference emplace_back(Args &&... args)
+        {
+            return *emplace(end(), std::forward<Args>(args)...);
+        }
+        template<typename... Args>
+        iterator emplace(const_iterator pos, Args &&... args)
+        {
+            auto & nodes = pool();
+            auto const capacity = nodes.capacity();
+            node * const n = nodes.allocate();
+            try {
+                ::new (static_cast<void *>(n))
+                    node(std::forward<Args>(args)...);
+            } catch (...) {
+                nodes.deallocate(n);
+                throw;
+            }
+            if (nodes.capacity() != capacity)
+                this->statistics().reallocate();
+            hook_type * const hook = n;
+            hook->link_before(node_of(pos));
+            ++size_;
+            this->statistics().insert(1);
+            this->statistics().grow_to(size_);
+            return make(hook);
+        }
+        template<
+            typename InputIterator,
+            typename Enable = std::enable_if_t<
+                v1_dtl::in_iter<InputIterator>::value>>
+        iterator
+        insert(const_iterator pos, InputIterator first, InputIterator last)
+        {
+            // The new elements go into a list that shares the pool, so that
+            // *this is unchanged if one of them throws, and are then spliced
+            // in.
+            pooled_list tmp(pool());
+            for (; first != last; ++first) {
+                tmp.emplace_back(*first);
+            }
+            auto const result = tmp.root_.next_;
+            auto const n = tmp.size_;
+            hook_type::splice(node_of(pos), tmp.root_.next_, &tmp.root_);
+            size_ += n;
+            tmp.size_ = 0;
+            return make(result == &tmp.root_ ? node_of(pos) : result);
+        }
+
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            auto hook = node_of(first);
+            auto const last_hook = node_of(last);
+            size_type n = 0;
+            while (hook != last_hook) {
+                auto const next = hook->next_;
+                destroy(hook);
+                hook = next;
+                ++n;
+            }
+            size_ -= n;
+            this->statistics().erase(n);
+            return make(last_hook);
+        }
+
+        /** Moves every element of `other` to just before `pos`.  This takes
+            constant time if `*this` and `other` share a pool. */
+        void splice(const_iterator pos, pooled_list & other)
+        {
+            splice(pos, other, other.begin(), other.end());
+        }
+        void splice(const_iterator pos, pooled_list && other)
+        {
+            splice(pos, other);
+        }
+        /** Moves the element of `other` at `it` to just before `pos`.  This
+            takes constant time if `*this` and `other` share a pool. */
+        void splice(const_iterator pos, pooled_list & other, const_iterator it)
+        {
+            splice(pos, other, it, std::next(it));
+        }
+        /** Moves the elements of `other` in `[first, last)` to just before
+            `pos`.  If `*this` and `other` share a pool, this takes constant
+            time when `other` is `*this`, and time linear in the number of
+            elements moved otherwise, for counting them.
+
+            \pre `pos` is not in `[first, last)`. */
+        void splice(
+            const_iterator pos,
+            pooled_list & other,
+            const_iterator first,
+            const_iterator last)
+        {
+            if (!pool_ && !other.own_pool_ && !size_)
+                pool_ = other.pool_;
+            auto const first_hook = other.node_of(first);
+            auto const last_hook = other.node_of(last);
+            if (pool_ != other.pool_) {
+                insert(
+                    pos,
+                    std::make_move_iterator(other.make(first_hook)),
+                    std::make_move_iterator(other.make(last_hook)));
+                other.erase(first, last);
+                return;
+            }
+            if (&other != this) {
+                size_type n = 0;
+                for (auto hook = first_hook; hook != last_hook;
+                     hook = hook->next_) {
+                    ++n;
+                }
+                other.size_ -= n;
+                size_ += n;
+            }
+            hook_type::splice(node_of(pos), first_hook, last_hook);
+        }
+
+        void swap(pooled_list & other) noexcept
+        {
+            if (&other == this)
+                return;
+            pooled_list tmp(std::move(other));
+            other = std::move(*this);
+            *this = std::move(tmp);
+        }
+
+        friend void swap(pooled_list & lhs, pooled_list & rhs) noexcept
+        {
+            lhs.swap(rhs);
+        }
+
+        using base_type = sequence_container_interface<pooled_list<T>>;
+        using base_type::begin;
+        using base_type::end;
+        using base_type::insert;
+        using base_type::erase;
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        pool_type & pool()
+        {
+            if (!pool_) {
+                own_pool_.reset(new pool_type);
+                pool_ = own_pool_.get();
+            }
+            return *pool_;
+        }
+
+        static iterator make(hook_type * hook) noexcept
+        {
+            using node_iterator = intrusive_list_iterator<node>;
+            return iterator(node_iterator(hook));
+        }
+
+        static hook_type * node_of(const_iterator it) noexcept
+        {
+            return const_cast<hook_type *>(it.it_.node_);
+        }
+
+        void destroy(hook_type * hook) noexcept
+        {
+            hook->unlink();
+            auto const n = static_cast<node *>(hook);
+            n->~node();
+            pool_->deallocate(n);
+        }
+
+        void steal(pooled_list & other) noexcept
+        {
+            own_pool_ = std::move(other.own_pool_);
+            pool_ = other.pool_;
+            root_.take_root(other.root_);
+            size_ = other.size_;
+            other.pool_ = nullptr;
+            other.size_ = 0;
+        }
+
+        std::unique_ptr<pool_type> own_pool_;
+        pool_type * pool_;
+        hook_type root_;
+        size_type size_;
+#endif
+    };
+
+}}}
+
+#endif
@@ -12,6 +12,39 @@
 namespace boost { namespace stl_interfaces { inline namespace v1 {
 
     namespace v1_dtl {
+        // This is roughly ITER_CONCEPT() from the C++20 standard.
+        template<typename BidiIter, typename = void>
+        struct iter_concept
+        {
+            using type =
+                typename std::iterator_traits<BidiIter>::iterator_category;
+        };
+        template<typename BidiIter>
+        struct iter_concept<
+            BidiIter,
+            void_t<typename BidiIter::iterator_concept>>
+        {
+            using type = typename BidiIter::iterator_concept;
+        };
+#if 201703L < __cplusplus && defined(__cpp_lib_ranges)
+        template<typename T>
+        struct iter_concept<T *>
+        {
+            using type = std::contiguous_iterator_tag;
+        };
+#endif
+        template<typename BidiIter>
+        using iter_concept_t = typename iter_concept<BidiIter>::type;
+
+        // The reverse of a contiguous sequence is not contiguous, so the
+        // strongest concept a reverse_iterator can have is random access.
+        template<typename BidiIter>
+        using reverse_iter_concept_t = std::conditional_t<
+            std::is_base_of<contiguous_iterator_tag, iter_concept_t<BidiIter>>::
+                value,
+            std::random_access_iterator_tag,
+            iter_concept_t<BidiIter>>;
+
         template<typename Iter>
         constexpr auto ce_dist(Iter f, Iter l, std::random_access_iterator_tag)
             -> decltype(l - f)
@@ -28,6 +61,34 @@ namespace boost { namespace stl_interfaces { inline namespace v1 {
             }
             return retval;
         }
+        template<typename Iter>
+        constexpr auto ce_dist_impl(Iter f, Iter l, std::false_type) noexcept(
+            noexcept(v1_dtl::ce_dist(
+                f,
+                l,
+                typename std::iterator_traits<Iter>::iterator_category{})))
+            -> decltype(v1_dtl::ce_dist(
+                f, l, typename std::iterator_traits<Iter>::iterator_category{}))
+        {
+            return v1_dtl::ce_dist(
+                f, l, typename std::iterator_traits<Iter>::iterator_category{});
+        }
+        template<typename Iter>
+        constexpr auto ce_dist_impl(Iter f, Iter l, std::true_type) noexcept(
+            noexcept(access::distance_to(f, l)))
+            -> decltype(access::distance_to(f, l))
+        {
+            return access::distance_to(f, l);
+        }
+        // Uses Iter's distance_to() hook if it has one, and otherwise steps
+        // from f to l unless Iter is random access.
+        template<typename Iter>
+        constexpr auto ce_dist(Iter f, Iter l) noexcept(
+            noexcept(v1_dtl::ce_dist_impl(f, l, distance_to_hook<Iter>{})))
+            -> decltype(v1_dtl::ce_dist_impl(f, l, distance_to_hook<Iter>{}))
+        {
+            return v1_dtl::ce_dist_impl(f, l, distance_to_hook<Iter>{});
+        }
 
         template<typename Iter>
         constexpr Iter ce_prev(Iter it)
@@ -54,6 +115,26 @@ namespace boost { namespace stl_interfaces { inline namespace v1 {
                 }
             }
         }
+        template<typename Iter, typename Offset>
+        constexpr void ce_adv_impl(Iter & f, Offset n, std::false_type)
+        {
+            v1_dtl::ce_adv(
+                f, n, typename std::iterator_traits<Iter>::iterator_category{});
+        }
+        template<typename Iter, typename Offset>
+        constexpr void ce_adv_impl(Iter & f, Offset n, std::true_type) noexcept(
+            noexcept(access::advance(f, n)))
+        {
+            access::advance(f, n);
+        }
+        // Uses Iter's advance() hook if it has one, and otherwise steps n
+        // times unless Iter is random access.
+        template<typename Iter, typename Offset>
+        constexpr void ce_adv(Iter & f, Offset n) noexcept(
+            noexcept(v1_dtl::ce_adv_impl(f, n, advance_hook<Iter, Offset>{})))
+        {
+            v1_dtl::ce_adv_impl(f, n, advance_hook<Iter, Offset>{});
+        }
     }
 
     /** This type is very similar to the C++20 version of
@@ -63,11 +144,7 @@ namespace boost { namespace stl_interfaces { inline namespace v1 {
     struct reverse_iterator
         : iterator_interface<
               reverse_iterator<BidiIter>,
-#if 201703L < __cplusplus && defined(__cpp_lib_ranges)
-              typename std::iterator_traits<BidiIter>::iterator_concept,
-#else
-              typename std::iterator_traits<BidiIter>::iterator_category,
-#endif
+              v1_dtl::reverse_iter_concept_t<BidiIter>,
               typename std::iterator_traits<BidiIter>::value_type,
               typename std::iterator_traits<BidiIter>::reference,
               typename std::iterator_traits<BidiIter>::pointer,
@@ -87,15 +164,9 @@ namespace boost { namespace stl_interfaces { inline namespace v1 {
 
         friend BOOST_STL_INTERFACES_HIDDEN_FRIEND_CONSTEXPR auto
         operator-(reverse_iterator lhs, reverse_iterator rhs) noexcept(
-            noexcept(v1_dtl::ce_dist(
-                lhs.it_,
-                rhs.it_,
-                typename std::iterator_traits<BidiIter>::iterator_category{})))
-        {
-            return -v1_dtl::ce_dist(
-                rhs.it_,
-                lhs.it_,
-                typename std::iterator_traits<BidiIter>::iterator_category{});
+            noexcept(v1_dtl::ce_dist(lhs.it_, rhs.it_)))
+        {
+            return -v1_dtl::ce_dist(rhs.it_, lhs.it_);
         }
 
         constexpr typename std::iterator_traits<BidiIter>::reference
@@ -109,16 +180,9 @@ namespace boost { namespace stl_interfaces { inline namespace v1 {
             typename std::iterator_traits<BidiIter>::difference_type
                 n) noexcept(noexcept(v1_dtl::
                                          ce_adv(
-                                             std::declval<BidiIter &>(),
-                                             -n,
-                                             typename std::iterator_traits<
-                                                 BidiIter>::
-                                                 iterator_category{})))
+                                             std::declval<BidiIter &>(), -n)))
         {
-            v1_dtl::ce_adv(
-                it_,
-                -n,
-                typename std::iterator_traits<BidiIter>::iterator_category{});
+            v1_dtl::ce_adv(it_, -n);
             return *this;
         }
 
@@ -0,0 +1,381 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_RING_BUFFER_HPP
+#define BOOST_STL_INTERFACES_RING_BUFFER_HPP
+
+#include <boost/stl_interfaces/checked_iterator.hpp>
+#include <boost/stl_interfaces/iterator_interface.hpp>
+#include <boost/stl_interfaces/sequence_container_interface.hpp>
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+
+namespace boost { namespace stl_interfaces { inline namespace v1 {
+
+    /** The random access iterator of `ring_buffer<std::remove_const_t<T>,
+        N>`.  It refers to an element by its position relative to the first
+        element, and wraps around the end of the storage when dereferenced.
+    */
+    template<typename T, std::size_t N>
+    struct ring_buffer_iterator
+        : iterator_interface<
+              ring_buffer_iterator<T, N>,
+              std::random_access_iterator_tag,
+              std::remove_const_t<T>,
+              T &>
+    {
+        constexpr ring_buffer_iterator() noexcept :
+            data_(nullptr), head_(0), index_(0)
+        {}
+        constexpr ring_buffer_iterator(
+            T * data, std::size_t head, std::ptrdiff_t index) noexcept :
+            data_(data), head_(head), index_(index)
+        {}
+        template<
+            typename U,
+            typename Enable =
+                std::enable_if_t<std::is_convertible<U *, T *>::value>>
+        constexpr ring_buffer_iterator(
+            ring_buffer_iterator<U, N> other) noexcept :
+            data_(other.data_), head_(other.head_), index_(other.index_)
+        {}
+
+        constexpr T & operator*() const noexcept
+        {
+            auto i = head_ + std::size_t(index_);
+            if (N <= i)
+                i -= N;
+            return data_[i];
+        }
+        constexpr ring_buffer_iterator & operator+=(std::ptrdiff_t n) noexcept
+        {
+            index_ += n;
+            return *this;
+        }
+        constexpr std::ptrdiff_t operator-(ring_buffer_iterator other) const
+            noexcept
+        {
+            return index_ - other.index_;
+        }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        template<typename U, std::size_t M>
+        friend struct ring_buffer_iterator;
+
+        T * data_;
+        std::size_t head_;
+        std::ptrdiff_t index_;
+#endif
+    };
+
+    /** A sequence container that stores up to `N` elements within the
+        object itself, in a circular buffer, so that inserting or erasing at
+        either end is constant time and never moves the other elements.
+
+        Inserting past `N` elements throws `std::length_error`.  Inserting
+        or erasing anywhere but the back invalidates iterators, though, as
+        with `std::deque`, inserting or erasing at the front leaves
+        references to the other elements valid.  In checked mode (see
+        `BOOST_STL_INTERFACES_CHECKED`), every erase invalidates iterators.
+
+        `ring_buffer` reports its inserts, erases, and element moves to
+        `statistics_policy_t<ring_buffer>`. */
+    template<typename T, std::size_t N>
+    struct ring_buffer : sequence_container_interface<ring_buffer<T, N>>
+    {
+        static_assert(0 < N, "ring_buffer requires a nonzero capacity.");
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        using raw_iterator = ring_buffer_iterator<T, N>;
+        using raw_const_iterator = ring_buffer_iterator<T const, N>;
+#endif
+
+    public:
+        using value_type = T;
+        using pointer = T *;
+        using const_pointer = T const *;
+        using reference = value_type &;
+        using const_reference = value_type const &;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using iterator = checked_iterator_t<raw_iterator>;
+        using const_iterator = checked_iterator_t<raw_const_iterator>;
+        using reverse_iterator = stl_interfaces::reverse_iterator<iterator>;
+        using const_reverse_iterator =
+            stl_interfaces::reverse_iterator<const_iterator>;
+
+        ring_buffer() noexcept : head_(0), size_(0) {}
+        explicit ring_buffer(size_type n) : ring_buffer() { resize(n); }
+        ring_buffer(size_type n, T const & x) : ring_buffer() { resize(n, x); }
+        template<
+            typename InputIterator,
+            typename Enable = std::enable_if_t<
+                v1_dtl::in_iter<InputIterator>::value>>
+        ring_buffer(InputIterator first, InputIterator last) : ring_buffer()
+        {
+            insert(end(), first, last);
+        }
+        ring_buffer(std::initializer_list<T> il) :
+            ring_buffer(il.begin(), il.end())
+        {}
+        ring_buffer(ring_buffer const & other) :
+            ring_buffer(other.begin(), other.end())
+        {}
+        ring_buffer(ring_buffer && other) noexcept(
+            std::is_nothrow_move_constructible<T>::value) :
+            ring_buffer()
+        {
+            steal(other);
+        }
+        ring_buffer & operator=(ring_buffer const & other)
+        {
+            if (&other != this)
+                this->assign(other.begin(), other.end());
+            return *this;
+        }
+        ring_buffer & operator=(ring_buffer && other) noexcept(
+            std::is_nothrow_move_constructible<T>::value)
+        {
+            if (&other != this) {
+                this->clear();
+                steal(other);
+            }
+            return *this;
+        }
+        ~ring_buffer() { this->clear(); }
+
+        iterator begin() noexcept { return this->make_iterator(raw(0)); }
+        iterator end() noexcept { return this->make_iterator(raw(size_)); }
+
+        size_type size() const noexcept { return size_; }
+        size_type max_size() const noexcept { return N; }
+        size_type capacity() const noexcept { return N; }
+        /** Returns true iff the buffer holds `N` elements. */
+        bool full() const noexcept { return size_ == N; }
+
+        void resize(size_type sz)
+        {
+            if (sz < size_) {
+                erase(begin() + sz, end());
+                return;
+            }
+            require_room(sz - size_);
+            while (size_ < sz) {
+                emplace_back();
+            }
+        }
+        void resize(size_type sz, T const & x)
+        {
+            if (sz < size_) {
+                erase(begin() + sz, end());
+                return;
+            }
+            require_room(sz - size_);
+            while (size_ < sz) {
+                emplace_back(x);
+            }
+        }
+
+        template<typename... Args>
+        reference emplace_back(Args &&... args)
+        {
+            require_room(1);
+            T * const p = slot(size_);
+            ::new (static_cast<void *>(p)) T(std::forward<Args>(args)...);
+            ++size_;
+            note_inserted(1);
+            return *p;
+        }
+        template<typename... Args>
+        reference emplace_front(Args &&... args)
+        {
+            require_room(1);
+            auto const head = head_ ? head_ - 1 : N - 1;
+            T * const p = storage() + head;
+            ::new (static_cast<void *>(p)) T(std::forward<Args>(args)...);
+            head_ = head;
+            ++size_;
+            this->invalidate_iterators();
+            note_inserted(1);
+            return *p;
+        }
+        template<typename... Args>
+        iterator emplace(const_iterator pos, Args &&... args)
+        {
+            auto const index = index_of(pos);
+            if (index == size_) {
+                emplace_back(std::forward<Args>(args)...);
+                return this->make_iterator(raw(index));
+            }
+            if (index == 0) {
+                emplace_front(std::forward<Args>(args)...);
+                return this->make_iterator(raw(0));
+            }
+            // args may refer to an element of *this, so the new element is
+            // constructed before anything is shifted.
+            T x(std::forward<Args>(args)...);
+            auto const old_size = size_;
+            emplace_back(std::move(*slot(old_size - 1)));
+            std::move_backward(
+                raw(index), raw(old_size - 1), raw(old_size));
+            *slot(index) = std::move(x);
+            this->invalidate_iterators();
+            this->statistics().move(old_size - index);
+            return this->make_iterator(raw(index));
+        }
+        template<
+            typename InputIterator,
+            typename Enable = std::enable_if_t<
+                v1_dtl::in_iter<InputIterator>::value>>
+        iterator
+        insert(const_iterator pos, InputIterator first, InputIterator last)
+        {
+            auto const index = index_of(pos);
+            auto const old_size = size_;
+            try {
+                for (; first != last; ++first) {
+                    emplace_back(*first);
+                }
+            } catch (...) {
+                pop_to(old_size);
+                throw;
+            }
+            if (index != old_size) {
+                std::rotate(raw(index), raw(old_size), raw(size_));
+                this->invalidate_iterators();
+                this->statistics().move(old_size - index);
+            }
+            return this->make_iterator(raw(index));
+        }
+        iterator erase(const_iterator f, const_iterator l)
+        {
+            auto const first = index_of(f);
+            auto const last = index_of(l);
+            if (first == last)
+                return this->make_iterator(raw(first));
+            this->invalidate_iterators();
+            auto const n = last - first;
+            if (first == 0) {
+                for (size_type i = 0; i < n; ++i) {
+                    slot(i)->~T();
+                }
+                head_ += n;
+                if (N <= head_)
+                    head_ -= N;
+                size_ -= n;
+            } else {
+                std::move(raw(last), raw(size_), raw(first));
+                this->statistics().move(size_ - last);
+                pop_to(size_ - n);
+            }
+            this->statistics().erase(n);
+            return this->make_iterator(raw(first));
+        }
+
+        void swap(ring_buffer & other) noexcept(
+            std::is_nothrow_move_constructible<T>::value &&
+            std::is_nothrow_move_assignable<T>::value)
+        {
+            if (&other == this)
+                return;
+            ring_buffer tmp(std::move(other));
+            other = std::move(*this);
+            *this = std::move(tmp);
+        }
+
+        friend void swap(ring_buffer & lhs, ring_buffer & rhs) noexcept(
+            noexcept(lhs.swap(rhs)))
+        {
+            lhs.swap(rhs);
+        }
+
+        using base_type = sequence_container_interface<ring_buffer<T, N>>;
+        using base_type::begin;
+        using base_type::end;
+        using base_type::insert;
+        using base_type::erase;
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        T * storage() noexcept { return reinterpret_cast<T *>(buf_); }
+
+        raw_iterator raw(size_type i) noexcept
+        {
+            return raw_iterator(storage(), head_, difference_type(i));
+        }
+
+        T * slot(size_type i) noexcept
+        {
+            auto p = head_ + i;
+            if (N <= p)
+                p -= N;
+            return storage() + p;
+        }
+
+        size_type index_of(const_iterator it)
+        {
+            return size_type(it - const_iterator(begin()));
+        }
+
+        void require_room(size_type n) const
+        {
+            if (N - size_ < n)
+                throw std::length_error("ring_buffer grew past its capacity");
+        }
+
+        void note_inserted(size_type n) noexcept
+        {
+            this->statistics().insert(n);
+            this->statistics().grow_to(size_);
+        }
+
+        // Destroys the elements at and after index sz.
+        void pop_to(size_type sz) noexcept
+        {
+            while (sz < size_) {
+                slot(size_ - 1)->~T();
+                --size_;
+            }
+        }
+
+        void steal(ring_buffer & other)
+        {
+            for (size_type i = 0; i < other.size_; ++i) {
+                emplace_back(std::move(*other.slot(i)));
+            }
+            other.clear();
+        }
+
+        alignas(T) unsigned char buf_[N * sizeof(T)];
+        size_type head_;
+        size_type size_;
+#endif
+    };
+
+}}}
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+
+namespace std {
+    template<typename T, std::size_t N>
+    struct hash<boost::stl_interfaces::ring_buffer<T, N>>
+        : boost::stl_interfaces::container_hash<
+              boost::stl_interfaces::ring_buffer<T, N>>
+    {
+    };
+}
+
+#endif
+
+#endif
@@ -0,0 +1,113 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_SEGMENTED_ITERATOR_HPP
+#define BOOST_STL_INTERFACES_SEGMENTED_ITERATOR_HPP
+
+#include <boost/stl_interfaces/iterator_interface.hpp>
+
+
+namespace boost { namespace stl_interfaces { inline namespace v1 {
+
+    namespace v1_dtl {
+        template<typename Iterator, typename = void>
+        struct segmented_hooks : std::false_type
+        {
+        };
+        template<typename Iterator>
+        struct segmented_hooks<
+            Iterator,
+            void_t<
+                typename Iterator::segment_iterator,
+                typename Iterator::local_iterator,
+                decltype(access::segment(std::declval<Iterator const &>())),
+                decltype(access::local(std::declval<Iterator const &>())),
+                decltype(access::local_begin<Iterator>(
+                    std::declval<typename Iterator::segment_iterator>())),
+                decltype(access::local_end<Iterator>(
+                    std::declval<typename Iterator::segment_iterator>())),
+                decltype(access::compose<Iterator>(
+                    std::declval<typename Iterator::segment_iterator>(),
+                    std::declval<typename Iterator::local_iterator>()))>>
+            : std::true_type
+        {
+        };
+    }
+
+    /** The segmented iterator traits from Matt Austern's "Segmented
+        Iterators and Hierarchical Algorithms".  An iterator over a
+        segmented data structure (a deque, a rope, a list of chunks) is
+        decomposed into a `segment_iterator`, that iterates over the
+        segments, and a `local_iterator`, that iterates within a single
+        segment.  Algorithms such as `for_each()` in algorithm.hpp use this
+        to run a tight loop within each segment, instead of checking for a
+        segment boundary on every increment.
+
+        `Iterator` is treated as segmented if it has the nested types
+        `segment_iterator` and `local_iterator`, and these members, which
+        may be private if `Iterator` befriends `access`:
+
+        - `segment_iterator segment() const`
+        - `local_iterator local() const`
+        - `static local_iterator local_begin(segment_iterator)`
+        - `static local_iterator local_end(segment_iterator)`
+        - `static Iterator compose(segment_iterator, local_iterator)`
+
+        Otherwise, `segmented_iterator_traits` may be specialized for
+        `Iterator`, with the same static members as below.
+
+        Every iterator into the data structure, including its end iterator,
+        must have a `segment()` for which `local_begin()` and `local_end()`
+        are valid; typically the end iterator is represented as the last
+        segment and its `local_end()`. */
+    template<typename Iterator, typename = void>
+    struct segmented_iterator_traits
+    {
+        using is_segmented_iterator = std::false_type;
+    };
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    template<typename Iterator>
+    struct segmented_iterator_traits<
+        Iterator,
+        std::enable_if_t<v1_dtl::segmented_hooks<Iterator>::value>>
+    {
+        using is_segmented_iterator = std::true_type;
+        using iterator = Iterator;
+        using segment_iterator = typename Iterator::segment_iterator;
+        using local_iterator = typename Iterator::local_iterator;
+
+        static constexpr segment_iterator segment(Iterator it)
+        {
+            return access::segment(it);
+        }
+        static constexpr local_iterator local(Iterator it)
+        {
+            return access::local(it);
+        }
+        static constexpr local_iterator begin(segment_iterator s)
+        {
+            return access::local_begin<Iterator>(s);
+        }
+        static constexpr local_iterator end(segment_iterator s)
+        {
+            return access::local_end<Iterator>(s);
+        }
+        static constexpr Iterator compose(segment_iterator s, local_iterator l)
+        {
+            return access::compose<Iterator>(s, l);
+        }
+    };
+#endif
+
+    /** `std::true_type` if `segmented_iterator_traits<Iterator>` describes
+        a segmented iterator, and `std::false_type` otherwise. */
+    template<typename Iterator>
+    using is_segmented_iterator =
+        typename segmented_iterator_traits<Iterator>::is_segmented_iterator;
+
+}}}
+
+#endif
@@ -6,14 +6,26 @@
 #ifndef BOOST_STL_INTERFACES_CONTAINER_INTERFACE_HPP
 #define BOOST_STL_INTERFACES_CONTAINER_INTERFACE_HPP
 
+#include <boost/stl_interfaces/checked_iterator.hpp>
 #include <boost/stl_interfaces/reverse_iterator.hpp>
+#include <boost/stl_interfaces/statistics.hpp>
 
 #include <boost/assert.hpp>
 #include <boost/config.hpp>
 
 #include <algorithm>
+#include <functional>
 #include <stdexcept>
+#include <climits>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#if 201703L < __cplusplus && defined(__cpp_lib_concepts)
+#include <ranges>
+#endif
+#if defined(__cpp_lib_three_way_comparison)
+#include <compare>
+#endif
 
 
 namespace boost { namespace stl_interfaces { namespace detail {
@@ -108,11 +120,6 @@ namespace boost { namespace stl_interfaces { inline namespace v1 {
     struct sequence_container_interface;
 
     namespace v1_dtl {
-        template<typename Iter>
-        using in_iter = std::is_convertible<
-            typename std::iterator_traits<Iter>::iterator_category,
-            std::input_iterator_tag>;
-
         template<typename D, typename = void>
         struct clear_impl
         {
@@ -126,6 +133,142 @@ namespace boost { namespace stl_interfaces { inline namespace v1 {
 
         template<typename D, element_layout Contiguity>
         void derived_container(sequence_container_interface<D, Contiguity> const &);
+
+        template<typename D, element_layout Contiguity>
+        std::integral_constant<element_layout, Contiguity>
+        container_layout(sequence_container_interface<D, Contiguity> const &);
+
+        template<typename Container>
+        using contiguous_container = std::integral_constant<
+            bool,
+            decltype(v1_dtl::container_layout(
+                std::declval<Container const &>()))::value ==
+                element_layout::contiguous>;
+
+        constexpr bool constant_evaluated() noexcept
+        {
+#if defined(__cpp_lib_is_constant_evaluated)
+            return std::is_constant_evaluated();
+#else
+            return false;
+#endif
+        }
+
+        // Types whose operator== is exactly a comparison of their object
+        // representations.  Floating point types are excluded (0.0 == -0.0,
+        // NaN != NaN), as are class and enumeration types, which may
+        // overload operator==, unless is_bytewise_hashable is specialized
+        // for them.  This is the same trait that hash_value() uses, so that
+        // a container's == and its hash never disagree.
+        template<typename T>
+        using bytewise_equality_comparable = is_bytewise_hashable<T>;
+
+        // Types whose operator< is exactly a lexicographical comparison of
+        // their object representations as unsigned chars.
+        template<typename T>
+        using bytewise_less_than_comparable = std::integral_constant<
+            bool,
+            std::is_same<T, unsigned char>::value ||
+#if defined(__cpp_lib_byte)
+                std::is_same<T, std::byte>::value ||
+#endif
+                (std::is_same<T, char>::value && CHAR_MIN == 0)>;
+
+        template<typename Container, bool Contiguous>
+        struct memcmp_equal_impl : std::false_type
+        {};
+        template<typename Container>
+        struct memcmp_equal_impl<Container, true>
+            : bytewise_equality_comparable<
+                  std::remove_cv_t<typename Container::value_type>>
+        {};
+        template<typename Container>
+        using memcmp_equal = memcmp_equal_impl<
+            Container,
+            contiguous_container<Container>::value>;
+
+        template<typename Container, bool Contiguous>
+        struct memcmp_less_impl : std::false_type
+        {};
+        template<typename Container>
+        struct memcmp_less_impl<Container, true>
+            : bytewise_less_than_comparable<
+                  std::remove_cv_t<typename Container::value_type>>
+        {};
+        template<typename Container>
+        using memcmp_less = memcmp_less_impl<
+            Container,
+            contiguous_container<Container>::value>;
+
+        template<typename Container, typename Iter, bool Contiguous>
+        struct memmove_assignable_impl : std::false_type
+        {};
+        template<typename Container, typename Iter>
+        struct memmove_assignable_impl<Container, Iter, true>
+            : std::integral_constant<
+                  bool,
+                  contiguous_iter<Iter>::value &&
+                      std::is_same<
+                          std::remove_cv_t<typename std::iterator_traits<
+                              Iter>::value_type>,
+                          typename Container::value_type>::value &&
+                      std::is_trivially_copyable<
+                          typename Container::value_type>::value>
+        {};
+        template<typename Container, typename Iter>
+        using memmove_assignable = memmove_assignable_impl<
+            Container,
+            Iter,
+            contiguous_container<Container>::value>;
+
+        template<typename Container>
+        constexpr bool container_equal(
+            Container const & lhs, Container const & rhs, std::false_type)
+        {
+            return lhs.size() == rhs.size() &&
+                   std::equal(lhs.begin(), lhs.end(), rhs.begin());
+        }
+        template<typename Container>
+        constexpr bool container_equal(
+            Container const & lhs, Container const & rhs, std::true_type)
+        {
+            if (v1_dtl::constant_evaluated())
+                return v1_dtl::container_equal(lhs, rhs, std::false_type{});
+            auto const size = lhs.size();
+            if (size != rhs.size())
+                return false;
+            if (!size)
+                return true;
+            return std::memcmp(
+                       lhs.data(),
+                       rhs.data(),
+                       size * sizeof(typename Container::value_type)) == 0;
+        }
+
+        template<typename Container>
+        constexpr bool container_less(
+            Container const & lhs, Container const & rhs, std::false_type)
+        {
+            return std::lexicographical_compare(
+                lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+        }
+        template<typename Container>
+        constexpr bool container_less(
+            Container const & lhs, Container const & rhs, std::true_type)
+        {
+            if (v1_dtl::constant_evaluated())
+                return v1_dtl::container_less(lhs, rhs, std::false_type{});
+            auto const lhs_size = lhs.size();
+            auto const rhs_size = rhs.size();
+            auto const min_size = (std::min)(lhs_size, rhs_size);
+            if (min_size) {
+                int const result =
+                    std::memcmp(lhs.data(), rhs.data(), min_size);
+                if (result)
+                    return result < 0;
+            }
+            return lhs_size < rhs_size;
+        }
     }
 
     template<
@@ -179,9 +322,10 @@ namespace boost { namespace stl_interfaces { inline namespace v1 {
             element_layout C = Contiguity,
             typename Enable = std::enable_if_t<C == element_layout::contiguous>>
         constexpr auto data() noexcept(noexcept(std::declval<D &>().begin()))
-            -> decltype(std::addressof(*std::declval<D &>().begin()))
+            -> decltype(
+                stl_interfaces::to_address(std::declval<D &>().begin()))
         {
-            return std::addressof(*derived().begin());
+            return stl_interfaces::to_address(derived().begin());
         }
         template<
             typename D = Derived,
@@ -189,9 +333,10 @@ namespace boost { namespace stl_interfaces { inline namespace v1 {
             typename Enable = std::enable_if_t<C == element_layout::contiguous>>
         constexpr auto data() const
             noexcept(noexcept(std::declval<D const &>().begin()))
-                -> decltype(std::addressof(*std::declval<D const &>().begin()))
+                -> decltype(stl_interfaces::to_address(
+                    std::declval<D const &>().begin()))
         {
-            return std::addressof(*derived().begin());
+            return stl_interfaces::to_address(derived().begin());
         }
 
         template<typename D = Derived>
@@ -220,16 +365,21 @@ namespace boost { namespace stl_interfaces { inline namespace v1 {
         }
 
         template<typename D = Derived>
-        constexpr auto front() noexcept(noexcept(*std::declval<D &>().begin()))
+        constexpr auto front() BOOST_STL_INTERFACES_CHECKED_NOEXCEPT(
+            noexcept(*std::declval<D &>().begin()))
             -> decltype(*std::declval<D &>().begin())
         {
+            BOOST_STL_INTERFACES_CHECK(
+                !derived().empty(), "front() called on an empty container.");
             return *derived().begin();
         }
         template<typename D = Derived>
-        constexpr auto front() const
-            noexcept(noexcept(*std::declval<D const &>().begin()))
-                -> decltype(*std::declval<D const &>().begin())
+        constexpr auto front() const BOOST_STL_INTERFACES_CHECKED_NOEXCEPT(
+            noexcept(*std::declval<D const &>().begin()))
+            -> decltype(*std::declval<D const &>().begin())
         {
+            BOOST_STL_INTERFACES_CHECK(
+                !derived().empty(), "front() called on an empty container.");
             return *derived().begin();
         }
 
@@ -250,11 +400,15 @@ namespace boost { namespace stl_interfaces { inline namespace v1 {
         }
 
         template<typename D = Derived>
-        constexpr auto pop_front() noexcept -> decltype(
+        constexpr auto pop_front() BOOST_STL_INTERFACES_CHECKED_NOEXCEPT(true)
+            -> decltype(
             std::declval<D &>().emplace_front(
                 std::declval<typename D::value_type &>()),
             (void)std::declval<D &>().erase(std::declval<D &>().begin()))
         {
+            BOOST_STL_INTERFACES_CHECK(
+                !derived().empty(),
+                "pop_front() called on an empty container.");
             derived().erase(derived().begin());
         }
 
@@ -263,10 +417,12 @@ namespace boost { namespace stl_interfaces { inline namespace v1 {
             typename Enable = std::enable_if_t<
                 v1_dtl::decrementable_sentinel<D>::value &&
                 v1_dtl::common_range<D>::value>>
-        constexpr auto
-        back() noexcept(noexcept(*std::prev(std::declval<D &>().end())))
+        constexpr auto back() BOOST_STL_INTERFACES_CHECKED_NOEXCEPT(
+            noexcept(*std::prev(std::declval<D &>().end())))
             -> decltype(*std::prev(std::declval<D &>().end()))
         {
+            BOOST_STL_INTERFACES_CHECK(
+                !derived().empty(), "back() called on an empty container.");
             return *std::prev(derived().end());
         }
         template<
@@ -274,10 +430,12 @@ namespace boost { namespace stl_interfaces { inline namespace v1 {
             typename Enable = std::enable_if_t<
                 v1_dtl::decrementable_sentinel<D>::value &&
                 v1_dtl::common_range<D>::value>>
-        constexpr auto back() const
-            noexcept(noexcept(*std::prev(std::declval<D const &>().end())))
-                -> decltype(*std::prev(std::declval<D const &>().end()))
+        constexpr auto back() const BOOST_STL_INTERFACES_CHECKED_NOEXCEPT(
+            noexcept(*std::prev(std::declval<D const &>().end())))
+            -> decltype(*std::prev(std::declval<D const &>().end()))
         {
+            BOOST_STL_INTERFACES_CHECK(
+                !derived().empty(), "back() called on an empty container.");
             return *std::prev(derived().end());
         }
 
@@ -298,27 +456,36 @@ namespace boost { namespace stl_interfaces { inline namespace v1 {
         }
 
         template<typename D = Derived>
-        constexpr auto pop_back() noexcept -> decltype(
+        constexpr auto pop_back() BOOST_STL_INTERFACES_CHECKED_NOEXCEPT(true)
+            -> decltype(
             std::declval<D &>().emplace_back(
                 std::declval<typename D::value_type &>()),
             (void)std::declval<D &>().erase(
                 std::prev(std::declval<D &>().end())))
         {
+            BOOST_STL_INTERFACES_CHECK(
+                !derived().empty(), "pop_back() called on an empty container.");
             derived().erase(std::prev(derived().end()));
         }
 
         template<typename D = Derived>
-        constexpr auto operator[](typename D::size_type n) noexcept(
-            noexcept(std::declval<D &>().begin()[n]))
+        constexpr auto operator[](typename D::size_type n)
+            BOOST_STL_INTERFACES_CHECKED_NOEXCEPT(
+                noexcept(std::declval<D &>().begin()[n]))
             -> decltype(std::declval<D &>().begin()[n])
         {
+            BOOST_STL_INTERFACES_CHECK(
+                n < derived().size(), "operator[]() index out of range.");
             return derived().begin()[n];
         }
         template<typename D = Derived>
         constexpr auto operator[](typename D::size_type n) const
-            noexcept(noexcept(std::declval<D const &>().begin()[n]))
-                -> decltype(std::declval<D const &>().begin()[n])
+            BOOST_STL_INTERFACES_CHECKED_NOEXCEPT(
+                noexcept(std::declval<D const &>().begin()[n]))
+            -> decltype(std::declval<D const &>().begin()[n])
         {
+            BOOST_STL_INTERFACES_CHECK(
+                n < derived().size(), "operator[]() index out of range.");
             return derived().begin()[n];
         }
 
@@ -327,6 +494,7 @@ namespace boost { namespace stl_interfaces { inline namespace v1 {
             -> decltype(std::declval<D &>().size(), std::declval<D &>()[i])
         {
             if (derived().size() <= i) {
+                statistics().out_of_range();
                 throw std::out_of_range(
                     "Bounds check failed in sequence_container_interface::at()");
             }
@@ -338,6 +506,7 @@ namespace boost { namespace stl_interfaces { inline namespace v1 {
             std::declval<D const &>().size(), std::declval<D const &>()[i])
         {
             if (derived().size() <= i) {
+                statistics().out_of_range();
                 throw std::out_of_range(
                     "Bounds check failed in sequence_container_interface::at()");
             }
@@ -476,6 +645,34 @@ namespace boost { namespace stl_interfaces { inline namespace v1 {
             return derived().insert(pos, il.begin(), il.end());
         }
 
+        template<typename Range, typename D = Derived>
+        constexpr auto insert_range(typename D::const_iterator pos, Range && r)
+            -> decltype(std::declval<D &>().insert(
+                pos, detail::adl_begin(r), detail::adl_end(r)))
+        {
+            return derived().insert(
+                pos, detail::adl_begin(r), detail::adl_end(r));
+        }
+
+        template<typename Range, typename D = Derived>
+        constexpr auto append_range(Range && r)
+            -> decltype((void)std::declval<D &>().insert(
+                std::declval<D &>().end(),
+                detail::adl_begin(r),
+                detail::adl_end(r)))
+        {
+            derived().insert(
+                derived().end(), detail::adl_begin(r), detail::adl_end(r));
+        }
+
+        template<typename Range, typename D = Derived>
+        constexpr auto assign_range(Range && r)
+            -> decltype((void)std::declval<D &>().assign(
+                detail::adl_begin(r), detail::adl_end(r)))
+        {
+            derived().assign(detail::adl_begin(r), detail::adl_end(r));
+        }
+
         template<typename D = Derived>
         constexpr auto erase(typename D::const_iterator pos) noexcept
             -> decltype(std::declval<D &>().erase(pos, std::next(pos)))
@@ -497,15 +694,10 @@ namespace boost { namespace stl_interfaces { inline namespace v1 {
                 (void)std::declval<D &>().insert(
                     std::declval<D &>().begin(), first, last))
         {
-            auto out = derived().begin();
-            auto const out_last = derived().end();
-            for (; out != out_last && first != last; ++first, ++out) {
-                *out = *first;
-            }
-            if (out != out_last)
-                derived().erase(out, out_last);
-            if (first != last)
-                derived().insert(derived().end(), first, last);
+            assign_impl(
+                first,
+                last,
+                v1_dtl::memmove_assignable<D, InputIterator>{});
         }
 
         template<typename D = Derived>
@@ -574,10 +766,202 @@ namespace boost { namespace stl_interfaces { inline namespace v1 {
         {
             derived().erase(derived().begin(), derived().end());
         }
+
+    protected:
+        /** Returns `it`, or in checked mode (see
+            `BOOST_STL_INTERFACES_CHECKED`) a `checked_iterator` that remains
+            valid until the next call to `invalidate_iterators()`.  A derived
+            container whose iterators are `checked_iterator_t<T *>` creates
+            them with this. */
+        template<typename Iter>
+        constexpr checked_iterator_t<Iter> make_iterator(Iter it) const noexcept
+        {
+#if defined(BOOST_STL_INTERFACES_CHECKED)
+            return checked_iterator<Iter>(it, generation_);
+#else
+            return it;
+#endif
+        }
+        /** Invalidates every iterator that `make_iterator()` has returned.
+            Does nothing outside of checked mode. */
+        constexpr void invalidate_iterators() noexcept
+        {
+#if defined(BOOST_STL_INTERFACES_CHECKED)
+            generation_.invalidate();
+#endif
+        }
+
+        /** Returns the statistics policy of `Derived` (see
+            `statistics_policy`).  A derived container reports its inserts,
+            erases, element moves, reallocations, and growth to it, as in
+            `this->statistics().insert(n)`. */
+        template<typename D = Derived>
+        static constexpr statistics_policy_t<D> statistics() noexcept
+        {
+            return statistics_policy_t<D>();
+        }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        template<typename InputIterator>
+        constexpr void
+        assign_impl(InputIterator first, InputIterator last, std::false_type)
+        {
+            auto out = derived().begin();
+            auto const out_last = derived().end();
+            for (; out != out_last && first != last; ++first, ++out) {
+                *out = *first;
+            }
+            if (out != out_last)
+                derived().erase(out, out_last);
+            if (first != last)
+                derived().insert(derived().end(), first, last);
+        }
+        // The source is contiguous and the elements are trivially copyable,
+        // so the overwritten prefix can be copied in one memmove.  memmove
+        // rather than memcpy, since the source may be part of *this.
+        template<typename ContiguousIterator>
+        constexpr void assign_impl(
+            ContiguousIterator first, ContiguousIterator last, std::true_type)
+        {
+            if (v1_dtl::constant_evaluated()) {
+                assign_impl(first, last, std::false_type{});
+                return;
+            }
+            using size_type = typename Derived::size_type;
+            auto const n = size_type(last - first);
+            auto const size = size_type(derived().size());
+            auto const min_size = (std::min)(n, size);
+            if (min_size) {
+                std::memmove(
+                    derived().data(),
+                    stl_interfaces::to_address(first),
+                    min_size * sizeof(typename Derived::value_type));
+            }
+            if (min_size < size)
+                derived().erase(derived().begin() + min_size, derived().end());
+            else if (min_size < n)
+                derived().insert(derived().end(), first + min_size, last);
+        }
+
+#if defined(BOOST_STL_INTERFACES_CHECKED)
+        iterator_generation generation_;
+#endif
+#endif
     };
 
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    namespace v1_dtl {
+        template<typename T>
+        using trivially_relocatable =
+            std::integral_constant<bool, is_trivially_relocatable<T>::value>;
+
+        template<typename T>
+        using nothrow_relocatable = std::integral_constant<
+            bool,
+            is_trivially_relocatable<T>::value ||
+                std::is_nothrow_move_constructible<T>::value>;
+
+        template<typename T>
+        T * uninitialized_relocate_impl(
+            T * first, T * last, T * out, std::true_type) noexcept
+        {
+            auto const n = last - first;
+            if (n) {
+                std::memmove(
+                    static_cast<void *>(out),
+                    static_cast<void const *>(first),
+                    n * sizeof(T));
+            }
+            return out + n;
+        }
+        template<typename T>
+        T * uninitialized_relocate_impl(
+            T * first,
+            T * last,
+            T * out,
+            std::false_type) noexcept(nothrow_relocatable<T>::value)
+        {
+            if (out == first)
+                return last;
+            for (; first != last; ++first, ++out) {
+                ::new (static_cast<void *>(out)) T(std::move(*first));
+                first->~T();
+            }
+            return out;
+        }
+
+        template<typename T>
+        T * uninitialized_relocate_backward_impl(
+            T * first, T * last, T * out_last, std::true_type) noexcept
+        {
+            auto const out_first = out_last - (last - first);
+            v1_dtl::uninitialized_relocate_impl(
+                first, last, out_first, std::true_type{});
+            return out_first;
+        }
+        template<typename T>
+        T * uninitialized_relocate_backward_impl(
+            T * first,
+            T * last,
+            T * out_last,
+            std::false_type) noexcept(nothrow_relocatable<T>::value)
+        {
+            if (out_last == last)
+                return first;
+            while (first != last) {
+                --last;
+                --out_last;
+                ::new (static_cast<void *>(out_last)) T(std::move(*last));
+                last->~T();
+            }
+            return out_last;
+        }
+    }
+#endif
+
+    /** Relocates the objects in `[first, last)` into the storage starting at
+        `out`: each object in the new location is move constructed from the
+        corresponding source object, which is then destroyed.  Returns the
+        end of the output range.
+
+        The output range must not contain objects whose lifetimes have not
+        ended.  It may overlap `[first, last)` only if `out <= first`.
+
+        If `is_trivially_relocatable<T>::value` is true, this is a single
+        `memmove()`. */
+    template<typename T>
+    T * uninitialized_relocate(T * first, T * last, T * out) noexcept(
+        v1_dtl::nothrow_relocatable<T>::value)
+    {
+        return v1_dtl::uninitialized_relocate_impl(
+            first, last, out, v1_dtl::trivially_relocatable<T>{});
+    }
+
+    /** Like `uninitialized_relocate()`, except that the objects are
+        relocated into the storage ending at `out_last`, last-to-first.
+        Returns the beginning of the output range.
+
+        The output range may overlap `[first, last)` only if `last <=
+        out_last`. */
+    template<typename T>
+    T * uninitialized_relocate_backward(
+        T * first,
+        T * last,
+        T * out_last) noexcept(v1_dtl::nothrow_relocatable<T>::value)
+    {
+        return v1_dtl::uninitialized_relocate_backward_impl(
+            first, last, out_last, v1_dtl::trivially_relocatable<T>{});
+    }
+
     /** Implementation of free function `swap()` for all containers derived
-        from `sequence_container_interface`.  */
+        from `sequence_container_interface`.
+
+        When a container's template arguments can come from namespace `std`
+        (an allocator, say), an unqualified `swap()` call finds both this and
+        `std::swap()`, and is ambiguous.  Such a container should also
+        declare a non-template friend `swap()` taking two references to
+        itself, which is preferred over both. */
     template<typename ContainerInterface>
     constexpr auto swap(
         ContainerInterface & lhs,
@@ -600,8 +984,8 @@ namespace boost { namespace stl_interfaces { inline namespace v1 {
             *lhs.begin() == *rhs.begin(),
             true)
     {
-        return lhs.size() == rhs.size() &&
-               std::equal(lhs.begin(), lhs.end(), rhs.begin());
+        return v1_dtl::container_equal(
+            lhs, rhs, v1_dtl::memcmp_equal<ContainerInterface>{});
     }
 
     /** Implementation of `operator!=()` for all containers derived from
@@ -625,17 +1009,8 @@ namespace boost { namespace stl_interfaces { inline namespace v1 {
         -> decltype(
             v1_dtl::derived_container(lhs), *lhs.begin() < *rhs.begin(), true)
     {
-        auto it1 = lhs.begin();
-        auto const last1 = lhs.end();
-        auto it2 = rhs.begin();
-        auto const last2 = rhs.end();
-        for (; it1 != last1 && it2 != last2; ++it1, ++it2) {
-            if (*it1 < *it2)
-                return true;
-            if (*it2 < *it1)
-                return false;
-        }
-        return it1 == last1 && it2 != last2;
+        return v1_dtl::container_less(
+            lhs, rhs, v1_dtl::memcmp_less<ContainerInterface>{});
     }
 
     /** Implementation of `operator<=()` for all containers derived from
@@ -671,6 +1046,754 @@ namespace boost { namespace stl_interfaces { inline namespace v1 {
         return !(lhs < rhs);
     }
 
+#if defined(__cpp_lib_three_way_comparison) ||                                 \
+    defined(BOOST_STL_INTERFACES_DOXYGEN)
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    namespace v1_dtl {
+        template<typename Container>
+        constexpr auto container_three_way(
+            Container const & lhs, Container const & rhs, std::false_type)
+        {
+            return std::lexicographical_compare_three_way(
+                lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+        }
+        template<typename Container>
+        constexpr std::strong_ordering container_three_way(
+            Container const & lhs, Container const & rhs, std::true_type)
+        {
+            if (v1_dtl::constant_evaluated()) {
+                return v1_dtl::container_three_way(
+                    lhs, rhs, std::false_type{});
+            }
+            auto const lhs_size = lhs.size();
+            auto const rhs_size = rhs.size();
+            auto const min_size = (std::min)(lhs_size, rhs_size);
+            if (min_size) {
+                int const result =
+                    std::memcmp(lhs.data(), rhs.data(), min_size);
+                if (result)
+                    return result <=> 0;
+            }
+            return lhs_size <=> rhs_size;
+        }
+    }
+#endif
+
+    /** Implementation of `operator<=>()` for all containers derived from
+        `sequence_container_interface`, whose elements have an
+        `operator<=>()`.  A single pass over the elements decides all four
+        of `<`, `<=`, `>`, and `>=`. */
+    template<typename ContainerInterface>
+    constexpr auto operator<=>(
+        ContainerInterface const & lhs,
+        ContainerInterface const &
+            rhs) noexcept(noexcept(*lhs.begin() <=> *rhs.begin()))
+        -> decltype(
+            v1_dtl::derived_container(lhs), *lhs.begin() <=> *rhs.begin())
+    {
+        return v1_dtl::container_three_way(
+            lhs, rhs, v1_dtl::memcmp_less<ContainerInterface>{});
+    }
+
+#endif
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    namespace v1_dtl {
+        inline std::size_t hash_combine(std::size_t seed, std::size_t h)
+        {
+            return seed ^ (h + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+        }
+
+        // MurmurHash64A, a word at a time.
+        inline std::size_t hash_bytes(void const * p, std::size_t n)
+        {
+            std::uint64_t const m = 0xc6a4a7935bd1e995;
+            int const r = 47;
+            auto bytes = static_cast<unsigned char const *>(p);
+            std::uint64_t h = 0x8445d61a4e774912 ^ (n * m);
+            for (; 8 <= n; bytes += 8, n -= 8) {
+                std::uint64_t k;
+                std::memcpy(&k, bytes, 8);
+                k *= m;
+                k ^= k >> r;
+                k *= m;
+                h ^= k;
+                h *= m;
+            }
+            if (n) {
+                std::uint64_t k = 0;
+                std::memcpy(&k, bytes, n);
+                h ^= k;
+                h *= m;
+            }
+            h ^= h >> r;
+            h *= m;
+            h ^= h >> r;
+            return static_cast<std::size_t>(h);
+        }
+
+        template<typename Container, bool Contiguous>
+        struct bytewise_hash_impl : std::false_type
+        {};
+        template<typename Container>
+        struct bytewise_hash_impl<Container, true>
+            : is_bytewise_hashable<
+                  std::remove_cv_t<typename Container::value_type>>
+        {};
+        template<typename Container>
+        using bytewise_hash = bytewise_hash_impl<
+            Container,
+            contiguous_container<Container>::value>;
+
+        template<typename Container>
+        using element_hash =
+            std::hash<std::remove_cv_t<typename Container::value_type>>;
+
+        template<typename Container>
+        auto hash_elements(Container const & c, std::false_type)
+            -> decltype(element_hash<Container>{}(*c.begin()), std::size_t())
+        {
+            element_hash<Container> const hash{};
+            std::size_t result = c.size();
+            for (auto && x : c) {
+                result = v1_dtl::hash_combine(result, hash(x));
+            }
+            return result;
+        }
+        template<typename Container>
+        std::size_t hash_elements(Container const & c, std::true_type)
+        {
+            return v1_dtl::hash_bytes(
+                c.data(), c.size() * sizeof(typename Container::value_type));
+        }
+    }
+#endif
+
+    /** Implementation of `hash_value()` for all containers derived from
+        `sequence_container_interface`.  Since it is found by ADL,
+        `boost::hash` uses it, and `container_hash` may be used to
+        specialize `std::hash`.
+
+        The elements of a contiguous container are hashed as a single block
+        of bytes when `is_bytewise_hashable<value_type>::value` is true.
+        Otherwise, the elements' `std::hash` hashes are combined one at a
+        time. */
+    template<typename ContainerInterface>
+    auto hash_value(ContainerInterface const & c) -> decltype(
+        v1_dtl::derived_container(c),
+        v1_dtl::hash_elements(
+            c, v1_dtl::bytewise_hash<ContainerInterface>{}))
+    {
+        return v1_dtl::hash_elements(
+            c, v1_dtl::bytewise_hash<ContainerInterface>{});
+    }
+
+    /** A hash function object for `Container`, which calls
+        `hash_value()`.  A container built on `sequence_container_interface`
+        may be made usable as the key of `std::unordered_map` and its
+        relatives by deriving the specialization of `std::hash` for it from
+        `container_hash`. */
+    template<typename Container>
+    struct container_hash
+    {
+        template<typename C = Container>
+        auto operator()(C const & c) const -> decltype(hash_value(c))
+        {
+            return hash_value(c);
+        }
+    };
+
+}}}
+
+#if 201703L < __cplusplus && defined(__cpp_lib_concepts) ||                    \
+    defined(BOOST_STL_INTERFACES_DOXYGEN)
+
+namespace boost { namespace stl_interfaces { namespace v2 {
+
+    namespace v2_dtl {
+        template<typename D>
+        concept contiguous_container = std::contiguous_iterator<
+            std::ranges::iterator_t<D>> && std::ranges::common_range<D>;
+
+        // The elements of c, as a subrange of pointers when c is contiguous,
+        // so that the std::ranges algorithms can use their memmove() and
+        // memcmp() paths for any contiguous container, not just for ones
+        // whose iterators are pointers.
+        template<typename D>
+        constexpr auto elements(D & c)
+        {
+            if constexpr (contiguous_container<D>) {
+                return std::ranges::subrange(
+                    std::to_address(c.begin()), std::to_address(c.end()));
+            } else {
+                return std::ranges::subrange(c.begin(), c.end());
+            }
+        }
+
+        template<typename D>
+        concept bytewise_hashable = contiguous_container<D const> &&
+            v1::is_bytewise_hashable<std::ranges::range_value_t<D>>::value;
+
+        template<typename T>
+        concept synth_three_way_comparable = requires(T const & t) {
+            {t < t} -> std::convertible_to<bool>;
+        };
+
+        // synth-three-way, from [expos.only.func].
+        struct synth_three_way
+        {
+            template<typename T>
+            constexpr auto operator()(T const & lhs, T const & rhs) const
+            {
+                if constexpr (std::three_way_comparable<T>) {
+                    return lhs <=> rhs;
+                } else {
+                    if (lhs < rhs)
+                        return std::weak_ordering::less;
+                    if (rhs < lhs)
+                        return std::weak_ordering::greater;
+                    return std::weak_ordering::equivalent;
+                }
+            }
+        };
+    }
+
+    /** A CRTP template that one may derive from to make it easier to define
+        container types.
+
+        This is the C++20 version of `v1::sequence_container_interface`, with
+        the same requirements on `D` and the same members.  It has no
+        `element_layout` parameter: `data()` is provided whenever the
+        iterators of `D` model `std::contiguous_iterator`.  The members and
+        operators forward to the `std::ranges` algorithms, over pointers when
+        `D` is contiguous; all of them are `constexpr`.  The comparisons are
+        hidden friends `operator==()` and `operator<=>()`, and so is
+        `hash_value()`, which is not `constexpr`.
+
+        \see `v1::sequence_container_interface` */
+    template<typename D>
+        requires std::is_class_v<D> && std::same_as<D, std::remove_cv_t<D>>
+    struct sequence_container_interface
+    {
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        constexpr D & derived() noexcept { return static_cast<D &>(*this); }
+        constexpr const D & derived() const noexcept
+        {
+            return static_cast<D const &>(*this);
+        }
+        constexpr D & mutable_derived() const noexcept
+        {
+            return const_cast<D &>(static_cast<D const &>(*this));
+        }
+#endif
+
+    public:
+        constexpr bool empty() requires std::ranges::forward_range<D>
+        {
+            return derived().begin() == derived().end();
+        }
+        constexpr bool empty() const
+            requires std::ranges::forward_range<D const>
+        {
+            return derived().begin() == derived().end();
+        }
+
+        constexpr auto data() requires std::contiguous_iterator<
+            std::ranges::iterator_t<D>>
+        {
+            return std::to_address(derived().begin());
+        }
+        constexpr auto data() const requires std::contiguous_iterator<
+            std::ranges::iterator_t<D const>>
+        {
+            return std::to_address(derived().begin());
+        }
+
+        template<typename C = D>
+        constexpr typename C::size_type size()
+            requires std::ranges::forward_range<C> &&
+            std::sized_sentinel_for<
+                std::ranges::sentinel_t<C>,
+                std::ranges::iterator_t<C>>
+        {
+            return derived().end() - derived().begin();
+        }
+        template<typename C = D>
+        constexpr typename C::size_type size() const
+            requires std::ranges::forward_range<C const> &&
+            std::sized_sentinel_for<
+                std::ranges::sentinel_t<C const>,
+                std::ranges::iterator_t<C const>>
+        {
+            return derived().end() - derived().begin();
+        }
+
+        constexpr decltype(auto) front()
+            requires std::ranges::forward_range<D>
+        {
+            BOOST_STL_INTERFACES_CHECK(
+                !derived().empty(), "front() called on an empty container.");
+            return *derived().begin();
+        }
+        constexpr decltype(auto) front() const
+            requires std::ranges::forward_range<D const>
+        {
+            BOOST_STL_INTERFACES_CHECK(
+                !derived().empty(), "front() called on an empty container.");
+            return *derived().begin();
+        }
+
+        template<typename C = D>
+        constexpr void push_front(typename C::value_type const & x)
+            requires requires(C & c) { c.emplace_front(x); }
+        {
+            derived().emplace_front(x);
+        }
+        template<typename C = D>
+        constexpr void push_front(typename C::value_type && x)
+            requires requires(C & c) { c.emplace_front(std::move(x)); }
+        {
+            derived().emplace_front(std::move(x));
+        }
+        constexpr void pop_front() BOOST_STL_INTERFACES_CHECKED_NOEXCEPT(true)
+            requires requires(D & d, std::ranges::range_value_t<D> & x) {
+                d.emplace_front(x);
+                d.erase(d.begin());
+            }
+        {
+            BOOST_STL_INTERFACES_CHECK(
+                !derived().empty(),
+                "pop_front() called on an empty container.");
+            derived().erase(derived().begin());
+        }
+
+        constexpr decltype(auto) back()
+            requires std::ranges::bidirectional_range<D> &&
+            std::ranges::common_range<D>
+        {
+            BOOST_STL_INTERFACES_CHECK(
+                !derived().empty(), "back() called on an empty container.");
+            return *std::ranges::prev(derived().end());
+        }
+        constexpr decltype(auto) back() const
+            requires std::ranges::bidirectional_range<D const> &&
+            std::ranges::common_range<D const>
+        {
+            BOOST_STL_INTERFACES_CHECK(
+                !derived().empty(), "back() called on an empty container.");
+            return *std::ranges::prev(derived().end());
+        }
+
+        template<typename C = D>
+        constexpr void push_back(typename C::value_type const & x)
+            requires requires(C & c) { c.emplace_back(x); }
+        {
+            derived().emplace_back(x);
+        }
+        template<typename C = D>
+        constexpr void push_back(typename C::value_type && x)
+            requires requires(C & c) { c.emplace_back(std::move(x)); }
+        {
+            derived().emplace_back(std::move(x));
+        }
+        constexpr void pop_back() BOOST_STL_INTERFACES_CHECKED_NOEXCEPT(true)
+            requires std::ranges::bidirectional_range<D> &&
+            std::ranges::common_range<D> &&
+            requires(D & d, std::ranges::range_value_t<D> & x) {
+                d.emplace_back(x);
+                d.erase(std::ranges::prev(d.end()));
+            }
+        {
+            BOOST_STL_INTERFACES_CHECK(
+                !derived().empty(), "pop_back() called on an empty container.");
+            derived().erase(std::ranges::prev(derived().end()));
+        }
+
+        template<typename C = D>
+        constexpr decltype(auto) operator[](typename C::size_type n)
+            requires std::ranges::random_access_range<C>
+        {
+            BOOST_STL_INTERFACES_CHECK(
+                n < derived().size(), "operator[]() index out of range.");
+            return derived().begin()[n];
+        }
+        template<typename C = D>
+        constexpr decltype(auto) operator[](typename C::size_type n) const
+            requires std::ranges::random_access_range<C const>
+        {
+            BOOST_STL_INTERFACES_CHECK(
+                n < derived().size(), "operator[]() index out of range.");
+            return derived().begin()[n];
+        }
+
+        template<typename C = D>
+        constexpr decltype(auto) at(typename C::size_type i)
+            requires requires(C & c) { c.size(); c[i]; }
+        {
+            if (derived().size() <= i) {
+                statistics().out_of_range();
+                throw std::out_of_range(
+                    "Bounds check failed in sequence_container_interface::at()");
+            }
+            return derived()[i];
+        }
+        template<typename C = D>
+        constexpr decltype(auto) at(typename C::size_type i) const
+            requires requires(C const & c) { c.size(); c[i]; }
+        {
+            if (derived().size() <= i) {
+                statistics().out_of_range();
+                throw std::out_of_range(
+                    "Bounds check failed in sequence_container_interface::at()");
+            }
+            return derived()[i];
+        }
+
+        template<typename C = D>
+        constexpr typename C::const_iterator begin() const
+            requires requires(C & c) { c.begin(); }
+        {
+            return typename C::const_iterator(mutable_derived().begin());
+        }
+        template<typename C = D>
+        constexpr typename C::const_iterator end() const
+            requires requires(C & c) { c.end(); }
+        {
+            return typename C::const_iterator(mutable_derived().end());
+        }
+
+        constexpr auto cbegin() const requires std::ranges::range<D const>
+        {
+            return derived().begin();
+        }
+        constexpr auto cend() const requires std::ranges::range<D const>
+        {
+            return derived().end();
+        }
+
+        template<typename C = D>
+        constexpr typename C::reverse_iterator rbegin()
+            requires std::ranges::bidirectional_range<C> &&
+            std::ranges::common_range<C>
+        {
+            return typename C::reverse_iterator(derived().end());
+        }
+        template<typename C = D>
+        constexpr typename C::reverse_iterator rend()
+            requires std::ranges::bidirectional_range<C> &&
+            std::ranges::common_range<C>
+        {
+            return typename C::reverse_iterator(derived().begin());
+        }
+
+        template<typename C = D>
+        constexpr typename C::const_reverse_iterator rbegin() const
+            requires std::ranges::bidirectional_range<C const> &&
+            std::ranges::common_range<C const>
+        {
+            return typename C::const_reverse_iterator(derived().end());
+        }
+        template<typename C = D>
+        constexpr typename C::const_reverse_iterator rend() const
+            requires std::ranges::bidirectional_range<C const> &&
+            std::ranges::common_range<C const>
+        {
+            return typename C::const_reverse_iterator(derived().begin());
+        }
+
+        constexpr auto crbegin() const
+            requires requires(D const & d) { d.rbegin(); }
+        {
+            return derived().rbegin();
+        }
+        constexpr auto crend() const
+            requires requires(D const & d) { d.rend(); }
+        {
+            return derived().rend();
+        }
+
+        template<typename C = D>
+        constexpr auto insert(
+            typename C::const_iterator pos,
+            typename C::value_type const & x)
+            requires requires(C & c) { c.emplace(pos, x); }
+        {
+            return derived().emplace(pos, x);
+        }
+        template<typename C = D>
+        constexpr auto
+        insert(typename C::const_iterator pos, typename C::value_type && x)
+            requires requires(C & c) { c.emplace(pos, std::move(x)); }
+        {
+            return derived().emplace(pos, std::move(x));
+        }
+        // As in v1, this is unconstrained; constraining it on the insert()
+        // call below makes the constraint depend on itself.
+        template<typename C = D>
+        constexpr auto insert(
+            typename C::const_iterator pos,
+            typename C::size_type n,
+            typename C::value_type const & x)
+        {
+            return derived().insert(
+                pos, detail::make_n_iter(x, n), detail::make_n_iter_end(x, n));
+        }
+        template<typename C = D>
+        constexpr auto insert(
+            typename C::const_iterator pos,
+            std::initializer_list<typename C::value_type> il)
+            requires requires(C & c) { c.insert(pos, il.begin(), il.end()); }
+        {
+            return derived().insert(pos, il.begin(), il.end());
+        }
+
+        template<std::ranges::input_range R, typename C = D>
+        constexpr auto insert_range(typename C::const_iterator pos, R && r)
+            requires std::ranges::common_range<R> &&
+            requires(C & c) {
+                c.insert(pos, std::ranges::begin(r), std::ranges::end(r));
+            }
+        {
+            return derived().insert(
+                pos, std::ranges::begin(r), std::ranges::end(r));
+        }
+        template<std::ranges::input_range R>
+        constexpr void append_range(R && r)
+            requires std::ranges::common_range<R> &&
+            requires(D & d) {
+                d.insert(d.end(), std::ranges::begin(r), std::ranges::end(r));
+            }
+        {
+            derived().insert(
+                derived().end(), std::ranges::begin(r), std::ranges::end(r));
+        }
+        template<std::ranges::input_range R>
+        constexpr void assign_range(R && r)
+            requires std::ranges::common_range<R> &&
+            requires(D & d) {
+                d.assign(std::ranges::begin(r), std::ranges::end(r));
+            }
+        {
+            derived().assign(std::ranges::begin(r), std::ranges::end(r));
+        }
+
+        template<typename C = D>
+        constexpr auto erase(typename C::const_iterator pos)
+            requires requires(C & c) { c.erase(pos, std::ranges::next(pos)); }
+        {
+            return derived().erase(pos, std::ranges::next(pos));
+        }
+
+        template<std::input_iterator InputIterator>
+        constexpr void assign(InputIterator first, InputIterator last)
+            requires requires(D & d) {
+                d.erase(d.begin(), d.end());
+                d.insert(d.begin(), first, last);
+            }
+        {
+            if constexpr (
+                std::sized_sentinel_for<InputIterator, InputIterator> &&
+                std::ranges::sized_range<D>) {
+                auto const n = std::ranges::distance(first, last);
+                auto const size = std::ranges::distance(derived());
+                auto const min_size = (std::min)(n, size);
+                auto const mid = first + min_size;
+                assign_prefix(first, mid);
+                if (min_size < size) {
+                    derived().erase(
+                        std::ranges::next(derived().begin(), min_size),
+                        derived().end());
+                } else if (min_size < n) {
+                    derived().insert(derived().end(), mid, last);
+                }
+            } else {
+                auto out = derived().begin();
+                auto const out_last = derived().end();
+                for (; out != out_last && first != last; ++first, ++out) {
+                    *out = *first;
+                }
+                if (out != out_last)
+                    derived().erase(out, out_last);
+                if (first != last)
+                    derived().insert(derived().end(), first, last);
+            }
+        }
+
+        template<typename C = D>
+        constexpr void
+        assign(typename C::size_type n, typename C::value_type const & x)
+            requires std::ranges::sized_range<C> && requires(C & c) {
+                c.erase(c.begin(), c.end());
+                c.insert(
+                    c.begin(),
+                    detail::make_n_iter(x, n),
+                    detail::make_n_iter_end(x, n));
+            }
+        {
+            if (detail::fake_capacity(derived()) < n) {
+                C temp(n, x);
+                derived().swap(temp);
+                return;
+            }
+            using size_type = typename C::size_type;
+            size_type const size = derived().size();
+            size_type const min_size = (std::min)(n, size);
+            auto const fill_end =
+                std::ranges::fill_n(derived().begin(), min_size, x);
+            if (min_size < size) {
+                derived().erase(fill_end, derived().end());
+            } else {
+                n -= min_size;
+                derived().insert(
+                    derived().end(),
+                    detail::make_n_iter(x, n),
+                    detail::make_n_iter_end(x, n));
+            }
+        }
+
+        template<typename C = D>
+        constexpr void assign(std::initializer_list<typename C::value_type> il)
+            requires requires(C & c) { c.assign(il.begin(), il.end()); }
+        {
+            derived().assign(il.begin(), il.end());
+        }
+
+        template<typename C = D>
+        constexpr D &
+        operator=(std::initializer_list<typename C::value_type> il)
+            requires requires(C & c) { c.assign(il.begin(), il.end()); }
+        {
+            derived().assign(il.begin(), il.end());
+            return derived();
+        }
+
+        constexpr void clear() noexcept
+            requires requires(D & d) { d.erase(d.begin(), d.end()); }
+        {
+            derived().erase(derived().begin(), derived().end());
+        }
+
+        // These are templates only so that an operator that D declares
+        // itself is a better match.
+        template<typename C = D>
+            requires requires(C & c) { c.swap(c); }
+        friend constexpr void swap(D & lhs, D & rhs)
+        {
+            lhs.swap(rhs);
+        }
+
+        template<typename C = D>
+            requires std::ranges::forward_range<C const> &&
+            std::equality_comparable<std::ranges::range_value_t<C>>
+        friend constexpr bool operator==(D const & lhs, D const & rhs)
+        {
+            return std::ranges::equal(
+                v2_dtl::elements(lhs), v2_dtl::elements(rhs));
+        }
+
+        template<typename C = D>
+            requires std::ranges::forward_range<C const> &&
+            v2_dtl::synth_three_way_comparable<std::ranges::range_value_t<C>>
+        friend constexpr auto operator<=>(D const & lhs, D const & rhs)
+        {
+            auto const lhs_elements = v2_dtl::elements(lhs);
+            auto const rhs_elements = v2_dtl::elements(rhs);
+            return std::lexicographical_compare_three_way(
+                lhs_elements.begin(),
+                lhs_elements.end(),
+                rhs_elements.begin(),
+                rhs_elements.end(),
+                v2_dtl::synth_three_way{});
+        }
+
+        /** Returns a hash of the elements.
+
+            \see `v1::hash_value()` */
+        template<typename C = D>
+            requires v2_dtl::bytewise_hashable<C> ||
+            requires(C const & c) {
+                std::hash<std::ranges::range_value_t<C>>{}(*c.begin());
+            }
+        friend std::size_t hash_value(D const & c)
+        {
+            using value_type = std::ranges::range_value_t<C>;
+            if constexpr (v2_dtl::bytewise_hashable<C>) {
+                return v1::v1_dtl::hash_bytes(
+                    std::to_address(c.begin()),
+                    std::ranges::size(c) * sizeof(value_type));
+            } else {
+                std::hash<value_type> const hash{};
+                std::size_t result = std::ranges::size(c);
+                for (auto && x : c) {
+                    result = v1::v1_dtl::hash_combine(result, hash(x));
+                }
+                return result;
+            }
+        }
+
+    protected:
+        /** Returns `it`, or in checked mode a `checked_iterator` that remains
+            valid until the next call to `invalidate_iterators()`.
+
+            \see `v1::sequence_container_interface::make_iterator()` */
+        template<typename Iter>
+        constexpr v1::checked_iterator_t<Iter>
+        make_iterator(Iter it) const noexcept
+        {
+#if defined(BOOST_STL_INTERFACES_CHECKED)
+            return v1::checked_iterator<Iter>(it, generation_);
+#else
+            return it;
+#endif
+        }
+        /** Invalidates every iterator that `make_iterator()` has returned.
+            Does nothing outside of checked mode. */
+        constexpr void invalidate_iterators() noexcept
+        {
+#if defined(BOOST_STL_INTERFACES_CHECKED)
+            generation_.invalidate();
+#endif
+        }
+
+        /** Returns the statistics policy of `D`.
+
+            \see `v1::sequence_container_interface::statistics()` */
+        template<typename C = D>
+        static constexpr v1::statistics_policy_t<C> statistics() noexcept
+        {
+            return v1::statistics_policy_t<C>();
+        }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        // Assigns [first, last) over the first last - first elements.  This
+        // is a single memmove() when both sides are contiguous and the
+        // elements are trivially copyable; the source may be part of *this.
+        template<typename InputIterator>
+        constexpr void assign_prefix(InputIterator first, InputIterator last)
+        {
+            if constexpr (
+                std::contiguous_iterator<InputIterator> &&
+                v2_dtl::contiguous_container<D>) {
+                std::ranges::copy(
+                    std::to_address(first),
+                    std::to_address(last),
+                    std::to_address(derived().begin()));
+            } else {
+                std::ranges::copy(first, last, derived().begin());
+            }
+        }
+
+#if defined(BOOST_STL_INTERFACES_CHECKED)
+        v1::iterator_generation generation_;
+#endif
+#endif
+    };
+
 }}}
 
 #endif
+
+#endif
@@ -0,0 +1,637 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_SLOT_MAP_HPP
+#define BOOST_STL_INTERFACES_SLOT_MAP_HPP
+
+#include <boost/stl_interfaces/checked_iterator.hpp>
+#include <boost/stl_interfaces/detail/bit_ops.hpp>
+#include <boost/stl_interfaces/iterator_interface.hpp>
+#include <boost/stl_interfaces/sequence_container_interface.hpp>
+
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace boost { namespace stl_interfaces { inline namespace v1 {
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    namespace v1_dtl {
+        // The index of the first set bit at or after i.  Some bit at or
+        // after i must be set.
+        inline std::size_t
+        next_set_bit(bitmap_word const * bits, std::size_t i) noexcept
+        {
+            auto word = i / bitmap_word_bits;
+            auto x = bits[word] & (~bitmap_word(0) << (i % bitmap_word_bits));
+            while (!x) {
+                x = bits[++word];
+            }
+            return word * bitmap_word_bits + lowest_bit(x);
+        }
+
+        // The index of the last set bit before i.  Some bit before i must be
+        // set.
+        inline std::size_t
+        prev_set_bit(bitmap_word const * bits, std::size_t i) noexcept
+        {
+            --i;
+            auto word = i / bitmap_word_bits;
+            auto x = bits[word] &
+                     (~bitmap_word(0) >>
+                      (bitmap_word_bits - 1 - i % bitmap_word_bits));
+            while (!x) {
+                x = bits[--word];
+            }
+            return word * bitmap_word_bits + highest_bit(x);
+        }
+    }
+#endif
+
+    /** The bidirectional iterator of `slot_map<std::remove_const_t<T>>`.
+        It finds the next or previous element by scanning the occupancy
+        bitmap of the `slot_map` a word at a time, so runs of erased slots
+        are skipped without touching them. */
+    template<typename T>
+    struct slot_map_iterator : iterator_interface<
+                                   slot_map_iterator<T>,
+                                   std::bidirectional_iterator_tag,
+                                   std::remove_const_t<T>,
+                                   T &>
+    {
+        constexpr slot_map_iterator() noexcept :
+            data_(nullptr), bits_(nullptr), index_(0)
+        {}
+        constexpr slot_map_iterator(
+            T * data,
+            v1_dtl::bitmap_word const * bits,
+            std::size_t index) noexcept :
+            data_(data), bits_(bits), index_(index)
+        {}
+        template<
+            typename U,
+            typename Enable =
+                std::enable_if_t<std::is_convertible<U *, T *>::value>>
+        constexpr slot_map_iterator(slot_map_iterator<U> other) noexcept :
+            data_(other.data_), bits_(other.bits_), index_(other.index_)
+        {}
+
+        constexpr T & operator*() const noexcept { return data_[index_]; }
+        slot_map_iterator & operator++() noexcept
+        {
+            index_ = v1_dtl::next_set_bit(bits_, index_ + 1);
+            return *this;
+        }
+        slot_map_iterator & operator--() noexcept
+        {
+            index_ = v1_dtl::prev_set_bit(bits_, index_);
+            return *this;
+        }
+
+        friend BOOST_STL_INTERFACES_HIDDEN_FRIEND_CONSTEXPR bool
+        operator==(slot_map_iterator lhs, slot_map_iterator rhs) noexcept
+        {
+            return lhs.index_ == rhs.index_;
+        }
+
+        using base_type = iterator_interface<
+            slot_map_iterator<T>,
+            std::bidirectional_iterator_tag,
+            std::remove_const_t<T>,
+            T &>;
+        using base_type::operator++;
+        using base_type::operator--;
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        template<typename U>
+        friend struct slot_map_iterator;
+        template<typename U>
+        friend struct slot_map;
+
+        T * data_;
+        v1_dtl::bitmap_word const * bits_;
+        std::size_t index_;
+#endif
+    };
+
+    /** A stable reference to an element of a `slot_map`.  A handle stays
+        valid until its element is erased, however many other elements are
+        inserted or erased, and even across reallocation.  A
+        value-initialized handle never refers to an element. */
+    struct slot_map_handle
+    {
+        constexpr slot_map_handle() noexcept :
+            index(std::numeric_limits<std::size_t>::max()), generation(0)
+        {}
+        constexpr slot_map_handle(std::size_t i, std::size_t g) noexcept :
+            index(i), generation(g)
+        {}
+
+        /** The slot of the element. */
+        std::size_t index;
+        /** The number of times the slot had been erased when the element
+            was inserted. */
+        std::size_t generation;
+
+        friend BOOST_STL_INTERFACES_HIDDEN_FRIEND_CONSTEXPR bool
+        operator==(slot_map_handle lhs, slot_map_handle rhs) noexcept
+        {
+            return lhs.index == rhs.index && lhs.generation == rhs.generation;
+        }
+        friend BOOST_STL_INTERFACES_HIDDEN_FRIEND_CONSTEXPR bool
+        operator!=(slot_map_handle lhs, slot_map_handle rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+    };
+
+    /** A container with constant-time insertion and erasure, whose
+        elements are referred to by `slot_map_handle`s that are never
+        invalidated by other insertions or erasures.
+
+        The elements live in a single array of slots.  Erasing an element
+        leaves a hole that a later insertion reuses, most recently erased
+        first; the other elements never move, except when the array is
+        reallocated.  Iteration visits the elements in slot order, skipping
+        the holes a bitmap word at a time.
+
+        Inserting may invalidate iterators and references if it reallocates;
+        erasing only invalidates those to the erased element.  In checked
+        mode (see `BOOST_STL_INTERFACES_CHECKED`), every erase or
+        reallocation invalidates iterators.  Copies keep every element in
+        the same slot, so a handle into the original also refers to the
+        corresponding element of the copy.
+
+        `slot_map` reports its inserts, erases, element moves, and
+        reallocations to `statistics_policy_t<slot_map>`. */
+    template<typename T>
+    struct slot_map : sequence_container_interface<slot_map<T>>
+    {
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        using raw_iterator = slot_map_iterator<T>;
+        using raw_const_iterator = slot_map_iterator<T const>;
+        using word = v1_dtl::bitmap_word;
+        static constexpr std::size_t word_bits = v1_dtl::bitmap_word_bits;
+
+        struct storage_type
+        {
+            alignas(T) unsigned char bytes[sizeof(T)];
+        };
+        using storage_ptr = std::unique_ptr<storage_type[]>;
+#endif
+
+    public:
+        using value_type = T;
+        using pointer = T *;
+        using const_pointer = T const *;
+        using reference = value_type &;
+        using const_reference = value_type const &;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using iterator = checked_iterator_t<raw_iterator>;
+        using const_iterator = checked_iterator_t<raw_const_iterator>;
+        using reverse_iterator = stl_interfaces::reverse_iterator<iterator>;
+        using const_reverse_iterator =
+            stl_interfaces::reverse_iterator<const_iterator>;
+        using handle = slot_map_handle;
+
+        slot_map() noexcept : capacity_(0), extent_(0), size_(0) {}
+        template<
+            typename InputIterator,
+            typename Enable = std::enable_if_t<
+                v1_dtl::in_iter<InputIterator>::value>>
+        slot_map(InputIterator first, InputIterator last) : slot_map()
+        {
+            for (; first != last; ++first) {
+                emplace(*first);
+            }
+        }
+        slot_map(std::initializer_list<T> il) :
+            slot_map(il.begin(), il.end())
+        {}
+        slot_map(slot_map const & other) : slot_map()
+        {
+            if (!other.extent_)
+                return;
+            allocate_bookkeeping(other.extent_);
+            auto fresh = allocate(other.extent_);
+            copy_elements(other, fresh);
+            storage_ = std::move(fresh);
+            capacity_ = other.extent_;
+            std::copy(
+                other.occupied_.begin(),
+                other.occupied_.begin() + words_for(other.extent_),
+                occupied_.begin());
+            std::copy(
+                other.generations_.begin(),
+                other.generations_.begin() + other.extent_,
+                generations_.begin());
+            free_.assign(other.free_.begin(), other.free_.end());
+            extent_ = other.extent_;
+            size_ = other.size_;
+            this->statistics().insert(size_);
+            this->statistics().grow_to(size_);
+        }
+        slot_map(slot_map && other) noexcept : slot_map() { steal(other); }
+        slot_map & operator=(slot_map const & other)
+        {
+            if (&other != this) {
+                slot_map tmp(other);
+                *this = std::move(tmp);
+            }
+            return *this;
+        }
+        slot_map & operator=(slot_map && other) noexcept
+        {
+            if (&other != this) {
+                destroy_all();
+                steal(other);
+            }
+            return *this;
+        }
+        ~slot_map() { destroy_all(); }
+
+        iterator begin() noexcept
+        {
+            return make(size_ ? v1_dtl::next_set_bit(bits(), 0) : extent_);
+        }
+        iterator end() noexcept { return make(extent_); }
+
+        size_type size() const noexcept { return size_; }
+        size_type max_size() const noexcept
+        {
+            return std::numeric_limits<difference_type>::max() /
+                   sizeof(storage_type);
+        }
+        /** Returns the number of slots, occupied or not, that the slot map
+            can hold before it must reallocate. */
+        size_type capacity() const noexcept { return capacity_; }
+
+        void reserve(size_type n)
+        {
+            if (n <= capacity_)
+                return;
+            if (max_size() < n)
+                throw std::length_error("slot_map grew past its max_size");
+            allocate_bookkeeping(n);
+            auto fresh = allocate(n);
+            relocate_to(fresh);
+            adopt(std::move(fresh), n);
+        }
+
+        /** Inserts a new element constructed from `args` in the most
+            recently emptied slot, or in a new one if there is none, and
+            returns its handle. */
+        template<typename... Args>
+        handle emplace(Args &&... args)
+        {
+            if (!free_.empty()) {
+                auto const i = free_.back();
+                ::new (static_cast<void *>(data() + i))
+                    T(std::forward<Args>(args)...);
+                free_.pop_back();
+                set_bit(i);
+                return inserted(i);
+            }
+            if (extent_ == capacity_) {
+                auto const n = grown_capacity();
+                allocate_bookkeeping(n);
+                auto fresh = allocate(n);
+                // args may refer to an element of *this, so the new element
+                // is constructed before anything is moved.
+                T * const p = reinterpret_cast<T *>(fresh.get()) + extent_;
+                ::new (static_cast<void *>(p)) T(std::forward<Args>(args)...);
+                try {
+                    relocate_to(fresh);
+                } catch (...) {
+                    p->~T();
+                    throw;
+                }
+                adopt(std::move(fresh), n);
+            } else {
+                ::new (static_cast<void *>(data() + extent_))
+                    T(std::forward<Args>(args)...);
+            }
+            // The bit of the new slot is already set, as the sentinel that
+            // stops iteration; the sentinel moves up one.
+            auto const i = extent_++;
+            set_bit(extent_);
+            return inserted(i);
+        }
+        handle insert(T const & x) { return emplace(x); }
+        handle insert(T && x) { return emplace(std::move(x)); }
+
+        iterator erase(const_iterator pos)
+        {
+            auto const i = index_of(pos);
+            destroy_at(i);
+            return make(v1_dtl::next_set_bit(bits(), i + 1));
+        }
+        iterator erase(const_iterator f, const_iterator l)
+        {
+            auto i = index_of(f);
+            auto const last = index_of(l);
+            while (i != last) {
+                auto const next = v1_dtl::next_set_bit(bits(), i + 1);
+                destroy_at(i);
+                i = next;
+            }
+            return make(last);
+        }
+        /** Erases the element that `h` refers to, if any, and returns the
+            number of elements erased. */
+        size_type erase(handle h)
+        {
+            if (!contains(h))
+                return 0;
+            destroy_at(h.index);
+            return 1;
+        }
+
+        /** Returns true iff `h` refers to an element of `*this`. */
+        bool contains(handle h) const noexcept
+        {
+            return h.index < extent_ && test_bit(h.index) &&
+                   generations_[h.index] == h.generation;
+        }
+        /** Returns an iterator to the element `h` refers to, or `end()` if
+            there is none. */
+        iterator find(handle h) noexcept
+        {
+            return make(contains(h) ? h.index : extent_);
+        }
+        const_iterator find(handle h) const noexcept
+        {
+            return const_cast<slot_map &>(*this).find(h);
+        }
+        /** Returns the handle of the element at `pos`. */
+        handle handle_of(const_iterator pos) const
+        {
+            auto const i = index_of(pos);
+            return handle(i, generations_[i]);
+        }
+
+        /** \pre `contains(h)` */
+        reference operator[](handle h) BOOST_STL_INTERFACES_CHECKED_NOEXCEPT(
+            true)
+        {
+            BOOST_STL_INTERFACES_CHECK(
+                contains(h), "slot_map::operator[] with an invalid handle.");
+            return data()[h.index];
+        }
+        /** \pre `contains(h)` */
+        const_reference operator[](handle h) const
+            BOOST_STL_INTERFACES_CHECKED_NOEXCEPT(true)
+        {
+            return const_cast<slot_map &>(*this)[h];
+        }
+        reference at(handle h)
+        {
+            if (!contains(h)) {
+                this->statistics().out_of_range();
+                throw std::out_of_range("Bad slot_map handle in at().");
+            }
+            return data()[h.index];
+        }
+        const_reference at(handle h) const
+        {
+            return const_cast<slot_map &>(*this).at(h);
+        }
+
+        void swap(slot_map & other) noexcept
+        {
+            using std::swap;
+            swap(storage_, other.storage_);
+            swap(occupied_, other.occupied_);
+            swap(generations_, other.generations_);
+            swap(free_, other.free_);
+            swap(capacity_, other.capacity_);
+            swap(extent_, other.extent_);
+            swap(size_, other.size_);
+            this->invalidate_iterators();
+            other.invalidate_iterators();
+        }
+
+        friend void swap(slot_map & lhs, slot_map & rhs) noexcept
+        {
+            lhs.swap(rhs);
+        }
+
+        using base_type = sequence_container_interface<slot_map<T>>;
+        using base_type::begin;
+        using base_type::end;
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        T * data() const noexcept
+        {
+            return reinterpret_cast<T *>(storage_.get());
+        }
+        word const * bits() const noexcept { return occupied_.data(); }
+
+        iterator make(size_type i) noexcept
+        {
+            return this->make_iterator(raw_iterator(data(), bits(), i));
+        }
+
+        size_type index_of(const_iterator it) const
+        {
+            BOOST_STL_INTERFACES_CHECK(
+                it.valid(),
+                "Use of an iterator that its container has invalidated.");
+            auto const raw = stl_interfaces::unchecked(it);
+            BOOST_STL_INTERFACES_CHECK(
+                raw.bits_ == bits(),
+                "slot_map used with an iterator into another container.");
+            return raw.index_;
+        }
+
+        static size_type words_for(size_type n) noexcept
+        {
+            // One more bit than there are slots, for the sentinel.
+            return n / word_bits + 1;
+        }
+        bool test_bit(size_type i) const noexcept
+        {
+            return (occupied_[i / word_bits] >> (i % word_bits)) & 1u;
+        }
+        void set_bit(size_type i) noexcept
+        {
+            occupied_[i / word_bits] |= word(1) << (i % word_bits);
+        }
+        void clear_bit(size_type i) noexcept
+        {
+            occupied_[i / word_bits] &= ~(word(1) << (i % word_bits));
+        }
+
+        size_type grown_capacity() const
+        {
+            if (max_size() - capacity_ <= capacity_) {
+                if (capacity_ == max_size())
+                    throw std::length_error("slot_map grew past its max_size");
+                return max_size();
+            }
+            return capacity_ ? 2 * capacity_ : 8;
+        }
+
+        static storage_ptr allocate(size_type n)
+        {
+            return storage_ptr(new storage_type[n]);
+        }
+
+        // Grows the bitmap, generations, and free list to hold n slots.
+        // This is all that can throw, so it is done first; the extra room
+        // is harmless if a later step throws.
+        void allocate_bookkeeping(size_type n)
+        {
+            bool const first = occupied_.empty();
+            occupied_.resize(words_for(n));
+            if (first)
+                set_bit(0);
+            generations_.resize(n);
+            free_.reserve(n);
+        }
+
+        // Moves the elements into the same slots of fresh, or, if a move
+        // throws, leaves *this unchanged.
+        void relocate_to(storage_ptr const & fresh)
+        {
+            T * const to = reinterpret_cast<T *>(fresh.get());
+            size_type i = size_ ? v1_dtl::next_set_bit(bits(), 0) : extent_;
+            try {
+                for (; i != extent_;
+                     i = v1_dtl::next_set_bit(bits(), i + 1)) {
+                    ::new (static_cast<void *>(to + i))
+                        T(std::move_if_noexcept(data()[i]));
+                }
+            } catch (...) {
+                destroy_before(to, bits(), i);
+                throw;
+            }
+        }
+
+        void copy_elements(slot_map const & other, storage_ptr const & fresh)
+        {
+            T * const to = reinterpret_cast<T *>(fresh.get());
+            auto const other_bits = other.bits();
+            auto i = v1_dtl::next_set_bit(other_bits, 0);
+            try {
+                for (; i != other.extent_;
+                     i = v1_dtl::next_set_bit(other_bits, i + 1)) {
+                    ::new (static_cast<void *>(to + i)) T(other.data()[i]);
+                }
+            } catch (...) {
+                destroy_before(to, other_bits, i);
+                throw;
+            }
+        }
+
+        // Destroys the elements of to in the slots before i that are
+        // occupied according to bits.
+        static void
+        destroy_before(T * to, word const * bits, size_type i) noexcept
+        {
+            auto j = v1_dtl::next_set_bit(bits, 0);
+            for (; j < i; j = v1_dtl::next_set_bit(bits, j + 1)) {
+                to[j].~T();
+            }
+        }
+
+        // Destroys the elements in the current storage and replaces it with
+        // fresh, which already holds them.
+        void adopt(storage_ptr fresh, size_type n) noexcept
+        {
+            destroy_elements();
+            storage_ = std::move(fresh);
+            capacity_ = n;
+            this->invalidate_iterators();
+            this->statistics().move(size_);
+            this->statistics().reallocate();
+        }
+
+        handle inserted(size_type i) noexcept
+        {
+            ++size_;
+            this->statistics().insert(1);
+            this->statistics().grow_to(size_);
+            return handle(i, generations_[i]);
+        }
+
+        void destroy_at(size_type i) noexcept
+        {
+            data()[i].~T();
+            clear_bit(i);
+            ++generations_[i];
+            free_.push_back(i);
+            --size_;
+            this->invalidate_iterators();
+            this->statistics().erase(1);
+        }
+
+        void destroy_elements() noexcept
+        {
+            if (size_)
+                destroy_before(data(), bits(), extent_);
+        }
+
+        void destroy_all() noexcept
+        {
+            this->statistics().erase(size_);
+            destroy_elements();
+            storage_.reset();
+            occupied_.clear();
+            generations_.clear();
+            free_.clear();
+            capacity_ = 0;
+            extent_ = 0;
+            size_ = 0;
+            this->invalidate_iterators();
+        }
+
+        void steal(slot_map & other) noexcept
+        {
+            storage_ = std::move(other.storage_);
+            occupied_ = std::move(other.occupied_);
+            generations_ = std::move(other.generations_);
+            free_ = std::move(other.free_);
+            capacity_ = other.capacity_;
+            extent_ = other.extent_;
+            size_ = other.size_;
+            other.occupied_.clear();
+            other.generations_.clear();
+            other.free_.clear();
+            other.capacity_ = 0;
+            other.extent_ = 0;
+            other.size_ = 0;
+            other.invalidate_iterators();
+        }
+
+        storage_ptr storage_;
+        // Bit i is set iff slot i holds an element, except that bit extent_
+        // is always set, so that scans stop at end().
+        std::vector<word> occupied_;
+        std::vector<size_type> generations_;
+        std::vector<size_type> free_;
+        size_type capacity_;
+        // The number of slots ever used; the slots at and after extent_ have
+        // never held an element.
+        size_type extent_;
+        size_type size_;
+#endif
+    };
+
+}}}
+
+#endif
@@ -0,0 +1,747 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_SMALL_VECTOR_HPP
+#define BOOST_STL_INTERFACES_SMALL_VECTOR_HPP
+
+#include <boost/stl_interfaces/allocator_interface.hpp>
+#include <boost/stl_interfaces/checked_iterator.hpp>
+#include <boost/stl_interfaces/sequence_container_interface.hpp>
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if 201402L < __cplusplus && defined(__has_include)
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+#endif
+#endif
+
+
+namespace boost { namespace stl_interfaces { inline namespace v1 {
+
+    /** A contiguous, `std::vector`-like sequence container that stores up to
+        `N` elements within the object itself, and only allocates storage
+        from `Allocator` once it grows past `N` elements.
+
+        Moving or swapping a `small_vector` whose elements are stored inline
+        relocates the elements (see `is_trivially_relocatable`), so it is
+        linear in `size()`, unlike `std::vector`.
+
+        In checked mode (see `BOOST_STL_INTERFACES_CHECKED`), the iterators
+        are `checked_iterator`s.  Reallocation, `insert()`, `emplace()` other
+        than at the end, `erase()`, and `swap()` invalidate all of them, which
+        is stricter than `std::vector`; `push_back()` without reallocation
+        invalidates none.
+
+        `small_vector` reports its inserts, erases, element moves,
+        reallocations, and growth to `statistics_policy_t<small_vector>`.
+
+        `std::allocator_traits<Allocator>::pointer` must be `T *`. */
+    template<typename T, std::size_t N, typename Allocator = std::allocator<T>>
+    struct small_vector
+        : sequence_container_interface<
+              small_vector<T, N, Allocator>,
+              element_layout::contiguous>,
+          allocator_interface<small_vector<T, N, Allocator>, Allocator>
+    {
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        using alloc_base =
+            allocator_interface<small_vector<T, N, Allocator>, Allocator>;
+        using alloc_traits = std::allocator_traits<Allocator>;
+
+        static_assert(
+            std::is_same<typename alloc_traits::value_type, T>::value,
+            "Allocator::value_type must be T.");
+        static_assert(
+            std::is_same<typename alloc_traits::pointer, T *>::value,
+            "small_vector only supports allocators whose pointer type is T "
+            "*.");
+#endif
+
+    public:
+        using value_type = T;
+        using pointer = T *;
+        using const_pointer = T const *;
+        using reference = value_type &;
+        using const_reference = value_type const &;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using iterator = checked_iterator_t<T *>;
+        using const_iterator = checked_iterator_t<T const *>;
+        using reverse_iterator = stl_interfaces::reverse_iterator<iterator>;
+        using const_reverse_iterator =
+            stl_interfaces::reverse_iterator<const_iterator>;
+
+        /** The number of elements that can be stored without allocating. */
+        static constexpr size_type inline_capacity = N;
+
+        small_vector() noexcept(noexcept(Allocator())) : small_vector(Allocator())
+        {}
+        explicit small_vector(Allocator const & a) noexcept :
+            alloc_base(a),
+            data_(inline_data()),
+            size_(0),
+            capacity_(N)
+        {}
+        explicit small_vector(size_type n, Allocator const & a = Allocator()) :
+            small_vector(a)
+        {
+            resize(n);
+        }
+        small_vector(
+            size_type n, T const & x, Allocator const & a = Allocator()) :
+            small_vector(a)
+        {
+            resize(n, x);
+        }
+        template<
+            typename ForwardIterator,
+            typename Enable = std::enable_if_t<std::is_convertible<
+                typename std::iterator_traits<
+                    ForwardIterator>::iterator_category,
+                std::forward_iterator_tag>::value>>
+        small_vector(
+            ForwardIterator first,
+            ForwardIterator last,
+            Allocator const & a = Allocator()) :
+            small_vector(a)
+        {
+            // *this is empty, so the elements are constructed in place,
+            // without handing insert() a position in uninitialized storage.
+            auto const n = size_type(std::distance(first, last));
+            reserve(n);
+            uninitialized_copy(first, last, data_);
+            size_ = n;
+            note_inserted(n);
+        }
+        small_vector(
+            std::initializer_list<T> il, Allocator const & a = Allocator()) :
+            small_vector(il.begin(), il.end(), a)
+        {}
+        small_vector(small_vector const & other) :
+            small_vector(
+                other.begin(),
+                other.end(),
+                alloc_base::select_on_container_copy_construction(other))
+        {}
+        small_vector(small_vector const & other, Allocator const & a) :
+            small_vector(other.begin(), other.end(), a)
+        {}
+        small_vector(small_vector && other) noexcept(
+            v1_dtl::nothrow_relocatable<T>::value) :
+            small_vector(std::move(other.alloc()))
+        {
+            steal_or_relocate(other);
+        }
+        small_vector(small_vector && other, Allocator const & a) :
+            small_vector(a)
+        {
+            if (other.alloc() == a) {
+                steal_or_relocate(other);
+            } else {
+                insert(
+                    end(),
+                    std::make_move_iterator(other.begin()),
+                    std::make_move_iterator(other.end()));
+                other.clear();
+            }
+        }
+        small_vector & operator=(small_vector const & other)
+        {
+            if (&other == this)
+                return *this;
+            if (this->copy_assignment_changes_allocator(other)) {
+                this->clear();
+                release_storage();
+            }
+            this->copy_assign_allocator(other);
+            this->assign(other.begin(), other.end());
+            return *this;
+        }
+        small_vector & operator=(small_vector && other) noexcept(
+            (alloc_traits::propagate_on_container_move_assignment::value ||
+             alloc_traits::is_always_equal::value) &&
+            v1_dtl::nothrow_relocatable<T>::value)
+        {
+            if (&other == this)
+                return *this;
+            this->clear();
+            if (this->move_assignment_steals_storage(other)) {
+                release_storage();
+                this->move_assign_allocator(other);
+                steal_or_relocate(other);
+            } else {
+                insert(
+                    end(),
+                    std::make_move_iterator(other.begin()),
+                    std::make_move_iterator(other.end()));
+                other.clear();
+            }
+            return *this;
+        }
+        ~small_vector()
+        {
+            this->clear();
+            release_storage();
+        }
+
+        iterator begin() noexcept { return this->make_iterator(data_); }
+        iterator end() noexcept { return this->make_iterator(data_ + size_); }
+
+        size_type size() const noexcept { return size_; }
+        size_type max_size() const noexcept
+        {
+            return (std::min)(
+                alloc_traits::max_size(alloc()),
+                size_type((std::numeric_limits<difference_type>::max)()));
+        }
+        size_type capacity() const noexcept { return capacity_; }
+        /** Returns true iff the elements are stored within the object
+            itself. */
+        bool is_inline() const noexcept { return data_ == inline_data(); }
+
+        void resize(size_type sz)
+        {
+            if (sz < size_) {
+                erase(begin() + sz, end());
+                return;
+            }
+            if (capacity_ < sz)
+                reserve(next_capacity(sz));
+            auto const old_size = size_;
+            while (size_ < sz) {
+                alloc_traits::construct(alloc(), data_ + size_);
+                ++size_;
+            }
+            note_inserted(sz - old_size);
+        }
+        void resize(size_type sz, T const & x)
+        {
+            if (sz < size_) {
+                erase(begin() + sz, end());
+                return;
+            }
+            auto const old_size = size_;
+            if (capacity_ < sz) {
+                // x may refer to an element, so it is copied before the old
+                // storage goes away.
+                auto const new_capacity = next_capacity(sz);
+                auto const new_data = allocate(new_capacity);
+                try {
+                    uninitialized_fill(new_data + size_, new_data + sz, x);
+                } catch (...) {
+                    alloc_traits::deallocate(alloc(), new_data, new_capacity);
+                    throw;
+                }
+                adopt_storage(new_data, new_capacity, sz);
+                note_inserted(sz - old_size);
+                return;
+            }
+            uninitialized_fill(data_ + size_, data_ + sz, x);
+            size_ = sz;
+            note_inserted(sz - old_size);
+        }
+        void reserve(size_type n)
+        {
+            if (n <= capacity_)
+                return;
+            auto const new_data = allocate(n);
+            adopt_storage(new_data, n, size_);
+        }
+        void shrink_to_fit()
+        {
+            if (is_inline() || size_ == capacity_)
+                return;
+            if (size_ <= N) {
+                T * const old_data = data_;
+                size_type const old_capacity = capacity_;
+                relocate_for_growth(old_data, old_data + size_, inline_data());
+                alloc_traits::deallocate(alloc(), old_data, old_capacity);
+                data_ = inline_data();
+                capacity_ = N;
+                this->invalidate_iterators();
+                this->statistics().move(size_);
+                this->statistics().reallocate();
+            } else {
+                auto const new_data = allocate(size_);
+                adopt_storage(new_data, size_, size_);
+            }
+        }
+
+        template<typename... Args>
+        reference emplace_back(Args &&... args)
+        {
+            if (size_ < capacity_) {
+                alloc_traits::construct(
+                    alloc(), data_ + size_, std::forward<Args>(args)...);
+                ++size_;
+                note_inserted(1);
+                return back_impl();
+            }
+            return *grow_emplace(data_ + size_, std::forward<Args>(args)...);
+        }
+        template<typename... Args>
+        iterator emplace(const_iterator pos, Args &&... args)
+        {
+            auto position = const_cast<T *>(stl_interfaces::unchecked(pos));
+            if (size_ == capacity_) {
+                return this->make_iterator(
+                    grow_emplace(position, std::forward<Args>(args)...));
+            }
+            if (position == data_ + size_) {
+                alloc_traits::construct(
+                    alloc(), position, std::forward<Args>(args)...);
+                ++size_;
+                note_inserted(1);
+                return this->make_iterator(position);
+            }
+            // args may refer to an element of *this, so the new element is
+            // constructed before anything is shifted.
+            T x(std::forward<Args>(args)...);
+            this->invalidate_iterators();
+            auto const old_end = data_ + size_;
+            if (v1_dtl::nothrow_relocatable<T>::value) {
+                stl_interfaces::uninitialized_relocate_backward(
+                    position, old_end, old_end + 1);
+                alloc_traits::construct(alloc(), position, std::move(x));
+                ++size_;
+            } else {
+                alloc_traits::construct(
+                    alloc(), old_end, std::move(*(old_end - 1)));
+                ++size_;
+                std::move_backward(position, old_end - 1, old_end);
+                *position = std::move(x);
+            }
+            this->statistics().move(size_type(old_end - position));
+            note_inserted(1);
+            return this->make_iterator(position);
+        }
+        template<
+            typename ForwardIterator,
+            typename Enable = std::enable_if_t<std::is_convertible<
+                typename std::iterator_traits<
+                    ForwardIterator>::iterator_category,
+                std::forward_iterator_tag>::value>>
+        iterator
+        insert(const_iterator pos, ForwardIterator first, ForwardIterator last)
+        {
+            auto position = const_cast<T *>(stl_interfaces::unchecked(pos));
+            auto const insertions = size_type(std::distance(first, last));
+            if (!insertions)
+                return this->make_iterator(position);
+            if (capacity_ - size_ < insertions) {
+                return this->make_iterator(
+                    grow_insert(position, first, last, insertions));
+            }
+
+            this->invalidate_iterators();
+            auto const old_end = data_ + size_;
+            auto const tail = size_type(old_end - position);
+            if (is_trivially_relocatable<T>::value) {
+                stl_interfaces::uninitialized_relocate_backward(
+                    position, old_end, old_end + insertions);
+                try {
+                    uninitialized_copy(first, last, position);
+                } catch (...) {
+                    stl_interfaces::uninitialized_relocate(
+                        position + insertions,
+                        old_end + insertions,
+                        position);
+                    throw;
+                }
+                size_ += insertions;
+            } else if (insertions < tail) {
+                // size_ covers the new elements past old_end before any
+                // assignment that may throw, so that they are destroyed
+                // along with the rest.
+                uninitialized_copy(
+                    std::make_move_iterator(old_end - insertions),
+                    std::make_move_iterator(old_end),
+                    old_end);
+                size_ += insertions;
+                std::move_backward(position, old_end - insertions, old_end);
+                std::copy(first, last, position);
+            } else {
+                auto const mid = std::next(first, tail);
+                uninitialized_copy(mid, last, old_end);
+                try {
+                    uninitialized_copy(
+                        std::make_move_iterator(position),
+                        std::make_move_iterator(old_end),
+                        position + insertions);
+                } catch (...) {
+                    destroy(old_end, old_end + (insertions - tail));
+                    throw;
+                }
+                size_ += insertions;
+                std::copy(first, mid, position);
+            }
+            this->statistics().move(tail);
+            note_inserted(insertions);
+            return this->make_iterator(position);
+        }
+        iterator erase(const_iterator f, const_iterator l)
+        {
+            auto first = const_cast<T *>(stl_interfaces::unchecked(f));
+            auto last = const_cast<T *>(stl_interfaces::unchecked(l));
+            if (first == last)
+                return this->make_iterator(first);
+            this->invalidate_iterators();
+            auto const old_end = data_ + size_;
+            if (is_trivially_relocatable<T>::value) {
+                destroy(first, last);
+                stl_interfaces::uninitialized_relocate(last, old_end, first);
+            } else {
+                destroy(std::move(last, old_end, first), old_end);
+            }
+            size_ -= last - first;
+            this->statistics().erase(size_type(last - first));
+            this->statistics().move(size_type(old_end - last));
+            return this->make_iterator(first);
+        }
+        void swap(small_vector & other) noexcept(
+            v1_dtl::nothrow_relocatable<T>::value)
+        {
+            if (&other == this)
+                return;
+            this->swap_allocator(other);
+            this->invalidate_iterators();
+            other.invalidate_iterators();
+
+            if (!is_inline() && !other.is_inline()) {
+                std::swap(data_, other.data_);
+                std::swap(size_, other.size_);
+                std::swap(capacity_, other.capacity_);
+                return;
+            }
+
+            if (is_inline() && other.is_inline()) {
+                small_vector * shorter = this;
+                small_vector * longer = &other;
+                if (longer->size_ < shorter->size_)
+                    std::swap(shorter, longer);
+                auto const short_size = shorter->size_;
+                std::swap_ranges(
+                    shorter->data_, shorter->data_ + short_size, longer->data_);
+                stl_interfaces::uninitialized_relocate(
+                    longer->data_ + short_size,
+                    longer->data_ + longer->size_,
+                    shorter->data_ + short_size);
+                this->statistics().move(short_size + longer->size_);
+                std::swap(size_, other.size_);
+                return;
+            }
+
+            small_vector & heap = is_inline() ? other : *this;
+            small_vector & local = is_inline() ? *this : other;
+            T * const heap_data = heap.data_;
+            auto const heap_size = heap.size_;
+            auto const heap_capacity = heap.capacity_;
+            stl_interfaces::uninitialized_relocate(
+                local.data_, local.data_ + local.size_, heap.inline_data());
+            this->statistics().move(local.size_);
+            heap.data_ = heap.inline_data();
+            heap.size_ = local.size_;
+            heap.capacity_ = N;
+            local.data_ = heap_data;
+            local.size_ = heap_size;
+            local.capacity_ = heap_capacity;
+        }
+
+        friend void swap(small_vector & lhs, small_vector & rhs) noexcept(
+            noexcept(lhs.swap(rhs)))
+        {
+            lhs.swap(rhs);
+        }
+
+        using base_type = sequence_container_interface<
+            small_vector<T, N, Allocator>,
+            element_layout::contiguous>;
+        using base_type::begin;
+        using base_type::end;
+        using base_type::insert;
+        using base_type::erase;
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        using alloc_base::alloc;
+
+        T * inline_data() noexcept { return reinterpret_cast<T *>(buf_); }
+        T const * inline_data() const noexcept
+        {
+            return reinterpret_cast<T const *>(buf_);
+        }
+
+        reference back_impl() noexcept { return data_[size_ - 1]; }
+
+        void note_inserted(size_type n) noexcept
+        {
+            this->statistics().insert(n);
+            this->statistics().grow_to(size_);
+        }
+
+        void destroy(T * first, T * last) noexcept
+        {
+            for (; first != last; ++first) {
+                alloc_traits::destroy(alloc(), first);
+            }
+        }
+
+        template<typename Iter>
+        T * uninitialized_copy(Iter first, Iter last, T * out)
+        {
+            T * it = out;
+            try {
+                for (; first != last; ++first, ++it) {
+                    alloc_traits::construct(alloc(), it, *first);
+                }
+            } catch (...) {
+                destroy(out, it);
+                throw;
+            }
+            return it;
+        }
+
+        T * uninitialized_move_if_noexcept(T * first, T * last, T * out)
+        {
+            T * it = out;
+            try {
+                for (; first != last; ++first, ++it) {
+                    alloc_traits::construct(
+                        alloc(), it, std::move_if_noexcept(*first));
+                }
+            } catch (...) {
+                destroy(out, it);
+                throw;
+            }
+            return it;
+        }
+
+        void uninitialized_fill(T * first, T * last, T const & x)
+        {
+            T * it = first;
+            try {
+                for (; it != last; ++it) {
+                    alloc_traits::construct(alloc(), it, x);
+                }
+            } catch (...) {
+                destroy(first, it);
+                throw;
+            }
+        }
+
+        size_type next_capacity(size_type min_capacity) const
+        {
+            auto const max = max_size();
+            if (max < min_capacity)
+                throw std::length_error("small_vector grew past max_size()");
+            auto const doubled =
+                capacity_ < max / 2 ? (std::max)(capacity_ * 2, size_type(1))
+                                    : max;
+            return (std::max)(doubled, min_capacity);
+        }
+
+        T * allocate(size_type n)
+        {
+            if (max_size() < n)
+                throw std::length_error("small_vector grew past max_size()");
+            return alloc_traits::allocate(alloc(), n);
+        }
+
+        // Moves [first, last) into uninitialized storage at out and ends
+        // the lifetimes of the source objects.  Elements whose relocation
+        // may throw are copied instead (as with std::move_if_noexcept), so
+        // that a throw leaves the source intact.
+        void relocate_for_growth(T * first, T * last, T * out)
+        {
+            if (v1_dtl::nothrow_relocatable<T>::value) {
+                stl_interfaces::uninitialized_relocate(first, last, out);
+            } else {
+                uninitialized_move_if_noexcept(first, last, out);
+                destroy(first, last);
+            }
+        }
+
+        // new_data must have the first size_ elements uninitialized, and the
+        // elements [size_, new_size) constructed.
+        void adopt_storage(
+            T * new_data, size_type new_capacity, size_type new_size)
+        {
+            try {
+                relocate_for_growth(data_, data_ + size_, new_data);
+            } catch (...) {
+                destroy(new_data + size_, new_data + new_size);
+                alloc_traits::deallocate(alloc(), new_data, new_capacity);
+                throw;
+            }
+            this->statistics().move(size_);
+            this->statistics().reallocate();
+            release_storage();
+            data_ = new_data;
+            size_ = new_size;
+            capacity_ = new_capacity;
+            this->invalidate_iterators();
+        }
+
+        void release_storage() noexcept
+        {
+            if (!is_inline())
+                alloc_traits::deallocate(alloc(), data_, capacity_);
+            data_ = inline_data();
+            capacity_ = N;
+        }
+
+        template<typename... Args>
+        T * grow_emplace(T * position, Args &&... args)
+        {
+            auto const index = size_type(position - data_);
+            auto const new_capacity = next_capacity(size_ + 1);
+            auto const new_data = allocate(new_capacity);
+            try {
+                alloc_traits::construct(
+                    alloc(), new_data + index, std::forward<Args>(args)...);
+            } catch (...) {
+                alloc_traits::deallocate(alloc(), new_data, new_capacity);
+                throw;
+            }
+            move_around(new_data, new_capacity, index, 1);
+            note_inserted(1);
+            return data_ + index;
+        }
+
+        template<typename ForwardIterator>
+        T * grow_insert(
+            T * position,
+            ForwardIterator first,
+            ForwardIterator last,
+            size_type insertions)
+        {
+            auto const index = size_type(position - data_);
+            auto const new_capacity = next_capacity(size_ + insertions);
+            auto const new_data = allocate(new_capacity);
+            T * it = new_data + index;
+            try {
+                for (; first != last; ++first, ++it) {
+                    alloc_traits::construct(alloc(), it, *first);
+                }
+            } catch (...) {
+                destroy(new_data + index, it);
+                alloc_traits::deallocate(alloc(), new_data, new_capacity);
+                throw;
+            }
+            move_around(new_data, new_capacity, index, insertions);
+            note_inserted(insertions);
+            return data_ + index;
+        }
+
+        // new_data has [index, index + n) constructed.  Moves the current
+        // elements around that gap, and takes ownership of new_data.
+        void move_around(
+            T * new_data, size_type new_capacity, size_type index, size_type n)
+        {
+            T * const position = data_ + index;
+            T * const old_end = data_ + size_;
+            if (v1_dtl::nothrow_relocatable<T>::value) {
+                stl_interfaces::uninitialized_relocate(
+                    data_, position, new_data);
+                stl_interfaces::uninitialized_relocate(
+                    position, old_end, new_data + index + n);
+            } else {
+                // The old elements are only destroyed once both halves have
+                // been copied, so a throw leaves *this unchanged.
+                try {
+                    uninitialized_move_if_noexcept(data_, position, new_data);
+                    try {
+                        uninitialized_move_if_noexcept(
+                            position, old_end, new_data + index + n);
+                    } catch (...) {
+                        destroy(new_data, new_data + index);
+                        throw;
+                    }
+                } catch (...) {
+                    destroy(new_data + index, new_data + index + n);
+                    alloc_traits::deallocate(alloc(), new_data, new_capacity);
+                    throw;
+                }
+                destroy(data_, old_end);
+            }
+            this->statistics().move(size_);
+            this->statistics().reallocate();
+            auto const new_size = size_ + n;
+            release_storage();
+            data_ = new_data;
+            size_ = new_size;
+            capacity_ = new_capacity;
+            this->invalidate_iterators();
+        }
+
+        // Requires that other's allocator compares equal to ours.
+        void steal_or_relocate(small_vector & other) noexcept(
+            v1_dtl::nothrow_relocatable<T>::value)
+        {
+            if (other.is_inline()) {
+                stl_interfaces::uninitialized_relocate(
+                    other.data_, other.data_ + other.size_, inline_data());
+                this->statistics().move(other.size_);
+                data_ = inline_data();
+                capacity_ = N;
+            } else {
+                data_ = other.data_;
+                capacity_ = other.capacity_;
+                other.data_ = other.inline_data();
+                other.capacity_ = N;
+            }
+            size_ = other.size_;
+            other.size_ = 0;
+            other.invalidate_iterators();
+        }
+
+        T * data_;
+        size_type size_;
+        size_type capacity_;
+        alignas(T) unsigned char buf_[(N ? N : 1) * sizeof(T)];
+#endif
+    };
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    template<typename T, std::size_t N, typename Allocator>
+    constexpr typename small_vector<T, N, Allocator>::size_type
+        small_vector<T, N, Allocator>::inline_capacity;
+#endif
+
+#if defined(__cpp_lib_memory_resource) || defined(BOOST_STL_INTERFACES_DOXYGEN)
+    namespace pmr {
+        /** A `small_vector` that allocates from a
+            `std::pmr::memory_resource`. */
+        template<typename T, std::size_t N>
+        using small_vector = stl_interfaces::
+            small_vector<T, N, std::pmr::polymorphic_allocator<T>>;
+    }
+#endif
+
+}}}
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+
+namespace std {
+    template<typename T, std::size_t N, typename Allocator>
+    struct hash<boost::stl_interfaces::small_vector<T, N, Allocator>>
+        : boost::stl_interfaces::container_hash<
+              boost::stl_interfaces::small_vector<T, N, Allocator>>
+    {
+    };
+}
+
+#endif
+
+#endif
@@ -0,0 +1,597 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_STATIC_VECTOR_HPP
+#define BOOST_STL_INTERFACES_STATIC_VECTOR_HPP
+
+#include <boost/stl_interfaces/checked_iterator.hpp>
+#include <boost/stl_interfaces/sequence_container_interface.hpp>
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+
+namespace boost { namespace stl_interfaces { inline namespace v1 {
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    namespace v1_dtl {
+        // Element types that may be stored in a plain array, and created,
+        // moved, and overwritten by assignment.
+        template<typename T>
+        using trivial_static_storage = std::integral_constant<
+            bool,
+            std::is_trivially_copyable<T>::value &&
+                std::is_trivially_default_constructible<T>::value &&
+                std::is_trivially_copy_assignable<T>::value>;
+
+        // The elements and size of a static_vector.  This is a separate
+        // base so that, for trivial T, the copy and move operations and the
+        // destructor are the implicit, trivial ones.
+        template<
+            typename T,
+            std::size_t N,
+            bool Trivial = trivial_static_storage<T>::value>
+        struct static_vector_storage
+        {
+            static_vector_storage() noexcept : size_(0) {}
+            static_vector_storage(static_vector_storage const & other) :
+                size_(0)
+            {
+                construct_from(
+                    other.elements(), other.elements() + other.size_);
+            }
+            static_vector_storage(static_vector_storage && other) noexcept(
+                std::is_nothrow_move_constructible<T>::value) :
+                size_(0)
+            {
+                construct_from(
+                    std::make_move_iterator(other.elements()),
+                    std::make_move_iterator(other.elements() + other.size_));
+            }
+            static_vector_storage &
+            operator=(static_vector_storage const & other)
+            {
+                if (&other != this)
+                    assign(other.elements(), other.elements() + other.size_);
+                return *this;
+            }
+            static_vector_storage &
+            operator=(static_vector_storage && other) noexcept(
+                std::is_nothrow_move_constructible<T>::value &&
+                std::is_nothrow_move_assignable<T>::value)
+            {
+                if (&other != this) {
+                    assign(
+                        std::make_move_iterator(other.elements()),
+                        std::make_move_iterator(
+                            other.elements() + other.size_));
+                }
+                return *this;
+            }
+            ~static_vector_storage()
+            {
+                destroy(elements(), elements() + size_);
+            }
+
+            T * elements() noexcept { return reinterpret_cast<T *>(buf_); }
+            T const * elements() const noexcept
+            {
+                return reinterpret_cast<T const *>(buf_);
+            }
+
+            static void destroy(T * first, T * last) noexcept
+            {
+                for (; first != last; ++first) {
+                    first->~T();
+                }
+            }
+
+            // Constructs the elements of [first, last) after the current
+            // ones.  If a constructor throws, the elements constructed so
+            // far remain part of *this.
+            template<typename Iter>
+            void append(Iter first, Iter last)
+            {
+                for (; first != last; ++first) {
+                    ::new (static_cast<void *>(elements() + size_)) T(*first);
+                    ++size_;
+                }
+            }
+
+            // The destructor does not run if a constructor throws, so this
+            // cleans up after append() itself.
+            template<typename Iter>
+            void construct_from(Iter first, Iter last)
+            {
+                try {
+                    append(first, last);
+                } catch (...) {
+                    destroy(elements(), elements() + size_);
+                    throw;
+                }
+            }
+
+            template<typename Iter>
+            void assign(Iter first, Iter last)
+            {
+                T * it = elements();
+                T * const old_end = it + size_;
+                for (; it != old_end && first != last; ++it, ++first) {
+                    *it = *first;
+                }
+                destroy(it, old_end);
+                size_ = std::size_t(it - elements());
+                append(first, last);
+            }
+
+            alignas(T) unsigned char buf_[(N ? N : 1) * sizeof(T)];
+            std::size_t size_;
+        };
+
+        template<typename T, std::size_t N>
+        struct static_vector_storage<T, N, true>
+        {
+#if defined(__cpp_lib_is_constant_evaluated) && 201907L <= __cpp_constexpr
+            constexpr static_vector_storage() noexcept
+            {
+                // Constant evaluation may not copy an element that was
+                // never written, which the implicit copy operations do.
+                if (std::is_constant_evaluated()) {
+                    for (auto & x : elems_) {
+                        x = T();
+                    }
+                }
+            }
+#else
+            static_vector_storage() noexcept {}
+#endif
+
+            constexpr T * elements() noexcept { return elems_; }
+            constexpr T const * elements() const noexcept { return elems_; }
+
+            static constexpr void destroy(T *, T *) noexcept {}
+
+            T elems_[N ? N : 1];
+            std::size_t size_ = 0;
+        };
+    }
+#endif
+
+    /** A contiguous, `std::vector`-like sequence container that stores up to
+        `N` elements within the object itself, and never allocates.  An
+        operation that would grow it past `N` elements throws
+        `std::length_error`; `emplace_back_unchecked()` and
+        `push_back_unchecked()` instead make not exceeding `N` a
+        precondition, and leave out the test of `size()` against `N`.
+
+        When `T` is trivially copyable, trivially default constructible, and
+        trivially copy assignable, the elements are stored in an array of
+        `T`, and are created, moved, and overwritten by assignment.  Copying,
+        moving, and destroying a `static_vector` are then trivial too; a
+        copy or a `swap()` is a fixed-size copy of the whole object, with no
+        loop over the elements, and erasing elements destroys nothing.  The
+        whole container may also be used in constant expressions in C++20.
+        Otherwise, `static_vector` is like `small_vector` without the
+        allocator, and moving it move-constructs each element, leaving the
+        moved-from elements in place.
+
+        In checked mode (see `BOOST_STL_INTERFACES_CHECKED`), the iterators
+        are `checked_iterator`s.  `insert()`, `emplace()` other than at the
+        end, `erase()`, `swap()`, and assignment invalidate all of them;
+        `push_back()` invalidates none.
+
+        `static_vector` reports its inserts, erases, element moves, and
+        growth to `statistics_policy_t<static_vector>`. */
+    template<typename T, std::size_t N>
+    struct static_vector
+        : sequence_container_interface<
+              static_vector<T, N>,
+              element_layout::contiguous>
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+        ,
+          private v1_dtl::static_vector_storage<T, N>
+#endif
+    {
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        using storage = v1_dtl::static_vector_storage<T, N>;
+        using trivial = v1_dtl::trivial_static_storage<T>;
+#endif
+
+    public:
+        using value_type = T;
+        using pointer = T *;
+        using const_pointer = T const *;
+        using reference = value_type &;
+        using const_reference = value_type const &;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using iterator = checked_iterator_t<T *>;
+        using const_iterator = checked_iterator_t<T const *>;
+        using reverse_iterator = stl_interfaces::reverse_iterator<iterator>;
+        using const_reverse_iterator =
+            stl_interfaces::reverse_iterator<const_iterator>;
+
+        static_vector() = default;
+        constexpr explicit static_vector(size_type n) { resize(n); }
+        constexpr static_vector(size_type n, T const & x) { resize(n, x); }
+        template<
+            typename ForwardIterator,
+            typename Enable = std::enable_if_t<std::is_convertible<
+                typename std::iterator_traits<
+                    ForwardIterator>::iterator_category,
+                std::forward_iterator_tag>::value>>
+        constexpr static_vector(ForwardIterator first, ForwardIterator last)
+        {
+            insert(end(), first, last);
+        }
+        constexpr static_vector(std::initializer_list<T> il) :
+            static_vector(il.begin(), il.end())
+        {}
+
+        constexpr iterator begin() noexcept
+        {
+            return this->make_iterator(this->elements());
+        }
+        constexpr iterator end() noexcept
+        {
+            return this->make_iterator(this->elements() + this->size_);
+        }
+
+        constexpr size_type size() const noexcept { return this->size_; }
+        constexpr size_type max_size() const noexcept { return N; }
+        constexpr size_type capacity() const noexcept { return N; }
+
+        constexpr void resize(size_type sz)
+        {
+            if (sz < this->size_) {
+                erase(begin() + sz, end());
+                return;
+            }
+            check_capacity(sz - this->size_);
+            auto const old_size = this->size_;
+            while (this->size_ < sz) {
+                construct(this->elements() + this->size_);
+                ++this->size_;
+            }
+            note_inserted(sz - old_size);
+        }
+        constexpr void resize(size_type sz, T const & x)
+        {
+            if (sz < this->size_) {
+                erase(begin() + sz, end());
+                return;
+            }
+            check_capacity(sz - this->size_);
+            auto const old_size = this->size_;
+            while (this->size_ < sz) {
+                construct(this->elements() + this->size_, x);
+                ++this->size_;
+            }
+            note_inserted(sz - old_size);
+        }
+        /** Throws `std::length_error` if `N < n`; does nothing otherwise. */
+        constexpr void reserve(size_type n)
+        {
+            if (N < n)
+                throw std::length_error("static_vector grew past N");
+        }
+        constexpr void shrink_to_fit() noexcept {}
+
+        template<typename... Args>
+        constexpr reference emplace_back(Args &&... args)
+        {
+            check_capacity(1);
+            return emplace_back_unchecked(std::forward<Args>(args)...);
+        }
+        /** Like `emplace_back()`, except that `size()` is not compared to
+            `N` (other than in checked mode).
+
+            \pre `size() < N` */
+        template<typename... Args>
+        constexpr reference emplace_back_unchecked(Args &&... args)
+        {
+            BOOST_STL_INTERFACES_CHECK(
+                this->size_ < N,
+                "emplace_back_unchecked() called on a full static_vector.");
+            T * const position = this->elements() + this->size_;
+            construct(position, std::forward<Args>(args)...);
+            ++this->size_;
+            note_inserted(1);
+            return *position;
+        }
+        /** \pre `size() < N` */
+        constexpr void push_back_unchecked(T const & x)
+        {
+            emplace_back_unchecked(x);
+        }
+        /** \pre `size() < N` */
+        constexpr void push_back_unchecked(T && x)
+        {
+            emplace_back_unchecked(std::move(x));
+        }
+
+        template<typename... Args>
+        constexpr iterator emplace(const_iterator pos, Args &&... args)
+        {
+            auto position = const_cast<T *>(stl_interfaces::unchecked(pos));
+            check_capacity(1);
+            T * const old_end = this->elements() + this->size_;
+            if (position == old_end) {
+                emplace_back_unchecked(std::forward<Args>(args)...);
+                return this->make_iterator(position);
+            }
+            // args may refer to an element of *this, so the new element is
+            // constructed before anything is shifted.
+            T x(std::forward<Args>(args)...);
+            this->invalidate_iterators();
+            emplace_impl(
+                position, old_end, std::move(x), this->size_, trivial{});
+            this->statistics().move(size_type(old_end - position));
+            note_inserted(1);
+            return this->make_iterator(position);
+        }
+        template<
+            typename ForwardIterator,
+            typename Enable = std::enable_if_t<std::is_convertible<
+                typename std::iterator_traits<
+                    ForwardIterator>::iterator_category,
+                std::forward_iterator_tag>::value>>
+        constexpr iterator
+        insert(const_iterator pos, ForwardIterator first, ForwardIterator last)
+        {
+            auto position = const_cast<T *>(stl_interfaces::unchecked(pos));
+            auto const insertions = size_type(std::distance(first, last));
+            if (!insertions)
+                return this->make_iterator(position);
+            check_capacity(insertions);
+            this->invalidate_iterators();
+            T * const old_end = this->elements() + this->size_;
+            insert_impl(
+                position,
+                old_end,
+                first,
+                last,
+                insertions,
+                this->size_,
+                trivial{});
+            this->statistics().move(size_type(old_end - position));
+            note_inserted(insertions);
+            return this->make_iterator(position);
+        }
+        constexpr iterator erase(const_iterator f, const_iterator l)
+        {
+            auto first = const_cast<T *>(stl_interfaces::unchecked(f));
+            auto last = const_cast<T *>(stl_interfaces::unchecked(l));
+            if (first == last)
+                return this->make_iterator(first);
+            this->invalidate_iterators();
+            T * const old_end = this->elements() + this->size_;
+            erase_impl(first, last, old_end, trivial{});
+            this->size_ -= size_type(last - first);
+            this->statistics().erase(size_type(last - first));
+            this->statistics().move(size_type(old_end - last));
+            return this->make_iterator(first);
+        }
+        constexpr void swap(static_vector & other) noexcept(
+            trivial::value || v1_dtl::nothrow_relocatable<T>::value)
+        {
+            if (&other == this)
+                return;
+            this->invalidate_iterators();
+            other.invalidate_iterators();
+            swap_impl(other, trivial{});
+        }
+
+        friend BOOST_STL_INTERFACES_HIDDEN_FRIEND_CONSTEXPR void
+        swap(static_vector & lhs, static_vector & rhs) noexcept(
+            noexcept(lhs.swap(rhs)))
+        {
+            lhs.swap(rhs);
+        }
+
+        using base_type = sequence_container_interface<
+            static_vector<T, N>,
+            element_layout::contiguous>;
+        using base_type::begin;
+        using base_type::end;
+        using base_type::insert;
+        using base_type::erase;
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        constexpr void check_capacity(size_type insertions) const
+        {
+            if (N - this->size_ < insertions)
+                throw std::length_error("static_vector grew past N");
+        }
+
+        constexpr void note_inserted(size_type n) noexcept
+        {
+            this->statistics().insert(n);
+            this->statistics().grow_to(this->size_);
+        }
+
+        template<typename... Args>
+        constexpr void construct(T * p, Args &&... args)
+        {
+            construct_impl(trivial{}, p, std::forward<Args>(args)...);
+        }
+        template<typename... Args>
+        static constexpr void
+        construct_impl(std::true_type, T * p, Args &&... args)
+        {
+            *p = T(std::forward<Args>(args)...);
+        }
+        template<typename... Args>
+        static void construct_impl(std::false_type, T * p, Args &&... args)
+        {
+            ::new (static_cast<void *>(p)) T(std::forward<Args>(args)...);
+        }
+
+        // Moves [position, old_end) up by one, puts x at position, and
+        // adds one to size.  In the nontrivial overloads, size covers each
+        // element built past old_end before anything that may throw, so
+        // that a throw does not leak it.
+        static constexpr void emplace_impl(
+            T * position,
+            T * old_end,
+            T && x,
+            std::size_t & size,
+            std::true_type) noexcept
+        {
+            std::copy_backward(position, old_end, old_end + 1);
+            *position = x;
+            ++size;
+        }
+        static void emplace_impl(
+            T * position,
+            T * old_end,
+            T && x,
+            std::size_t & size,
+            std::false_type)
+        {
+            if (v1_dtl::nothrow_relocatable<T>::value) {
+                stl_interfaces::uninitialized_relocate_backward(
+                    position, old_end, old_end + 1);
+                ::new (static_cast<void *>(position)) T(std::move(x));
+                ++size;
+            } else {
+                ::new (static_cast<void *>(old_end))
+                    T(std::move(*(old_end - 1)));
+                ++size;
+                std::move_backward(position, old_end - 1, old_end);
+                *position = std::move(x);
+            }
+        }
+
+        template<typename ForwardIterator>
+        static constexpr void insert_impl(
+            T * position,
+            T * old_end,
+            ForwardIterator first,
+            ForwardIterator last,
+            size_type insertions,
+            std::size_t & size,
+            std::true_type)
+        {
+            std::copy_backward(position, old_end, old_end + insertions);
+            std::copy(first, last, position);
+            size += insertions;
+        }
+        template<typename ForwardIterator>
+        static void insert_impl(
+            T * position,
+            T * old_end,
+            ForwardIterator first,
+            ForwardIterator last,
+            size_type insertions,
+            std::size_t & size,
+            std::false_type)
+        {
+            auto const tail = size_type(old_end - position);
+            if (insertions < tail) {
+                uninitialized_copy(
+                    std::make_move_iterator(old_end - insertions),
+                    std::make_move_iterator(old_end),
+                    old_end);
+                size += insertions;
+                std::move_backward(position, old_end - insertions, old_end);
+                std::copy(first, last, position);
+            } else {
+                auto const mid = std::next(first, tail);
+                uninitialized_copy(mid, last, old_end);
+                try {
+                    uninitialized_copy(
+                        std::make_move_iterator(position),
+                        std::make_move_iterator(old_end),
+                        position + insertions);
+                } catch (...) {
+                    storage::destroy(old_end, old_end + (insertions - tail));
+                    throw;
+                }
+                size += insertions;
+                std::copy(first, mid, position);
+            }
+        }
+
+        template<typename Iter>
+        static T * uninitialized_copy(Iter first, Iter last, T * out)
+        {
+            T * it = out;
+            try {
+                for (; first != last; ++first, ++it) {
+                    ::new (static_cast<void *>(it)) T(*first);
+                }
+            } catch (...) {
+                storage::destroy(out, it);
+                throw;
+            }
+            return it;
+        }
+
+        static constexpr void
+        erase_impl(T * first, T * last, T * old_end, std::true_type) noexcept
+        {
+            std::copy(last, old_end, first);
+        }
+        static void
+        erase_impl(T * first, T * last, T * old_end, std::false_type)
+        {
+            if (is_trivially_relocatable<T>::value) {
+                storage::destroy(first, last);
+                stl_interfaces::uninitialized_relocate(last, old_end, first);
+            } else {
+                storage::destroy(std::move(last, old_end, first), old_end);
+            }
+        }
+
+        constexpr void swap_impl(static_vector & other, std::true_type) noexcept
+        {
+            std::swap(
+                static_cast<storage &>(*this), static_cast<storage &>(other));
+        }
+        void swap_impl(static_vector & other, std::false_type) noexcept(
+            v1_dtl::nothrow_relocatable<T>::value)
+        {
+            static_vector * shorter = this;
+            static_vector * longer = &other;
+            if (longer->size_ < shorter->size_)
+                std::swap(shorter, longer);
+            auto const short_size = shorter->size_;
+            T * const short_data = shorter->elements();
+            T * const long_data = longer->elements();
+            std::swap_ranges(short_data, short_data + short_size, long_data);
+            stl_interfaces::uninitialized_relocate(
+                long_data + short_size,
+                long_data + longer->size_,
+                short_data + short_size);
+            this->statistics().move(short_size + longer->size_);
+            std::swap(this->size_, other.size_);
+        }
+#endif
+    };
+
+}}}
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+
+namespace std {
+    template<typename T, std::size_t N>
+    struct hash<boost::stl_interfaces::static_vector<T, N>>
+        : boost::stl_interfaces::container_hash<
+              boost::stl_interfaces::static_vector<T, N>>
+    {
+    };
+}
+
+#endif
+
+#endif
@@ -0,0 +1,162 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_STATISTICS_HPP
+#define BOOST_STL_INTERFACES_STATISTICS_HPP
+
+#include <atomic>
+#include <cstddef>
+
+
+namespace boost { namespace stl_interfaces { inline namespace v1 {
+
+    /** The statistics policy that containers use by default.  Every hook
+        does nothing.
+
+        A statistics policy is a class with these static member functions,
+        which a container calls as it works:
+
+        - `insert(n)`, after inserting `n` elements;
+        - `erase(n)`, after erasing `n` elements;
+        - `move(n)`, after moving or relocating `n` existing elements, as when
+          shifting them to make room, or moving them into new storage;
+        - `reallocate()`, after moving its elements into new storage;
+        - `grow_to(n)`, after growing to `n` elements; and
+        - `out_of_range()`, when `at()` is given an index out of range. */
+    struct null_statistics
+    {
+        static constexpr void insert(std::size_t) noexcept {}
+        static constexpr void erase(std::size_t) noexcept {}
+        static constexpr void move(std::size_t) noexcept {}
+        static constexpr void reallocate() noexcept {}
+        static constexpr void grow_to(std::size_t) noexcept {}
+        static constexpr void out_of_range() noexcept {}
+    };
+
+    /** The totals gathered by a `counting_statistics`. */
+    struct container_statistics
+    {
+        std::size_t inserts;
+        std::size_t erases;
+        std::size_t moves;
+        std::size_t reallocations;
+        std::size_t out_of_range;
+        /** The largest size reached by any single container. */
+        std::size_t peak_size;
+    };
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    namespace v1_dtl {
+        struct atomic_container_statistics
+        {
+            std::atomic<std::size_t> inserts;
+            std::atomic<std::size_t> erases;
+            std::atomic<std::size_t> moves;
+            std::atomic<std::size_t> reallocations;
+            std::atomic<std::size_t> out_of_range;
+            std::atomic<std::size_t> peak_size;
+        };
+    }
+#endif
+
+    /** A statistics policy that totals the events of every container that
+        uses it, with relaxed atomic operations, so that it may be used from
+        multiple threads.  Each `Tag` gets its own totals; using the
+        container type itself as `Tag` gives per-type totals. */
+    template<typename Tag>
+    struct counting_statistics
+    {
+        static void insert(std::size_t n) noexcept
+        {
+            counters_.inserts.fetch_add(n, std::memory_order_relaxed);
+        }
+        static void erase(std::size_t n) noexcept
+        {
+            counters_.erases.fetch_add(n, std::memory_order_relaxed);
+        }
+        static void move(std::size_t n) noexcept
+        {
+            counters_.moves.fetch_add(n, std::memory_order_relaxed);
+        }
+        static void reallocate() noexcept
+        {
+            counters_.reallocations.fetch_add(1, std::memory_order_relaxed);
+        }
+        static void grow_to(std::size_t n) noexcept
+        {
+            auto peak = counters_.peak_size.load(std::memory_order_relaxed);
+            while (peak < n && !counters_.peak_size.compare_exchange_weak(
+                                   peak, n, std::memory_order_relaxed)) {
+            }
+        }
+        static void out_of_range() noexcept
+        {
+            counters_.out_of_range.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        /** Returns the totals so far. */
+        static container_statistics get() noexcept
+        {
+            auto const load = [](std::atomic<std::size_t> const & x) {
+                return x.load(std::memory_order_relaxed);
+            };
+            return {
+                load(counters_.inserts),
+                load(counters_.erases),
+                load(counters_.moves),
+                load(counters_.reallocations),
+                load(counters_.out_of_range),
+                load(counters_.peak_size)};
+        }
+
+        /** Sets all the totals to zero. */
+        static void reset() noexcept
+        {
+            counters_.inserts.store(0, std::memory_order_relaxed);
+            counters_.erases.store(0, std::memory_order_relaxed);
+            counters_.moves.store(0, std::memory_order_relaxed);
+            counters_.reallocations.store(0, std::memory_order_relaxed);
+            counters_.out_of_range.store(0, std::memory_order_relaxed);
+            counters_.peak_size.store(0, std::memory_order_relaxed);
+        }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        static v1_dtl::atomic_container_statistics counters_;
+#endif
+    };
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    template<typename Tag>
+    v1_dtl::atomic_container_statistics counting_statistics<Tag>::counters_;
+#endif
+
+    /** The statistics policy used by `Container`.  Specialize this to select
+        a policy for a particular container type.
+
+        `type` is `null_statistics`, unless
+        `BOOST_STL_INTERFACES_STATISTICS_POLICY` is defined to the name of a
+        policy template, such as `boost::stl_interfaces::counting_statistics`,
+        in which case it is `BOOST_STL_INTERFACES_STATISTICS_POLICY<Container>`
+        for every container.  Like any specialization, a `statistics_policy`
+        specialization, and that macro, must be the same in every translation
+        unit. */
+    template<typename Container>
+    struct statistics_policy
+    {
+#if defined(BOOST_STL_INTERFACES_STATISTICS_POLICY)
+        using type = BOOST_STL_INTERFACES_STATISTICS_POLICY<Container>;
+#else
+        using type = null_statistics;
+#endif
+    };
+
+    /** An alias for `statistics_policy<Container>::type`. */
+    template<typename Container>
+    using statistics_policy_t = typename statistics_policy<Container>::type;
+
+}}}
+
+#endif
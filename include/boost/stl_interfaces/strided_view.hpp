@@ -0,0 +1,507 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_STRIDED_VIEW_HPP
+#define BOOST_STL_INTERFACES_STRIDED_VIEW_HPP
+
+#include <boost/stl_interfaces/iterator_interface.hpp>
+#include <boost/stl_interfaces/view_interface.hpp>
+
+#include <boost/assert.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+
+namespace boost { namespace stl_interfaces { inline namespace v1 {
+
+    /** A view of the elements of a contiguous buffer `[first, last)`, which
+        it does not own.  This is the type of each row of a `matrix_view`. */
+    template<typename T>
+    struct contiguous_view
+        : view_interface<contiguous_view<T>, element_layout::contiguous>
+    {
+        using value_type = std::remove_cv_t<T>;
+        using iterator = T *;
+
+        constexpr contiguous_view() noexcept = default;
+        constexpr contiguous_view(T * first, T * last) noexcept :
+            first_(first), last_(last)
+        {}
+        template<
+            typename U,
+            typename Enable =
+                std::enable_if_t<std::is_convertible<U *, T *>::value>>
+        constexpr contiguous_view(contiguous_view<U> other) noexcept :
+            first_(other.begin()), last_(other.end())
+        {}
+
+        constexpr iterator begin() const noexcept { return first_; }
+        constexpr iterator end() const noexcept { return last_; }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        T * first_ = nullptr;
+        T * last_ = nullptr;
+#endif
+    };
+
+    /** A random access iterator over every `stride`-th element of a buffer.
+
+        The iterator keeps the buffer position it started from and an
+        element index, rather than a pointer it steps by `stride`.  Advancing
+        and taking differences are then a single addition or subtraction,
+        and an iterator one past the last element never forms a pointer
+        outside the buffer (as `first + n * stride` would for a column of a
+        matrix, say). */
+    template<typename T>
+    struct strided_iterator : iterator_interface<
+                                  strided_iterator<T>,
+                                  std::random_access_iterator_tag,
+                                  std::remove_cv_t<T>,
+                                  T &,
+                                  T *>
+    {
+        constexpr strided_iterator() noexcept = default;
+
+        /** Constructs an iterator to the `n`-th element of the sequence
+            `first[0]`, `first[stride]`, `first[2 * stride]`, .... */
+        constexpr strided_iterator(
+            T * first, std::ptrdiff_t stride, std::ptrdiff_t n = 0) noexcept
+            :
+            first_(first), stride_(stride), n_(n)
+        {}
+        template<
+            typename U,
+            typename Enable =
+                std::enable_if_t<std::is_convertible<U *, T *>::value>>
+        constexpr strided_iterator(strided_iterator<U> other) noexcept :
+            first_(other.first_), stride_(other.stride_), n_(other.n_)
+        {}
+
+        /** Returns a pointer to the current element.
+
+            \pre `*this` is dereferenceable. */
+        constexpr T * base() const noexcept { return first_ + n_ * stride_; }
+
+        constexpr std::ptrdiff_t stride() const noexcept { return stride_; }
+
+        constexpr T & operator*() const noexcept
+        {
+            return first_[n_ * stride_];
+        }
+        constexpr strided_iterator & operator+=(std::ptrdiff_t n) noexcept
+        {
+            n_ += n;
+            return *this;
+        }
+        constexpr std::ptrdiff_t operator-(strided_iterator other) const
+            noexcept
+        {
+            BOOST_ASSERT(first_ == other.first_ && stride_ == other.stride_);
+            return n_ - other.n_;
+        }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        template<typename U>
+        friend struct strided_iterator;
+
+        T * first_ = nullptr;
+        std::ptrdiff_t stride_ = 1;
+        std::ptrdiff_t n_ = 0;
+#endif
+    };
+
+    /** A view of `size` elements of a buffer, each `stride` elements after
+        the one before it, which it does not own.  `stride` may be negative,
+        to walk the buffer backward from `first`, or zero, to repeat
+        `*first`.
+
+        Unlike `stride_view`, which steps any view one element at a time and
+        has to guard against running off its end, a `strided_view` knows its
+        size up front, so its iterators advance in constant time without
+        touching the elements in between. */
+    template<typename T>
+    struct strided_view : view_interface<strided_view<T>>
+    {
+        using value_type = std::remove_cv_t<T>;
+        using iterator = strided_iterator<T>;
+
+        constexpr strided_view() noexcept = default;
+
+        /** \pre `0 <= size` */
+        constexpr strided_view(
+            T * first, std::ptrdiff_t size, std::ptrdiff_t stride) noexcept :
+            first_(first), size_(size), stride_(stride)
+        {
+            BOOST_ASSERT(0 <= size);
+        }
+        template<
+            typename U,
+            typename Enable =
+                std::enable_if_t<std::is_convertible<U *, T *>::value>>
+        constexpr strided_view(strided_view<U> other) noexcept :
+            first_(other.begin().base()),
+            size_(other.size()),
+            stride_(other.stride())
+        {}
+
+        constexpr iterator begin() const noexcept
+        {
+            return iterator(first_, stride_);
+        }
+        constexpr iterator end() const noexcept
+        {
+            return iterator(first_, stride_, size_);
+        }
+
+        constexpr std::ptrdiff_t stride() const noexcept { return stride_; }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        T * first_ = nullptr;
+        std::ptrdiff_t size_ = 0;
+        std::ptrdiff_t stride_ = 1;
+#endif
+    };
+
+    /** A view of a `rows` by `cols` block of elements in a row-major buffer,
+        where the start of each row is `row_stride` elements after the start
+        of the one before it.  The view does not own the buffer.
+
+        A `matrix_view` is a random access range of its rows, each of which
+        is a `contiguous_view`.  Its columns are `strided_view`s, and
+        `submatrix()` selects a smaller block without copying. */
+    template<typename T>
+    struct matrix_view : view_interface<matrix_view<T>>
+    {
+        using element_type = T;
+        using row_type = contiguous_view<T>;
+        using column_type = strided_view<T>;
+
+        struct iterator;
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        using iterator_base = proxy_iterator_interface<
+            iterator,
+            std::random_access_iterator_tag,
+            row_type>;
+#endif
+
+    public:
+        /** An iterator over the rows of a `matrix_view`. */
+        struct iterator : iterator_base
+        {
+            constexpr iterator() noexcept = default;
+
+            constexpr row_type operator*() const noexcept
+            {
+                T * const first = data_ + row_ * row_stride_;
+                return row_type(first, first + cols_);
+            }
+            constexpr iterator & operator+=(std::ptrdiff_t n) noexcept
+            {
+                row_ += n;
+                return *this;
+            }
+            constexpr std::ptrdiff_t operator-(iterator other) const noexcept
+            {
+                BOOST_ASSERT(data_ == other.data_);
+                return row_ - other.row_;
+            }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+        private:
+            friend matrix_view;
+
+            constexpr iterator(
+                T * data,
+                std::ptrdiff_t cols,
+                std::ptrdiff_t row_stride,
+                std::ptrdiff_t row) noexcept :
+                data_(data), cols_(cols), row_stride_(row_stride), row_(row)
+            {}
+
+            T * data_ = nullptr;
+            std::ptrdiff_t cols_ = 0;
+            std::ptrdiff_t row_stride_ = 0;
+            std::ptrdiff_t row_ = 0;
+#endif
+        };
+
+        constexpr matrix_view() noexcept = default;
+
+        /** \pre `0 <= rows && 0 <= cols && cols <= row_stride` */
+        constexpr matrix_view(
+            T * data,
+            std::ptrdiff_t rows,
+            std::ptrdiff_t cols,
+            std::ptrdiff_t row_stride) noexcept :
+            data_(data), rows_(rows), cols_(cols), row_stride_(row_stride)
+        {
+            BOOST_ASSERT(0 <= rows && 0 <= cols && cols <= row_stride);
+        }
+        /** Constructs a view of a buffer whose rows are back-to-back.
+
+            \pre `0 <= rows && 0 <= cols` */
+        constexpr matrix_view(
+            T * data, std::ptrdiff_t rows, std::ptrdiff_t cols) noexcept :
+            matrix_view(data, rows, cols, cols)
+        {}
+        template<
+            typename U,
+            typename Enable =
+                std::enable_if_t<std::is_convertible<U *, T *>::value>>
+        constexpr matrix_view(matrix_view<U> other) noexcept :
+            data_(other.data()),
+            rows_(other.rows()),
+            cols_(other.cols()),
+            row_stride_(other.row_stride())
+        {}
+
+        constexpr iterator begin() const noexcept
+        {
+            return iterator(data_, cols_, row_stride_, 0);
+        }
+        constexpr iterator end() const noexcept
+        {
+            return iterator(data_, cols_, row_stride_, rows_);
+        }
+
+        /** Returns a pointer to the first element of the first row. */
+        constexpr T * data() const noexcept { return data_; }
+        constexpr std::ptrdiff_t rows() const noexcept { return rows_; }
+        constexpr std::ptrdiff_t cols() const noexcept { return cols_; }
+        constexpr std::ptrdiff_t row_stride() const noexcept
+        {
+            return row_stride_;
+        }
+
+        /** \pre `0 <= i && i < rows() && 0 <= j && j < cols()` */
+        constexpr T & operator()(std::ptrdiff_t i, std::ptrdiff_t j) const
+            noexcept
+        {
+            BOOST_ASSERT(0 <= i && i < rows_ && 0 <= j && j < cols_);
+            return data_[i * row_stride_ + j];
+        }
+
+        /** \pre `0 <= i && i < rows()` */
+        constexpr row_type row(std::ptrdiff_t i) const noexcept
+        {
+            BOOST_ASSERT(0 <= i && i < rows_);
+            return *(begin() + i);
+        }
+        /** \pre `0 <= j && j < cols()` */
+        constexpr column_type column(std::ptrdiff_t j) const noexcept
+        {
+            BOOST_ASSERT(0 <= j && j < cols_);
+            return column_type(data_ + j, rows_, row_stride_);
+        }
+
+        /** Returns the `rows` by `cols` block whose first element is
+            `(*this)(i, j)`.
+
+            \pre `0 <= i && 0 <= rows && i + rows <= this->rows()`
+            \pre `0 <= j && 0 <= cols && j + cols <= this->cols()` */
+        constexpr matrix_view submatrix(
+            std::ptrdiff_t i,
+            std::ptrdiff_t j,
+            std::ptrdiff_t rows,
+            std::ptrdiff_t cols) const noexcept
+        {
+            BOOST_ASSERT(0 <= i && 0 <= rows && i + rows <= rows_);
+            BOOST_ASSERT(0 <= j && 0 <= cols && j + cols <= cols_);
+            return matrix_view(
+                rows && cols ? data_ + i * row_stride_ + j : data_,
+                rows,
+                cols,
+                row_stride_);
+        }
+
+        /** Returns true iff there is no gap between one row and the next,
+            in which case `elements()` may be called. */
+        constexpr bool is_contiguous() const noexcept
+        {
+            return rows_ <= 1 || cols_ == row_stride_;
+        }
+        /** Returns all the elements, in row-major order, as a single
+            contiguous range.
+
+            \pre `is_contiguous()` */
+        constexpr row_type elements() const noexcept
+        {
+            BOOST_ASSERT(is_contiguous());
+            return row_type(data_, data_ + rows_ * cols_);
+        }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        T * data_ = nullptr;
+        std::ptrdiff_t rows_ = 0;
+        std::ptrdiff_t cols_ = 0;
+        std::ptrdiff_t row_stride_ = 0;
+#endif
+    };
+
+    /** A view of a `matrix_view` as a sequence of `tile_rows` by
+        `tile_cols` tiles, in row-major order.  Each tile is itself a
+        `matrix_view` of the elements it covers; the tiles along the bottom
+        and right edges are smaller when the matrix's dimensions are not
+        multiples of the tile's.
+
+        Visiting the tiles in order, and the rows of each tile in order,
+        gives a cache-blocked traversal of the matrix: each tile's rows can
+        be made to fit in cache together, where visiting a whole column of
+        the matrix touches a different cache line for every element.  The
+        iterators are random access, and map a tile index to its position
+        in closed form. */
+    template<typename T>
+    struct tiled_view : view_interface<tiled_view<T>>
+    {
+        using tile_type = matrix_view<T>;
+
+        struct iterator;
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        using iterator_base = proxy_iterator_interface<
+            iterator,
+            std::random_access_iterator_tag,
+            tile_type>;
+#endif
+
+    public:
+        /** An iterator over the tiles of a `tiled_view`. */
+        struct iterator : iterator_base
+        {
+            constexpr iterator() noexcept = default;
+
+            constexpr tile_type operator*() const noexcept
+            {
+                std::ptrdiff_t const i = tile_row() * tile_rows_;
+                std::ptrdiff_t const j = tile_column() * tile_cols_;
+                std::ptrdiff_t const rows = matrix_.rows() - i;
+                std::ptrdiff_t const cols = matrix_.cols() - j;
+                return matrix_.submatrix(
+                    i,
+                    j,
+                    tile_rows_ < rows ? tile_rows_ : rows,
+                    tile_cols_ < cols ? tile_cols_ : cols);
+            }
+            constexpr iterator & operator+=(std::ptrdiff_t n) noexcept
+            {
+                n_ += n;
+                return *this;
+            }
+            constexpr std::ptrdiff_t operator-(iterator other) const noexcept
+            {
+                BOOST_ASSERT(matrix_.data() == other.matrix_.data());
+                return n_ - other.n_;
+            }
+
+            /** Returns the index of the row of tiles the current tile is
+                in.
+
+                \pre `*this` is dereferenceable. */
+            constexpr std::ptrdiff_t tile_row() const noexcept
+            {
+                return n_ / tiles_across_;
+            }
+            /** Returns the index of the column of tiles the current tile is
+                in.
+
+                \pre `*this` is dereferenceable. */
+            constexpr std::ptrdiff_t tile_column() const noexcept
+            {
+                return n_ % tiles_across_;
+            }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+        private:
+            friend tiled_view;
+
+            constexpr iterator(
+                tile_type matrix,
+                std::ptrdiff_t tile_rows,
+                std::ptrdiff_t tile_cols,
+                std::ptrdiff_t tiles_across,
+                std::ptrdiff_t n) noexcept :
+                matrix_(matrix),
+                tile_rows_(tile_rows),
+                tile_cols_(tile_cols),
+                tiles_across_(tiles_across),
+                n_(n)
+            {}
+
+            tile_type matrix_;
+            std::ptrdiff_t tile_rows_ = 1;
+            std::ptrdiff_t tile_cols_ = 1;
+            std::ptrdiff_t tiles_across_ = 1;
+            std::ptrdiff_t n_ = 0;
+#endif
+        };
+
+        constexpr tiled_view() noexcept = default;
+
+        /** \pre `0 < tile_rows && 0 < tile_cols` */
+        constexpr tiled_view(
+            tile_type matrix,
+            std::ptrdiff_t tile_rows,
+            std::ptrdiff_t tile_cols) noexcept :
+            matrix_(matrix), tile_rows_(tile_rows), tile_cols_(tile_cols)
+        {
+            BOOST_ASSERT(0 < tile_rows && 0 < tile_cols);
+        }
+
+        constexpr iterator begin() const noexcept
+        {
+            return iterator(
+                matrix_, tile_rows_, tile_cols_, tiles_across(), 0);
+        }
+        constexpr iterator end() const noexcept
+        {
+            return iterator(
+                matrix_,
+                tile_rows_,
+                tile_cols_,
+                tiles_across(),
+                tiles_down() * tiles_across());
+        }
+
+        constexpr tile_type base() const noexcept { return matrix_; }
+        constexpr std::ptrdiff_t tile_rows() const noexcept
+        {
+            return tile_rows_;
+        }
+        constexpr std::ptrdiff_t tile_cols() const noexcept
+        {
+            return tile_cols_;
+        }
+
+        /** Returns the number of rows of tiles. */
+        constexpr std::ptrdiff_t tiles_down() const noexcept
+        {
+            return (matrix_.rows() + tile_rows_ - 1) / tile_rows_;
+        }
+        /** Returns the number of columns of tiles. */
+        constexpr std::ptrdiff_t tiles_across() const noexcept
+        {
+            return (matrix_.cols() + tile_cols_ - 1) / tile_cols_;
+        }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        tile_type matrix_;
+        std::ptrdiff_t tile_rows_ = 1;
+        std::ptrdiff_t tile_cols_ = 1;
+#endif
+    };
+
+}}}
+
+#endif
@@ -198,6 +198,71 @@ namespace boost { namespace stl_interfaces { inline namespace v1 {
         return !(lhs == rhs);
     }
 
+    /** A member that a view may use to memoize the result of a `begin()`
+        that is too expensive to compute on every call, such as the search
+        for the first element in a `drop_while_view`.  Since the members of
+        `view_interface` (`empty()`, `front()`, `size()`, etc.) are all
+        implemented in terms of `begin()`, a view that caches its `begin()`
+        iterator searches only once, no matter how it is used; this is what
+        C++20 requires of `std::ranges::drop_while_view` and similar views.
+
+        Since the cached iterator refers into the view's underlying range,
+        a copy of a `cached_begin` starts out empty, and assigning to a
+        `cached_begin` empties it, as does moving from it.  A view that uses
+        `cached_begin` only provides a non-`const` `begin()`. */
+    template<typename Iterator>
+    struct cached_begin
+    {
+        constexpr cached_begin() noexcept(
+            std::is_nothrow_default_constructible<Iterator>::value) = default;
+        constexpr cached_begin(cached_begin const &) noexcept(
+            std::is_nothrow_default_constructible<Iterator>::value)
+        {}
+        constexpr cached_begin(cached_begin && other) noexcept(
+            std::is_nothrow_default_constructible<Iterator>::value)
+        {
+            other.reset();
+        }
+        constexpr cached_begin & operator=(cached_begin const & other) noexcept
+        {
+            if (this != &other)
+                reset();
+            return *this;
+        }
+        constexpr cached_begin & operator=(cached_begin && other) noexcept
+        {
+            reset();
+            other.reset();
+            return *this;
+        }
+
+        /** Returns true iff an iterator is cached. */
+        constexpr bool has_value() const noexcept { return cached_; }
+
+        /** Returns the cached iterator if there is one; otherwise, caches
+            and returns the result of `f()`. */
+        template<typename F>
+        constexpr Iterator get(F && f)
+        {
+            if (!cached_) {
+                it_ = static_cast<F &&>(f)();
+                cached_ = true;
+            }
+            return it_;
+        }
+
+        /** Empties the cache.  A view should call this if its underlying
+            range changes in a way that may invalidate the cached
+            iterator. */
+        constexpr void reset() noexcept { cached_ = false; }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        Iterator it_ = Iterator();
+        bool cached_ = false;
+#endif
+    };
+
 }}}
 
 
@@ -209,7 +274,9 @@ namespace boost { namespace stl_interfaces { namespace v2 {
     /** A template alias for `std::view_interface`.  This only exists to make
         migration from Boost.STLInterfaces to C++20 easier; switch to the one
         in `std` as soon as you can. */
-    template<typename D, bool = v1::discontiguous>
+    template<
+        typename D,
+        element_layout = element_layout::discontiguous>
     using view_interface = std::ranges::view_interface<D>;
 
 }}}
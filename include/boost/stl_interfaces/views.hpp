@@ -0,0 +1,1556 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_VIEWS_HPP
+#define BOOST_STL_INTERFACES_VIEWS_HPP
+
+#include <boost/stl_interfaces/iterator_interface.hpp>
+#include <boost/stl_interfaces/view_interface.hpp>
+
+#include <boost/assert.hpp>
+
+#include <utility>
+
+
+namespace boost { namespace stl_interfaces { inline namespace v1 {
+
+    namespace v1_dtl {
+        template<typename Range>
+        using adl_iterator_t =
+            decltype(detail::adl_begin(std::declval<Range &>()));
+        template<typename Range>
+        using adl_sentinel_t =
+            decltype(detail::adl_end(std::declval<Range &>()));
+
+        template<typename Range, typename = void>
+        struct is_range : std::false_type
+        {
+        };
+        template<typename Range>
+        struct is_range<
+            Range,
+            void_t<adl_iterator_t<Range>, adl_sentinel_t<Range>>>
+            : std::true_type
+        {
+        };
+
+        template<typename Range>
+        using is_common_range =
+            std::is_same<adl_iterator_t<Range>, adl_sentinel_t<Range>>;
+
+        template<typename T, typename = void>
+        struct is_view : std::false_type
+        {
+        };
+        template<typename T>
+        struct is_view<
+            T,
+            void_t<decltype(derived_view(std::declval<T const &>()))>>
+            : std::true_type
+        {
+        };
+
+        template<typename Iter>
+        using iter_category_t =
+            typename std::iterator_traits<Iter>::iterator_category;
+        template<typename Iter>
+        using iter_value_t = typename std::iterator_traits<Iter>::value_type;
+        template<typename Iter>
+        using iter_reference_t =
+            typename std::iterator_traits<Iter>::reference;
+
+        template<typename Iter, typename Tag>
+        using has_category = std::is_base_of<Tag, iter_category_t<Iter>>;
+
+        // The category of Iter, weakened to at most Cap.
+        template<typename Iter, typename Cap>
+        using capped_category_t = std::conditional_t<
+            has_category<Iter, Cap>::value,
+            Cap,
+            iter_category_t<Iter>>;
+
+        // Random access if Iter is; otherwise at most forward.  Views that
+        // only know where their last element is when they can compute it
+        // (take, stride, chunk) cannot step backward from end() otherwise.
+        template<typename Iter>
+        using forward_or_random_access_t = std::conditional_t<
+            has_category<Iter, std::random_access_iterator_tag>::value,
+            std::random_access_iterator_tag,
+            capped_category_t<Iter, std::forward_iterator_tag>>;
+
+        template<typename Reference>
+        using adaptor_pointer_t = std::conditional_t<
+            std::is_reference<Reference>::value,
+            std::add_pointer_t<std::remove_reference_t<Reference>>,
+            proxy_arrow_result<Reference>>;
+
+        // Advances it by up to n steps without passing last, and returns
+        // the number of steps not taken.
+        template<typename Iter>
+        constexpr iter_difference_t<Iter> advance_bounded(
+            Iter & it,
+            iter_difference_t<Iter> n,
+            Iter last,
+            std::random_access_iterator_tag)
+        {
+            iter_difference_t<Iter> const m = last - it < n ? last - it : n;
+            it += m;
+            return n - m;
+        }
+        template<typename Iter>
+        constexpr iter_difference_t<Iter> advance_bounded(
+            Iter & it,
+            iter_difference_t<Iter> n,
+            Iter last,
+            std::input_iterator_tag)
+        {
+            for (; n && it != last; --n) {
+                ++it;
+            }
+            return n;
+        }
+        template<typename Iter>
+        constexpr iter_difference_t<Iter>
+        advance_bounded(Iter & it, iter_difference_t<Iter> n, Iter last)
+        {
+            return v1_dtl::advance_bounded(
+                it, n, last, iter_category_t<Iter>{});
+        }
+
+        // The position of a stride_view or chunk_view iterator.  missing_
+        // is the part of the last stride that ran past last_; it is only
+        // ever nonzero at the end, and lets a random access iterator step
+        // back from the end to the start of the last stride.
+        template<typename Iter>
+        struct strided_cursor
+        {
+            using difference_type = iter_difference_t<Iter>;
+
+            constexpr strided_cursor() = default;
+            constexpr strided_cursor(
+                Iter it,
+                Iter last,
+                difference_type stride,
+                difference_type missing) :
+                it_(it), last_(last), stride_(stride), missing_(missing)
+            {}
+
+            constexpr void next()
+            {
+                missing_ = v1_dtl::advance_bounded(it_, stride_, last_);
+            }
+            constexpr void prev()
+            {
+                it_ += missing_ - stride_;
+                missing_ = 0;
+            }
+            constexpr void advance(difference_type n)
+            {
+                if (0 < n) {
+                    it_ += stride_ * (n - 1);
+                    missing_ = v1_dtl::advance_bounded(it_, stride_, last_);
+                } else if (n < 0) {
+                    it_ += stride_ * n + missing_;
+                    missing_ = 0;
+                }
+            }
+            constexpr difference_type distance(strided_cursor other) const
+            {
+                return (it_ - other.it_ + missing_ - other.missing_) / stride_;
+            }
+
+            Iter it_ = Iter();
+            Iter last_ = Iter();
+            difference_type stride_ = 0;
+            difference_type missing_ = 0;
+        };
+
+        template<typename View>
+        constexpr strided_cursor<adl_iterator_t<View>>
+        strided_begin(View & v, iter_difference_t<adl_iterator_t<View>> n)
+        {
+            return {v.begin(), v.end(), n, 0};
+        }
+
+        template<typename Iter>
+        constexpr iter_difference_t<Iter> strided_end_missing(
+            Iter first,
+            Iter last,
+            iter_difference_t<Iter> n,
+            std::true_type)
+        {
+            return (n - (last - first) % n) % n;
+        }
+        template<typename Iter>
+        constexpr iter_difference_t<Iter> strided_end_missing(
+            Iter, Iter, iter_difference_t<Iter>, std::false_type)
+        {
+            return 0;
+        }
+
+        template<typename View>
+        constexpr strided_cursor<adl_iterator_t<View>>
+        strided_end(View & v, iter_difference_t<adl_iterator_t<View>> n)
+        {
+            using iter = adl_iterator_t<View>;
+            iter const last = v.end();
+            return {
+                last,
+                last,
+                n,
+                v1_dtl::strided_end_missing(
+                    v.begin(),
+                    last,
+                    n,
+                    has_category<iter, std::random_access_iterator_tag>{})};
+        }
+    }
+
+    /** An iterator-sentinel pair, as a view.  This is a simplified version
+        of C++20's `std::ranges::subrange`. */
+    template<typename Iterator, typename Sentinel = Iterator>
+    struct subrange : view_interface<subrange<Iterator, Sentinel>>
+    {
+        constexpr subrange() = default;
+        constexpr subrange(Iterator first, Sentinel last) :
+            first_(first), last_(last)
+        {}
+
+        constexpr Iterator begin() const { return first_; }
+        constexpr Sentinel end() const { return last_; }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        Iterator first_ = Iterator();
+        Sentinel last_ = Sentinel();
+#endif
+    };
+
+    /** A view of all the elements of an lvalue range of type `Range`, which
+        refers to the range rather than copying it.  This is a pre-C++20
+        version of `std::ranges::ref_view`. */
+    template<typename Range>
+    struct ref_view : view_interface<ref_view<Range>>
+    {
+        constexpr ref_view() = default;
+        constexpr ref_view(Range & r) noexcept : r_(std::addressof(r)) {}
+
+        constexpr Range & base() const noexcept { return *r_; }
+
+        constexpr v1_dtl::adl_iterator_t<Range> begin() const
+        {
+            return detail::adl_begin(*r_);
+        }
+        constexpr v1_dtl::adl_sentinel_t<Range> end() const
+        {
+            return detail::adl_end(*r_);
+        }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        Range * r_ = nullptr;
+#endif
+    };
+
+    /** A view that owns an rvalue range of type `Range` moved into it.  This
+        is a pre-C++20 version of `std::ranges::owning_view`. */
+    template<typename Range>
+    struct owning_view : view_interface<owning_view<Range>>
+    {
+        constexpr owning_view() = default;
+        constexpr owning_view(Range && r) : r_(std::move(r)) {}
+
+        constexpr Range & base() noexcept { return r_; }
+        constexpr Range const & base() const noexcept { return r_; }
+
+        constexpr v1_dtl::adl_iterator_t<Range> begin()
+        {
+            return detail::adl_begin(r_);
+        }
+        constexpr v1_dtl::adl_sentinel_t<Range> end()
+        {
+            return detail::adl_end(r_);
+        }
+        constexpr v1_dtl::adl_iterator_t<Range const> begin() const
+        {
+            return detail::adl_begin(r_);
+        }
+        constexpr v1_dtl::adl_sentinel_t<Range const> end() const
+        {
+            return detail::adl_end(r_);
+        }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        Range r_ = Range();
+#endif
+    };
+
+    namespace v1_dtl {
+        template<typename Range>
+        constexpr std::decay_t<Range> all_impl(Range && r, std::true_type)
+        {
+            return static_cast<Range &&>(r);
+        }
+        template<typename Range>
+        constexpr ref_view<Range> all_impl(Range & r, std::false_type)
+        {
+            return ref_view<Range>(r);
+        }
+        template<
+            typename Range,
+            typename Enable =
+                std::enable_if_t<!std::is_lvalue_reference<Range>::value>>
+        constexpr owning_view<Range> all_impl(Range && r, std::false_type)
+        {
+            return owning_view<Range>(std::move(r));
+        }
+    }
+
+    namespace views {
+        /** Returns a view of all the elements of `r`: a copy of `r` if it
+            is already a view (a type derived from `view_interface`), a
+            `ref_view` if it is an lvalue, and an `owning_view` otherwise.
+            This is a pre-C++20 version of `std::views::all`. */
+        template<
+            typename Range,
+            typename Enable =
+                std::enable_if_t<v1_dtl::is_range<Range>::value>>
+        constexpr auto all(Range && r) -> decltype(v1_dtl::all_impl(
+            static_cast<Range &&>(r),
+            v1_dtl::is_view<std::decay_t<Range>>{}))
+        {
+            return v1_dtl::all_impl(
+                static_cast<Range &&>(r),
+                v1_dtl::is_view<std::decay_t<Range>>{});
+        }
+
+        /** The type of `views::all(std::declval<Range>())`. */
+        template<typename Range>
+        using all_t = decltype(views::all(std::declval<Range>()));
+    }
+
+    /** A view of the elements of `View`, each transformed by a call to an
+        invocable of type `F`.  This is a pre-C++20 version of
+        `std::ranges::transform_view`.
+
+        The iterators are as strong as `View`'s, up to random access.  If
+        `F` returns a prvalue, the iterators are proxy iterators.  Like all
+        the adaptors in this header, `transform_view` requires `View` to be
+        a common range (one whose `begin()` and `end()` have the same type),
+        and it only has non-`const` `begin()` and `end()`. */
+    template<typename View, typename F>
+    struct transform_view : view_interface<transform_view<View, F>>
+    {
+        static_assert(v1_dtl::is_common_range<View>::value, "");
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        using base_iter = v1_dtl::adl_iterator_t<View>;
+        using iter_reference =
+            decltype(std::declval<F &>()(*std::declval<base_iter &>()));
+        using iter_concept = v1_dtl::
+            capped_category_t<base_iter, std::random_access_iterator_tag>;
+
+        static constexpr bool bidi =
+            v1_dtl::has_category<base_iter, std::bidirectional_iterator_tag>::
+                value;
+        static constexpr bool random_access = v1_dtl::
+            has_category<base_iter, std::random_access_iterator_tag>::value;
+#endif
+
+    public:
+        struct iterator;
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        using iterator_base = iterator_interface<
+            iterator,
+            iter_concept,
+            std::remove_cv_t<std::remove_reference_t<iter_reference>>,
+            iter_reference,
+            v1_dtl::adaptor_pointer_t<iter_reference>,
+            v1_dtl::iter_difference_t<base_iter>>;
+#endif
+
+    public:
+        struct iterator : iterator_base
+        {
+            using typename iterator_base::difference_type;
+            using typename iterator_base::reference;
+
+            constexpr iterator() = default;
+
+            /** Returns the underlying iterator. */
+            constexpr base_iter base() const { return it_; }
+
+            constexpr reference operator*() const { return parent_->f_(*it_); }
+
+            constexpr iterator & operator++()
+            {
+                ++it_;
+                return *this;
+            }
+            template<bool Bidi = bidi, typename Enable = std::enable_if_t<Bidi>>
+            constexpr iterator & operator--()
+            {
+                --it_;
+                return *this;
+            }
+            template<
+                bool RandomAccess = random_access,
+                typename Enable = std::enable_if_t<RandomAccess>>
+            constexpr iterator & operator+=(difference_type n)
+            {
+                it_ += n;
+                return *this;
+            }
+            template<
+                bool RandomAccess = random_access,
+                typename Enable = std::enable_if_t<RandomAccess>>
+            constexpr difference_type operator-(iterator other) const
+            {
+                return it_ - other.it_;
+            }
+
+            friend BOOST_STL_INTERFACES_HIDDEN_FRIEND_CONSTEXPR bool
+            operator==(iterator lhs, iterator rhs)
+            {
+                return lhs.it_ == rhs.it_;
+            }
+
+            using iterator_base::operator++;
+            using iterator_base::operator--;
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+        private:
+            friend transform_view;
+
+            constexpr iterator(transform_view & parent, base_iter it) :
+                parent_(std::addressof(parent)), it_(it)
+            {}
+
+            transform_view * parent_ = nullptr;
+            base_iter it_ = base_iter();
+#endif
+        };
+
+        constexpr transform_view() = default;
+        constexpr transform_view(View base, F f) :
+            base_(std::move(base)), f_(std::move(f))
+        {}
+
+        constexpr View base() const { return base_; }
+
+        constexpr iterator begin() { return iterator(*this, base_.begin()); }
+        constexpr iterator end() { return iterator(*this, base_.end()); }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        View base_ = View();
+        F f_;
+#endif
+    };
+
+    /** A view of the elements of `View` that satisfy a predicate of type
+        `Pred`.  This is a pre-C++20 version of
+        `std::ranges::filter_view`.
+
+        The iterators are at most bidirectional.  The search for the first
+        element that satisfies the predicate is done once, in the first
+        call to `begin()`, and cached (see `cached_begin`). */
+    template<typename View, typename Pred>
+    struct filter_view : view_interface<filter_view<View, Pred>>
+    {
+        static_assert(v1_dtl::is_common_range<View>::value, "");
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        using base_iter = v1_dtl::adl_iterator_t<View>;
+        using iter_reference = v1_dtl::iter_reference_t<base_iter>;
+
+        static constexpr bool bidi =
+            v1_dtl::has_category<base_iter, std::bidirectional_iterator_tag>::
+                value;
+#endif
+
+    public:
+        struct iterator;
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        using iterator_base = iterator_interface<
+            iterator,
+            v1_dtl::
+                capped_category_t<base_iter, std::bidirectional_iterator_tag>,
+            v1_dtl::iter_value_t<base_iter>,
+            iter_reference,
+            v1_dtl::adaptor_pointer_t<iter_reference>,
+            v1_dtl::iter_difference_t<base_iter>>;
+#endif
+
+    public:
+        struct iterator : iterator_base
+        {
+            using typename iterator_base::reference;
+
+            constexpr iterator() = default;
+
+            /** Returns the underlying iterator. */
+            constexpr base_iter base() const { return it_; }
+
+            constexpr reference operator*() const { return *it_; }
+
+            constexpr iterator & operator++()
+            {
+                it_ = parent_->find_next(++it_);
+                return *this;
+            }
+            template<bool Bidi = bidi, typename Enable = std::enable_if_t<Bidi>>
+            constexpr iterator & operator--()
+            {
+                do {
+                    --it_;
+                } while (!parent_->pred_(*it_));
+                return *this;
+            }
+
+            friend BOOST_STL_INTERFACES_HIDDEN_FRIEND_CONSTEXPR bool
+            operator==(iterator lhs, iterator rhs)
+            {
+                return lhs.it_ == rhs.it_;
+            }
+
+            using iterator_base::operator++;
+            using iterator_base::operator--;
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+        private:
+            friend filter_view;
+
+            constexpr iterator(filter_view & parent, base_iter it) :
+                parent_(std::addressof(parent)), it_(it)
+            {}
+
+            filter_view * parent_ = nullptr;
+            base_iter it_ = base_iter();
+#endif
+        };
+
+        constexpr filter_view() = default;
+        constexpr filter_view(View base, Pred pred) :
+            base_(std::move(base)), pred_(std::move(pred))
+        {}
+
+        constexpr View base() const { return base_; }
+        constexpr Pred const & pred() const noexcept { return pred_; }
+
+        constexpr iterator begin()
+        {
+            return iterator(
+                *this, first_.get([this] { return find_next(base_.begin()); }));
+        }
+        constexpr iterator end() { return iterator(*this, base_.end()); }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        constexpr base_iter find_next(base_iter it)
+        {
+            base_iter const last = base_.end();
+            while (it != last && !pred_(*it)) {
+                ++it;
+            }
+            return it;
+        }
+
+        View base_ = View();
+        Pred pred_;
+        cached_begin<base_iter> first_;
+#endif
+    };
+
+    /** A view of at most the first `n` elements of `View`.  This is a
+        pre-C++20 version of `std::ranges::take_view`.
+
+        The iterators are random access if `View`'s are; otherwise they are
+        at most forward.  An iterator counts the elements remaining, so
+        `take_view` is a common range even when `View` is not sized. */
+    template<typename View>
+    struct take_view : view_interface<take_view<View>>
+    {
+        static_assert(v1_dtl::is_common_range<View>::value, "");
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        using base_iter = v1_dtl::adl_iterator_t<View>;
+        using iter_reference = v1_dtl::iter_reference_t<base_iter>;
+
+        static constexpr bool random_access = v1_dtl::
+            has_category<base_iter, std::random_access_iterator_tag>::value;
+#endif
+
+    public:
+        using difference_type = v1_dtl::iter_difference_t<base_iter>;
+
+        struct iterator;
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        using iterator_base = iterator_interface<
+            iterator,
+            v1_dtl::forward_or_random_access_t<base_iter>,
+            v1_dtl::iter_value_t<base_iter>,
+            iter_reference,
+            v1_dtl::adaptor_pointer_t<iter_reference>,
+            difference_type>;
+#endif
+
+    public:
+        struct iterator : iterator_base
+        {
+            using typename iterator_base::reference;
+
+            constexpr iterator() = default;
+
+            /** Returns the underlying iterator. */
+            constexpr base_iter base() const { return it_; }
+
+            /** Returns the number of elements the iterator may still be
+                incremented past. */
+            constexpr difference_type count() const noexcept { return n_; }
+
+            constexpr reference operator*() const { return *it_; }
+
+            constexpr iterator & operator++()
+            {
+                ++it_;
+                --n_;
+                return *this;
+            }
+            template<
+                bool RandomAccess = random_access,
+                typename Enable = std::enable_if_t<RandomAccess>>
+            constexpr iterator & operator--()
+            {
+                --it_;
+                ++n_;
+                return *this;
+            }
+            template<
+                bool RandomAccess = random_access,
+                typename Enable = std::enable_if_t<RandomAccess>>
+            constexpr iterator & operator+=(difference_type n)
+            {
+                it_ += n;
+                n_ -= n;
+                return *this;
+            }
+            template<
+                bool RandomAccess = random_access,
+                typename Enable = std::enable_if_t<RandomAccess>>
+            constexpr difference_type operator-(iterator other) const
+            {
+                return other.n_ - n_;
+            }
+
+            // An iterator is at the end either when it has counted down to
+            // zero or when it has reached the end of the underlying range.
+            friend BOOST_STL_INTERFACES_HIDDEN_FRIEND_CONSTEXPR bool
+            operator==(iterator lhs, iterator rhs)
+            {
+                return lhs.n_ == rhs.n_ || lhs.it_ == rhs.it_;
+            }
+
+            using iterator_base::operator++;
+            using iterator_base::operator--;
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+        private:
+            friend take_view;
+
+            constexpr iterator(base_iter it, difference_type n) :
+                it_(it), n_(n)
+            {}
+
+            base_iter it_ = base_iter();
+            difference_type n_ = 0;
+#endif
+        };
+
+        constexpr take_view() = default;
+        constexpr take_view(View base, difference_type n) :
+            base_(std::move(base)), n_(n)
+        {
+            BOOST_ASSERT(0 <= n);
+        }
+
+        constexpr View base() const { return base_; }
+
+        constexpr iterator begin()
+        {
+            return iterator(base_.begin(), count(random_access_t{}));
+        }
+        constexpr iterator end() { return end_impl(random_access_t{}); }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        using random_access_t = std::integral_constant<bool, random_access>;
+
+        constexpr difference_type count(std::true_type)
+        {
+            difference_type const size = base_.end() - base_.begin();
+            return size < n_ ? size : n_;
+        }
+        constexpr difference_type count(std::false_type) { return n_; }
+
+        constexpr iterator end_impl(std::true_type)
+        {
+            return iterator(base_.begin() + count(std::true_type{}), 0);
+        }
+        constexpr iterator end_impl(std::false_type)
+        {
+            return iterator(base_.end(), 0);
+        }
+
+        View base_ = View();
+        difference_type n_ = 0;
+#endif
+    };
+
+    /** A view of every `n`-th element of `View`, starting with the first.
+        This is a pre-C++23 version of `std::ranges::stride_view`.
+
+        The iterators are random access if `View`'s are; otherwise they are
+        at most forward. */
+    template<typename View>
+    struct stride_view : view_interface<stride_view<View>>
+    {
+        static_assert(v1_dtl::is_common_range<View>::value, "");
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        using base_iter = v1_dtl::adl_iterator_t<View>;
+        using iter_reference = v1_dtl::iter_reference_t<base_iter>;
+        using cursor = v1_dtl::strided_cursor<base_iter>;
+
+        static constexpr bool random_access = v1_dtl::
+            has_category<base_iter, std::random_access_iterator_tag>::value;
+#endif
+
+    public:
+        using difference_type = v1_dtl::iter_difference_t<base_iter>;
+
+        struct iterator;
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        using iterator_base = iterator_interface<
+            iterator,
+            v1_dtl::forward_or_random_access_t<base_iter>,
+            v1_dtl::iter_value_t<base_iter>,
+            iter_reference,
+            v1_dtl::adaptor_pointer_t<iter_reference>,
+            difference_type>;
+#endif
+
+    public:
+        struct iterator : iterator_base
+        {
+            using typename iterator_base::reference;
+
+            constexpr iterator() = default;
+
+            /** Returns the underlying iterator. */
+            constexpr base_iter base() const { return pos_.it_; }
+
+            constexpr reference operator*() const { return *pos_.it_; }
+
+            constexpr iterator & operator++()
+            {
+                pos_.next();
+                return *this;
+            }
+            template<
+                bool RandomAccess = random_access,
+                typename Enable = std::enable_if_t<RandomAccess>>
+            constexpr iterator & operator--()
+            {
+                pos_.prev();
+                return *this;
+            }
+            template<
+                bool RandomAccess = random_access,
+                typename Enable = std::enable_if_t<RandomAccess>>
+            constexpr iterator & operator+=(difference_type n)
+            {
+                pos_.advance(n);
+                return *this;
+            }
+            template<
+                bool RandomAccess = random_access,
+                typename Enable = std::enable_if_t<RandomAccess>>
+            constexpr difference_type operator-(iterator other) const
+            {
+                return pos_.distance(other.pos_);
+            }
+
+            friend BOOST_STL_INTERFACES_HIDDEN_FRIEND_CONSTEXPR bool
+            operator==(iterator lhs, iterator rhs)
+            {
+                return lhs.pos_.it_ == rhs.pos_.it_;
+            }
+
+            using iterator_base::operator++;
+            using iterator_base::operator--;
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+        private:
+            friend stride_view;
+
+            constexpr iterator(cursor pos) : pos_(pos) {}
+
+            cursor pos_;
+#endif
+        };
+
+        constexpr stride_view() = default;
+        constexpr stride_view(View base, difference_type n) :
+            base_(std::move(base)), n_(n)
+        {
+            BOOST_ASSERT(0 < n);
+        }
+
+        constexpr View base() const { return base_; }
+        constexpr difference_type stride() const noexcept { return n_; }
+
+        constexpr iterator begin()
+        {
+            return iterator(v1_dtl::strided_begin(base_, n_));
+        }
+        constexpr iterator end()
+        {
+            return iterator(v1_dtl::strided_end(base_, n_));
+        }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        View base_ = View();
+        difference_type n_ = 1;
+#endif
+    };
+
+    /** A view of the elements of `View` in consecutive, non-overlapping
+        chunks of `n` elements.  Each element of a `chunk_view` is a
+        `subrange` of `View`'s iterators; the last one may be shorter than
+        `n`.  This is a pre-C++23 version of `std::ranges::chunk_view`, for
+        forward ranges only.
+
+        The iterators are random access if `View`'s are; otherwise they are
+        forward. */
+    template<typename View>
+    struct chunk_view : view_interface<chunk_view<View>>
+    {
+        static_assert(v1_dtl::is_common_range<View>::value, "");
+        static_assert(
+            v1_dtl::has_category<
+                v1_dtl::adl_iterator_t<View>,
+                std::forward_iterator_tag>::value,
+            "");
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        using base_iter = v1_dtl::adl_iterator_t<View>;
+        using cursor = v1_dtl::strided_cursor<base_iter>;
+
+        static constexpr bool random_access = v1_dtl::
+            has_category<base_iter, std::random_access_iterator_tag>::value;
+#endif
+
+    public:
+        using difference_type = v1_dtl::iter_difference_t<base_iter>;
+
+        struct iterator;
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        using iterator_base = proxy_iterator_interface<
+            iterator,
+            v1_dtl::forward_or_random_access_t<base_iter>,
+            subrange<base_iter>,
+            subrange<base_iter>,
+            difference_type>;
+#endif
+
+    public:
+        struct iterator : iterator_base
+        {
+            using typename iterator_base::reference;
+
+            constexpr iterator() = default;
+
+            /** Returns the underlying iterator to the start of the
+                chunk. */
+            constexpr base_iter base() const { return pos_.it_; }
+
+            constexpr reference operator*() const
+            {
+                base_iter last = pos_.it_;
+                v1_dtl::advance_bounded(last, pos_.stride_, pos_.last_);
+                return reference(pos_.it_, last);
+            }
+
+            constexpr iterator & operator++()
+            {
+                pos_.next();
+                return *this;
+            }
+            template<
+                bool RandomAccess = random_access,
+                typename Enable = std::enable_if_t<RandomAccess>>
+            constexpr iterator & operator--()
+            {
+                pos_.prev();
+                return *this;
+            }
+            template<
+                bool RandomAccess = random_access,
+                typename Enable = std::enable_if_t<RandomAccess>>
+            constexpr iterator & operator+=(difference_type n)
+            {
+                pos_.advance(n);
+                return *this;
+            }
+            template<
+                bool RandomAccess = random_access,
+                typename Enable = std::enable_if_t<RandomAccess>>
+            constexpr difference_type operator-(iterator other) const
+            {
+                return pos_.distance(other.pos_);
+            }
+
+            friend BOOST_STL_INTERFACES_HIDDEN_FRIEND_CONSTEXPR bool
+            operator==(iterator lhs, iterator rhs)
+            {
+                return lhs.pos_.it_ == rhs.pos_.it_;
+            }
+
+            using iterator_base::operator++;
+            using iterator_base::operator--;
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+        private:
+            friend chunk_view;
+
+            constexpr iterator(cursor pos) : pos_(pos) {}
+
+            cursor pos_;
+#endif
+        };
+
+        constexpr chunk_view() = default;
+        constexpr chunk_view(View base, difference_type n) :
+            base_(std::move(base)), n_(n)
+        {
+            BOOST_ASSERT(0 < n);
+        }
+
+        constexpr View base() const { return base_; }
+
+        constexpr iterator begin()
+        {
+            return iterator(v1_dtl::strided_begin(base_, n_));
+        }
+        constexpr iterator end()
+        {
+            return iterator(v1_dtl::strided_end(base_, n_));
+        }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        View base_ = View();
+        difference_type n_ = 1;
+#endif
+    };
+
+    namespace v1_dtl {
+        template<typename T>
+        struct is_borrowed_view : std::false_type
+        {
+        };
+        template<typename Iterator, typename Sentinel>
+        struct is_borrowed_view<subrange<Iterator, Sentinel>> : std::true_type
+        {
+        };
+        template<typename Range>
+        struct is_borrowed_view<ref_view<Range>> : std::true_type
+        {
+        };
+    }
+
+    /** A view of the elements of the ranges that are the elements of
+        `View`, flattened into a single sequence.  This is a pre-C++20
+        version of `std::ranges::join_view`.
+
+        `View`'s elements must be lvalues, or views that do not own their
+        elements (such as `subrange`s and `ref_view`s), since the iterators
+        refer into the inner ranges.  The iterators are at most forward.
+
+        The iterators are segmented iterators (see
+        `segmented_iterator_traits`), in which each inner range is a
+        segment.  The algorithms in algorithm.hpp therefore visit the
+        elements one inner range at a time, using the inner ranges' own
+        iterators, rather than checking for the end of an inner range on
+        every increment. */
+    template<typename View>
+    struct join_view : view_interface<join_view<View>>
+    {
+        static_assert(v1_dtl::is_common_range<View>::value, "");
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        using outer_iter = v1_dtl::adl_iterator_t<View>;
+        using inner_range = v1_dtl::iter_reference_t<outer_iter>;
+        using inner_iter =
+            decltype(detail::adl_begin(std::declval<inner_range>()));
+        using iter_reference = v1_dtl::iter_reference_t<inner_iter>;
+
+        static_assert(
+            std::is_reference<inner_range>::value ||
+                v1_dtl::is_borrowed_view<std::decay_t<inner_range>>::value,
+            "");
+#endif
+
+    public:
+        struct iterator;
+        struct segment_iterator;
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        using segment_iterator_base = iterator_interface<
+            segment_iterator,
+            std::forward_iterator_tag,
+            std::decay_t<inner_range>,
+            inner_range,
+            v1_dtl::adaptor_pointer_t<inner_range>,
+            v1_dtl::iter_difference_t<outer_iter>>;
+#endif
+
+    public:
+        /** The segment iterator of `iterator`, which iterates over the
+            inner ranges.  It also knows where the outer range ends, so
+            that the end iterator's segment is the empty range at the end
+            of the outer range. */
+        struct segment_iterator : segment_iterator_base
+        {
+            using typename segment_iterator_base::reference;
+
+            constexpr segment_iterator() = default;
+
+            constexpr reference operator*() const { return *outer_; }
+
+            constexpr segment_iterator & operator++()
+            {
+                ++outer_;
+                return *this;
+            }
+
+            friend BOOST_STL_INTERFACES_HIDDEN_FRIEND_CONSTEXPR bool
+            operator==(segment_iterator lhs, segment_iterator rhs)
+            {
+                return lhs.outer_ == rhs.outer_;
+            }
+
+            using segment_iterator_base::operator++;
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+        private:
+            friend join_view;
+
+            constexpr segment_iterator(outer_iter outer, outer_iter last) :
+                outer_(outer), outer_last_(last)
+            {}
+
+            outer_iter outer_ = outer_iter();
+            outer_iter outer_last_ = outer_iter();
+#endif
+        };
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        using iterator_base = iterator_interface<
+            iterator,
+            std::common_type_t<
+                v1_dtl::capped_category_t<
+                    outer_iter,
+                    std::forward_iterator_tag>,
+                v1_dtl::capped_category_t<
+                    inner_iter,
+                    std::forward_iterator_tag>>,
+            v1_dtl::iter_value_t<inner_iter>,
+            iter_reference,
+            v1_dtl::adaptor_pointer_t<iter_reference>,
+            std::common_type_t<
+                v1_dtl::iter_difference_t<outer_iter>,
+                v1_dtl::iter_difference_t<inner_iter>>>;
+#endif
+
+    public:
+        struct iterator : iterator_base
+        {
+            using typename iterator_base::reference;
+            using segment_iterator = join_view::segment_iterator;
+            using local_iterator = inner_iter;
+
+            constexpr iterator() = default;
+
+            constexpr reference operator*() const { return *inner_; }
+
+            constexpr iterator & operator++()
+            {
+                if (++inner_ == inner_last_) {
+                    ++outer_;
+                    satisfy();
+                }
+                return *this;
+            }
+
+            friend BOOST_STL_INTERFACES_HIDDEN_FRIEND_CONSTEXPR bool
+            operator==(iterator lhs, iterator rhs)
+            {
+                return lhs.outer_ == rhs.outer_ && lhs.inner_ == rhs.inner_;
+            }
+
+            using iterator_base::operator++;
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+        private:
+            friend join_view;
+            friend access;
+
+            constexpr iterator(outer_iter outer, outer_iter outer_last) :
+                outer_(outer), outer_last_(outer_last)
+            {
+                satisfy();
+            }
+
+            constexpr segment_iterator segment() const
+            {
+                return segment_iterator(outer_, outer_last_);
+            }
+            constexpr local_iterator local() const { return inner_; }
+            static constexpr local_iterator local_begin(segment_iterator s)
+            {
+                if (s.outer_ == s.outer_last_)
+                    return inner_iter();
+                return detail::adl_begin(*s.outer_);
+            }
+            static constexpr local_iterator local_end(segment_iterator s)
+            {
+                if (s.outer_ == s.outer_last_)
+                    return inner_iter();
+                return detail::adl_end(*s.outer_);
+            }
+            static constexpr iterator
+            compose(segment_iterator s, local_iterator l)
+            {
+                iterator result;
+                result.outer_ = s.outer_;
+                result.outer_last_ = s.outer_last_;
+                result.inner_ = l;
+                result.inner_last_ = local_end(s);
+                if (l == result.inner_last_ && s.outer_ != s.outer_last_) {
+                    ++result.outer_;
+                    result.satisfy();
+                }
+                return result;
+            }
+
+            // Skips empty inner ranges.  At the end, inner_ is
+            // value-initialized, so that all end iterators compare equal.
+            constexpr void satisfy()
+            {
+                for (; outer_ != outer_last_; ++outer_) {
+                    auto && inner = *outer_;
+                    inner_ = detail::adl_begin(inner);
+                    inner_last_ = detail::adl_end(inner);
+                    if (inner_ != inner_last_)
+                        return;
+                }
+                inner_ = inner_iter();
+                inner_last_ = inner_iter();
+            }
+
+            outer_iter outer_ = outer_iter();
+            outer_iter outer_last_ = outer_iter();
+            inner_iter inner_ = inner_iter();
+            inner_iter inner_last_ = inner_iter();
+#endif
+        };
+
+        constexpr join_view() = default;
+        constexpr join_view(View base) : base_(std::move(base)) {}
+
+        constexpr View base() const { return base_; }
+
+        constexpr iterator begin()
+        {
+            return iterator(base_.begin(), base_.end());
+        }
+        constexpr iterator end() { return iterator(base_.end(), base_.end()); }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        View base_ = View();
+#endif
+    };
+
+    /** A view of the elements of `N` views of type `View`, one after
+        another.  Each of the views is a segment of the iterators, which
+        are `join_view` iterators; see `join_view`.
+
+        The iterators refer to the views held in the `concat_view`, and so
+        are only valid as long as it is. */
+    template<typename View, std::size_t N>
+    struct concat_view : view_interface<concat_view<View, N>>
+    {
+        static_assert(0 < N, "");
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        using joined = join_view<subrange<View *>>;
+        template<typename V>
+        using const_joined = join_view<subrange<V const *>>;
+#endif
+
+    public:
+        using iterator = typename joined::iterator;
+
+        constexpr concat_view() = default;
+        template<
+            typename... Views,
+            typename Enable = std::enable_if_t<sizeof...(Views) + 1 == N>>
+        constexpr concat_view(View view, Views... views) :
+            views_{std::move(view), std::move(views)...}
+        {}
+
+        constexpr iterator begin()
+        {
+            return joined(subrange<View *>(views_, views_ + N)).begin();
+        }
+        constexpr iterator end()
+        {
+            return joined(subrange<View *>(views_, views_ + N)).end();
+        }
+
+        /** Defined only if `View const` is a range, as `subrange` and
+            `ref_view` are. */
+        template<
+            typename V = View,
+            typename Enable = v1_dtl::adl_iterator_t<V const>>
+        constexpr typename const_joined<V>::iterator begin() const
+        {
+            return const_joined<V>(subrange<V const *>(views_, views_ + N))
+                .begin();
+        }
+        /** Defined only if `View const` is a range. */
+        template<
+            typename V = View,
+            typename Enable = v1_dtl::adl_iterator_t<V const>>
+        constexpr typename const_joined<V>::iterator end() const
+        {
+            return const_joined<V>(subrange<V const *>(views_, views_ + N))
+                .end();
+        }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        View views_[N] = {};
+#endif
+    };
+
+    template<typename F>
+    struct range_adaptor_closure;
+
+    namespace v1_dtl {
+        template<typename T>
+        struct is_range_adaptor_closure : std::false_type
+        {
+        };
+        template<typename F>
+        struct is_range_adaptor_closure<range_adaptor_closure<F>>
+            : std::true_type
+        {
+        };
+
+        // Applies F, then G.
+        template<typename F, typename G>
+        struct composed_closure
+        {
+            template<typename Range>
+            constexpr auto operator()(Range && r) const -> decltype(
+                std::declval<G const &>()(
+                    std::declval<F const &>()(static_cast<Range &&>(r))))
+            {
+                return g_(f_(static_cast<Range &&>(r)));
+            }
+
+            F f_;
+            G g_;
+        };
+
+        // Calls Fn with a range, followed by a previously-bound argument.
+        template<typename Fn, typename Arg>
+        struct bound_adaptor
+        {
+            template<typename Range>
+            constexpr auto operator()(Range && r) const
+                -> decltype(std::declval<Fn const &>()(
+                    static_cast<Range &&>(r), std::declval<Arg const &>()))
+            {
+                return fn_(static_cast<Range &&>(r), arg_);
+            }
+
+            Fn fn_;
+            Arg arg_;
+        };
+    }
+
+    /** A function object that takes a single range argument, and that may
+        also be applied with pipe syntax: `r | closure` means `closure(r)`.
+        Two closures may be piped together, producing a closure that
+        applies the first and then the second; `r | (c1 | c2)` is the same
+        as `r | c1 | c2`.  This is a pre-C++23 version of
+        `std::ranges::range_adaptor_closure`.
+
+        The one-argument forms of the adaptors in `views` (such as
+        `views::transform(f)`) return `range_adaptor_closure`s.  The
+        adaptors applied by a pipeline are lazy, so `r | views::transform(f)
+        | views::filter(p)` makes no copies of the elements of `r`, and
+        visits each of them once, when the result is iterated. */
+    template<typename F>
+    struct range_adaptor_closure
+    {
+        constexpr range_adaptor_closure(F f) : f_(std::move(f)) {}
+
+        template<typename Range>
+        constexpr auto operator()(Range && r) const
+            -> decltype(std::declval<F const &>()(static_cast<Range &&>(r)))
+        {
+            return f_(static_cast<Range &&>(r));
+        }
+
+        template<
+            typename Range,
+            typename Enable = std::enable_if_t<
+                !v1_dtl::is_range_adaptor_closure<std::decay_t<Range>>::value>>
+        friend BOOST_STL_INTERFACES_HIDDEN_FRIEND_CONSTEXPR auto
+        operator|(Range && r, range_adaptor_closure const & closure)
+            -> decltype(closure(static_cast<Range &&>(r)))
+        {
+            return closure(static_cast<Range &&>(r));
+        }
+
+        template<typename G>
+        friend BOOST_STL_INTERFACES_HIDDEN_FRIEND_CONSTEXPR
+            range_adaptor_closure<v1_dtl::composed_closure<
+                range_adaptor_closure,
+                range_adaptor_closure<G>>>
+            operator|(
+                range_adaptor_closure const & lhs,
+                range_adaptor_closure<G> const & rhs)
+        {
+            return v1_dtl::composed_closure<
+                range_adaptor_closure,
+                range_adaptor_closure<G>>{lhs, rhs};
+        }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        F f_;
+#endif
+    };
+
+    namespace v1_dtl {
+        template<typename Fn, typename Arg>
+        constexpr range_adaptor_closure<bound_adaptor<Fn, Arg>>
+        bind_back(Arg arg)
+        {
+            return bound_adaptor<Fn, Arg>{Fn{}, std::move(arg)};
+        }
+
+        struct transform_fn
+        {
+            template<typename Range, typename F>
+            constexpr auto operator()(Range && r, F f) const
+                -> transform_view<views::all_t<Range>, F>
+            {
+                return transform_view<views::all_t<Range>, F>(
+                    views::all(static_cast<Range &&>(r)), std::move(f));
+            }
+        };
+
+        struct filter_fn
+        {
+            template<typename Range, typename Pred>
+            constexpr auto operator()(Range && r, Pred pred) const
+                -> filter_view<views::all_t<Range>, Pred>
+            {
+                return filter_view<views::all_t<Range>, Pred>(
+                    views::all(static_cast<Range &&>(r)), std::move(pred));
+            }
+        };
+
+        struct take_fn
+        {
+            template<typename Range>
+            constexpr auto operator()(Range && r, std::ptrdiff_t n) const
+                -> take_view<views::all_t<Range>>
+            {
+                return take_view<views::all_t<Range>>(
+                    views::all(static_cast<Range &&>(r)), n);
+            }
+        };
+
+        struct stride_fn
+        {
+            template<typename Range>
+            constexpr auto operator()(Range && r, std::ptrdiff_t n) const
+                -> stride_view<views::all_t<Range>>
+            {
+                return stride_view<views::all_t<Range>>(
+                    views::all(static_cast<Range &&>(r)), n);
+            }
+        };
+
+        struct chunk_fn
+        {
+            template<typename Range>
+            constexpr auto operator()(Range && r, std::ptrdiff_t n) const
+                -> chunk_view<views::all_t<Range>>
+            {
+                return chunk_view<views::all_t<Range>>(
+                    views::all(static_cast<Range &&>(r)), n);
+            }
+        };
+
+        struct join_fn
+        {
+            template<typename Range>
+            constexpr auto operator()(Range && r) const
+                -> join_view<views::all_t<Range>>
+            {
+                return join_view<views::all_t<Range>>(
+                    views::all(static_cast<Range &&>(r)));
+            }
+        };
+    }
+
+    /** Range adaptors, each of which may be called with a range and its
+        other arguments, or with just its other arguments to produce a
+        `range_adaptor_closure`.  For instance, `views::transform(r, f)` and
+        `r | views::transform(f)` are equivalent.
+
+        Since this library supports C++14, the adaptors are functions rather
+        than the `inline constexpr` objects that `std::views` has; in
+        particular, the closure form of `join` is spelled `views::join()`.
+        All adaptors require their range arguments to be common ranges. */
+    namespace views {
+        /** Returns a `transform_view` of the elements of `r`. */
+        template<typename Range, typename F>
+        constexpr auto transform(Range && r, F f)
+            -> decltype(v1_dtl::transform_fn{}(static_cast<Range &&>(r), f))
+        {
+            return v1_dtl::transform_fn{}(static_cast<Range &&>(r), f);
+        }
+        /** Returns a closure that produces a `transform_view`. */
+        template<typename F>
+        constexpr auto transform(F f)
+        {
+            return v1_dtl::bind_back<v1_dtl::transform_fn>(std::move(f));
+        }
+
+        /** Returns a `filter_view` of the elements of `r`. */
+        template<typename Range, typename Pred>
+        constexpr auto filter(Range && r, Pred pred)
+            -> decltype(v1_dtl::filter_fn{}(static_cast<Range &&>(r), pred))
+        {
+            return v1_dtl::filter_fn{}(static_cast<Range &&>(r), pred);
+        }
+        /** Returns a closure that produces a `filter_view`. */
+        template<typename Pred>
+        constexpr auto filter(Pred pred)
+        {
+            return v1_dtl::bind_back<v1_dtl::filter_fn>(std::move(pred));
+        }
+
+        /** Returns a `take_view` of the first `n` elements of `r`. */
+        template<typename Range>
+        constexpr auto take(Range && r, std::ptrdiff_t n)
+            -> decltype(v1_dtl::take_fn{}(static_cast<Range &&>(r), n))
+        {
+            return v1_dtl::take_fn{}(static_cast<Range &&>(r), n);
+        }
+        /** Returns a closure that produces a `take_view`. */
+        inline constexpr auto take(std::ptrdiff_t n)
+        {
+            return v1_dtl::bind_back<v1_dtl::take_fn>(n);
+        }
+
+        /** Returns a `stride_view` of every `n`-th element of `r`. */
+        template<typename Range>
+        constexpr auto stride(Range && r, std::ptrdiff_t n)
+            -> decltype(v1_dtl::stride_fn{}(static_cast<Range &&>(r), n))
+        {
+            return v1_dtl::stride_fn{}(static_cast<Range &&>(r), n);
+        }
+        /** Returns a closure that produces a `stride_view`. */
+        inline constexpr auto stride(std::ptrdiff_t n)
+        {
+            return v1_dtl::bind_back<v1_dtl::stride_fn>(n);
+        }
+
+        /** Returns a `chunk_view` of the elements of `r`, in chunks of
+            `n`. */
+        template<typename Range>
+        constexpr auto chunk(Range && r, std::ptrdiff_t n)
+            -> decltype(v1_dtl::chunk_fn{}(static_cast<Range &&>(r), n))
+        {
+            return v1_dtl::chunk_fn{}(static_cast<Range &&>(r), n);
+        }
+        /** Returns a closure that produces a `chunk_view`. */
+        inline constexpr auto chunk(std::ptrdiff_t n)
+        {
+            return v1_dtl::bind_back<v1_dtl::chunk_fn>(n);
+        }
+
+        /** Returns a `join_view` of the elements of the ranges in `r`. */
+        template<typename Range>
+        constexpr auto join(Range && r)
+            -> decltype(v1_dtl::join_fn{}(static_cast<Range &&>(r)))
+        {
+            return v1_dtl::join_fn{}(static_cast<Range &&>(r));
+        }
+        /** Returns a closure that produces a `join_view`. */
+        inline constexpr range_adaptor_closure<v1_dtl::join_fn> join()
+        {
+            return v1_dtl::join_fn{};
+        }
+
+        /** Returns a `concat_view` of the elements of `r` followed by
+            those of each of `rs`.  The ranges must all have the same
+            `all_t` type. */
+        template<typename Range, typename... Ranges>
+        constexpr auto concat(Range && r, Ranges &&... rs)
+            -> concat_view<all_t<Range>, 1 + sizeof...(Ranges)>
+        {
+            return concat_view<all_t<Range>, 1 + sizeof...(Ranges)>(
+                views::all(static_cast<Range &&>(r)),
+                views::all(static_cast<Ranges &&>(rs))...);
+        }
+    }
+
+}}}
+
+#endif
@@ -0,0 +1,388 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_ZIP_ITERATOR_HPP
+#define BOOST_STL_INTERFACES_ZIP_ITERATOR_HPP
+
+#include <boost/stl_interfaces/iterator_interface.hpp>
+#include <boost/stl_interfaces/view_interface.hpp>
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <initializer_list>
+#include <tuple>
+#include <utility>
+
+
+namespace boost { namespace stl_interfaces { inline namespace v1 {
+
+    /** The reference type of `zip_iterator`: a `std::tuple` of the
+        underlying iterators' reference types.
+
+        Unlike a plain `std::tuple` of references, a `zip_reference` can be
+        swapped while it is an rvalue, which is how `std::sort()` and friends
+        swap the elements referred to by two proxy iterators.  Assigning to a
+        `zip_reference` assigns through each of its references, even when the
+        `zip_reference` is const, as C++20 requires of the reference type of
+        a writable iterator. */
+    template<typename... Refs>
+    struct zip_reference : std::tuple<Refs...>
+    {
+        using base_type = std::tuple<Refs...>;
+
+        using base_type::base_type;
+        using base_type::operator=;
+
+        constexpr zip_reference(base_type const & t) : base_type(t) {}
+        /** Refers to the elements of `t`.  This lets a `zip_reference` be
+            the common reference of itself and its iterator's value type. */
+        template<
+            typename... Ts,
+            typename Enable = decltype(base_type(std::declval<Ts &>()...))>
+        constexpr zip_reference(std::tuple<Ts...> & t) :
+            zip_reference(t, std::index_sequence_for<Refs...>{})
+        {}
+
+        template<typename... Ts>
+        constexpr std::enable_if_t<
+            sizeof...(Ts) == sizeof...(Refs),
+            zip_reference const &>
+        operator=(std::tuple<Ts...> const & t) const
+        {
+            assign_impl(t, std::index_sequence_for<Refs...>{});
+            return *this;
+        }
+        template<typename... Ts>
+        constexpr std::enable_if_t<
+            sizeof...(Ts) == sizeof...(Refs),
+            zip_reference const &>
+        operator=(std::tuple<Ts...> && t) const
+        {
+            assign_impl(std::move(t), std::index_sequence_for<Refs...>{});
+            return *this;
+        }
+
+        /** Swaps the referred-to elements, one at a time. */
+        friend void swap(zip_reference lhs, zip_reference rhs)
+        {
+            lhs.swap_impl(rhs, std::index_sequence_for<Refs...>{});
+        }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        template<typename Tuple, std::size_t... I>
+        constexpr zip_reference(Tuple & t, std::index_sequence<I...>) :
+            base_type(std::get<I>(t)...)
+        {}
+
+        template<typename Tuple, std::size_t... I>
+        constexpr void
+        assign_impl(Tuple && t, std::index_sequence<I...>) const
+        {
+            (void)std::initializer_list<int>{
+                (std::get<I>(static_cast<base_type const &>(*this)) =
+                     std::get<I>(std::forward<Tuple>(t)),
+                 0)...};
+        }
+
+        template<std::size_t... I>
+        void swap_impl(zip_reference & other, std::index_sequence<I...>)
+        {
+            using std::swap;
+            (void)std::initializer_list<int>{
+                (swap(std::get<I>(*this), std::get<I>(other)), 0)...};
+        }
+#endif
+    };
+
+    namespace v1_dtl {
+        // The strongest category all of Iters share.  A zip of contiguous
+        // iterators is not itself contiguous.
+        template<typename... Iters>
+        using zip_concept_t = std::conditional_t<
+            std::is_base_of<
+                std::random_access_iterator_tag,
+                std::common_type_t<typename std::iterator_traits<
+                    Iters>::iterator_category...>>::value,
+            std::random_access_iterator_tag,
+            std::common_type_t<
+                typename std::iterator_traits<Iters>::iterator_category...>>;
+
+        template<typename Iter>
+        using iter_rvalue_reference_t =
+            decltype(std::move(*std::declval<Iter &>()));
+    }
+
+    /** An iterator over a notional sequence of tuples, formed from the
+        elements at the same position in one or more underlying sequences.
+        Its reference type is `zip_reference<R...>`, where each `R` is an
+        underlying iterator's reference type, and its value type is a
+        `std::tuple` of the underlying value types.
+
+        The underlying sequences keep their own layout: sorting a zip of
+        columns permutes each column in place, and no array of structs is
+        ever formed except for the few temporaries a sorting algorithm
+        holds.
+
+        `zip_iterator` is as strong as the weakest of `Iters`, up to random
+        access.  Equality and distance are determined by the first
+        underlying iterator. */
+    template<typename... Iters>
+    struct zip_iterator
+        : proxy_iterator_interface<
+              zip_iterator<Iters...>,
+              v1_dtl::zip_concept_t<Iters...>,
+              std::tuple<typename std::iterator_traits<Iters>::value_type...>,
+              zip_reference<typename std::iterator_traits<Iters>::reference...>,
+              std::common_type_t<
+                  typename std::iterator_traits<Iters>::difference_type...>>
+    {
+        static_assert(0 < sizeof...(Iters), "");
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        using concept_ = v1_dtl::zip_concept_t<Iters...>;
+        using indices = std::index_sequence_for<Iters...>;
+
+        static constexpr bool bidi =
+            std::is_base_of<std::bidirectional_iterator_tag, concept_>::value;
+        static constexpr bool random_access =
+            std::is_base_of<std::random_access_iterator_tag, concept_>::value;
+#endif
+
+    public:
+        using base_type = proxy_iterator_interface<
+            zip_iterator<Iters...>,
+            v1_dtl::zip_concept_t<Iters...>,
+            std::tuple<typename std::iterator_traits<Iters>::value_type...>,
+            zip_reference<typename std::iterator_traits<Iters>::reference...>,
+            std::common_type_t<
+                typename std::iterator_traits<Iters>::difference_type...>>;
+        using typename base_type::difference_type;
+        using typename base_type::reference;
+
+        constexpr zip_iterator() = default;
+        constexpr zip_iterator(Iters... its) : its_(its...) {}
+
+        /** Returns the underlying iterators. */
+        constexpr std::tuple<Iters...> const & iterators() const noexcept
+        {
+            return its_;
+        }
+
+        constexpr reference operator*() const
+        {
+            return deref(indices{});
+        }
+
+        constexpr zip_iterator & operator++()
+        {
+            increment(indices{});
+            return *this;
+        }
+        template<bool Bidi = bidi, typename Enable = std::enable_if_t<Bidi>>
+        constexpr zip_iterator & operator--()
+        {
+            decrement(indices{});
+            return *this;
+        }
+        template<
+            bool RandomAccess = random_access,
+            typename Enable = std::enable_if_t<RandomAccess>>
+        constexpr zip_iterator & operator+=(difference_type n)
+        {
+            advance(n, indices{});
+            return *this;
+        }
+        template<
+            bool RandomAccess = random_access,
+            typename Enable = std::enable_if_t<RandomAccess>>
+        constexpr difference_type operator-(zip_iterator other) const
+        {
+            return std::get<0>(its_) - std::get<0>(other.its_);
+        }
+
+        friend BOOST_STL_INTERFACES_HIDDEN_FRIEND_CONSTEXPR bool
+        operator==(zip_iterator lhs, zip_iterator rhs)
+        {
+            return std::get<0>(lhs.its_) == std::get<0>(rhs.its_);
+        }
+
+        /** Returns a tuple of rvalue references to the elements. */
+        friend BOOST_STL_INTERFACES_HIDDEN_FRIEND_CONSTEXPR std::tuple<
+            v1_dtl::iter_rvalue_reference_t<Iters>...>
+        iter_move(zip_iterator it)
+        {
+            return it.move_deref(indices{});
+        }
+
+        /** Swaps the elements referred to by `lhs` and `rhs`. */
+        friend void iter_swap(zip_iterator lhs, zip_iterator rhs)
+        {
+            lhs.iter_swap_impl(rhs, indices{});
+        }
+
+        using base_type::operator++;
+        using base_type::operator--;
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        template<std::size_t... I>
+        constexpr reference deref(std::index_sequence<I...>) const
+        {
+            return reference(*std::get<I>(its_)...);
+        }
+        template<std::size_t... I>
+        constexpr std::tuple<v1_dtl::iter_rvalue_reference_t<Iters>...>
+        move_deref(std::index_sequence<I...>) const
+        {
+            return std::tuple<v1_dtl::iter_rvalue_reference_t<Iters>...>(
+                std::move(*std::get<I>(its_))...);
+        }
+        template<std::size_t... I>
+        constexpr void increment(std::index_sequence<I...>)
+        {
+            (void)std::initializer_list<int>{(++std::get<I>(its_), 0)...};
+        }
+        template<std::size_t... I>
+        constexpr void decrement(std::index_sequence<I...>)
+        {
+            (void)std::initializer_list<int>{(--std::get<I>(its_), 0)...};
+        }
+        template<std::size_t... I>
+        constexpr void advance(difference_type n, std::index_sequence<I...>)
+        {
+            (void)std::initializer_list<int>{(std::get<I>(its_) += n, 0)...};
+        }
+        template<std::size_t... I>
+        void iter_swap_impl(zip_iterator other, std::index_sequence<I...>)
+        {
+            (void)std::initializer_list<int>{
+                (std::iter_swap(std::get<I>(its_), std::get<I>(other.its_)),
+                 0)...};
+        }
+
+        std::tuple<Iters...> its_;
+#endif
+    };
+
+    /** Returns a `zip_iterator` over `its...`. */
+    template<typename... Iters>
+    constexpr zip_iterator<Iters...> make_zip_iterator(Iters... its)
+    {
+        return zip_iterator<Iters...>(its...);
+    }
+
+    /** A view of `N` contiguous columns of the same length, with elements of
+        types `Ts...`, as a random access sequence of `zip_reference`s.  This
+        is a structure-of-arrays: each column remains a separate array, so a
+        loop over one column (see `column()`) is a loop over a plain array
+        that the compiler can vectorize, while algorithms such as
+        `std::sort()` can still treat whole rows as elements. */
+    template<typename... Ts>
+    struct soa_view : view_interface<soa_view<Ts...>>
+    {
+        using iterator = zip_iterator<Ts *...>;
+        using size_type = std::size_t;
+
+        constexpr soa_view() = default;
+        constexpr soa_view(size_type size, Ts *... columns) noexcept :
+            first_(columns...),
+            size_(size)
+        {}
+
+        constexpr iterator begin() const noexcept { return first_; }
+        constexpr iterator end() const noexcept
+        {
+            return first_ + difference_type(size_);
+        }
+        constexpr size_type size() const noexcept { return size_; }
+
+        /** Returns a pointer to the first element of the `I`-th column. */
+        template<std::size_t I>
+        constexpr auto column() const noexcept
+        {
+            return std::get<I>(first_.iterators());
+        }
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+    private:
+        using difference_type = typename iterator::difference_type;
+
+        iterator first_;
+        size_type size_ = 0;
+#endif
+    };
+
+    /** Returns a `soa_view` over the elements of `columns...`, each of which
+        must be a contiguous container with `data()` and `size()` members.
+
+        \pre All of `columns...` have the same `size()`. */
+    template<typename Column, typename... Columns>
+    constexpr auto make_soa_view(Column & column, Columns &... columns)
+    {
+        std::size_t const size = column.size();
+        (void)std::initializer_list<int>{
+            (BOOST_ASSERT(columns.size() == size), 0)...};
+        return soa_view<
+            std::remove_pointer_t<decltype(column.data())>,
+            std::remove_pointer_t<decltype(columns.data())>...>(
+            size, column.data(), columns.data()...);
+    }
+
+}}}
+
+#ifndef BOOST_STL_INTERFACES_DOXYGEN
+
+namespace std {
+    template<typename... Refs>
+    struct tuple_size<boost::stl_interfaces::zip_reference<Refs...>>
+        : tuple_size<tuple<Refs...>>
+    {
+    };
+    template<std::size_t I, typename... Refs>
+    struct tuple_element<I, boost::stl_interfaces::zip_reference<Refs...>>
+        : tuple_element<I, tuple<Refs...>>
+    {
+    };
+
+#if 201703L < __cplusplus && defined(__cpp_lib_concepts)
+    template<
+        typename... Refs,
+        typename... Ts,
+        template<typename> class RefQual,
+        template<typename> class TQual>
+        requires(sizeof...(Refs) == sizeof...(Ts))
+    struct basic_common_reference<
+        boost::stl_interfaces::zip_reference<Refs...>,
+        tuple<Ts...>,
+        RefQual,
+        TQual>
+    {
+        using type = boost::stl_interfaces::zip_reference<
+            common_reference_t<RefQual<Refs>, TQual<Ts>>...>;
+    };
+    template<
+        typename... Ts,
+        typename... Refs,
+        template<typename> class TQual,
+        template<typename> class RefQual>
+        requires(sizeof...(Ts) == sizeof...(Refs))
+    struct basic_common_reference<
+        tuple<Ts...>,
+        boost::stl_interfaces::zip_reference<Refs...>,
+        TQual,
+        RefQual>
+    {
+        using type = boost::stl_interfaces::zip_reference<
+            common_reference_t<TQual<Ts>, RefQual<Refs>>...>;
+    };
+#endif
+}
+
+#endif
+
+#endif
@@ -0,0 +1,89 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/small_vector.hpp>
+
+#include "perf_common.hpp"
+
+
+// This file is built twice: as checked_perf_*, and as checked_perf_checked_*
+// with BOOST_STL_INTERFACES_CHECKED defined.  In the former, small_vec must
+// be exactly the unchecked container, so it should keep pace with std_vec;
+// the latter shows what the checks cost.
+using small_vec = boost::stl_interfaces::small_vector<int, 8>;
+using std_vec = std::vector<int>;
+
+#if !defined(BOOST_STL_INTERFACES_CHECKED)
+static_assert(std::is_same<small_vec::iterator, int *>::value, "");
+static_assert(std::is_same<small_vec::const_iterator, int const *>::value, "");
+static_assert(
+    std::is_empty<boost::stl_interfaces::sequence_container_interface<
+        small_vec,
+        boost::stl_interfaces::element_layout::contiguous>>::value,
+    "");
+static_assert(
+    noexcept(std::declval<small_vec &>()[0]) &&
+        noexcept(std::declval<small_vec &>().front()) &&
+        noexcept(std::declval<small_vec &>().pop_back()),
+    "");
+#endif
+
+
+template<typename Vec>
+void BM_index(benchmark::State & state)
+{
+    auto const ints = make_random_ints(state.range(0));
+    Vec const v(ints.begin(), ints.end());
+    for (auto _ : state) {
+        int sum = 0;
+        for (std::size_t i = 0, n = v.size(); i < n; ++i) {
+            sum += v[i];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Vec>
+void BM_iterate(benchmark::State & state)
+{
+    auto const ints = make_random_ints(state.range(0));
+    Vec const v(ints.begin(), ints.end());
+    for (auto _ : state) {
+        int sum = 0;
+        for (auto it = v.begin(), last = v.end(); it != last; ++it) {
+            sum += *it;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Uses the container as a stack, which exercises back() and pop_back().
+template<typename Vec>
+void BM_stack(benchmark::State & state)
+{
+    auto const n = int(state.range(0));
+    Vec v;
+    v.reserve(n);
+    for (auto _ : state) {
+        for (int i = 0; i < n; ++i) {
+            v.push_back(i);
+        }
+        int sum = 0;
+        while (!v.empty()) {
+            sum += v.back();
+            v.pop_back();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+BOOST_STL_INTERFACES_PERF_PAIR(BM_index, small_vec, std_vec);
+BOOST_STL_INTERFACES_PERF_PAIR(BM_iterate, small_vec, std_vec);
+BOOST_STL_INTERFACES_PERF_PAIR(BM_stack, small_vec, std_vec);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,30 @@
+# Copyright (C) 2019 T. Zachary Laine
+#
+# Distributed under the Boost Software License, Version 1.0. (See
+# accompanying file LICENSE_1_0.txt or copy at
+# http://www.boost.org/LICENSE_1_0.txt)
+
+# Compiles SOURCE with COMPILER and the ;-separated FLAGS REPS times, and
+# reports the fastest of those compiles as LABEL.  The fastest (rather than
+# the mean) keeps the numbers stable on a busy machine.
+if (NOT REPS)
+    set(REPS 3)
+endif ()
+
+set(best)
+foreach (rep RANGE 1 ${REPS})
+    string(TIMESTAMP start "%s%f")
+    execute_process(
+        COMMAND ${COMPILER} ${FLAGS} -c ${SOURCE} -o ${OUTPUT}
+        RESULT_VARIABLE result)
+    string(TIMESTAMP stop "%s%f")
+    if (NOT result EQUAL 0)
+        message(FATAL_ERROR "${LABEL}: compilation failed")
+    endif ()
+    math(EXPR elapsed "(${stop} - ${start}) / 1000")
+    if (NOT best OR elapsed LESS best)
+        set(best ${elapsed})
+    endif ()
+endforeach ()
+
+message("${LABEL}: ${best} ms")
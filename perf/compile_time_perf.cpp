@@ -0,0 +1,111 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// This file is not a runtime benchmark.  It instantiates
+// BOOST_STL_INTERFACES_PERF_COUNT distinct iterator types of one kind, and
+// uses every operation that kind of iterator supports, so that the time it
+// takes to compile is dominated by the cost of instantiating
+// iterator_interface.  See the compile_time_perf target in CMakeLists.txt,
+// which compiles it once per iterator kind (BOOST_STL_INTERFACES_PERF_KIND)
+// and iterator_interface version (BOOST_STL_INTERFACES_PERF_VERSION).
+#include <boost/stl_interfaces/iterator_interface.hpp>
+
+#include <numeric>
+#include <utility>
+
+
+#ifndef BOOST_STL_INTERFACES_PERF_VERSION
+#define BOOST_STL_INTERFACES_PERF_VERSION 1
+#endif
+#ifndef BOOST_STL_INTERFACES_PERF_KIND
+#define BOOST_STL_INTERFACES_PERF_KIND random_access
+#endif
+#ifndef BOOST_STL_INTERFACES_PERF_COUNT
+#define BOOST_STL_INTERFACES_PERF_COUNT 200
+#endif
+
+#if BOOST_STL_INTERFACES_PERF_VERSION == 2
+namespace interface = boost::stl_interfaces::v2;
+#else
+namespace interface = boost::stl_interfaces::v1;
+#endif
+
+namespace kinds {
+    using input = std::input_iterator_tag;
+    using forward = std::forward_iterator_tag;
+    using bidirectional = std::bidirectional_iterator_tag;
+    using random_access = std::random_access_iterator_tag;
+    using contiguous = boost::stl_interfaces::contiguous_iterator_tag;
+}
+
+using tag = kinds::BOOST_STL_INTERFACES_PERF_KIND;
+
+// Each N is a distinct iterator type, so nothing instantiated for one can be
+// reused for another.
+template<int N>
+struct iter : interface::iterator_interface<iter<N>, tag, int>
+{
+    iter() : it_(nullptr) {}
+    iter(int * it) : it_(it) {}
+
+private:
+    friend boost::stl_interfaces::access;
+    int *& base_reference() noexcept { return it_; }
+    int * base_reference() const noexcept { return it_; }
+
+    int * it_;
+};
+
+template<typename Iter>
+int use(Iter first, Iter last, std::input_iterator_tag)
+{
+    int retval = 0;
+    for (; first != last; ++first) {
+        retval += *first;
+    }
+    first++;
+    return retval + (first == last);
+}
+
+template<typename Iter>
+int use(Iter first, Iter last, std::bidirectional_iterator_tag)
+{
+    Iter it = last;
+    --it;
+    it--;
+    return use(first, last, std::input_iterator_tag{}) + *it;
+}
+
+template<typename Iter>
+int use(Iter first, Iter last, std::random_access_iterator_tag)
+{
+    Iter it = first + 2;
+    it = 1 + it;
+    it += 1;
+    it -= 2;
+    it = it - 1;
+    return use(first, last, std::bidirectional_iterator_tag{}) + first[1] +
+           int(last - it) + (first < last) + (first <= last) +
+           (first > last) + (first >= last);
+}
+
+template<int... N>
+int use_all(int * first, int * last, std::integer_sequence<int, N...>)
+{
+    int const results[] = {use(iter<N>(first), iter<N>(last), tag{})...};
+    return std::accumulate(std::begin(results), std::end(results), 0);
+}
+
+int main()
+{
+    int ints[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    return use_all(
+               ints,
+               ints + 10,
+               std::make_integer_sequence<
+                   int,
+                   BOOST_STL_INTERFACES_PERF_COUNT>()) == 0;
+}
@@ -0,0 +1,86 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/small_vector.hpp>
+
+#include "perf_common.hpp"
+
+
+using vec_type = boost::stl_interfaces::small_vector<int, 16>;
+
+// The element-at-a-time hash that hash_value() would use for a
+// value_type that is not bytewise hashable.
+std::size_t hash_elements(vec_type const & v)
+{
+    std::size_t result = v.size();
+    for (int x : v) {
+        result ^= std::hash<int>{}(x) + 0x9e3779b9 + (result << 6) +
+                  (result >> 2);
+    }
+    return result;
+}
+
+void BM_hash_bytes(benchmark::State & state)
+{
+    auto const ints = make_random_ints(state.range(0));
+    vec_type const v(ints.begin(), ints.end());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(hash_value(v));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_hash_elements(benchmark::State & state)
+{
+    auto const ints = make_random_ints(state.range(0));
+    vec_type const v(ints.begin(), ints.end());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(hash_elements(v));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#if defined(__cpp_lib_three_way_comparison)
+// Deciding both a <= b and a >= b, with one pass over the elements or two.
+using byte_vec = boost::stl_interfaces::small_vector<unsigned char, 16>;
+
+byte_vec make_bytes(std::size_t n)
+{
+    auto const ints = make_random_ints(n);
+    return byte_vec(ints.begin(), ints.end());
+}
+
+void BM_compare_three_way(benchmark::State & state)
+{
+    auto const a = make_bytes(state.range(0));
+    auto const b = a;
+    for (auto _ : state) {
+        auto const result = a <=> b;
+        benchmark::DoNotOptimize(result <= 0);
+        benchmark::DoNotOptimize(result >= 0);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_compare_less(benchmark::State & state)
+{
+    auto const a = make_bytes(state.range(0));
+    auto const b = a;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a <= b);
+        benchmark::DoNotOptimize(a >= b);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+#endif
+
+BENCHMARK(BM_hash_bytes)->BOOST_STL_INTERFACES_PERF_SIZES;
+BENCHMARK(BM_hash_elements)->BOOST_STL_INTERFACES_PERF_SIZES;
+#if defined(__cpp_lib_three_way_comparison)
+BENCHMARK(BM_compare_three_way)->BOOST_STL_INTERFACES_PERF_SIZES;
+BENCHMARK(BM_compare_less)->BOOST_STL_INTERFACES_PERF_SIZES;
+#endif
+
+BENCHMARK_MAIN();
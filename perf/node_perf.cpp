@@ -0,0 +1,302 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/algorithm.hpp>
+#include <boost/stl_interfaces/iterator_interface.hpp>
+
+#include "perf_common.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+
+template<typename T>
+struct node
+{
+    T value_;
+    node * next_; // == nullptr in the tail node
+};
+
+// The iterator from example/node_iterator.cpp.
+template<typename T>
+struct interface_node_iterator
+    : boost::stl_interfaces::iterator_interface<
+          interface_node_iterator<T>,
+          std::forward_iterator_tag,
+          T>
+{
+    constexpr interface_node_iterator() noexcept : it_(nullptr) {}
+    constexpr interface_node_iterator(node<T> * it) noexcept : it_(it) {}
+
+    constexpr T & operator*() const noexcept { return it_->value_; }
+    constexpr interface_node_iterator & operator++() noexcept
+    {
+        it_ = it_->next_;
+        return *this;
+    }
+    friend constexpr bool
+    operator==(interface_node_iterator lhs, interface_node_iterator rhs) noexcept
+    {
+        return lhs.it_ == rhs.it_;
+    }
+
+    using base_type = boost::stl_interfaces::iterator_interface<
+        interface_node_iterator<T>,
+        std::forward_iterator_tag,
+        T>;
+    using base_type::operator++;
+
+private:
+    node<T> * it_;
+};
+
+// The same iterator, with every operation written out by hand.
+template<typename T>
+struct hand_written_node_iterator
+{
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using reference = T &;
+    using pointer = T *;
+    using iterator_category = std::forward_iterator_tag;
+
+    constexpr hand_written_node_iterator() noexcept : it_(nullptr) {}
+    constexpr hand_written_node_iterator(node<T> * it) noexcept : it_(it) {}
+
+    constexpr T & operator*() const noexcept { return it_->value_; }
+    constexpr T * operator->() const noexcept { return &it_->value_; }
+    constexpr hand_written_node_iterator & operator++() noexcept
+    {
+        it_ = it_->next_;
+        return *this;
+    }
+    constexpr hand_written_node_iterator operator++(int) noexcept
+    {
+        auto retval = *this;
+        ++*this;
+        return retval;
+    }
+    friend constexpr bool operator==(
+        hand_written_node_iterator lhs, hand_written_node_iterator rhs) noexcept
+    {
+        return lhs.it_ == rhs.it_;
+    }
+    friend constexpr bool operator!=(
+        hand_written_node_iterator lhs, hand_written_node_iterator rhs) noexcept
+    {
+        return lhs.it_ != rhs.it_;
+    }
+
+private:
+    node<T> * it_;
+};
+
+// Links the nodes in a shuffled order, so that traversal chases pointers
+// around memory the way a real list would.  nodes[0] is always the head, and
+// the values increase in link order, so that lower_bound() is meaningful.
+inline std::vector<node<int>> make_list(std::size_t n)
+{
+    std::vector<node<int>> nodes(n);
+    std::vector<std::size_t> order(n);
+    std::iota(order.begin(), order.end(), std::size_t(0));
+    if (1 < n)
+        std::shuffle(order.begin() + 1, order.end(), std::mt19937(1234));
+    for (std::size_t i = 0; i < n; ++i) {
+        auto & node = nodes[order[i]];
+        node.value_ = int(i);
+        node.next_ = i + 1 < n ? &nodes[order[i + 1]] : nullptr;
+    }
+    return nodes;
+}
+
+// A node that also points jump_distance nodes ahead, and an iterator that
+// exposes that pointer through the prefetch_address() hook.
+struct jump_node
+{
+    int value_;
+    jump_node * next_;
+    jump_node * jump_;
+};
+
+constexpr std::size_t jump_distance = 8;
+
+struct jump_node_iterator : boost::stl_interfaces::iterator_interface<
+                                jump_node_iterator,
+                                std::forward_iterator_tag,
+                                int>
+{
+    jump_node_iterator() noexcept : it_(nullptr) {}
+    jump_node_iterator(jump_node * it) noexcept : it_(it) {}
+
+    int & operator*() const noexcept { return it_->value_; }
+    jump_node_iterator & operator++() noexcept
+    {
+        it_ = it_->next_;
+        return *this;
+    }
+    friend bool
+    operator==(jump_node_iterator lhs, jump_node_iterator rhs) noexcept
+    {
+        return lhs.it_ == rhs.it_;
+    }
+
+    using base_type = boost::stl_interfaces::iterator_interface<
+        jump_node_iterator,
+        std::forward_iterator_tag,
+        int>;
+    using base_type::operator++;
+
+private:
+    friend boost::stl_interfaces::access;
+
+    jump_node const * prefetch_address() const noexcept { return it_->jump_; }
+
+    jump_node * it_;
+};
+
+// The list from make_list(), with jump pointers.
+inline std::vector<jump_node> make_jump_list(std::size_t n)
+{
+    std::vector<jump_node> nodes(n);
+    std::vector<std::size_t> order(n);
+    std::iota(order.begin(), order.end(), std::size_t(0));
+    if (1 < n)
+        std::shuffle(order.begin() + 1, order.end(), std::mt19937(1234));
+    for (std::size_t i = 0; i < n; ++i) {
+        auto & node = nodes[order[i]];
+        node.value_ = int(i);
+        node.next_ = i + 1 < n ? &nodes[order[i + 1]] : nullptr;
+        node.jump_ =
+            i + jump_distance < n ? &nodes[order[i + jump_distance]] : nullptr;
+    }
+    return nodes;
+}
+
+// The same traversals of a jump-pointer list, with the std algorithms, which
+// ignore the hook, and with the ones from algorithm.hpp, which prefetch.
+struct std_algorithms
+{
+    template<typename Iter, typename T>
+    static T accumulate(Iter first, Iter last, T init)
+    {
+        return std::accumulate(first, last, init);
+    }
+    template<typename Iter, typename T>
+    static Iter find(Iter first, Iter last, T const & x)
+    {
+        return std::find(first, last, x);
+    }
+};
+
+struct prefetching_algorithms
+{
+    template<typename Iter, typename T>
+    static T accumulate(Iter first, Iter last, T init)
+    {
+        return boost::stl_interfaces::accumulate(first, last, init);
+    }
+    template<typename Iter, typename T>
+    static Iter find(Iter first, Iter last, T const & x)
+    {
+        return boost::stl_interfaces::find(first, last, x);
+    }
+};
+
+template<typename Algorithms>
+void BM_jump_accumulate(benchmark::State & state)
+{
+    auto nodes = make_jump_list(state.range(0));
+    jump_node_iterator const first(&nodes[0]);
+    jump_node_iterator const last;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Algorithms::accumulate(first, last, 0ll));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Algorithms>
+void BM_jump_find(benchmark::State & state)
+{
+    auto nodes = make_jump_list(state.range(0));
+    jump_node_iterator const first(&nodes[0]);
+    jump_node_iterator const last;
+    int const value = int(nodes.size() - 1);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Algorithms::find(first, last, value));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+
+template<typename Iterator>
+void BM_accumulate(benchmark::State & state)
+{
+    auto nodes = make_list(state.range(0));
+    Iterator const first(&nodes[0]);
+    Iterator const last;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::accumulate(first, last, 0ll));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Iterator>
+void BM_copy(benchmark::State & state)
+{
+    auto nodes = make_list(state.range(0));
+    std::vector<int> out(nodes.size());
+    Iterator const first(&nodes[0]);
+    Iterator const last;
+    for (auto _ : state) {
+        std::copy(first, last, out.begin());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Iterator>
+void BM_find(benchmark::State & state)
+{
+    auto nodes = make_list(state.range(0));
+    Iterator const first(&nodes[0]);
+    Iterator const last;
+    int const value = int(nodes.size() - 1);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::find(first, last, value));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Iterator>
+void BM_lower_bound(benchmark::State & state)
+{
+    auto nodes = make_list(state.range(0));
+    Iterator const first(&nodes[0]);
+    Iterator const last;
+    int const value = int(nodes.size() * 3 / 4);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::lower_bound(first, last, value));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BOOST_STL_INTERFACES_PERF_PAIR(
+    BM_accumulate,
+    interface_node_iterator<int>,
+    hand_written_node_iterator<int>);
+BOOST_STL_INTERFACES_PERF_PAIR(
+    BM_copy, interface_node_iterator<int>, hand_written_node_iterator<int>);
+BOOST_STL_INTERFACES_PERF_PAIR(
+    BM_find, interface_node_iterator<int>, hand_written_node_iterator<int>);
+BOOST_STL_INTERFACES_PERF_PAIR(
+    BM_lower_bound,
+    interface_node_iterator<int>,
+    hand_written_node_iterator<int>);
+BOOST_STL_INTERFACES_PERF_PAIR(
+    BM_jump_accumulate, prefetching_algorithms, std_algorithms);
+BOOST_STL_INTERFACES_PERF_PAIR(
+    BM_jump_find, prefetching_algorithms, std_algorithms);
+
+BENCHMARK_MAIN();
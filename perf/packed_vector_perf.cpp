@@ -0,0 +1,89 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/packed_vector.hpp>
+
+#include "perf_common.hpp"
+
+#include <algorithm>
+
+
+namespace bsi = boost::stl_interfaces;
+
+// A bitset with roughly one bit in 64 set, like a sparse filter.
+template<typename Bitset>
+Bitset make_bits(std::size_t n)
+{
+    auto const ints = make_random_ints(n);
+    Bitset result;
+    for (auto x : ints) {
+        result.push_back(x % 64 == 0);
+    }
+    return result;
+}
+
+void BM_count_std_vector_bool(benchmark::State & state)
+{
+    auto const bits = make_bits<std::vector<bool>>(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            std::count(bits.begin(), bits.end(), true));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_count_packed_vector_std(benchmark::State & state)
+{
+    auto const bits = make_bits<bsi::packed_vector<1>>(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            std::count(bits.begin(), bits.end(), true));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_count_packed_vector(benchmark::State & state)
+{
+    auto const bits = make_bits<bsi::packed_vector<1>>(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            bsi::count(bits.begin(), bits.end(), true));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Finds the last set bit by searching past every other one.
+template<typename Bitset, typename Find>
+void find_last(benchmark::State & state, Find find)
+{
+    auto bits = Bitset(state.range(0), false);
+    bits.back() = true;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(find(bits.begin(), bits.end()));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_find_std_vector_bool(benchmark::State & state)
+{
+    find_last<std::vector<bool>>(state, [](auto first, auto last) {
+        return std::find(first, last, true);
+    });
+}
+
+void BM_find_packed_vector(benchmark::State & state)
+{
+    find_last<bsi::packed_vector<1>>(state, [](auto first, auto last) {
+        return bsi::find(first, last, true);
+    });
+}
+
+BENCHMARK(BM_count_std_vector_bool)->BOOST_STL_INTERFACES_PERF_SIZES;
+BENCHMARK(BM_count_packed_vector_std)->BOOST_STL_INTERFACES_PERF_SIZES;
+BENCHMARK(BM_count_packed_vector)->BOOST_STL_INTERFACES_PERF_SIZES;
+BENCHMARK(BM_find_std_vector_bool)->BOOST_STL_INTERFACES_PERF_SIZES;
+BENCHMARK(BM_find_packed_vector)->BOOST_STL_INTERFACES_PERF_SIZES;
+
+BENCHMARK_MAIN();
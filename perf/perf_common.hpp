@@ -0,0 +1,39 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_STL_INTERFACES_PERF_COMMON_HPP
+#define BOOST_STL_INTERFACES_PERF_COMMON_HPP
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+
+// The same seed is used everywhere, so that paired benchmarks (interface
+// vs. hand-written) always see identical inputs.
+inline std::vector<int> make_random_ints(std::size_t n)
+{
+    std::mt19937 gen(1234);
+    std::uniform_int_distribution<int> dist(0, 1 << 20);
+    std::vector<int> retval(n);
+    for (auto & x : retval) {
+        x = dist(gen);
+    }
+    return retval;
+}
+
+// Range of element counts used by every benchmark in this directory.
+#define BOOST_STL_INTERFACES_PERF_SIZES                                        \
+    RangeMultiplier(16)->Range(1 << 6, 1 << 18)
+
+// Defines a pair of benchmarks, one for the iterator built on
+// iterator_interface, and one for its hand-written equivalent, so that they
+// appear next to each other in the output.
+#define BOOST_STL_INTERFACES_PERF_PAIR(bench, interface_type, hand_written_type) \
+    BENCHMARK_TEMPLATE(bench, interface_type)->BOOST_STL_INTERFACES_PERF_SIZES; \
+    BENCHMARK_TEMPLATE(bench, hand_written_type)->BOOST_STL_INTERFACES_PERF_SIZES
+
+#endif
@@ -0,0 +1,64 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/pooled_list.hpp>
+
+#include "perf_common.hpp"
+
+#include <list>
+#include <numeric>
+
+
+using pooled_list = boost::stl_interfaces::pooled_list<int>;
+using std_list = std::list<int>;
+
+
+// Keeps range(0) elements in the list, erasing from the front and
+// inserting at the back, the way an order-book price level turns over.
+template<typename List>
+void BM_churn(benchmark::State & state)
+{
+    auto const n = int(state.range(0));
+    List l;
+    for (int i = 0; i < n; ++i) {
+        l.push_back(i);
+    }
+    int i = 0;
+    for (auto _ : state) {
+        l.pop_front();
+        l.push_back(i++);
+        benchmark::DoNotOptimize(l.back());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Sums a list whose nodes have been shuffled in memory by churn.
+template<typename List>
+void BM_iterate(benchmark::State & state)
+{
+    auto const ints = make_random_ints(state.range(0));
+    List l(ints.begin(), ints.end());
+    for (std::size_t i = 0; i < ints.size(); ++i) {
+        auto it = l.begin();
+        std::advance(it, ints[i] % int(l.size()));
+        l.push_back(*it);
+        l.erase(it);
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::accumulate(l.begin(), l.end(), 0));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_churn, pooled_list)->RangeMultiplier(16)->Range(16, 4096);
+BENCHMARK_TEMPLATE(BM_churn, std_list)->RangeMultiplier(16)->Range(16, 4096);
+BENCHMARK_TEMPLATE(BM_iterate, pooled_list)
+    ->RangeMultiplier(8)
+    ->Range(1 << 6, 1 << 12);
+BENCHMARK_TEMPLATE(BM_iterate, std_list)
+    ->RangeMultiplier(8)
+    ->Range(1 << 6, 1 << 12);
+
+BENCHMARK_MAIN();
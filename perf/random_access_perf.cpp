@@ -0,0 +1,160 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/iterator_interface.hpp>
+
+#include "perf_common.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+
+// The iterator from example/random_access_iterator.cpp.  Only operator*(),
+// operator+=() and operator-() are user-defined; everything else, including
+// operator[](), operator+(), operator--(int) and the relational operators,
+// comes from iterator_interface.
+struct simple_random_access_iterator
+    : boost::stl_interfaces::iterator_interface<
+          simple_random_access_iterator,
+          std::random_access_iterator_tag,
+          int>
+{
+    simple_random_access_iterator() noexcept {}
+    simple_random_access_iterator(int * it) noexcept : it_(it) {}
+
+    int & operator*() const noexcept { return *it_; }
+    simple_random_access_iterator & operator+=(std::ptrdiff_t i) noexcept
+    {
+        it_ += i;
+        return *this;
+    }
+    auto operator-(simple_random_access_iterator other) const noexcept
+    {
+        return it_ - other.it_;
+    }
+
+private:
+    int * it_;
+};
+
+struct interface_iterators
+{
+    using iterator = simple_random_access_iterator;
+    static iterator make(int * p) noexcept { return iterator(p); }
+};
+
+// The hand-written equivalent of a random access iterator over ints is, of
+// course, int *.
+struct pointer_iterators
+{
+    using iterator = int *;
+    static iterator make(int * p) noexcept { return p; }
+};
+
+
+template<typename Iterators>
+void BM_sort(benchmark::State & state)
+{
+    auto const ints = make_random_ints(state.range(0));
+    std::vector<int> v;
+    for (auto _ : state) {
+        v = ints;
+        std::sort(
+            Iterators::make(v.data()), Iterators::make(v.data() + v.size()));
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Iterators>
+void BM_lower_bound(benchmark::State & state)
+{
+    auto ints = make_random_ints(state.range(0));
+    std::sort(ints.begin(), ints.end());
+    auto const keys = make_random_ints(1024);
+    auto const first = Iterators::make(ints.data());
+    auto const last = Iterators::make(ints.data() + ints.size());
+    for (auto _ : state) {
+        for (auto key : keys) {
+            benchmark::DoNotOptimize(std::lower_bound(first, last, key));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+template<typename Iterators>
+void BM_accumulate(benchmark::State & state)
+{
+    auto ints = make_random_ints(state.range(0));
+    auto const first = Iterators::make(ints.data());
+    auto const last = Iterators::make(ints.data() + ints.size());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::accumulate(first, last, 0ll));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Iterators>
+void BM_copy(benchmark::State & state)
+{
+    auto ints = make_random_ints(state.range(0));
+    std::vector<int> out(ints.size());
+    auto const first = Iterators::make(ints.data());
+    auto const last = Iterators::make(ints.data() + ints.size());
+    for (auto _ : state) {
+        std::copy(first, last, Iterators::make(out.data()));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(
+        state.iterations() * state.range(0) * sizeof(int));
+}
+
+// Exercises operator[]() and operator+() directly.
+template<typename Iterators>
+void BM_subscript(benchmark::State & state)
+{
+    auto ints = make_random_ints(state.range(0));
+    auto const first = Iterators::make(ints.data());
+    auto const n = std::ptrdiff_t(ints.size());
+    for (auto _ : state) {
+        long long sum = 0;
+        for (std::ptrdiff_t i = 0; i < n / 2; ++i) {
+            sum += first[i] + *(first + (n - 1 - i));
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Exercises operator--(int) and operator<().
+template<typename Iterators>
+void BM_backward_walk(benchmark::State & state)
+{
+    auto ints = make_random_ints(state.range(0));
+    auto const first = Iterators::make(ints.data());
+    auto const last = Iterators::make(ints.data() + ints.size());
+    for (auto _ : state) {
+        long long sum = 0;
+        for (auto it = last; first < it;) {
+            it--;
+            sum += *it;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BOOST_STL_INTERFACES_PERF_PAIR(BM_sort, interface_iterators, pointer_iterators);
+BOOST_STL_INTERFACES_PERF_PAIR(
+    BM_lower_bound, interface_iterators, pointer_iterators);
+BOOST_STL_INTERFACES_PERF_PAIR(
+    BM_accumulate, interface_iterators, pointer_iterators);
+BOOST_STL_INTERFACES_PERF_PAIR(BM_copy, interface_iterators, pointer_iterators);
+BOOST_STL_INTERFACES_PERF_PAIR(
+    BM_subscript, interface_iterators, pointer_iterators);
+BOOST_STL_INTERFACES_PERF_PAIR(
+    BM_backward_walk, interface_iterators, pointer_iterators);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,105 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/reverse_iterator.hpp>
+
+#include "perf_common.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <list>
+#include <numeric>
+
+
+// std::reverse_iterator is the hand-written equivalent here.
+template<typename Iter>
+using interface_reverse = boost::stl_interfaces::reverse_iterator<Iter>;
+template<typename Iter>
+using std_reverse = std::reverse_iterator<Iter>;
+
+
+template<template<class> class Reverse>
+void BM_sort(benchmark::State & state)
+{
+    auto const ints = make_random_ints(state.range(0));
+    std::vector<int> v;
+    for (auto _ : state) {
+        v = ints;
+        std::sort(
+            Reverse<int *>(v.data() + v.size()), Reverse<int *>(v.data()));
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<template<class> class Reverse>
+void BM_lower_bound(benchmark::State & state)
+{
+    auto ints = make_random_ints(state.range(0));
+    std::sort(ints.begin(), ints.end());
+    auto const keys = make_random_ints(1024);
+    // Reversed, the sequence is descending.
+    Reverse<int *> const first(ints.data() + ints.size());
+    Reverse<int *> const last(ints.data());
+    for (auto _ : state) {
+        for (auto key : keys) {
+            benchmark::DoNotOptimize(
+                std::lower_bound(first, last, key, std::greater<int>{}));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+template<template<class> class Reverse>
+void BM_accumulate(benchmark::State & state)
+{
+    auto ints = make_random_ints(state.range(0));
+    Reverse<int *> const first(ints.data() + ints.size());
+    Reverse<int *> const last(ints.data());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::accumulate(first, last, 0ll));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<template<class> class Reverse>
+void BM_copy(benchmark::State & state)
+{
+    auto ints = make_random_ints(state.range(0));
+    std::vector<int> out(ints.size());
+    Reverse<int *> const first(ints.data() + ints.size());
+    Reverse<int *> const last(ints.data());
+    for (auto _ : state) {
+        std::copy(first, last, out.begin());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(
+        state.iterations() * state.range(0) * sizeof(int));
+}
+
+// Bidirectional iterators take the non-random-access paths through
+// reverse_iterator.
+template<template<class> class Reverse>
+void BM_accumulate_list(benchmark::State & state)
+{
+    auto const ints = make_random_ints(state.range(0));
+    std::list<int> l(ints.begin(), ints.end());
+    using iterator = std::list<int>::iterator;
+    Reverse<iterator> const first(l.end());
+    Reverse<iterator> const last(l.begin());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::accumulate(first, last, 0ll));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BOOST_STL_INTERFACES_PERF_PAIR(BM_sort, interface_reverse, std_reverse);
+BOOST_STL_INTERFACES_PERF_PAIR(BM_lower_bound, interface_reverse, std_reverse);
+BOOST_STL_INTERFACES_PERF_PAIR(BM_accumulate, interface_reverse, std_reverse);
+BOOST_STL_INTERFACES_PERF_PAIR(BM_copy, interface_reverse, std_reverse);
+BOOST_STL_INTERFACES_PERF_PAIR(
+    BM_accumulate_list, interface_reverse, std_reverse);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,257 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/algorithm.hpp>
+#include <boost/stl_interfaces/iterator_interface.hpp>
+
+#include "perf_common.hpp"
+
+#include <algorithm>
+#include <memory>
+
+
+// A deque-like buffer of fixed-size chunks.  Every chunk but the last is
+// full; the end iterator is the last chunk's local end.  The chunk table ends
+// with a null entry, so an iterator can tell when it is in the last chunk.
+struct chunk
+{
+    static constexpr int capacity = 512;
+
+    int data[capacity];
+    int size = 0;
+};
+
+struct chunked_iterator : boost::stl_interfaces::iterator_interface<
+                              chunked_iterator,
+                              std::forward_iterator_tag,
+                              int>
+{
+    using segment_iterator = chunk * const *;
+    using local_iterator = int *;
+
+    chunked_iterator() = default;
+    chunked_iterator(segment_iterator s, int * p) : s_(s), p_(p) {}
+
+    int & operator*() const { return *p_; }
+    chunked_iterator & operator++()
+    {
+        ++p_;
+        if (p_ == local_end(s_) && s_[1]) {
+            ++s_;
+            p_ = local_begin(s_);
+        }
+        return *this;
+    }
+    friend bool operator==(chunked_iterator lhs, chunked_iterator rhs)
+    {
+        return lhs.p_ == rhs.p_;
+    }
+
+    using base_type = boost::stl_interfaces::
+        iterator_interface<chunked_iterator, std::forward_iterator_tag, int>;
+    using base_type::operator++;
+
+private:
+    friend boost::stl_interfaces::access;
+
+    segment_iterator segment() const { return s_; }
+    local_iterator local() const { return p_; }
+    static local_iterator local_begin(segment_iterator s)
+    {
+        return (*s)->data;
+    }
+    static local_iterator local_end(segment_iterator s)
+    {
+        return (*s)->data + (*s)->size;
+    }
+    static chunked_iterator compose(segment_iterator s, local_iterator p)
+    {
+        if (p == local_end(s) && s[1])
+            return chunked_iterator(s + 1, local_begin(s + 1));
+        return chunked_iterator(s, p);
+    }
+
+    segment_iterator s_ = nullptr;
+    int * p_ = nullptr;
+};
+
+struct chunked_buffer
+{
+    explicit chunked_buffer(std::vector<int> const & values)
+    {
+        std::size_t i = 0;
+        do {
+            storage_.push_back(std::make_unique<chunk>());
+            chunks_.push_back(storage_.back().get());
+            auto & c = *storage_.back();
+            for (; c.size < chunk::capacity && i < values.size(); ++i) {
+                c.data[c.size++] = values[i];
+            }
+        } while (i < values.size());
+        chunks_.push_back(nullptr);
+    }
+
+    chunked_iterator begin() const
+    {
+        return chunked_iterator(&chunks_[0], chunks_[0]->data);
+    }
+    chunked_iterator end() const
+    {
+        auto const last = &chunks_[chunks_.size() - 2];
+        return chunked_iterator(last, (*last)->data + (*last)->size);
+    }
+
+private:
+    std::vector<std::unique_ptr<chunk>> storage_;
+    std::vector<chunk *> chunks_;
+};
+
+// The same operations, as element-at-a-time std algorithms and as the
+// segment-at-a-time algorithms from algorithm.hpp.
+struct element_at_a_time
+{
+    template<typename Iter, typename F>
+    static F for_each(Iter first, Iter last, F f)
+    {
+        return std::for_each(first, last, f);
+    }
+    template<typename Iter, typename Out>
+    static Out copy(Iter first, Iter last, Out out)
+    {
+        return std::copy(first, last, out);
+    }
+    template<typename Iter, typename T>
+    static void fill(Iter first, Iter last, T const & x)
+    {
+        std::fill(first, last, x);
+    }
+    template<typename Iter, typename T>
+    static Iter find(Iter first, Iter last, T const & x)
+    {
+        return std::find(first, last, x);
+    }
+};
+
+struct segment_at_a_time
+{
+    template<typename Iter, typename F>
+    static F for_each(Iter first, Iter last, F f)
+    {
+        return boost::stl_interfaces::for_each(first, last, f);
+    }
+    template<typename Iter, typename Out>
+    static Out copy(Iter first, Iter last, Out out)
+    {
+        return boost::stl_interfaces::copy(first, last, out);
+    }
+    template<typename Iter, typename T>
+    static void fill(Iter first, Iter last, T const & x)
+    {
+        boost::stl_interfaces::fill(first, last, x);
+    }
+    template<typename Iter, typename T>
+    static Iter find(Iter first, Iter last, T const & x)
+    {
+        return boost::stl_interfaces::find(first, last, x);
+    }
+};
+
+
+template<typename Algorithms>
+void BM_for_each(benchmark::State & state)
+{
+    chunked_buffer const buffer(make_random_ints(state.range(0)));
+    for (auto _ : state) {
+        long long sum = 0;
+        Algorithms::for_each(
+            buffer.begin(), buffer.end(), [&](int x) { sum += x; });
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Algorithms>
+void BM_copy(benchmark::State & state)
+{
+    chunked_buffer const buffer(make_random_ints(state.range(0)));
+    std::vector<int> out(state.range(0));
+    for (auto _ : state) {
+        Algorithms::copy(buffer.begin(), buffer.end(), out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Algorithms>
+void BM_fill(benchmark::State & state)
+{
+    chunked_buffer const buffer(make_random_ints(state.range(0)));
+    for (auto _ : state) {
+        Algorithms::fill(buffer.begin(), buffer.end(), 42);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Algorithms>
+void BM_find(benchmark::State & state)
+{
+    chunked_buffer const buffer(make_random_ints(state.range(0)));
+    for (auto _ : state) {
+        // make_random_ints() never produces negative values.
+        benchmark::DoNotOptimize(
+            Algorithms::find(buffer.begin(), buffer.end(), -1));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Sums a concat_view of four vectors, one element at a time through the
+// view's iterators, or one vector at a time with for_each_segment().
+void BM_concat_sum_elements(benchmark::State & state)
+{
+    auto a = make_random_ints(state.range(0) / 4);
+    auto b = make_random_ints(state.range(0) / 4);
+    auto c = make_random_ints(state.range(0) / 4);
+    auto d = make_random_ints(state.range(0) / 4);
+    auto cat = boost::stl_interfaces::views::concat(a, b, c, d);
+    for (auto _ : state) {
+        long long sum = 0;
+        for (int x : cat) {
+            sum += x;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_concat_sum_segments(benchmark::State & state)
+{
+    auto a = make_random_ints(state.range(0) / 4);
+    auto b = make_random_ints(state.range(0) / 4);
+    auto c = make_random_ints(state.range(0) / 4);
+    auto d = make_random_ints(state.range(0) / 4);
+    auto cat = boost::stl_interfaces::views::concat(a, b, c, d);
+    for (auto _ : state) {
+        long long sum = 0;
+        boost::stl_interfaces::for_each_segment(
+            cat.begin(), cat.end(), [&](auto first, auto last) {
+                for (; first != last; ++first) {
+                    sum += *first;
+                }
+            });
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BOOST_STL_INTERFACES_PERF_PAIR(
+    BM_for_each, segment_at_a_time, element_at_a_time);
+BOOST_STL_INTERFACES_PERF_PAIR(BM_copy, segment_at_a_time, element_at_a_time);
+BOOST_STL_INTERFACES_PERF_PAIR(BM_fill, segment_at_a_time, element_at_a_time);
+BOOST_STL_INTERFACES_PERF_PAIR(BM_find, segment_at_a_time, element_at_a_time);
+BENCHMARK(BM_concat_sum_segments)->BOOST_STL_INTERFACES_PERF_SIZES;
+BENCHMARK(BM_concat_sum_elements)->BOOST_STL_INTERFACES_PERF_SIZES;
+
+BENCHMARK_MAIN();
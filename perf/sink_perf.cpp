@@ -0,0 +1,95 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/algorithm.hpp>
+#include <boost/stl_interfaces/iterator_interface.hpp>
+
+#include "perf_common.hpp"
+
+
+// An appending output iterator, with and without a sink() hook.  Without
+// one, copy() does one push_back() per element.
+template<bool Sink>
+struct append_iterator : boost::stl_interfaces::iterator_interface<
+                             append_iterator<Sink>,
+                             std::output_iterator_tag,
+                             int,
+                             append_iterator<Sink> &>
+{
+    append_iterator() = default;
+    explicit append_iterator(std::vector<int> & v) : v_(&v) {}
+
+    append_iterator & operator=(int x)
+    {
+        v_->push_back(x);
+        return *this;
+    }
+    append_iterator & operator*() { return *this; }
+    append_iterator & operator++() { return *this; }
+
+    using base_type = boost::stl_interfaces::iterator_interface<
+        append_iterator<Sink>,
+        std::output_iterator_tag,
+        int,
+        append_iterator<Sink> &>;
+    using base_type::operator++;
+
+private:
+    friend boost::stl_interfaces::access;
+
+    template<
+        typename Iter,
+        bool S = Sink,
+        typename Enable = std::enable_if_t<S>>
+    void sink(Iter first, Iter last)
+    {
+        v_->insert(v_->end(), first, last);
+    }
+
+    std::vector<int> * v_ = nullptr;
+};
+
+using element_at_a_time = append_iterator<false>;
+using sink = append_iterator<true>;
+
+struct plus_one
+{
+    int operator()(int x) const { return x + 1; }
+};
+
+
+template<typename Out>
+void BM_copy(benchmark::State & state)
+{
+    std::vector<int> const ints = make_random_ints(state.range(0));
+    std::vector<int> out;
+    for (auto _ : state) {
+        out.clear();
+        out.shrink_to_fit();
+        boost::stl_interfaces::copy(ints.begin(), ints.end(), Out(out));
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Out>
+void BM_transform(benchmark::State & state)
+{
+    std::vector<int> const ints = make_random_ints(state.range(0));
+    std::vector<int> out;
+    for (auto _ : state) {
+        out.clear();
+        out.shrink_to_fit();
+        boost::stl_interfaces::transform(
+            ints.begin(), ints.end(), Out(out), plus_one{});
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BOOST_STL_INTERFACES_PERF_PAIR(BM_copy, sink, element_at_a_time);
+BOOST_STL_INTERFACES_PERF_PAIR(BM_transform, sink, element_at_a_time);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,82 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/slot_map.hpp>
+
+#include "perf_common.hpp"
+
+#include <numeric>
+
+
+// The usual hand-written entity table: every slot carries a live flag,
+// which iteration tests slot by slot.
+struct flagged_table
+{
+    struct slot
+    {
+        bool live;
+        int value;
+    };
+
+    void insert(int x) { slots_.push_back(slot{true, x}); }
+    void erase(std::size_t i) { slots_[i].live = false; }
+
+    long long sum() const
+    {
+        long long result = 0;
+        for (auto const & s : slots_) {
+            if (s.live)
+                result += s.value;
+        }
+        return result;
+    }
+
+    std::vector<slot> slots_;
+};
+
+struct slot_map_table
+{
+    void insert(int x) { handles_.push_back(map_.insert(x)); }
+    void erase(std::size_t i) { map_.erase(handles_[i]); }
+
+    long long sum() const
+    {
+        return std::accumulate(map_.begin(), map_.end(), 0ll);
+    }
+
+    boost::stl_interfaces::slot_map<int> map_;
+    std::vector<boost::stl_interfaces::slot_map_handle> handles_;
+};
+
+// Sums a table of 1 << 16 slots after erasing all but every range(0)th
+// element, the way a long-lived entity table accumulates holes.
+template<typename Table>
+void BM_iterate_sparse(benchmark::State & state)
+{
+    std::size_t const n = 1 << 16;
+    auto const stride = std::size_t(state.range(0));
+    auto const ints = make_random_ints(n);
+    Table table;
+    for (auto x : ints) {
+        table.insert(x);
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+        if (i % stride)
+            table.erase(i);
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(table.sum());
+    }
+    state.SetItemsProcessed(state.iterations() * (n / stride));
+}
+
+BENCHMARK_TEMPLATE(BM_iterate_sparse, slot_map_table)
+    ->RangeMultiplier(4)
+    ->Range(1, 1 << 8);
+BENCHMARK_TEMPLATE(BM_iterate_sparse, flagged_table)
+    ->RangeMultiplier(4)
+    ->Range(1, 1 << 8);
+
+BENCHMARK_MAIN();
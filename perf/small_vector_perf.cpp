@@ -0,0 +1,51 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/small_vector.hpp>
+
+#include "perf_common.hpp"
+
+#include <numeric>
+
+
+using small_vec = boost::stl_interfaces::small_vector<int, 8>;
+using std_vec = std::vector<int>;
+
+
+// Builds and discards one short vector per iteration, the way a
+// per-request scratch vector is used.  range(0) is the element count; up to
+// 8 fit inline in small_vec.
+template<typename Vec>
+void BM_build_short(benchmark::State & state)
+{
+    auto const n = int(state.range(0));
+    for (auto _ : state) {
+        Vec v;
+        for (int i = 0; i < n; ++i) {
+            v.push_back(i);
+        }
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+template<typename Vec>
+void BM_copy_short(benchmark::State & state)
+{
+    Vec v(state.range(0));
+    std::iota(v.begin(), v.end(), 0);
+    for (auto _ : state) {
+        Vec v2(v);
+        benchmark::DoNotOptimize(v2.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_build_short, small_vec)->DenseRange(2, 16, 2);
+BENCHMARK_TEMPLATE(BM_build_short, std_vec)->DenseRange(2, 16, 2);
+BENCHMARK_TEMPLATE(BM_copy_short, small_vec)->DenseRange(2, 16, 2);
+BENCHMARK_TEMPLATE(BM_copy_short, std_vec)->DenseRange(2, 16, 2);
+
+BENCHMARK_MAIN();
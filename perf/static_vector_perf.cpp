@@ -0,0 +1,80 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/static_vector.hpp>
+#include "../example/static_vector.hpp"
+
+#include "perf_common.hpp"
+
+#include <numeric>
+
+
+using lib_vec = boost::stl_interfaces::static_vector<int, 32>;
+using example_vec = static_vector<int, 32>;
+
+
+// Builds and discards one short vector per iteration.  range(0) is the
+// element count.
+template<typename Vec>
+void BM_build_short(benchmark::State & state)
+{
+    auto const n = int(state.range(0));
+    for (auto _ : state) {
+        Vec v;
+        for (int i = 0; i < n; ++i) {
+            v.push_back(i);
+        }
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+void BM_build_short_unchecked(benchmark::State & state)
+{
+    auto const n = int(state.range(0));
+    for (auto _ : state) {
+        lib_vec v;
+        for (int i = 0; i < n; ++i) {
+            v.push_back_unchecked(i);
+        }
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+template<typename Vec>
+void BM_copy_short(benchmark::State & state)
+{
+    Vec v(state.range(0));
+    std::iota(v.begin(), v.end(), 0);
+    for (auto _ : state) {
+        Vec v2(v);
+        benchmark::DoNotOptimize(v2.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Vec>
+void BM_swap_short(benchmark::State & state)
+{
+    Vec v(state.range(0));
+    Vec v2(state.range(0) / 2);
+    for (auto _ : state) {
+        v.swap(v2);
+        benchmark::DoNotOptimize(v.data());
+        benchmark::DoNotOptimize(v2.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_build_short, lib_vec)->DenseRange(2, 16, 2);
+BENCHMARK_TEMPLATE(BM_build_short, example_vec)->DenseRange(2, 16, 2);
+BENCHMARK(BM_build_short_unchecked)->DenseRange(2, 16, 2);
+BENCHMARK_TEMPLATE(BM_copy_short, lib_vec)->DenseRange(2, 16, 2);
+BENCHMARK_TEMPLATE(BM_copy_short, example_vec)->DenseRange(2, 16, 2);
+BENCHMARK_TEMPLATE(BM_swap_short, lib_vec)->DenseRange(2, 16, 2);
+BENCHMARK_TEMPLATE(BM_swap_short, example_vec)->DenseRange(2, 16, 2);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,63 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/strided_view.hpp>
+
+#include "perf_common.hpp"
+
+#include <algorithm>
+
+
+namespace bsi = boost::stl_interfaces;
+
+// Transposes an n by n matrix one column of the source at a time.
+void BM_transpose_columns(benchmark::State & state)
+{
+    auto const n = std::ptrdiff_t(state.range(0));
+    auto const src_ints = make_random_ints(n * n);
+    std::vector<int> dst_ints(n * n);
+    bsi::matrix_view<int const> src(src_ints.data(), n, n);
+    bsi::matrix_view<int> dst(dst_ints.data(), n, n);
+    for (auto _ : state) {
+        for (std::ptrdiff_t j = 0; j < n; ++j) {
+            auto const column = src.column(j);
+            std::copy(column.begin(), column.end(), dst.row(j).begin());
+        }
+        benchmark::DoNotOptimize(dst_ints.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+// Transposes an n by n matrix one 32 by 32 tile at a time.
+void BM_transpose_tiles(benchmark::State & state)
+{
+    auto const n = std::ptrdiff_t(state.range(0));
+    auto const src_ints = make_random_ints(n * n);
+    std::vector<int> dst_ints(n * n);
+    bsi::matrix_view<int const> src(src_ints.data(), n, n);
+    bsi::matrix_view<int> dst(dst_ints.data(), n, n);
+    bsi::tiled_view<int const> tiles(src, 32, 32);
+    for (auto _ : state) {
+        for (auto it = tiles.begin(), last = tiles.end(); it != last; ++it) {
+            auto const tile = *it;
+            auto const out = dst.submatrix(
+                it.tile_column() * 32,
+                it.tile_row() * 32,
+                tile.cols(),
+                tile.rows());
+            for (std::ptrdiff_t j = 0; j < tile.cols(); ++j) {
+                auto const column = tile.column(j);
+                std::copy(column.begin(), column.end(), out.row(j).begin());
+            }
+        }
+        benchmark::DoNotOptimize(dst_ints.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+BENCHMARK(BM_transpose_columns)->RangeMultiplier(4)->Range(1 << 6, 1 << 12);
+BENCHMARK(BM_transpose_tiles)->RangeMultiplier(4)->Range(1 << 6, 1 << 12);
+
+BENCHMARK_MAIN();
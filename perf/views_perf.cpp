@@ -0,0 +1,72 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/views.hpp>
+
+#include "perf_common.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+
+namespace views = boost::stl_interfaces::views;
+
+struct is_odd
+{
+    bool operator()(int x) const { return x % 2 != 0; }
+};
+
+struct halve
+{
+    long long operator()(int x) const { return x / 2; }
+};
+
+// The same filter-transform-take pipeline, as lazy views over the input,
+// and as a sequence of algorithms that each fill a temporary vector.
+struct lazy_views
+{
+    static long long sum(std::vector<int> const & ints, std::ptrdiff_t n)
+    {
+        long long retval = 0;
+        for (auto x : ints | views::filter(is_odd{}) |
+                          views::transform(halve{}) | views::take(n)) {
+            retval += x;
+        }
+        return retval;
+    }
+};
+
+struct temporary_vectors
+{
+    static long long sum(std::vector<int> const & ints, std::ptrdiff_t n)
+    {
+        std::vector<int> odds;
+        std::copy_if(
+            ints.begin(), ints.end(), std::back_inserter(odds), is_odd{});
+        std::vector<long long> halves(odds.size());
+        std::transform(odds.begin(), odds.end(), halves.begin(), halve{});
+        halves.resize(std::min<std::size_t>(halves.size(), n));
+        long long retval = 0;
+        for (auto x : halves) {
+            retval += x;
+        }
+        return retval;
+    }
+};
+
+
+template<typename Pipeline>
+void BM_pipeline(benchmark::State & state)
+{
+    std::vector<int> const ints = make_random_ints(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Pipeline::sum(ints, state.range(0) / 4));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BOOST_STL_INTERFACES_PERF_PAIR(BM_pipeline, lazy_views, temporary_vectors);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,274 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/iterator_interface.hpp>
+#include <boost/stl_interfaces/zip_iterator.hpp>
+
+#include "perf_common.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <tuple>
+
+
+using zip_reference = std::tuple<int &, int &>;
+
+// The iterator from example/zip_proxy_iterator.cpp.
+struct interface_zip_iterator : boost::stl_interfaces::proxy_iterator_interface<
+                                    interface_zip_iterator,
+                                    std::random_access_iterator_tag,
+                                    std::tuple<int, int>,
+                                    zip_reference>
+{
+    constexpr interface_zip_iterator() noexcept : it1_(), it2_() {}
+    constexpr interface_zip_iterator(int * it1, int * it2) noexcept :
+        it1_(it1),
+        it2_(it2)
+    {}
+
+    constexpr zip_reference operator*() const noexcept
+    {
+        return zip_reference{*it1_, *it2_};
+    }
+    constexpr interface_zip_iterator & operator+=(std::ptrdiff_t i) noexcept
+    {
+        it1_ += i;
+        it2_ += i;
+        return *this;
+    }
+    constexpr auto operator-(interface_zip_iterator other) const noexcept
+    {
+        return it1_ - other.it1_;
+    }
+
+private:
+    int * it1_;
+    int * it2_;
+};
+
+// The same iterator, with every operation written out by hand.
+struct hand_written_zip_iterator
+{
+    using value_type = std::tuple<int, int>;
+    using difference_type = std::ptrdiff_t;
+    using reference = zip_reference;
+    using pointer = boost::stl_interfaces::proxy_arrow_result<reference>;
+    using iterator_category = std::random_access_iterator_tag;
+
+    constexpr hand_written_zip_iterator() noexcept : it1_(), it2_() {}
+    constexpr hand_written_zip_iterator(int * it1, int * it2) noexcept :
+        it1_(it1),
+        it2_(it2)
+    {}
+
+    constexpr reference operator*() const noexcept
+    {
+        return reference{*it1_, *it2_};
+    }
+    constexpr pointer operator->() const noexcept { return pointer(**this); }
+    constexpr reference operator[](difference_type n) const noexcept
+    {
+        return reference{it1_[n], it2_[n]};
+    }
+
+    constexpr hand_written_zip_iterator & operator++() noexcept
+    {
+        ++it1_;
+        ++it2_;
+        return *this;
+    }
+    constexpr hand_written_zip_iterator operator++(int) noexcept
+    {
+        auto retval = *this;
+        ++*this;
+        return retval;
+    }
+    constexpr hand_written_zip_iterator & operator--() noexcept
+    {
+        --it1_;
+        --it2_;
+        return *this;
+    }
+    constexpr hand_written_zip_iterator operator--(int) noexcept
+    {
+        auto retval = *this;
+        --*this;
+        return retval;
+    }
+    constexpr hand_written_zip_iterator &
+    operator+=(difference_type n) noexcept
+    {
+        it1_ += n;
+        it2_ += n;
+        return *this;
+    }
+    constexpr hand_written_zip_iterator &
+    operator-=(difference_type n) noexcept
+    {
+        it1_ -= n;
+        it2_ -= n;
+        return *this;
+    }
+
+    friend constexpr hand_written_zip_iterator
+    operator+(hand_written_zip_iterator it, difference_type n) noexcept
+    {
+        return it += n;
+    }
+    friend constexpr hand_written_zip_iterator
+    operator+(difference_type n, hand_written_zip_iterator it) noexcept
+    {
+        return it += n;
+    }
+    friend constexpr hand_written_zip_iterator
+    operator-(hand_written_zip_iterator it, difference_type n) noexcept
+    {
+        return it -= n;
+    }
+    friend constexpr difference_type operator-(
+        hand_written_zip_iterator lhs, hand_written_zip_iterator rhs) noexcept
+    {
+        return lhs.it1_ - rhs.it1_;
+    }
+
+    friend constexpr bool operator==(
+        hand_written_zip_iterator lhs, hand_written_zip_iterator rhs) noexcept
+    {
+        return lhs.it1_ == rhs.it1_;
+    }
+    friend constexpr bool operator!=(
+        hand_written_zip_iterator lhs, hand_written_zip_iterator rhs) noexcept
+    {
+        return lhs.it1_ != rhs.it1_;
+    }
+    friend constexpr bool operator<(
+        hand_written_zip_iterator lhs, hand_written_zip_iterator rhs) noexcept
+    {
+        return lhs.it1_ < rhs.it1_;
+    }
+    friend constexpr bool operator<=(
+        hand_written_zip_iterator lhs, hand_written_zip_iterator rhs) noexcept
+    {
+        return lhs.it1_ <= rhs.it1_;
+    }
+    friend constexpr bool operator>(
+        hand_written_zip_iterator lhs, hand_written_zip_iterator rhs) noexcept
+    {
+        return lhs.it1_ > rhs.it1_;
+    }
+    friend constexpr bool operator>=(
+        hand_written_zip_iterator lhs, hand_written_zip_iterator rhs) noexcept
+    {
+        return lhs.it1_ >= rhs.it1_;
+    }
+
+private:
+    int * it1_;
+    int * it2_;
+};
+
+namespace std {
+    // Required for std::sort; see example/zip_proxy_iterator.cpp.
+    void swap(zip_reference && lhs, zip_reference && rhs)
+    {
+        using std::swap;
+        swap(std::get<0>(lhs), std::get<0>(rhs));
+        swap(std::get<1>(lhs), std::get<1>(rhs));
+    }
+}
+
+
+template<typename Iterator>
+void BM_sort(benchmark::State & state)
+{
+    auto const firsts = make_random_ints(state.range(0));
+    std::vector<int> const seconds(firsts.rbegin(), firsts.rend());
+    std::vector<int> v1;
+    std::vector<int> v2;
+    for (auto _ : state) {
+        v1 = firsts;
+        v2 = seconds;
+        std::sort(
+            Iterator(v1.data(), v2.data()),
+            Iterator(v1.data() + v1.size(), v2.data() + v2.size()));
+        benchmark::DoNotOptimize(v1.data());
+        benchmark::DoNotOptimize(v2.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Iterator>
+void BM_lower_bound(benchmark::State & state)
+{
+    auto v1 = make_random_ints(state.range(0));
+    std::sort(v1.begin(), v1.end());
+    std::vector<int> v2(v1.size(), 1);
+    auto const keys = make_random_ints(1024);
+    Iterator const first(v1.data(), v2.data());
+    Iterator const last(v1.data() + v1.size(), v2.data() + v2.size());
+    for (auto _ : state) {
+        for (auto key : keys) {
+            benchmark::DoNotOptimize(
+                std::lower_bound(first, last, std::tuple<int, int>(key, 1)));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+template<typename Iterator>
+void BM_accumulate(benchmark::State & state)
+{
+    auto v1 = make_random_ints(state.range(0));
+    auto v2 = make_random_ints(state.range(0));
+    Iterator const first(v1.data(), v2.data());
+    Iterator const last(v1.data() + v1.size(), v2.data() + v2.size());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::accumulate(
+            first, last, 0ll, [](long long sum, zip_reference r) {
+                return sum + std::get<0>(r) - std::get<1>(r);
+            }));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Iterator>
+void BM_copy(benchmark::State & state)
+{
+    auto v1 = make_random_ints(state.range(0));
+    auto v2 = make_random_ints(state.range(0));
+    std::vector<int> out1(v1.size());
+    std::vector<int> out2(v2.size());
+    Iterator const first(v1.data(), v2.data());
+    Iterator const last(v1.data() + v1.size(), v2.data() + v2.size());
+    for (auto _ : state) {
+        std::copy(first, last, Iterator(out1.data(), out2.data()));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(
+        state.iterations() * state.range(0) * 2 * sizeof(int));
+}
+
+BOOST_STL_INTERFACES_PERF_PAIR(
+    BM_sort, interface_zip_iterator, hand_written_zip_iterator);
+BOOST_STL_INTERFACES_PERF_PAIR(
+    BM_lower_bound, interface_zip_iterator, hand_written_zip_iterator);
+BOOST_STL_INTERFACES_PERF_PAIR(
+    BM_accumulate, interface_zip_iterator, hand_written_zip_iterator);
+BOOST_STL_INTERFACES_PERF_PAIR(
+    BM_copy, interface_zip_iterator, hand_written_zip_iterator);
+
+// The generic zip_iterator from zip_iterator.hpp, which should match the two
+// iterators above.
+using library_zip_iterator = boost::stl_interfaces::zip_iterator<int *, int *>;
+BENCHMARK_TEMPLATE(BM_sort, library_zip_iterator)
+    ->BOOST_STL_INTERFACES_PERF_SIZES;
+BENCHMARK_TEMPLATE(BM_lower_bound, library_zip_iterator)
+    ->BOOST_STL_INTERFACES_PERF_SIZES;
+BENCHMARK_TEMPLATE(BM_accumulate, library_zip_iterator)
+    ->BOOST_STL_INTERFACES_PERF_SIZES;
+BENCHMARK_TEMPLATE(BM_copy, library_zip_iterator)
+    ->BOOST_STL_INTERFACES_PERF_SIZES;
+
+BENCHMARK_MAIN();
@@ -0,0 +1,269 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/allocator_interface.hpp>
+#include <boost/stl_interfaces/small_vector.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <memory>
+#include <string>
+
+
+// An arena-like allocator: each instance is bound to an arena, and
+// allocators bound to different arenas compare unequal.  Whether it
+// propagates is configurable.
+struct arena
+{
+    int live_allocations = 0;
+};
+
+template<typename T, bool Propagate>
+struct arena_allocator
+{
+    using value_type = T;
+    using propagate_on_container_copy_assignment =
+        std::integral_constant<bool, Propagate>;
+    using propagate_on_container_move_assignment =
+        std::integral_constant<bool, Propagate>;
+    using propagate_on_container_swap = std::integral_constant<bool, Propagate>;
+
+    template<typename U>
+    struct rebind
+    {
+        using other = arena_allocator<U, Propagate>;
+    };
+
+    arena_allocator(arena * a) : arena_(a) {}
+    template<typename U>
+    arena_allocator(arena_allocator<U, Propagate> const & other) :
+        arena_(other.arena_)
+    {}
+
+    T * allocate(std::size_t n)
+    {
+        ++arena_->live_allocations;
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T * p, std::size_t n)
+    {
+        --arena_->live_allocations;
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    friend bool
+    operator==(arena_allocator const & lhs, arena_allocator const & rhs)
+    {
+        return lhs.arena_ == rhs.arena_;
+    }
+    friend bool
+    operator!=(arena_allocator const & lhs, arena_allocator const & rhs)
+    {
+        return lhs.arena_ != rhs.arena_;
+    }
+
+    arena * arena_;
+};
+
+template<bool Propagate>
+using arena_vec = boost::stl_interfaces::
+    small_vector<int, 2, arena_allocator<int, Propagate>>;
+
+
+// A minimal container that gets its allocator support from
+// allocator_interface.
+struct int_buffer : boost::stl_interfaces::allocator_interface<
+                        int_buffer,
+                        arena_allocator<int, true>>
+{
+    using base_type = boost::stl_interfaces::
+        allocator_interface<int_buffer, arena_allocator<int, true>>;
+
+    int_buffer(std::size_t n, allocator_type const & a) :
+        base_type(a),
+        data_(this->allocate(n)),
+        size_(n)
+    {
+        for (std::size_t i = 0; i < n; ++i) {
+            this->construct(data_ + i, int(i));
+        }
+    }
+    int_buffer(int_buffer const & other) :
+        base_type(select_on_container_copy_construction(other)),
+        data_(this->allocate(other.size_)),
+        size_(other.size_)
+    {
+        std::copy(other.data_, other.data_ + size_, data_);
+    }
+    int_buffer & operator=(int_buffer const & other) = delete;
+    ~int_buffer() { this->deallocate(data_, size_); }
+
+    void swap(int_buffer & other)
+    {
+        this->swap_allocator(other);
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+    }
+
+    int * data_;
+    std::size_t size_;
+};
+
+static_assert(
+    std::uses_allocator<int_buffer, arena_allocator<int, true>>::value, "");
+static_assert(
+    std::is_same<
+        int_buffer::allocator_type,
+        arena_allocator<int, true>>::value,
+    "");
+static_assert(
+    sizeof(boost::stl_interfaces::small_vector<int, 2>) ==
+        sizeof(boost::stl_interfaces::small_vector<int, 2, arena_allocator<int, true>>) -
+            sizeof(arena *),
+    "");
+
+
+int main()
+{
+
+{
+    arena a1;
+    arena a2;
+    {
+        int_buffer b1(3, &a1);
+        int_buffer b2(b1);
+        BOOST_TEST(b2.get_allocator() == b1.get_allocator());
+        BOOST_TEST(a1.live_allocations == 2);
+
+        int_buffer b3(1, &a2);
+        b3.swap(b1);
+        BOOST_TEST(b3.get_allocator().arena_ == &a1);
+        BOOST_TEST(b1.get_allocator().arena_ == &a2);
+        BOOST_TEST(b3.size_ == 3u);
+        BOOST_TEST(b1.size_ == 1u);
+    }
+    BOOST_TEST(a1.live_allocations == 0);
+    BOOST_TEST(a2.live_allocations == 0);
+}
+
+// Propagating allocators.
+{
+    arena a1;
+    arena a2;
+    {
+        arena_vec<true> v1({1, 2, 3}, &a1);
+        arena_vec<true> v2({4, 5, 6, 7}, &a2);
+        BOOST_TEST(a1.live_allocations == 1);
+        BOOST_TEST(a2.live_allocations == 1);
+
+        arena_vec<true> v3(v1);
+        BOOST_TEST(v3.get_allocator().arena_ == &a1);
+        BOOST_TEST(a1.live_allocations == 2);
+
+        // Copy assignment takes v2's allocator, releasing v3's a1 storage
+        // first.
+        v3 = v2;
+        BOOST_TEST(v3.get_allocator().arena_ == &a2);
+        BOOST_TEST(a1.live_allocations == 1);
+        BOOST_TEST(a2.live_allocations == 2);
+        BOOST_TEST(v3 == v2);
+
+        // Move assignment takes v1's allocator and storage.
+        int const * data = v1.data();
+        v3 = std::move(v1);
+        BOOST_TEST(v3.get_allocator().arena_ == &a1);
+        BOOST_TEST(v3.data() == data);
+        BOOST_TEST(a1.live_allocations == 1);
+        BOOST_TEST(a2.live_allocations == 1);
+
+        v3.swap(v2);
+        BOOST_TEST(v3.get_allocator().arena_ == &a2);
+        BOOST_TEST(v2.get_allocator().arena_ == &a1);
+        BOOST_TEST(v2.data() == data);
+        BOOST_TEST(v3 == arena_vec<true>({4, 5, 6, 7}, &a2));
+    }
+    BOOST_TEST(a1.live_allocations == 0);
+    BOOST_TEST(a2.live_allocations == 0);
+}
+
+// Non-propagating allocators.
+{
+    arena a1;
+    arena a2;
+    {
+        arena_vec<false> v1({1, 2, 3}, &a1);
+        arena_vec<false> v2({4, 5, 6, 7}, &a2);
+
+        v2 = v1;
+        BOOST_TEST(v2.get_allocator().arena_ == &a2);
+        BOOST_TEST(v2 == v1);
+
+        // Unequal allocators, so the elements are moved one at a time into
+        // v2's own storage.
+        int const * data = v1.data();
+        v2 = std::move(v1);
+        BOOST_TEST(v2.get_allocator().arena_ == &a2);
+        BOOST_TEST(v2.data() != data);
+        BOOST_TEST(v2 == arena_vec<false>({1, 2, 3}, &a1));
+
+        // Allocator-extended move construction.
+        arena_vec<false> v3(std::move(v2), &a1);
+        BOOST_TEST(v3.get_allocator().arena_ == &a1);
+        BOOST_TEST(a2.live_allocations == 1);
+        BOOST_TEST(v3 == arena_vec<false>({1, 2, 3}, &a1));
+
+        arena_vec<false> v4(v3, &a2);
+        BOOST_TEST(v4.get_allocator().arena_ == &a2);
+        BOOST_TEST(v4 == v3);
+    }
+    BOOST_TEST(a1.live_allocations == 0);
+    BOOST_TEST(a2.live_allocations == 0);
+}
+
+#if defined(__cpp_lib_memory_resource)
+{
+    // Everything, including the strings' own buffers, comes from the arena,
+    // which is freed in one step.
+    alignas(std::max_align_t) unsigned char buffer[4096];
+    std::pmr::monotonic_buffer_resource resource(
+        buffer, sizeof(buffer), std::pmr::null_memory_resource());
+
+    using string_vec =
+        boost::stl_interfaces::pmr::small_vector<std::pmr::string, 2>;
+    string_vec v(&resource);
+    v.emplace_back("a string long enough to require an allocation");
+    v.emplace_back("another string long enough to require an allocation");
+    v.emplace_back("and a third, which moves the elements to the heap");
+    BOOST_TEST(!v.is_inline());
+    BOOST_TEST(v.get_allocator().resource() == &resource);
+    for (auto const & s : v) {
+        BOOST_TEST(s.get_allocator().resource() == &resource);
+    }
+    auto const in_buffer = [&](void const * p) {
+        return buffer <= p && p < buffer + sizeof(buffer);
+    };
+    BOOST_TEST(in_buffer(v.data()));
+    BOOST_TEST(in_buffer(v[2].data()));
+
+    static_assert(
+        std::uses_allocator<
+            string_vec,
+            std::pmr::polymorphic_allocator<std::pmr::string>>::value,
+        "");
+
+    // A nested pmr container gets the outer container's resource.
+    std::pmr::vector<string_vec> nested(&resource);
+    nested.emplace_back();
+    BOOST_TEST(nested[0].get_allocator().resource() == &resource);
+
+    // Copies use the default resource, as with std::pmr containers.
+    string_vec copy(v);
+    BOOST_TEST(copy.get_allocator().resource() != &resource);
+    BOOST_TEST(copy == v);
+}
+#endif
+
+    return boost::report_errors();
+}
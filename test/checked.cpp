@@ -0,0 +1,246 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#define BOOST_STL_INTERFACES_CHECKED
+#define BOOST_ENABLE_ASSERT_HANDLER
+#undef NDEBUG
+
+#if 201703L < __cplusplus
+#include <version>
+#endif
+#if 201703L < __cplusplus && defined(__cpp_lib_concepts)
+#define USE_V2
+#endif
+
+#include <boost/stl_interfaces/intrusive_list.hpp>
+#include <boost/stl_interfaces/pooled_list.hpp>
+#include <boost/stl_interfaces/small_vector.hpp>
+#include <boost/stl_interfaces/static_vector.hpp>
+#include "../example/static_vector.hpp"
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+
+// Failed checks throw, so that the tests can observe them.
+struct check_failure : std::logic_error
+{
+    using std::logic_error::logic_error;
+};
+
+namespace boost {
+    void assertion_failed(char const * expr, char const *, char const *, long)
+    {
+        throw check_failure(expr);
+    }
+    void assertion_failed_msg(
+        char const *, char const * msg, char const *, char const *, long)
+    {
+        throw check_failure(msg);
+    }
+}
+
+using vec_type = boost::stl_interfaces::small_vector<int, 4>;
+
+static_assert(
+    std::is_same<
+        vec_type::iterator,
+        boost::stl_interfaces::checked_iterator<int *>>::value,
+    "");
+static_assert(
+    std::is_convertible<vec_type::iterator, vec_type::const_iterator>::value,
+    "");
+struct node : boost::stl_interfaces::list_hook<>
+{
+    explicit node(int v) : value(v) {}
+    int value;
+};
+
+#if 201703L < __cplusplus && defined(__cpp_lib_concepts)
+static_assert(std::contiguous_iterator<vec_type::iterator>);
+static_assert(std::ranges::contiguous_range<vec_type>);
+#endif
+
+
+int main()
+{
+
+{
+    // Correct use passes every check.
+    vec_type v = {3, 1, 2};
+    std::sort(v.begin(), v.end());
+    BOOST_TEST(v == vec_type({1, 2, 3}));
+    BOOST_TEST(v[2] == 3);
+    BOOST_TEST(v.front() == 1);
+    BOOST_TEST(v.back() == 3);
+
+    auto it = v.erase(v.begin());
+    BOOST_TEST(*it == 2);
+    it = v.insert(it, 7);
+    BOOST_TEST(*it == 7);
+    BOOST_TEST(v == vec_type({7, 2, 3}));
+
+    // push_back() that does not reallocate leaves iterators valid.
+    auto first = v.begin();
+    v.push_back(4);
+    BOOST_TEST(*first == 7);
+
+    vec_type::const_iterator const_first = first;
+    BOOST_TEST(const_first == v.cbegin());
+    BOOST_TEST(v.end() - const_first == 4);
+
+    vec_type empty;
+    BOOST_TEST(empty.data() != nullptr);
+    BOOST_TEST(empty.begin() == empty.end());
+    vec_type::iterator singular_1, singular_2;
+    BOOST_TEST(singular_1 == singular_2);
+}
+
+{
+    // Bounds checks.
+    vec_type v = {1, 2};
+    BOOST_TEST_THROWS(v[2], check_failure);
+    vec_type const & cv = v;
+    BOOST_TEST_THROWS(cv[2], check_failure);
+
+    v.clear();
+    BOOST_TEST_THROWS(v.front(), check_failure);
+    BOOST_TEST_THROWS(v.back(), check_failure);
+    BOOST_TEST_THROWS(v.pop_back(), check_failure);
+    BOOST_TEST_THROWS(cv.front(), check_failure);
+    BOOST_TEST_THROWS(cv.back(), check_failure);
+}
+
+{
+    // Invalidation.
+    vec_type v = {1, 2, 3};
+    auto it = v.begin();
+    v.erase(v.begin() + 1);
+    BOOST_TEST(!it.valid());
+    BOOST_TEST_THROWS(*it, check_failure);
+    BOOST_TEST_THROWS(++it, check_failure);
+
+    it = v.begin();
+    v.insert(v.begin(), 0);
+    BOOST_TEST_THROWS(*it, check_failure);
+
+    it = v.begin();
+    v.pop_back();
+    BOOST_TEST_THROWS(it == v.begin(), check_failure);
+
+    // Reallocation.
+    it = v.begin();
+    BOOST_TEST(it.valid());
+    v.insert(v.end(), {4, 5, 6, 7});
+    BOOST_TEST(!v.is_inline());
+    BOOST_TEST_THROWS(*it, check_failure);
+
+    it = v.begin();
+    v.reserve(v.capacity());
+    BOOST_TEST(*it == 0);
+    v.reserve(100);
+    BOOST_TEST_THROWS(*it, check_failure);
+    it = v.begin();
+    v.shrink_to_fit();
+    BOOST_TEST_THROWS(*it, check_failure);
+
+    vec_type w = {8};
+    auto w_it = w.begin();
+    it = v.begin();
+    swap(v, w);
+    BOOST_TEST_THROWS(*it, check_failure);
+    BOOST_TEST_THROWS(*w_it, check_failure);
+
+    it = w.begin();
+    vec_type x = std::move(w);
+    BOOST_TEST_THROWS(*it, check_failure);
+    it = x.begin();
+    x = v;
+    BOOST_TEST_THROWS(*it, check_failure);
+}
+
+{
+    // Iterators into different containers.
+    vec_type v = {1, 2};
+    vec_type w = {1, 2};
+    BOOST_TEST_THROWS(v.begin() == w.begin(), check_failure);
+    BOOST_TEST_THROWS(v.end() - w.begin(), check_failure);
+
+    // Singular iterators.
+    vec_type::iterator singular;
+    BOOST_TEST_THROWS(*singular, check_failure);
+    BOOST_TEST_THROWS(singular == v.begin(), check_failure);
+}
+
+{
+    // The bounds checks also apply to containers whose iterators are
+    // unchecked, such as this static_vector (which uses
+    // v2::sequence_container_interface in C++20 and later).
+    static_vector<int, 4> v = {1, 2};
+    BOOST_TEST(v[1] == 2);
+    BOOST_TEST_THROWS(v[2], check_failure);
+    v.clear();
+    BOOST_TEST_THROWS(v.front(), check_failure);
+    BOOST_TEST_THROWS(v.back(), check_failure);
+    BOOST_TEST_THROWS(v.pop_back(), check_failure);
+}
+
+{
+    // The library static_vector's iterators are checked, and so is the
+    // precondition of its unchecked appends.
+    boost::stl_interfaces::static_vector<int, 3> v = {1, 2};
+    auto first = v.begin();
+    v.push_back_unchecked(3);
+    BOOST_TEST(*first == 1);
+    BOOST_TEST_THROWS(v.push_back_unchecked(4), check_failure);
+    BOOST_TEST_THROWS(v.emplace_back_unchecked(4), check_failure);
+    BOOST_TEST(v.size() == 3u);
+
+    v.erase(v.begin() + 1);
+    BOOST_TEST_THROWS(*first, check_failure);
+    auto copy = v;
+    first = v.begin();
+    v = copy;
+    BOOST_TEST_THROWS(*first, check_failure);
+}
+
+{
+    // Erasing from or splicing a node container leaves iterators to its
+    // other elements valid, so they are not checked_iterators.
+    node a(1), b(2), c(3);
+    boost::stl_interfaces::intrusive_list<node> l;
+    l.push_back(a);
+    l.push_back(b);
+    l.push_back(c);
+    auto it = l.iterator_to(c);
+    l.erase(l.iterator_to(a));
+    BOOST_TEST(it->value == 3);
+    boost::stl_interfaces::intrusive_list<node> m;
+    m.splice(m.end(), l, l.iterator_to(b));
+    BOOST_TEST((*it).value == 3);
+    BOOST_TEST(++it == l.end());
+    m.clear();
+    l.clear();
+
+    boost::stl_interfaces::pooled_list<int> p = {1, 2, 3};
+    auto p_it = std::next(p.begin(), 2);
+    p.erase(p.begin());
+    BOOST_TEST(*p_it == 3);
+    boost::stl_interfaces::pooled_list<int> q;
+    q.splice(q.end(), p, p.begin());
+    BOOST_TEST(*p_it == 3);
+    BOOST_TEST(q.front() == 2);
+
+    // The bounds checks still apply.
+    BOOST_TEST_THROWS(m.front(), check_failure);
+    BOOST_TEST_THROWS(m.pop_back(), check_failure);
+    q.clear();
+    BOOST_TEST_THROWS(q.front(), check_failure);
+}
+
+    return boost::report_errors();
+}
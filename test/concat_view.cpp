@@ -0,0 +1,205 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/algorithm.hpp>
+#include <boost/stl_interfaces/static_vector.hpp>
+#include <boost/stl_interfaces/views.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <list>
+#include <numeric>
+#include <vector>
+
+
+namespace stl_interfaces = boost::stl_interfaces;
+namespace views = boost::stl_interfaces::views;
+
+using span = stl_interfaces::subrange<int *>;
+using nested_vec = std::vector<std::vector<int>>;
+
+static_assert(
+    stl_interfaces::is_segmented_iterator<
+        stl_interfaces::concat_view<span, 3>::iterator>::value,
+    "");
+static_assert(
+    stl_interfaces::is_segmented_iterator<
+        stl_interfaces::join_view<
+            stl_interfaces::ref_view<nested_vec>>::iterator>::value,
+    "");
+static_assert(
+    std::is_same<
+        stl_interfaces::segmented_iterator_traits<
+            stl_interfaces::concat_view<span, 3>::iterator>::local_iterator,
+        int *>::value,
+    "");
+
+template<typename Range>
+std::vector<int> to_vector(Range && r)
+{
+    return std::vector<int>(r.begin(), r.end());
+}
+
+// Records each unsegmented range that for_each_segment() passes it.
+struct record_segments
+{
+    template<typename Iter>
+    void operator()(Iter first, Iter last)
+    {
+        segments.push_back(std::vector<int>(first, last));
+    }
+
+    std::vector<std::vector<int>> segments;
+};
+
+
+int main()
+{
+
+{
+    int a[] = {0, 1, 2};
+    int b[] = {3, 4};
+    int c[] = {5, 6, 7, 8};
+    stl_interfaces::concat_view<span, 4> cat(
+        span(a, a + 3), span(b, b), span(b, b + 2), span(c, c + 4));
+    BOOST_TEST(to_vector(cat) == (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8}));
+    BOOST_TEST(std::distance(cat.begin(), cat.end()) == 9);
+    BOOST_TEST(cat.front() == 0);
+
+    // The segmented algorithms see each part separately.
+    auto segments = stl_interfaces::for_each_segment(
+                        cat.begin(), cat.end(), record_segments{})
+                        .segments;
+    BOOST_TEST(segments.size() == 3u);
+    BOOST_TEST(segments[0] == (std::vector<int>{0, 1, 2}));
+    BOOST_TEST(segments[1] == (std::vector<int>{3, 4}));
+    BOOST_TEST(segments[2] == (std::vector<int>{5, 6, 7, 8}));
+
+    // A subrange that starts and ends in the middle of parts.
+    auto const first = std::next(cat.begin(), 2);
+    auto const last = std::next(cat.begin(), 6);
+    segments =
+        stl_interfaces::for_each_segment(first, last, record_segments{})
+            .segments;
+    BOOST_TEST(segments.size() == 3u);
+    BOOST_TEST(segments[0] == (std::vector<int>{2}));
+    BOOST_TEST(segments[1] == (std::vector<int>{3, 4}));
+    BOOST_TEST(segments[2] == (std::vector<int>{5}));
+    segments =
+        stl_interfaces::for_each_segment(last, last, record_segments{})
+            .segments;
+    BOOST_TEST(segments.empty());
+
+    int sum = 0;
+    stl_interfaces::for_each(first, last, [&](int x) { sum += x; });
+    BOOST_TEST(sum == 14);
+    BOOST_TEST(stl_interfaces::count(cat.begin(), cat.end(), 4) == 1);
+    BOOST_TEST(stl_interfaces::find(cat.begin(), cat.end(), 6) == last);
+    BOOST_TEST(stl_interfaces::find(cat.begin(), cat.end(), 2) == first);
+    // An element at the end of a part is found, and the result compares
+    // equal to the iterator that reaches it by incrementing.
+    BOOST_TEST(
+        stl_interfaces::find(cat.begin(), cat.end(), 4) ==
+        std::next(cat.begin(), 4));
+    BOOST_TEST(
+        stl_interfaces::find(cat.begin(), cat.end(), 9) == cat.end());
+
+    stl_interfaces::fill(first, last, 0);
+    BOOST_TEST(to_vector(cat) == (std::vector<int>{0, 1, 0, 0, 0, 0, 6, 7, 8}));
+    std::vector<int> out(9);
+    stl_interfaces::copy(cat.begin(), cat.end(), out.begin());
+    BOOST_TEST(out == to_vector(cat));
+}
+
+{
+    // views::concat() of containers with the same type.
+    stl_interfaces::static_vector<int, 8> x = {1, 2, 3};
+    stl_interfaces::static_vector<int, 8> y;
+    stl_interfaces::static_vector<int, 8> z = {4, 5};
+    auto cat = views::concat(x, y, z);
+    BOOST_TEST(to_vector(cat) == (std::vector<int>{1, 2, 3, 4, 5}));
+    auto segments = stl_interfaces::for_each_segment(
+                        cat.begin(), cat.end(), record_segments{})
+                        .segments;
+    BOOST_TEST(segments.size() == 2u);
+
+    for (auto & i : cat) {
+        i *= 10;
+    }
+    BOOST_TEST(x[2] == 30 && z[0] == 40);
+
+    std::list<int> l = {7, 8};
+    BOOST_TEST(to_vector(views::concat(l)) == (std::vector<int>{7, 8}));
+    BOOST_TEST(to_vector(views::concat(l, l)) ==
+               (std::vector<int>{7, 8, 7, 8}));
+    BOOST_TEST(views::concat(y, y).empty());
+
+    // A const concat_view can be iterated too.
+    auto const & const_cat = cat;
+    BOOST_TEST(
+        to_vector(const_cat) == (std::vector<int>{10, 20, 30, 40, 50}));
+    BOOST_TEST(!const_cat.empty());
+    BOOST_TEST(const_cat);
+    BOOST_TEST(
+        stl_interfaces::count(const_cat.begin(), const_cat.end(), 40) == 1);
+    auto const empty_cat = views::concat(y, y);
+    BOOST_TEST(empty_cat.empty());
+    BOOST_TEST(empty_cat.begin() == empty_cat.end());
+
+    // A view that is not const-iterable can still be concatenated.
+    std::vector<int> ints = {1, 2, 3, 4};
+    auto odd = ints | views::filter([](int i) { return i % 2 == 1; });
+    auto odds = views::concat(odd, odd);
+    BOOST_TEST(to_vector(odds) == (std::vector<int>{1, 3, 1, 3}));
+    BOOST_TEST(!odds.empty());
+}
+
+{
+    // join_view's iterators are segmented too.
+    nested_vec nested = {{0, 1}, {}, {2}, {}, {3, 4, 5}, {}};
+    auto joined = nested | views::join();
+    auto segments = stl_interfaces::for_each_segment(
+                        joined.begin(), joined.end(), record_segments{})
+                        .segments;
+    BOOST_TEST(segments == (nested_vec{{0, 1}, {2}, {3, 4, 5}}));
+    BOOST_TEST(
+        stl_interfaces::count(joined.begin(), joined.end(), 2) == 1);
+    BOOST_TEST(
+        stl_interfaces::find(joined.begin(), joined.end(), 1) ==
+        std::next(joined.begin()));
+    BOOST_TEST(
+        stl_interfaces::find(joined.begin(), joined.end(), 5) ==
+        std::next(joined.begin(), 5));
+    BOOST_TEST(
+        stl_interfaces::find(joined.begin(), joined.end(), 6) ==
+        joined.end());
+
+    nested_vec empties(3);
+    auto none = empties | views::join();
+    BOOST_TEST(stl_interfaces::count(none.begin(), none.end(), 0) == 0);
+
+    // Each chunk is a segment.
+    std::vector<int> ints(10);
+    std::iota(ints.begin(), ints.end(), 0);
+    auto rejoined = ints | views::chunk(4) | views::join();
+    segments = stl_interfaces::for_each_segment(
+                   rejoined.begin(), rejoined.end(), record_segments{})
+                   .segments;
+    BOOST_TEST(segments.size() == 3u);
+    BOOST_TEST(segments[2] == (std::vector<int>{8, 9}));
+    long long sum = 0;
+    stl_interfaces::for_each(
+        rejoined.begin(), rejoined.end(), [&](int x) { sum += x; });
+    BOOST_TEST(sum == 45);
+
+    // Without segments, for_each_segment() makes a single call.
+    segments = stl_interfaces::for_each_segment(
+                   ints.begin(), ints.end(), record_segments{})
+                   .segments;
+    BOOST_TEST(segments.size() == 1u);
+}
+
+    return boost::report_errors();
+}
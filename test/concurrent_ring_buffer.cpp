@@ -0,0 +1,233 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/concurrent_ring_buffer.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+
+namespace bsi = boost::stl_interfaces;
+
+using spsc_type = bsi::spsc_ring_buffer<int, 8>;
+using mpmc_type = bsi::mpmc_ring_buffer<int, 8>;
+
+static_assert(alignof(spsc_type) == BOOST_STL_INTERFACES_CACHE_LINE_SIZE, "");
+static_assert(alignof(mpmc_type) == BOOST_STL_INTERFACES_CACHE_LINE_SIZE, "");
+
+int const elements = 100000;
+
+
+int main()
+{
+
+{
+    spsc_type q;
+    BOOST_TEST(q.empty());
+    BOOST_TEST(q.capacity() == 8u);
+    int x = -1;
+    BOOST_TEST(!q.try_pop(x));
+    BOOST_TEST(x == -1);
+
+    BOOST_TEST(q.try_push(1));
+    BOOST_TEST(q.try_emplace(2));
+    BOOST_TEST(q.size() == 2u);
+
+    std::vector<int> const more = {3, 4, 5, 6, 7, 8, 9, 10};
+    auto it = q.push(more.begin(), more.end());
+    BOOST_TEST(it == more.begin() + 6);
+    BOOST_TEST(q.size() == 8u);
+    BOOST_TEST(!q.try_push(11));
+
+    BOOST_TEST(q.try_pop(x));
+    BOOST_TEST(x == 1);
+
+    std::vector<int> out;
+    BOOST_TEST(q.pop(std::back_inserter(out), 3) == 3u);
+    BOOST_TEST(out == std::vector<int>({2, 3, 4}));
+    it = q.push(it, more.end());
+    BOOST_TEST(it == more.end());
+    out.clear();
+    BOOST_TEST(q.pop(std::back_inserter(out)) == 6u);
+    BOOST_TEST(out == std::vector<int>({5, 6, 7, 8, 9, 10}));
+    BOOST_TEST(q.empty());
+}
+
+{
+    // Elements left in the queue are destroyed with it.
+    auto const counter = std::make_shared<int>(0);
+    {
+        bsi::spsc_ring_buffer<std::shared_ptr<int>, 4> q;
+        for (int i = 0; i < 6; ++i) {
+            q.try_push(counter);
+        }
+        std::shared_ptr<int> p;
+        q.try_pop(p);
+        BOOST_TEST(counter.use_count() == 5);
+    }
+    BOOST_TEST(counter.use_count() == 1);
+    {
+        bsi::mpmc_ring_buffer<std::shared_ptr<int>, 4> q;
+        for (int i = 0; i < 6; ++i) {
+            q.try_push(counter);
+        }
+        std::shared_ptr<int> p;
+        q.try_pop(p);
+        BOOST_TEST(counter.use_count() == 5);
+    }
+    BOOST_TEST(counter.use_count() == 1);
+}
+
+{
+    // One producer and one consumer, mixing single and batch operations.
+    spsc_type q;
+    std::thread producer([&q] {
+        std::vector<int> batch(5);
+        int next = 0;
+        while (next < elements) {
+            auto const old_next = next;
+            if (next % 3) {
+                if (q.try_push(next))
+                    ++next;
+            } else {
+                auto const n = std::min(5, elements - next);
+                std::iota(batch.begin(), batch.begin() + n, next);
+                auto const pushed = q.push(batch.begin(), batch.begin() + n);
+                next += int(pushed - batch.begin());
+            }
+            if (next == old_next)
+                std::this_thread::yield();
+        }
+    });
+    std::vector<int> received;
+    received.reserve(elements);
+    while (received.size() < std::size_t(elements)) {
+        int x;
+        if (received.size() % 2) {
+            if (q.try_pop(x))
+                received.push_back(x);
+            else
+                std::this_thread::yield();
+        } else if (!q.pop(std::back_inserter(received), 4)) {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    std::vector<int> expected(elements);
+    std::iota(expected.begin(), expected.end(), 0);
+    BOOST_TEST(received == expected);
+    BOOST_TEST(q.empty());
+}
+
+{
+    mpmc_type q;
+    int x = -1;
+    BOOST_TEST(!q.try_pop(x));
+    std::vector<int> const values = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    auto it = q.push(values.begin(), values.end());
+    BOOST_TEST(it == values.begin() + 8);
+    BOOST_TEST(q.size() == 8u);
+    BOOST_TEST(!q.try_emplace(11));
+
+    std::vector<int> out;
+    BOOST_TEST(q.pop(std::back_inserter(out), 5) == 5u);
+    BOOST_TEST(out == std::vector<int>({1, 2, 3, 4, 5}));
+    BOOST_TEST(q.try_push(9));
+    BOOST_TEST(q.try_pop(x));
+    BOOST_TEST(x == 6);
+    out.clear();
+    BOOST_TEST(q.pop(std::back_inserter(out)) == 3u);
+    BOOST_TEST(out == std::vector<int>({7, 8, 9}));
+    BOOST_TEST(q.empty());
+}
+
+{
+    // Several producers and consumers; every element arrives exactly once,
+    // and each producer's elements arrive in order at any one consumer.
+    int const producers = 3;
+    int const consumers = 3;
+    int const per_producer = elements / producers;
+    mpmc_type q;
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&q, p] {
+            int const first = p * per_producer;
+            int const last = first + per_producer;
+            std::vector<int> batch(3);
+            for (int next = first; next < last;) {
+                auto const old_next = next;
+                if (next % 2) {
+                    if (q.try_push(next))
+                        ++next;
+                } else {
+                    auto const n = std::min(3, last - next);
+                    std::iota(batch.begin(), batch.begin() + n, next);
+                    next += int(
+                        q.push(batch.begin(), batch.begin() + n) -
+                        batch.begin());
+                }
+                if (next == old_next)
+                    std::this_thread::yield();
+            }
+        });
+    }
+
+    std::atomic<int> remaining(producers * per_producer);
+    std::vector<std::vector<int>> received(consumers);
+    for (int c = 0; c < consumers; ++c) {
+        threads.emplace_back([&q, &remaining, &received, c] {
+            auto & mine = received[c];
+            while (0 < remaining.load()) {
+                std::size_t n = 0;
+                if (c % 2) {
+                    int x;
+                    if (q.try_pop(x)) {
+                        mine.push_back(x);
+                        n = 1;
+                    }
+                } else {
+                    n = q.pop(std::back_inserter(mine), 4);
+                }
+                if (n)
+                    remaining -= int(n);
+                else
+                    std::this_thread::yield();
+            }
+        });
+    }
+    for (auto & t : threads) {
+        t.join();
+    }
+
+    std::vector<int> all;
+    for (auto const & mine : received) {
+        for (int p = 0; p < producers; ++p) {
+            std::vector<int> from_p;
+            std::copy_if(
+                mine.begin(),
+                mine.end(),
+                std::back_inserter(from_p),
+                [p](int x) { return x / per_producer == p; });
+            BOOST_TEST(std::is_sorted(from_p.begin(), from_p.end()));
+        }
+        all.insert(all.end(), mine.begin(), mine.end());
+    }
+    std::sort(all.begin(), all.end());
+    std::vector<int> expected(producers * per_producer);
+    std::iota(expected.begin(), expected.end(), 0);
+    BOOST_TEST(all == expected);
+    BOOST_TEST(q.empty());
+}
+
+    return boost::report_errors();
+}
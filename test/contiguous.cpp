@@ -0,0 +1,255 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/iterator_interface.hpp>
+#include <boost/stl_interfaces/reverse_iterator.hpp>
+
+#include "ill_formed.hpp"
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <type_traits>
+
+
+struct basic_contiguous_iter : boost::stl_interfaces::iterator_interface<
+                                   basic_contiguous_iter,
+                                   boost::stl_interfaces::contiguous_iterator_tag,
+                                   int>
+{
+    basic_contiguous_iter() {}
+    basic_contiguous_iter(int * it) : it_(it) {}
+
+    int & operator*() const { return *it_; }
+    basic_contiguous_iter & operator+=(std::ptrdiff_t i)
+    {
+        it_ += i;
+        return *this;
+    }
+    friend std::ptrdiff_t
+    operator-(basic_contiguous_iter lhs, basic_contiguous_iter rhs) noexcept
+    {
+        return lhs.it_ - rhs.it_;
+    }
+
+private:
+    int * it_;
+};
+
+BOOST_STL_INTERFACES_STATIC_ASSERT_CONCEPT(
+    basic_contiguous_iter, std::contiguous_iterator)
+BOOST_STL_INTERFACES_STATIC_ASSERT_ITERATOR_TRAITS(
+    basic_contiguous_iter,
+    std::random_access_iterator_tag,
+    boost::stl_interfaces::contiguous_iterator_tag,
+    int,
+    int &,
+    int *,
+    std::ptrdiff_t)
+
+template<typename ValueType>
+struct adapted_contiguous_iter
+    : boost::stl_interfaces::iterator_interface<
+          adapted_contiguous_iter<ValueType>,
+          boost::stl_interfaces::contiguous_iterator_tag,
+          ValueType>
+{
+    adapted_contiguous_iter() {}
+    adapted_contiguous_iter(ValueType * it) : it_(it) {}
+
+    template<
+        typename ValueType2,
+        typename Enable = std::enable_if_t<
+            std::is_convertible<ValueType2 *, ValueType *>::value>>
+    adapted_contiguous_iter(adapted_contiguous_iter<ValueType2> other) :
+        it_(other.it_)
+    {}
+
+    template<typename ValueType2>
+    friend struct adapted_contiguous_iter;
+
+private:
+    friend boost::stl_interfaces::access;
+    ValueType *& base_reference() noexcept { return it_; }
+    ValueType * base_reference() const noexcept { return it_; }
+
+    ValueType * it_;
+};
+
+using contiguous = adapted_contiguous_iter<int>;
+using const_contiguous = adapted_contiguous_iter<int const>;
+
+BOOST_STL_INTERFACES_STATIC_ASSERT_CONCEPT(contiguous, std::contiguous_iterator)
+BOOST_STL_INTERFACES_STATIC_ASSERT_ITERATOR_TRAITS(
+    contiguous,
+    std::random_access_iterator_tag,
+    boost::stl_interfaces::contiguous_iterator_tag,
+    int,
+    int &,
+    int *,
+    std::ptrdiff_t)
+BOOST_STL_INTERFACES_STATIC_ASSERT_CONCEPT(
+    const_contiguous, std::contiguous_iterator)
+BOOST_STL_INTERFACES_STATIC_ASSERT_ITERATOR_TRAITS(
+    const_contiguous,
+    std::random_access_iterator_tag,
+    boost::stl_interfaces::contiguous_iterator_tag,
+    int const,
+    int const &,
+    int const *,
+    std::ptrdiff_t)
+
+struct basic_random_access_iter : boost::stl_interfaces::iterator_interface<
+                                      basic_random_access_iter,
+                                      std::random_access_iterator_tag,
+                                      int>
+{
+    basic_random_access_iter() {}
+    basic_random_access_iter(int * it) : it_(it) {}
+
+    int & operator*() const { return *it_; }
+    basic_random_access_iter & operator+=(std::ptrdiff_t i)
+    {
+        it_ += i;
+        return *this;
+    }
+    friend std::ptrdiff_t operator-(
+        basic_random_access_iter lhs, basic_random_access_iter rhs) noexcept
+    {
+        return lhs.it_ - rhs.it_;
+    }
+
+private:
+    int * it_;
+};
+
+// element_type is only present for contiguous iterators.
+template<typename T>
+using element_type_t = typename T::element_type;
+
+static_assert(
+    std::is_same<basic_contiguous_iter::element_type, int>::value, "");
+static_assert(std::is_same<contiguous::element_type, int>::value, "");
+static_assert(
+    std::is_same<const_contiguous::element_type, int const>::value, "");
+static_assert(ill_formed<element_type_t, basic_random_access_iter>::value, "");
+
+static_assert(
+    std::is_same<
+        std::pointer_traits<basic_contiguous_iter>::element_type,
+        int>::value,
+    "");
+static_assert(
+    std::is_same<
+        std::pointer_traits<const_contiguous>::difference_type,
+        std::ptrdiff_t>::value,
+    "");
+
+static_assert(
+    boost::stl_interfaces::v1::v1_dtl::contiguous_iter<
+        basic_contiguous_iter>::value,
+    "");
+static_assert(
+    boost::stl_interfaces::v1::v1_dtl::contiguous_iter<const_contiguous>::value,
+    "");
+static_assert(boost::stl_interfaces::v1::v1_dtl::contiguous_iter<int *>::value, "");
+static_assert(
+    !boost::stl_interfaces::v1::v1_dtl::contiguous_iter<
+        basic_random_access_iter>::value,
+    "");
+
+// The reverse of a contiguous iterator is only random access.
+static_assert(
+    std::is_same<
+        boost::stl_interfaces::reverse_iterator<contiguous>::iterator_concept,
+        std::random_access_iterator_tag>::value,
+    "");
+static_assert(
+    std::is_same<
+        boost::stl_interfaces::reverse_iterator<int *>::iterator_concept,
+        std::random_access_iterator_tag>::value,
+    "");
+static_assert(
+    ill_formed<
+        element_type_t,
+        boost::stl_interfaces::reverse_iterator<contiguous>>::value,
+    "");
+
+template<typename T>
+using to_address_t =
+    decltype(boost::stl_interfaces::to_address(std::declval<T const &>()));
+
+static_assert(std::is_same<to_address_t<contiguous>, int *>::value, "");
+static_assert(
+    std::is_same<to_address_t<const_contiguous>, int const *>::value, "");
+static_assert(std::is_same<to_address_t<int const *>, int const *>::value, "");
+
+
+std::array<int, 10> ints = {{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}};
+
+
+int main()
+{
+
+{
+    basic_contiguous_iter first(ints.data());
+    basic_contiguous_iter last(ints.data() + ints.size());
+
+    BOOST_TEST(*first == 0);
+    BOOST_TEST(*(first + 1) == 1);
+    BOOST_TEST(first[2] == 2);
+    BOOST_TEST(*(last - 1) == 9);
+    BOOST_TEST(last - first == 10);
+    BOOST_TEST(first < last);
+
+    BOOST_TEST(boost::stl_interfaces::to_address(first) == ints.data());
+    BOOST_TEST(
+        boost::stl_interfaces::to_address(first + 3) == ints.data() + 3);
+}
+
+{
+    contiguous first(ints.data());
+    contiguous last(ints.data() + ints.size());
+    const_contiguous cfirst(first);
+    const_contiguous clast(last);
+
+    BOOST_TEST(boost::stl_interfaces::to_address(first) == ints.data());
+    BOOST_TEST(boost::stl_interfaces::to_address(cfirst) == ints.data());
+    BOOST_TEST(cfirst == first);
+    BOOST_TEST(clast - cfirst == 10);
+}
+
+{
+    std::array<int, 10> ints_copy;
+    contiguous first(ints.data());
+    contiguous last(ints.data() + ints.size());
+    contiguous out(ints_copy.data());
+
+    std::copy(first, last, out);
+    BOOST_TEST(ints_copy == ints);
+
+    BOOST_TEST(std::equal(first, last, ints_copy.begin(), ints_copy.end()));
+
+    std::fill(out, out + ints_copy.size(), 7);
+    BOOST_TEST(std::count(ints_copy.begin(), ints_copy.end(), 7) == 10);
+}
+
+{
+    contiguous first(ints.data());
+    contiguous last(ints.data() + ints.size());
+
+    std::array<int, 10> reversed;
+    std::copy(
+        boost::stl_interfaces::make_reverse_iterator(last),
+        boost::stl_interfaces::make_reverse_iterator(first),
+        reversed.begin());
+    std::reverse(reversed.begin(), reversed.end());
+    BOOST_TEST(reversed == ints);
+}
+
+    return boost::report_errors();
+}
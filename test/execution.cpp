@@ -0,0 +1,101 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/execution.hpp>
+
+#include "../example/static_vector.hpp"
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <algorithm>
+#include <vector>
+
+
+namespace stl_interfaces = boost::stl_interfaces;
+
+using vec_type = static_vector<int, 10>;
+
+
+int main()
+{
+
+#if defined(__cpp_lib_execution)
+
+{
+    vec_type v = {9, 9, 9, 9};
+    std::vector<int> const src = {0, 1, 2, 3, 4, 5};
+
+    stl_interfaces::assign(std::execution::seq, v, src.begin(), src.end());
+    BOOST_TEST(v == (vec_type{0, 1, 2, 3, 4, 5}));
+
+    stl_interfaces::assign(
+        std::execution::seq, v, src.begin() + 3, src.end());
+    BOOST_TEST(v == (vec_type{3, 4, 5}));
+
+    stl_interfaces::assign(std::execution::seq, v, src.begin(), src.begin());
+    BOOST_TEST(v.empty());
+}
+
+{
+    vec_type v = {1, 2, 3};
+
+    stl_interfaces::assign(std::execution::seq, v, 5, 7);
+    BOOST_TEST(v == (vec_type{7, 7, 7, 7, 7}));
+
+    stl_interfaces::assign(std::execution::seq, v, 2, 8);
+    BOOST_TEST(v == (vec_type{8, 8}));
+
+    stl_interfaces::assign(std::execution::seq, v, 0, 8);
+    BOOST_TEST(v.empty());
+}
+
+{
+    vec_type const a = {1, 2, 3};
+    vec_type const b = {1, 2, 4};
+    vec_type const c = {1, 2};
+
+    BOOST_TEST(stl_interfaces::equal(std::execution::seq, a, a));
+    BOOST_TEST(!stl_interfaces::equal(std::execution::seq, a, b));
+    BOOST_TEST(!stl_interfaces::equal(std::execution::seq, a, c));
+
+    BOOST_TEST(stl_interfaces::lexicographical_compare(
+        std::execution::seq, a, b));
+    BOOST_TEST(!stl_interfaces::lexicographical_compare(
+        std::execution::seq, b, a));
+    BOOST_TEST(stl_interfaces::lexicographical_compare(
+        std::execution::seq, c, a));
+    BOOST_TEST(!stl_interfaces::lexicographical_compare(
+        std::execution::seq, a, a));
+}
+
+{
+    // The parallel policies split the work into chunks; use containers
+    // large enough to be split.
+    using big_vec_type = static_vector<int, 100001>;
+    std::vector<int> src(100000);
+    for (int i = 0; i < (int)src.size(); ++i) {
+        src[i] = i;
+    }
+
+    big_vec_type v(1000, 42);
+    stl_interfaces::assign(std::execution::par, v, src.begin(), src.end());
+    BOOST_TEST(std::equal(v.begin(), v.end(), src.begin(), src.end()));
+
+    big_vec_type w = v;
+    BOOST_TEST(stl_interfaces::equal(std::execution::par_unseq, v, w));
+    w.back() = 0;
+    BOOST_TEST(!stl_interfaces::equal(std::execution::par_unseq, v, w));
+    BOOST_TEST(
+        stl_interfaces::lexicographical_compare(std::execution::par, w, v));
+
+    stl_interfaces::assign(std::execution::par, v, 50000, 3);
+    BOOST_TEST(v.size() == 50000u);
+    BOOST_TEST(std::count(v.begin(), v.end(), 3) == 50000);
+}
+
+#endif
+
+    return boost::report_errors();
+}
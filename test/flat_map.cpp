@@ -0,0 +1,246 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/flat_map.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+namespace bsi = boost::stl_interfaces;
+
+using map_type = bsi::flat_map<int, std::string>;
+
+static_assert(
+    std::is_same<
+        std::iterator_traits<map_type::iterator>::iterator_category,
+        std::random_access_iterator_tag>::value,
+    "");
+static_assert(
+    std::is_same<
+        std::iterator_traits<map_type::iterator>::reference,
+        std::pair<int const &, std::string &>>::value,
+    "");
+static_assert(
+    std::is_convertible<map_type::iterator, map_type::const_iterator>::value,
+    "");
+static_assert(
+    !std::is_convertible<map_type::const_iterator, map_type::iterator>::value,
+    "");
+
+using pairs = std::vector<std::pair<int, std::string>>;
+
+// Throws from its copy constructor after a set number of copies.
+struct throwing_key
+{
+    throwing_key(char const * s) : value(s) {}
+    throwing_key(throwing_key const & other) : value(other.value)
+    {
+        if (copies_until_throw == 0)
+            throw std::runtime_error("copy");
+        --copies_until_throw;
+    }
+    throwing_key(throwing_key &&) = default;
+    throwing_key & operator=(throwing_key const &) = default;
+    throwing_key & operator=(throwing_key &&) = default;
+
+    friend bool operator<(throwing_key const & lhs, throwing_key const & rhs)
+    {
+        return lhs.value < rhs.value;
+    }
+
+    std::string value;
+    static int copies_until_throw;
+};
+int throwing_key::copies_until_throw = 1000;
+
+pairs to_pairs(map_type const & m)
+{
+    pairs result;
+    for (auto && x : m) {
+        result.emplace_back(x.first, x.second);
+    }
+    return result;
+}
+
+
+int main()
+{
+
+{
+    map_type m;
+    BOOST_TEST(m.empty());
+    BOOST_TEST(m.find(1) == m.end());
+
+    auto result = m.insert({2, "two"});
+    BOOST_TEST(result.second);
+    BOOST_TEST(result.first->first == 2);
+    BOOST_TEST(result.first->second == "two");
+    result = m.emplace(1, "one");
+    BOOST_TEST(result.second);
+    BOOST_TEST(result.first == m.begin());
+    result = m.insert({2, "deux"});
+    BOOST_TEST(!result.second);
+    BOOST_TEST(result.first->second == "two");
+    result = m.try_emplace(3, 3, 'c');
+    BOOST_TEST(result.first->second == "ccc");
+    result = m.try_emplace(3, "three");
+    BOOST_TEST(!result.second);
+    BOOST_TEST(m.size() == 3u);
+    BOOST_TEST(
+        to_pairs(m) == pairs({{1, "one"}, {2, "two"}, {3, "ccc"}}));
+
+    result = m.insert_or_assign(3, "three");
+    BOOST_TEST(!result.second);
+    BOOST_TEST(m.at(3) == "three");
+    result = m.insert_or_assign(0, "zero");
+    BOOST_TEST(result.second);
+    BOOST_TEST(m.begin()->second == "zero");
+
+    BOOST_TEST(m[1] == "one");
+    m[1] = "uno";
+    m[5] = "five";
+    BOOST_TEST(m.at(1) == "uno");
+    BOOST_TEST(m.size() == 5u);
+    BOOST_TEST_THROWS(m.at(4), std::out_of_range);
+    map_type const & cm = m;
+    BOOST_TEST(cm.at(5) == "five");
+    BOOST_TEST_THROWS(cm.at(4), std::out_of_range);
+
+    BOOST_TEST(m.contains(2));
+    BOOST_TEST(!m.contains(4));
+    BOOST_TEST(m.count(5) == 1u);
+    BOOST_TEST(m.lower_bound(4)->first == 5);
+    BOOST_TEST(m.upper_bound(2)->first == 3);
+    BOOST_TEST(cm.find(2)->second == "two");
+    BOOST_TEST(cm.equal_range(4).first == cm.equal_range(4).second);
+
+    BOOST_TEST(m.keys() == std::vector<int>({0, 1, 2, 3, 5}));
+    BOOST_TEST(m.values()[4] == "five");
+
+    // Modifying through the iterators.
+    for (auto it = m.begin(); it != m.end(); ++it) {
+        it->second += "!";
+    }
+    BOOST_TEST(m[0] == "zero!");
+    (*m.find(2)).second = "2";
+    BOOST_TEST(m.at(2) == "2");
+    std::vector<std::string> reversed;
+    for (auto it = cm.rbegin(); it != cm.rend(); ++it) {
+        reversed.push_back(it->second);
+    }
+    BOOST_TEST(reversed.front() == "five!");
+}
+
+{
+    // Hints.
+    map_type m = {{10, "a"}, {20, "b"}};
+    auto it = m.emplace_hint(m.begin() + 1, 15, "c");
+    BOOST_TEST(it->first == 15);
+    it = m.insert(m.begin(), {30, "d"});
+    BOOST_TEST(it->first == 30);
+    BOOST_TEST(m.keys() == std::vector<int>({10, 15, 20, 30}));
+}
+
+{
+    // Bulk insertion and construction.
+    map_type m = {{3, "c"}, {1, "a"}, {3, "x"}};
+    BOOST_TEST(to_pairs(m) == pairs({{1, "a"}, {3, "c"}}));
+
+    pairs const more = {{4, "d"}, {0, "z"}, {1, "y"}, {2, "b"}, {2, "w"}};
+    m.insert(more.begin(), more.end());
+    BOOST_TEST(
+        to_pairs(m) ==
+        pairs({{0, "z"}, {1, "a"}, {2, "b"}, {3, "c"}, {4, "d"}}));
+
+    pairs const sorted = {{-1, "n"}, {4, "q"}, {6, "f"}};
+    m.insert(bsi::sorted_unique, sorted.begin(), sorted.end());
+    BOOST_TEST(m.size() == 7u);
+    BOOST_TEST(m.at(4) == "d");
+    BOOST_TEST(m.at(-1) == "n");
+    BOOST_TEST(m.keys() == std::vector<int>({-1, 0, 1, 2, 3, 4, 6}));
+    BOOST_TEST(m.values()[6] == "f");
+
+    map_type from_columns({3, 1, 2}, {"c", "a", "b"});
+    BOOST_TEST(
+        to_pairs(from_columns) == pairs({{1, "a"}, {2, "b"}, {3, "c"}}));
+    map_type sorted_columns(bsi::sorted_unique, {1, 2, 3}, {"a", "b", "c"});
+    BOOST_TEST(from_columns == sorted_columns);
+
+    std::map<int, std::string> const std_map = {{8, "h"}, {7, "g"}};
+    map_type from_std(std_map.begin(), std_map.end());
+    BOOST_TEST(to_pairs(from_std) == pairs({{7, "g"}, {8, "h"}}));
+
+    from_std = {{1, "a"}};
+    BOOST_TEST(from_std.size() == 1u);
+}
+
+{
+    // Erasure.
+    map_type m = {{1, "a"}, {2, "b"}, {3, "c"}, {4, "d"}};
+    BOOST_TEST(m.erase(2) == 1u);
+    BOOST_TEST(m.erase(2) == 0u);
+    auto it = m.erase(m.begin());
+    BOOST_TEST(it->first == 3);
+    it = m.erase(m.find(3), m.end());
+    BOOST_TEST(it == m.end());
+    BOOST_TEST(to_pairs(m) == pairs({}));
+    BOOST_TEST(m.empty());
+}
+
+{
+    // Comparison, swapping, and the underlying containers.
+    map_type a = {{1, "a"}, {2, "b"}};
+    map_type b = {{1, "a"}, {2, "c"}};
+    BOOST_TEST(a != b);
+    BOOST_TEST(a < b);
+    BOOST_TEST(b > a);
+    swap(a, b);
+    BOOST_TEST(a.at(2) == "c");
+
+    auto c = std::move(a).extract();
+    BOOST_TEST(a.empty());
+    BOOST_TEST(c.keys == std::vector<int>({1, 2}));
+    BOOST_TEST(c.values == std::vector<std::string>({"a", "c"}));
+    c.values[0] = "x";
+    a.replace(std::move(c.keys), std::move(c.values));
+    BOOST_TEST(a.at(1) == "x");
+}
+
+{
+    // Move-only mapped values.
+    bsi::flat_map<int, std::unique_ptr<int>> m;
+    m.try_emplace(2, new int(2));
+    m.emplace(1, std::unique_ptr<int>(new int(1)));
+    m[3].reset(new int(3));
+    BOOST_TEST(*m.at(1) == 1);
+    BOOST_TEST(*m.at(3) == 3);
+    BOOST_TEST(m.erase(2) == 1u);
+    BOOST_TEST(m.begin()->first == 1);
+}
+
+{
+    // A throw while copying the new elements leaves the map as it was.
+    bsi::flat_map<throwing_key, int> m = {{"b", 2}, {"d", 4}, {"f", 6}};
+    std::vector<std::pair<throwing_key, int>> const elements = {
+        {"a", 1}, {"c", 3}, {"e", 5}};
+    throwing_key::copies_until_throw = 1;
+    BOOST_TEST_THROWS(
+        m.insert(bsi::sorted_unique, elements.begin(), elements.end()),
+        std::runtime_error);
+    throwing_key::copies_until_throw = 1000;
+    BOOST_TEST(m.size() == 3u);
+    BOOST_TEST(m.begin()->first.value == "b");
+    BOOST_TEST(m.at("d") == 4);
+    BOOST_TEST(m.at("f") == 6);
+}
+
+    return boost::report_errors();
+}
@@ -0,0 +1,223 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/flat_set.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <deque>
+#include <functional>
+#include <list>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+namespace bsi = boost::stl_interfaces;
+
+using set_type = bsi::flat_set<int>;
+
+static_assert(
+    std::is_same<set_type::iterator, std::vector<int>::const_iterator>::value,
+    "");
+
+// Throws from its copy constructor after a set number of copies.
+struct throwing_key
+{
+    throwing_key(char const * s) : value(s) {}
+    throwing_key(throwing_key const & other) : value(other.value)
+    {
+        if (copies_until_throw == 0)
+            throw std::runtime_error("copy");
+        --copies_until_throw;
+    }
+    throwing_key(throwing_key &&) = default;
+    throwing_key & operator=(throwing_key const &) = default;
+    throwing_key & operator=(throwing_key &&) = default;
+
+    friend bool operator<(throwing_key const & lhs, throwing_key const & rhs)
+    {
+        return lhs.value < rhs.value;
+    }
+
+    std::string value;
+    static int copies_until_throw;
+};
+int throwing_key::copies_until_throw = 1000;
+
+std::vector<int> to_vector(set_type const & s)
+{
+    return std::vector<int>(s.begin(), s.end());
+}
+
+
+int main()
+{
+
+{
+    set_type s;
+    BOOST_TEST(s.empty());
+    BOOST_TEST(s.size() == 0u);
+    BOOST_TEST(s.begin() == s.end());
+    BOOST_TEST(s.find(1) == s.end());
+    BOOST_TEST(!s.contains(1));
+
+    auto result = s.insert(3);
+    BOOST_TEST(result.second);
+    BOOST_TEST(*result.first == 3);
+    result = s.insert(1);
+    BOOST_TEST(result.second);
+    BOOST_TEST(result.first == s.begin());
+    result = s.emplace(2);
+    BOOST_TEST(*result.first == 2);
+    result = s.insert(3);
+    BOOST_TEST(!result.second);
+    BOOST_TEST(*result.first == 3);
+    BOOST_TEST(to_vector(s) == std::vector<int>({1, 2, 3}));
+    BOOST_TEST(s.size() == 3u);
+
+    BOOST_TEST(*s.find(2) == 2);
+    BOOST_TEST(s.find(4) == s.end());
+    BOOST_TEST(s.contains(3));
+    BOOST_TEST(s.count(3) == 1u);
+    BOOST_TEST(s.count(0) == 0u);
+    BOOST_TEST(*s.lower_bound(2) == 2);
+    BOOST_TEST(*s.upper_bound(2) == 3);
+    BOOST_TEST(s.upper_bound(3) == s.end());
+    auto const range = s.equal_range(2);
+    BOOST_TEST(range.second - range.first == 1);
+
+    set_type const & cs = s;
+    BOOST_TEST(*cs.find(1) == 1);
+    BOOST_TEST(cs.lower_bound(0) == cs.begin());
+    BOOST_TEST(std::vector<int>(cs.rbegin(), cs.rend()) ==
+                std::vector<int>({3, 2, 1}));
+}
+
+{
+    // Hints.
+    set_type s = {10, 20, 30};
+    auto it = s.insert(s.begin() + 1, 15);
+    BOOST_TEST(*it == 15);
+    it = s.insert(s.begin(), 25);
+    BOOST_TEST(*it == 25);
+    it = s.insert(s.end(), 20);
+    BOOST_TEST(*it == 20);
+    it = s.emplace_hint(s.end(), 35);
+    BOOST_TEST(*it == 35);
+    BOOST_TEST(to_vector(s) == std::vector<int>({10, 15, 20, 25, 30, 35}));
+}
+
+{
+    // Bulk insertion.
+    set_type s = {5, 1, 3, 3, 1};
+    BOOST_TEST(to_vector(s) == std::vector<int>({1, 3, 5}));
+
+    std::vector<int> const more = {6, 2, 3, 4, 2, 0};
+    s.insert(more.begin(), more.end());
+    BOOST_TEST(to_vector(s) == std::vector<int>({0, 1, 2, 3, 4, 5, 6}));
+
+    std::vector<int> const sorted = {-2, -1, 3, 7, 8};
+    s.insert(bsi::sorted_unique, sorted.begin(), sorted.end());
+    BOOST_TEST(
+        to_vector(s) ==
+        std::vector<int>({-2, -1, 0, 1, 2, 3, 4, 5, 6, 7, 8}));
+
+    s.insert({9, -3});
+    s.insert(bsi::sorted_unique, {10, 11});
+    BOOST_TEST(s.size() == 15u);
+    BOOST_TEST(*s.begin() == -3);
+    BOOST_TEST(*s.rbegin() == 11);
+
+    // Input iterators.
+    std::istringstream is("4 12 -4");
+    s.insert(std::istream_iterator<int>(is), std::istream_iterator<int>());
+    BOOST_TEST(s.size() == 17u);
+    BOOST_TEST(*s.begin() == -4);
+
+    set_type t(bsi::sorted_unique, {1, 2, 3});
+    BOOST_TEST(to_vector(t) == std::vector<int>({1, 2, 3}));
+    set_type u(std::vector<int>({3, 1, 2, 1}));
+    BOOST_TEST(t == u);
+    t = {4, 4};
+    BOOST_TEST(to_vector(t) == std::vector<int>({4}));
+}
+
+{
+    // Erasure.
+    set_type s = {1, 2, 3, 4, 5, 6};
+    BOOST_TEST(s.erase(3) == 1u);
+    BOOST_TEST(s.erase(3) == 0u);
+    auto it = s.erase(s.find(4));
+    BOOST_TEST(*it == 5);
+    it = s.erase(s.begin(), s.begin() + 2);
+    BOOST_TEST(*it == 5);
+    BOOST_TEST(to_vector(s) == std::vector<int>({5, 6}));
+    s.clear();
+    BOOST_TEST(s.empty());
+}
+
+{
+    // Comparison, swapping, and the underlying container.
+    set_type a = {1, 2, 3};
+    set_type b = {1, 2, 4};
+    BOOST_TEST(a != b);
+    BOOST_TEST(a < b);
+    BOOST_TEST(a <= b);
+    BOOST_TEST(b > a);
+    BOOST_TEST(b >= a);
+    swap(a, b);
+    BOOST_TEST(*a.rbegin() == 4);
+    using std::swap;
+    swap(a, b);
+    BOOST_TEST(*a.rbegin() == 3);
+
+    std::vector<int> keys = std::move(a).extract();
+    BOOST_TEST(keys == std::vector<int>({1, 2, 3}));
+    BOOST_TEST(a.empty());
+    keys.push_back(7);
+    a.replace(std::move(keys));
+    BOOST_TEST(to_vector(a) == std::vector<int>({1, 2, 3, 7}));
+}
+
+{
+    // Other comparisons and containers.
+    bsi::flat_set<std::string, std::greater<std::string>> s = {
+        "b", "c", "a"};
+    BOOST_TEST(*s.begin() == "c");
+    BOOST_TEST(s.find("a") == s.begin() + 2);
+    BOOST_TEST(s.erase("b") == 1u);
+    BOOST_TEST(s.size() == 2u);
+
+    bsi::flat_set<int, std::less<int>, std::deque<int>> d = {3, 1, 2};
+    BOOST_TEST(*d.begin() == 1);
+    d.insert(0);
+    BOOST_TEST(d.find(0) == d.begin());
+    std::list<int> const l = {5, 4};
+    d.insert(l.begin(), l.end());
+    BOOST_TEST(d.size() == 6u);
+}
+
+{
+    // A throw while copying the new keys leaves the set as it was.
+    bsi::flat_set<throwing_key> s = {"b", "d", "f"};
+    std::vector<throwing_key> const keys = {"a", "c", "e"};
+    throwing_key::copies_until_throw = 1;
+    BOOST_TEST_THROWS(
+        s.insert(bsi::sorted_unique, keys.begin(), keys.end()),
+        std::runtime_error);
+    throwing_key::copies_until_throw = 1;
+    BOOST_TEST_THROWS(s.insert(keys.begin(), keys.end()), std::runtime_error);
+    throwing_key::copies_until_throw = 1000;
+    std::vector<std::string> values;
+    for (auto const & k : s) {
+        values.push_back(k.value);
+    }
+    BOOST_TEST(values == std::vector<std::string>({"b", "d", "f"}));
+}
+
+    return boost::report_errors();
+}
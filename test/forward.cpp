@@ -218,6 +218,34 @@ static_assert(
         value,
     "");
 
+// A view whose begin() skips a prefix, counting how many times it searches.
+struct skip_zeros_view
+    : boost::stl_interfaces::view_interface<skip_zeros_view>
+{
+    skip_zeros_view(int * first, int * last) : first_(first), last_(last) {}
+
+    basic_forward_iter begin()
+    {
+        return begin_.get([this] {
+            ++searches;
+            basic_forward_iter it(first_);
+            basic_forward_iter const last(last_);
+            while (it != last && *it == 0) {
+                ++it;
+            }
+            return it;
+        });
+    }
+    basic_forward_iter end() { return basic_forward_iter(last_); }
+
+    int searches = 0;
+
+private:
+    int * first_;
+    int * last_;
+    boost::stl_interfaces::cached_begin<basic_forward_iter> begin_;
+};
+
 
 int main()
 {
@@ -339,5 +367,36 @@ int main()
     }
 }
 
+{
+    std::array<int, 6> ints = {{0, 0, 3, 0, 5, 6}};
+    skip_zeros_view v(ints.data(), ints.data() + ints.size());
+    BOOST_TEST(!v.empty());
+    BOOST_TEST(v);
+    BOOST_TEST(v.front() == 3);
+    BOOST_TEST(std::distance(v.begin(), v.end()) == 4);
+    BOOST_TEST(v.searches == 1);
+
+    // Copies start with an empty cache, since a cached iterator may refer
+    // into the source.
+    skip_zeros_view copy = v;
+    copy.searches = 0;
+    BOOST_TEST(copy.front() == 3);
+    BOOST_TEST(copy.searches == 1);
+
+    copy = v;
+    copy.searches = 0;
+    BOOST_TEST(copy.front() == 3);
+    BOOST_TEST(copy.front() == 3);
+    BOOST_TEST(copy.searches == 1);
+
+    boost::stl_interfaces::cached_begin<int *> cache;
+    BOOST_TEST(!cache.has_value());
+    BOOST_TEST(cache.get([&] { return ints.data() + 2; }) == ints.data() + 2);
+    BOOST_TEST(cache.has_value());
+    BOOST_TEST(cache.get([] { return (int *)nullptr; }) == ints.data() + 2);
+    cache.reset();
+    BOOST_TEST(!cache.has_value());
+}
+
     return boost::report_errors();
 }
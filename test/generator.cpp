@@ -0,0 +1,360 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/generator.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+#if defined(__cpp_lib_coroutine)
+
+namespace bsi = boost::stl_interfaces;
+
+static_assert(
+    std::is_same<
+        std::iterator_traits<bsi::generator<int>::iterator>::iterator_category,
+        std::input_iterator_tag>::value,
+    "");
+static_assert(
+    std::is_same<
+        std::iterator_traits<bsi::generator<int>::iterator>::reference,
+        int &>::value,
+    "");
+static_assert(std::input_iterator<bsi::generator<int>::iterator>);
+static_assert(std::ranges::input_range<bsi::generator<int>>);
+
+bsi::generator<int> iota(int first, int last)
+{
+    for (; first != last; ++first) {
+        co_yield first;
+    }
+}
+
+template<typename T>
+bsi::generator<T> elements(std::vector<T> & v)
+{
+    for (auto & x : v) {
+        co_yield x;
+    }
+}
+
+// Splits a buffer into lines, without copying any of them.
+bsi::generator<std::string_view const> lines(std::string_view buffer)
+{
+    while (!buffer.empty()) {
+        auto const newline = buffer.find('\n');
+        co_yield buffer.substr(0, newline);
+        if (newline == std::string_view::npos)
+            break;
+        buffer.remove_prefix(newline + 1);
+    }
+}
+
+struct copy_counter
+{
+    copy_counter(int x) : value(x) {}
+    copy_counter(copy_counter const & other) : value(other.value)
+    {
+        ++copies;
+    }
+    int value;
+    static int copies;
+};
+int copy_counter::copies = 0;
+
+bsi::generator<copy_counter> counters(int n)
+{
+    for (int i = 0; i < n; ++i) {
+        co_yield copy_counter(i);
+    }
+}
+
+// Each element is a const lvalue, so each is copied when it is yielded.
+template<typename T>
+bsi::generator<T> const_elements(std::vector<std::remove_const_t<T>> const & v)
+{
+    for (auto const & x : v) {
+        co_yield x;
+    }
+}
+
+bsi::generator<int> throws_after(int n)
+{
+    for (int i = 0; i < n; ++i) {
+        co_yield i;
+    }
+    throw std::runtime_error("parse error");
+}
+
+struct scope_counter
+{
+    scope_counter(int & live) : live_(live) { ++live_; }
+    ~scope_counter() { --live_; }
+    int & live_;
+};
+
+bsi::generator<int> guarded(int & live)
+{
+    scope_counter guard(live);
+    for (int i = 0;; ++i) {
+        co_yield i;
+    }
+}
+
+// A bump allocator over a fixed buffer, standing in for a per-connection
+// arena.
+struct arena
+{
+    alignas(std::max_align_t) unsigned char buf[4096];
+    std::size_t used = 0;
+    int live = 0;
+};
+
+template<typename T>
+struct arena_allocator
+{
+    using value_type = T;
+
+    arena_allocator(arena & a) noexcept : arena_(&a) {}
+    template<typename U>
+    arena_allocator(arena_allocator<U> const & other) noexcept :
+        arena_(other.arena_)
+    {}
+
+    T * allocate(std::size_t n)
+    {
+        auto const bytes = (n * sizeof(T) + alignof(std::max_align_t) - 1) /
+                           alignof(std::max_align_t) *
+                           alignof(std::max_align_t);
+        if (sizeof(arena_->buf) - arena_->used < bytes)
+            throw std::bad_alloc();
+        T * const result = reinterpret_cast<T *>(arena_->buf + arena_->used);
+        arena_->used += bytes;
+        ++arena_->live;
+        return result;
+    }
+    void deallocate(T *, std::size_t) noexcept { --arena_->live; }
+
+    friend bool
+    operator==(arena_allocator const & lhs, arena_allocator const & rhs)
+    {
+        return lhs.arena_ == rhs.arena_;
+    }
+
+    arena * arena_;
+};
+
+// GCC pairs the frame's sized operator delete() with the allocator_arg
+// operator new() and reports a mismatch, though the frame is deallocated
+// through the allocator it came from.
+#if defined(__GNUC__) && !defined(__clang__) && 11 <= __GNUC__
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+bsi::generator<int>
+arena_iota(std::allocator_arg_t, arena_allocator<int>, int n)
+{
+    for (int i = 0; i < n; ++i) {
+        co_yield i;
+    }
+}
+
+struct counter
+{
+    bsi::generator<int>
+    count_to(std::allocator_arg_t, arena_allocator<int>, int n) const
+    {
+        for (int i = start; i < n; ++i) {
+            co_yield i;
+        }
+    }
+    int start;
+};
+
+#if defined(__GNUC__) && !defined(__clang__) && 11 <= __GNUC__
+#pragma GCC diagnostic pop
+#endif
+
+#endif
+
+
+int main()
+{
+
+#if defined(__cpp_lib_coroutine)
+
+{
+    auto g = iota(0, 10);
+    BOOST_TEST(std::accumulate(g.begin(), g.end(), 0) == 45);
+
+    auto h = iota(3, 8);
+    BOOST_TEST(*std::find(h.begin(), h.end(), 5) == 5);
+    std::vector<int> rest(h.begin(), h.end());
+    BOOST_TEST(rest == std::vector<int>({5, 6, 7}));
+
+    // begin() only starts the coroutine once.
+    auto e = iota(0, 3);
+    BOOST_TEST(!e.empty());
+    BOOST_TEST(e);
+    BOOST_TEST(*e.begin() == 0);
+    std::vector<int> all(e.begin(), e.end());
+    BOOST_TEST(all == std::vector<int>({0, 1, 2}));
+    BOOST_TEST(e.empty());
+
+    auto none = iota(0, 0);
+    BOOST_TEST(none.begin() == none.end());
+    bsi::generator<int> empty;
+    BOOST_TEST(empty.begin() == empty.end());
+
+    int n = 0;
+    for (int x : iota(0, 4)) {
+        n += x;
+    }
+    BOOST_TEST(n == 6);
+}
+
+{
+    // Elements are yielded by reference.
+    std::vector<int> v = {1, 2, 3};
+    auto g = elements(v);
+    auto it = g.begin();
+    BOOST_TEST(&*it == &v[0]);
+    *it = 10;
+    ++it;
+    it++;
+    BOOST_TEST(&*it == &v[2]);
+    BOOST_TEST(v[0] == 10);
+
+    copy_counter::copies = 0;
+    int sum = 0;
+    for (auto const & c : counters(5)) {
+        sum += c.value;
+    }
+    BOOST_TEST(sum == 10);
+    BOOST_TEST(copy_counter::copies == 0);
+
+    std::string const buffer = "GET / HTTP/1.1\nHost: x\n\nbody";
+    std::vector<std::string_view> split;
+    for (auto line : lines(buffer)) {
+        split.push_back(line);
+    }
+    BOOST_TEST(split.size() == 4u);
+    BOOST_TEST(split[0] == "GET / HTTP/1.1");
+    BOOST_TEST(split[2].empty());
+    BOOST_TEST(split[3] == "body");
+    BOOST_TEST(split[1].data() == buffer.data() + 15);
+
+    auto l = lines(buffer);
+    BOOST_TEST(
+        std::count_if(l.begin(), l.end(), [](std::string_view s) {
+            return s.empty();
+        }) == 1);
+}
+
+{
+    // A const lvalue is copied, and the copy is what the iterator refers
+    // to.
+    std::vector<int> const ints = {1, 2, 3};
+    auto g = const_elements<int>(ints);
+    auto it = g.begin();
+    BOOST_TEST(*it == 1);
+    BOOST_TEST(&*it != &ints[0]);
+    *it = 10;
+    BOOST_TEST(ints[0] == 1);
+    BOOST_TEST(std::vector<int>(++it, g.end()) == std::vector<int>({2, 3}));
+
+    std::vector<copy_counter> const v = {copy_counter(4), copy_counter(5)};
+    copy_counter::copies = 0;
+    int sum = 0;
+    for (auto & x : const_elements<copy_counter>(v)) {
+        sum += x.value;
+    }
+    BOOST_TEST(sum == 9);
+    BOOST_TEST(copy_counter::copies == 2);
+
+    // A generator of a const type refers to the yielded object itself.
+    std::vector<int const *> addresses;
+    for (auto & x : const_elements<int const>(ints)) {
+        addresses.push_back(&x);
+    }
+    BOOST_TEST(
+        addresses == std::vector<int const *>({&ints[0], &ints[1], &ints[2]}));
+}
+
+{
+    // Exceptions escape through iteration.
+    auto g = throws_after(2);
+    auto it = g.begin();
+    BOOST_TEST(*it == 0);
+    ++it;
+    BOOST_TEST_THROWS(++it, std::runtime_error);
+    BOOST_TEST(it == g.end());
+
+    auto h = throws_after(0);
+    BOOST_TEST_THROWS(h.begin(), std::runtime_error);
+}
+
+{
+    // Destroying a suspended generator destroys its locals.
+    int live = 0;
+    {
+        auto g = guarded(live);
+        auto it = g.begin();
+        BOOST_TEST(live == 1);
+        std::advance(it, 5);
+        BOOST_TEST(*it == 5);
+
+        auto g2 = std::move(g);
+        BOOST_TEST(g.begin() == g.end());
+        BOOST_TEST(*g2.begin() == 5);
+        BOOST_TEST(live == 1);
+
+        g = guarded(live);
+        BOOST_TEST(live == 1);
+        g.begin();
+        BOOST_TEST(live == 2);
+        g = std::move(g2);
+        BOOST_TEST(live == 1);
+    }
+    BOOST_TEST(live == 0);
+}
+
+{
+    // Frames come from the arena when one is passed in.
+    arena a;
+    {
+        auto g = arena_iota(std::allocator_arg, a, 4);
+        BOOST_TEST(a.live == 1);
+        BOOST_TEST(0u < a.used);
+        BOOST_TEST(std::accumulate(g.begin(), g.end(), 0) == 6);
+        BOOST_TEST(a.live == 1);
+    }
+    BOOST_TEST(a.live == 0);
+
+    counter const c{2};
+    {
+        auto g = c.count_to(std::allocator_arg, a, 5);
+        BOOST_TEST(a.live == 1);
+        BOOST_TEST(std::vector<int>(g.begin(), g.end()) ==
+                   std::vector<int>({2, 3, 4}));
+    }
+    BOOST_TEST(a.live == 0);
+
+    BOOST_TEST(iota(0, 2).begin() != iota(0, 0).begin());
+}
+
+#endif
+
+    return boost::report_errors();
+}
@@ -0,0 +1,209 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// The example static_vector is built on v2::sequence_container_interface
+// when it is available, and the library's containers on v1, so that both
+// versions of hash_value() are covered.
+#if 201703L < __cplusplus
+#include <version>
+#endif
+#if 201703L < __cplusplus && defined(__cpp_lib_concepts)
+#define USE_V2
+#endif
+#include "../example/static_vector.hpp"
+
+#include <boost/stl_interfaces/packed_vector.hpp>
+#include <boost/stl_interfaces/ring_buffer.hpp>
+#include <boost/stl_interfaces/small_vector.hpp>
+#include <boost/stl_interfaces/static_vector.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <unordered_set>
+
+
+namespace stl_interfaces = boost::stl_interfaces;
+
+using int_vec = stl_interfaces::static_vector<int, 8>;
+using string_vec = stl_interfaces::small_vector<std::string, 2>;
+
+// Equal exactly when the bytes are equal, but with no std::hash.
+struct pixel
+{
+    std::uint8_t r, g, b, a;
+
+    friend bool operator==(pixel lhs, pixel rhs)
+    {
+        return lhs.r == rhs.r && lhs.g == rhs.g && lhs.b == rhs.b &&
+               lhs.a == rhs.a;
+    }
+};
+
+namespace boost { namespace stl_interfaces {
+    template<>
+    struct is_bytewise_hashable<pixel> : std::true_type
+    {
+    };
+}}
+
+struct unhashable
+{};
+
+template<typename T, typename = void>
+struct has_hash_value : std::false_type
+{};
+template<typename T>
+struct has_hash_value<
+    T,
+    stl_interfaces::v1_dtl::void_t<decltype(hash_value(std::declval<T>()))>>
+    : std::true_type
+{};
+
+// Equality and hashing use the same bytewise trait.
+static_assert(
+    stl_interfaces::v1_dtl::memcmp_equal<
+        stl_interfaces::static_vector<pixel, 4>>::value,
+    "");
+static_assert(
+    stl_interfaces::v1_dtl::bytewise_hash<
+        stl_interfaces::static_vector<pixel, 4>>::value,
+    "");
+static_assert(
+    !stl_interfaces::v1_dtl::memcmp_equal<
+        stl_interfaces::static_vector<unhashable, 4>>::value,
+    "");
+
+static_assert(has_hash_value<int_vec>::value, "");
+static_assert(
+    has_hash_value<stl_interfaces::static_vector<pixel, 4>>::value, "");
+static_assert(
+    !has_hash_value<stl_interfaces::ring_buffer<pixel, 4>>::value, "");
+static_assert(
+    !has_hash_value<stl_interfaces::static_vector<unhashable, 4>>::value, "");
+static_assert(has_hash_value<static_vector<int, 4>>::value, "");
+static_assert(has_hash_value<static_vector<pixel, 4>>::value, "");
+
+template<typename Container>
+std::size_t std_hash(Container const & c)
+{
+    return std::hash<Container>{}(c);
+}
+
+
+int main()
+{
+
+{
+    int_vec const a = {1, 2, 3};
+    int_vec const b = a;
+    int_vec const c = {3, 2, 1};
+    BOOST_TEST(hash_value(a) == hash_value(b));
+    BOOST_TEST(hash_value(a) != hash_value(c));
+    BOOST_TEST(hash_value(a) != hash_value(int_vec({1, 2})));
+    BOOST_TEST(hash_value(int_vec()) == hash_value(int_vec()));
+    BOOST_TEST(std_hash(a) == hash_value(a));
+
+    std::unordered_set<int_vec> set = {a, c, int_vec()};
+    BOOST_TEST(set.size() == 3u);
+    BOOST_TEST(set.count(b) == 1u);
+    BOOST_TEST(set.count(int_vec({1})) == 0u);
+
+    stl_interfaces::static_vector<pixel, 4> p = {{1, 2, 3, 4}, {5, 6, 7, 8}};
+    auto q = p;
+    BOOST_TEST(hash_value(p) == hash_value(q));
+    BOOST_TEST(p == q);
+    q[1].a = 9;
+    BOOST_TEST(p != q);
+    BOOST_TEST(hash_value(p) != hash_value(q));
+}
+
+{
+    // Elements without a bytewise hash are hashed one at a time.
+    string_vec const a = {"a", "b", std::string(40, 'c')};
+    string_vec const b(a.begin(), a.end());
+    BOOST_TEST(hash_value(a) == hash_value(b));
+    BOOST_TEST(std_hash(a) == hash_value(a));
+    BOOST_TEST(hash_value(string_vec({"a", "b"})) !=
+               hash_value(string_vec({"b", "a"})));
+    BOOST_TEST(hash_value(string_vec()) != hash_value(string_vec({""})));
+
+    std::unordered_set<string_vec> set;
+    set.insert(a);
+    set.insert(b);
+    BOOST_TEST(set.size() == 1u);
+}
+
+{
+    // Equal ring_buffers hash the same, wherever their elements start.
+    stl_interfaces::ring_buffer<int, 4> a = {0, 1, 2};
+    a.erase(a.begin());
+    a.push_back(3);
+    a.push_back(4);
+    stl_interfaces::ring_buffer<int, 4> const b = {1, 2, 3, 4};
+    BOOST_TEST(a == b);
+    BOOST_TEST(hash_value(a) == hash_value(b));
+    BOOST_TEST(std_hash(a) == std_hash(b));
+
+    stl_interfaces::packed_vector<4> c = {1, 15, 0, 5};
+    stl_interfaces::packed_vector<4> d(c.begin(), c.end());
+    BOOST_TEST(hash_value(c) == hash_value(d));
+    d[2] = 1;
+    BOOST_TEST(std_hash(c) != std_hash(d));
+}
+
+{
+    static_vector<int, 4> a;
+    a.push_back(1);
+    a.push_back(2);
+    static_vector<int, 4> b = a;
+    BOOST_TEST(hash_value(a) == hash_value(b));
+    b.push_back(3);
+    BOOST_TEST(hash_value(a) != hash_value(b));
+
+    static_vector<std::string, 4> c;
+    c.push_back("x");
+    static_vector<std::string, 4> d = c;
+    BOOST_TEST(hash_value(c) == hash_value(d));
+}
+
+#if defined(__cpp_lib_three_way_comparison)
+{
+    int_vec const a = {1, 2, 3};
+    int_vec const b = {1, 3};
+    static_assert(
+        std::is_same_v<decltype(a <=> b), std::strong_ordering>);
+    BOOST_TEST((a <=> b) < 0);
+    BOOST_TEST((b <=> a) > 0);
+    BOOST_TEST((a <=> a) == 0);
+    BOOST_TEST((a <=> int_vec({1, 2})) > 0);
+    BOOST_TEST(a <= b && !(a >= b));
+
+    // The memcmp() path compares the bytes as unsigned chars.
+    using byte_vec = stl_interfaces::static_vector<unsigned char, 4>;
+    BOOST_TEST((byte_vec({1, 200}) <=> byte_vec({1, 3})) > 0);
+    BOOST_TEST((byte_vec({1}) <=> byte_vec({1, 0})) < 0);
+    BOOST_TEST((byte_vec() <=> byte_vec()) == 0);
+
+    using double_vec = stl_interfaces::small_vector<double, 4>;
+    static_assert(std::is_same_v<
+                  decltype(double_vec() <=> double_vec()),
+                  std::partial_ordering>);
+    double const nan = std::numeric_limits<double>::quiet_NaN();
+    BOOST_TEST(
+        (double_vec({1.0, nan}) <=> double_vec({1.0, 2.0})) ==
+        std::partial_ordering::unordered);
+
+    string_vec const s = {"a", "b"};
+    BOOST_TEST((s <=> string_vec({"a", "c"})) < 0);
+    BOOST_TEST(s < string_vec({"b"}));
+}
+#endif
+
+    return boost::report_errors();
+}
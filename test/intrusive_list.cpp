@@ -0,0 +1,208 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/intrusive_list.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <algorithm>
+#include <vector>
+
+
+namespace bsi = boost::stl_interfaces;
+
+struct by_owner_tag;
+
+struct order : bsi::list_hook<>, bsi::list_hook<by_owner_tag>
+{
+    order(int id_) : id(id_) {}
+    int id;
+
+    friend bool operator==(order const & lhs, order const & rhs)
+    {
+        return lhs.id == rhs.id;
+    }
+    friend bool operator<(order const & lhs, order const & rhs)
+    {
+        return lhs.id < rhs.id;
+    }
+};
+
+using list_type = bsi::intrusive_list<order>;
+using owner_list_type = bsi::intrusive_list<order, by_owner_tag>;
+
+static_assert(
+    std::is_same<
+        std::iterator_traits<list_type::iterator>::iterator_category,
+        std::bidirectional_iterator_tag>::value,
+    "");
+static_assert(
+    std::is_convertible<list_type::iterator, list_type::const_iterator>::
+        value,
+    "");
+
+template<typename List>
+std::vector<int> ids(List const & l)
+{
+    std::vector<int> result;
+    for (auto const & x : l) {
+        result.push_back(x.id);
+    }
+    return result;
+}
+
+
+int main()
+{
+
+{
+    std::vector<order> orders = {1, 2, 3, 4, 5};
+    list_type l;
+    BOOST_TEST(l.empty());
+    BOOST_TEST(l.begin() == l.end());
+
+    l.push_back(orders[1]);
+    l.push_back(orders[2]);
+    l.push_front(orders[0]);
+    auto it = l.insert(l.end(), orders[4]);
+    BOOST_TEST(it->id == 5);
+    it = l.insert(it, orders[3]);
+    BOOST_TEST(it->id == 4);
+    BOOST_TEST(l.size() == 5u);
+    BOOST_TEST(ids(l) == std::vector<int>({1, 2, 3, 4, 5}));
+    BOOST_TEST(l.front().id == 1);
+    BOOST_TEST(l.back().id == 5);
+    BOOST_TEST(&*l.iterator_to(orders[2]) == &orders[2]);
+
+    std::vector<int> backward;
+    for (auto rit = l.rbegin(); rit != l.rend(); ++rit) {
+        backward.push_back(rit->id);
+    }
+    BOOST_TEST(backward == std::vector<int>({5, 4, 3, 2, 1}));
+
+    // Unlinking in constant time, from a reference to the element.
+    BOOST_TEST(orders[2].bsi::list_hook<>::is_linked());
+    it = l.erase(l.iterator_to(orders[2]));
+    BOOST_TEST(it->id == 4);
+    BOOST_TEST(!orders[2].bsi::list_hook<>::is_linked());
+    BOOST_TEST(ids(l) == std::vector<int>({1, 2, 4, 5}));
+
+    l.pop_front();
+    l.pop_back();
+    BOOST_TEST(ids(l) == std::vector<int>({2, 4}));
+    it = l.erase(l.begin(), l.end());
+    BOOST_TEST(it == l.end());
+    BOOST_TEST(l.empty());
+    for (auto const & o : orders) {
+        BOOST_TEST(!o.bsi::list_hook<>::is_linked());
+    }
+
+    // Erased elements can be relinked.
+    l.push_back(orders[2]);
+    l.push_back(orders[0]);
+    BOOST_TEST(ids(l) == std::vector<int>({3, 1}));
+    l.clear();
+    BOOST_TEST(l.empty());
+}
+
+{
+    // One element in two lists at once.
+    std::vector<order> orders = {1, 2, 3, 4};
+    list_type by_time;
+    owner_list_type by_owner;
+    for (auto & o : orders) {
+        by_time.push_back(o);
+    }
+    by_owner.push_back(orders[3]);
+    by_owner.push_back(orders[1]);
+    BOOST_TEST(ids(by_owner) == std::vector<int>({4, 2}));
+    by_time.erase(by_time.iterator_to(orders[1]));
+    BOOST_TEST(ids(by_time) == std::vector<int>({1, 3, 4}));
+    BOOST_TEST(ids(by_owner) == std::vector<int>({4, 2}));
+    by_owner.clear();
+}
+
+{
+    // Splicing.
+    std::vector<order> orders = {1, 2, 3, 4, 5, 6};
+    list_type a;
+    list_type b;
+    for (int i = 0; i < 3; ++i) {
+        a.push_back(orders[i]);
+        b.push_back(orders[i + 3]);
+    }
+
+    a.splice(std::next(a.begin()), b);
+    BOOST_TEST(ids(a) == std::vector<int>({1, 4, 5, 6, 2, 3}));
+    BOOST_TEST(b.empty());
+    BOOST_TEST(a.size() == 6u);
+
+    b.splice(b.end(), a, a.iterator_to(orders[4]));
+    BOOST_TEST(ids(a) == std::vector<int>({1, 4, 6, 2, 3}));
+    BOOST_TEST(ids(b) == std::vector<int>({5}));
+    BOOST_TEST(a.size() == 5u);
+    BOOST_TEST(b.size() == 1u);
+
+    b.splice(b.begin(), a, std::next(a.begin()), std::prev(a.end()));
+    BOOST_TEST(ids(a) == std::vector<int>({1, 3}));
+    BOOST_TEST(ids(b) == std::vector<int>({4, 6, 2, 5}));
+    BOOST_TEST(a.size() == 2u);
+    BOOST_TEST(b.size() == 4u);
+
+    // Within one list.
+    b.splice(b.begin(), b, std::prev(b.end()));
+    BOOST_TEST(ids(b) == std::vector<int>({5, 4, 6, 2}));
+    b.splice(b.end(), b, b.begin(), std::next(b.begin(), 2));
+    BOOST_TEST(ids(b) == std::vector<int>({6, 2, 5, 4}));
+    b.splice(b.begin(), b, b.begin());
+    BOOST_TEST(ids(b) == std::vector<int>({6, 2, 5, 4}));
+    BOOST_TEST(b.size() == 4u);
+
+    // Moves and swaps only relink the roots.
+    list_type c(std::move(b));
+    BOOST_TEST(b.empty());
+    BOOST_TEST(ids(c) == std::vector<int>({6, 2, 5, 4}));
+    swap(a, c);
+    BOOST_TEST(ids(a) == std::vector<int>({6, 2, 5, 4}));
+    BOOST_TEST(ids(c) == std::vector<int>({1, 3}));
+    c = std::move(a);
+    BOOST_TEST(ids(c) == std::vector<int>({6, 2, 5, 4}));
+    BOOST_TEST(a.empty());
+    BOOST_TEST(!orders[0].bsi::list_hook<>::is_linked());
+    a.push_back(orders[0]);
+    BOOST_TEST(a.size() == 1u);
+
+    list_type d;
+    d.splice(d.end(), list_type());
+    BOOST_TEST(d.empty());
+    a.clear();
+    c.clear();
+}
+
+{
+    // Copying an element does not copy its links.
+    std::vector<order> orders = {1, 2};
+    list_type l;
+    l.push_back(orders[0]);
+    order copy = orders[0];
+    BOOST_TEST(!copy.bsi::list_hook<>::is_linked());
+    orders[1] = orders[0];
+    BOOST_TEST(!orders[1].bsi::list_hook<>::is_linked());
+    BOOST_TEST(l.size() == 1u);
+
+    // The interface's comparisons work on the elements.
+    list_type l2;
+    l2.push_back(orders[1]);
+    BOOST_TEST(l == l2);
+    l2.clear();
+    l2.push_back(copy);
+    BOOST_TEST(l == l2);
+    BOOST_TEST(std::find(l.begin(), l.end(), order(1)) == l.begin());
+    l2.clear();
+    l.clear();
+}
+
+    return boost::report_errors();
+}
@@ -0,0 +1,483 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/iterator_interface.hpp>
+#include <boost/stl_interfaces/reverse_iterator.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+
+#if 201703L < __cplusplus && defined(__cpp_lib_concepts)
+
+namespace v2 = boost::stl_interfaces::v2;
+
+// Random access, with all the operations implemented in terms of the
+// adapted pointer.
+template<typename ValueType>
+struct adapted_random_access_iter : v2::iterator_interface<
+                                        adapted_random_access_iter<ValueType>,
+                                        std::random_access_iterator_tag,
+                                        ValueType>
+{
+    adapted_random_access_iter() {}
+    adapted_random_access_iter(ValueType * it) : it_(it) {}
+
+    template<
+        typename ValueType2,
+        typename Enable = std::enable_if_t<
+            std::is_convertible<ValueType2 *, ValueType *>::value>>
+    adapted_random_access_iter(adapted_random_access_iter<ValueType2> other) :
+        it_(other.it_)
+    {}
+
+    template<typename ValueType2>
+    friend struct adapted_random_access_iter;
+
+private:
+    friend boost::stl_interfaces::access;
+    ValueType *& base_reference() noexcept { return it_; }
+    ValueType * base_reference() const noexcept { return it_; }
+
+    ValueType * it_;
+};
+
+using ra_iter = adapted_random_access_iter<int>;
+using const_ra_iter = adapted_random_access_iter<int const>;
+
+static_assert(std::random_access_iterator<ra_iter>);
+static_assert(std::random_access_iterator<const_ra_iter>);
+static_assert(!std::contiguous_iterator<ra_iter>);
+BOOST_STL_INTERFACES_STATIC_ASSERT_ITERATOR_TRAITS(
+    ra_iter,
+    std::random_access_iterator_tag,
+    std::random_access_iterator_tag,
+    int,
+    int &,
+    int *,
+    std::ptrdiff_t)
+
+// Random access, with the user-defined basis operations.
+struct basic_random_access_iter : v2::iterator_interface<
+                                      basic_random_access_iter,
+                                      std::random_access_iterator_tag,
+                                      int>
+{
+    basic_random_access_iter() {}
+    basic_random_access_iter(int * it) : it_(it) {}
+
+    int & operator*() const { return *it_; }
+    basic_random_access_iter & operator+=(std::ptrdiff_t i)
+    {
+        it_ += i;
+        return *this;
+    }
+    friend std::ptrdiff_t operator-(
+        basic_random_access_iter lhs, basic_random_access_iter rhs) noexcept
+    {
+        return lhs.it_ - rhs.it_;
+    }
+
+private:
+    int * it_;
+};
+
+static_assert(std::random_access_iterator<basic_random_access_iter>);
+
+struct contiguous_iter : v2::iterator_interface<
+                             contiguous_iter,
+                             boost::stl_interfaces::contiguous_iterator_tag,
+                             int>
+{
+    contiguous_iter() {}
+    contiguous_iter(int * it) : it_(it) {}
+
+    // The interface's operator==() is only used when D has none.
+    friend bool operator==(contiguous_iter lhs, contiguous_iter rhs)
+    {
+        return lhs.it_ == rhs.it_;
+    }
+
+private:
+    friend boost::stl_interfaces::access;
+    int *& base_reference() noexcept { return it_; }
+    int * base_reference() const noexcept { return it_; }
+
+    int * it_;
+};
+
+static_assert(std::contiguous_iterator<contiguous_iter>);
+BOOST_STL_INTERFACES_STATIC_ASSERT_ITERATOR_TRAITS(
+    contiguous_iter,
+    std::random_access_iterator_tag,
+    boost::stl_interfaces::contiguous_iterator_tag,
+    int,
+    int &,
+    int *,
+    std::ptrdiff_t)
+
+// Bidirectional, with the user-defined basis operations.
+template<typename Node>
+struct list_iter
+    : v2::iterator_interface<
+          list_iter<Node>,
+          std::bidirectional_iterator_tag,
+          std::remove_const_t<decltype(std::declval<Node &>().value)>,
+          decltype((std::declval<Node &>().value))>
+{
+    list_iter() {}
+    list_iter(Node * n) : n_(n) {}
+
+    decltype(auto) operator*() const { return (n_->value); }
+    list_iter & operator++()
+    {
+        n_ = n_->next;
+        return *this;
+    }
+    list_iter & operator--()
+    {
+        n_ = n_->prev;
+        return *this;
+    }
+    friend bool operator==(list_iter lhs, list_iter rhs)
+    {
+        return lhs.n_ == rhs.n_;
+    }
+
+    using base_type = v2::iterator_interface<
+        list_iter<Node>,
+        std::bidirectional_iterator_tag,
+        std::remove_const_t<decltype(std::declval<Node &>().value)>,
+        decltype((std::declval<Node &>().value))>;
+    using base_type::operator++;
+    using base_type::operator--;
+
+private:
+    Node * n_ = nullptr;
+};
+
+struct node
+{
+    int value;
+    node * prev;
+    node * next;
+};
+
+using bidi_iter = list_iter<node>;
+
+static_assert(std::bidirectional_iterator<bidi_iter>);
+static_assert(!std::random_access_iterator<bidi_iter>);
+BOOST_STL_INTERFACES_STATIC_ASSERT_ITERATOR_TRAITS(
+    bidi_iter,
+    std::bidirectional_iterator_tag,
+    std::bidirectional_iterator_tag,
+    int,
+    int &,
+    int *,
+    std::ptrdiff_t)
+
+// Bidirectional, but with constant-time distance_to() and advance() hooks.
+struct sized_bidi_iter : v2::iterator_interface<
+                             sized_bidi_iter,
+                             std::bidirectional_iterator_tag,
+                             int>
+{
+    sized_bidi_iter() {}
+    sized_bidi_iter(int * it) : it_(it) {}
+
+    int & operator*() const { return *it_; }
+    sized_bidi_iter & operator++()
+    {
+        ++it_;
+        return *this;
+    }
+    sized_bidi_iter & operator--()
+    {
+        --it_;
+        return *this;
+    }
+    friend bool operator==(sized_bidi_iter lhs, sized_bidi_iter rhs)
+    {
+        return lhs.it_ == rhs.it_;
+    }
+
+    using base_type = v2::iterator_interface<
+        sized_bidi_iter,
+        std::bidirectional_iterator_tag,
+        int>;
+    using base_type::operator++;
+    using base_type::operator--;
+
+private:
+    friend boost::stl_interfaces::access;
+    std::ptrdiff_t distance_to(sized_bidi_iter other) const
+    {
+        return other.it_ - it_;
+    }
+    void advance(std::ptrdiff_t n) { it_ += n; }
+
+    int * it_;
+};
+
+static_assert(std::bidirectional_iterator<sized_bidi_iter>);
+static_assert(!std::random_access_iterator<sized_bidi_iter>);
+
+// A forward proxy iterator over two arrays at once.
+struct zip_iter : v2::proxy_iterator_interface<
+                      zip_iter,
+                      std::forward_iterator_tag,
+                      std::tuple<int, int>,
+                      std::tuple<int &, int &>>
+{
+    zip_iter() {}
+    zip_iter(int * it1, int * it2) : it1_(it1), it2_(it2) {}
+
+    std::tuple<int &, int &> operator*() const { return {*it1_, *it2_}; }
+    zip_iter & operator++()
+    {
+        ++it1_;
+        ++it2_;
+        return *this;
+    }
+    friend bool operator==(zip_iter lhs, zip_iter rhs)
+    {
+        return lhs.it1_ == rhs.it1_;
+    }
+
+    using base_type = v2::proxy_iterator_interface<
+        zip_iter,
+        std::forward_iterator_tag,
+        std::tuple<int, int>,
+        std::tuple<int &, int &>>;
+    using base_type::operator++;
+
+private:
+    int * it1_ = nullptr;
+    int * it2_ = nullptr;
+};
+
+using int_pair = std::tuple<int, int>;
+using int_ref_pair = std::tuple<int &, int &>;
+using int_ref_pair_arrow =
+    boost::stl_interfaces::proxy_arrow_result<int_ref_pair>;
+
+static_assert(std::forward_iterator<zip_iter>);
+BOOST_STL_INTERFACES_STATIC_ASSERT_ITERATOR_TRAITS(
+    zip_iter,
+    std::forward_iterator_tag,
+    std::forward_iterator_tag,
+    int_pair,
+    int_ref_pair,
+    int_ref_pair_arrow,
+    std::ptrdiff_t)
+
+struct input_iter
+    : v2::iterator_interface<input_iter, std::input_iterator_tag, int>
+{
+    input_iter() {}
+    input_iter(int * it) : it_(it) {}
+
+private:
+    friend boost::stl_interfaces::access;
+    int *& base_reference() noexcept { return it_; }
+    int * base_reference() const noexcept { return it_; }
+
+    int * it_;
+};
+
+static_assert(std::input_iterator<input_iter>);
+static_assert(!std::forward_iterator<input_iter>);
+
+template<typename Container>
+struct back_insert_iter : v2::iterator_interface<
+                              back_insert_iter<Container>,
+                              std::output_iterator_tag,
+                              typename Container::value_type,
+                              back_insert_iter<Container> &>
+{
+    back_insert_iter() : c_(nullptr) {}
+    back_insert_iter(Container & c) : c_(std::addressof(c)) {}
+
+    back_insert_iter & operator*() noexcept { return *this; }
+    back_insert_iter & operator++() noexcept { return *this; }
+
+    back_insert_iter & operator=(typename Container::value_type const & v)
+    {
+        c_->push_back(v);
+        return *this;
+    }
+
+    using base_type = v2::iterator_interface<
+        back_insert_iter<Container>,
+        std::output_iterator_tag,
+        typename Container::value_type,
+        back_insert_iter<Container> &>;
+    using base_type::operator++;
+
+private:
+    Container * c_;
+};
+
+using back_insert = back_insert_iter<std::vector<int>>;
+
+static_assert(std::output_iterator<back_insert, int>);
+BOOST_STL_INTERFACES_STATIC_ASSERT_ITERATOR_TRAITS(
+    back_insert,
+    std::output_iterator_tag,
+    std::output_iterator_tag,
+    int,
+    back_insert &,
+    void,
+    std::ptrdiff_t)
+
+#endif
+
+
+int main()
+{
+
+#if 201703L < __cplusplus && defined(__cpp_lib_concepts)
+
+{
+    std::array<int, 10> ints = {{9, 8, 7, 6, 5, 4, 3, 2, 1, 0}};
+    ra_iter first(ints.data());
+    ra_iter last(ints.data() + ints.size());
+
+    std::sort(first, last);
+    BOOST_TEST(std::is_sorted(ints.begin(), ints.end()));
+
+    BOOST_TEST(last - first == 10);
+    BOOST_TEST(first[3] == 3);
+    BOOST_TEST(*(first + 4) == 4);
+    BOOST_TEST(*(4 + first) == 4);
+    BOOST_TEST(*(last - 1) == 9);
+    BOOST_TEST(first < last);
+    BOOST_TEST(last > first);
+    BOOST_TEST(first <= first);
+    BOOST_TEST(first != last);
+    BOOST_TEST((first <=> last) == std::strong_ordering::less);
+
+    ra_iter it = first;
+    BOOST_TEST(*it++ == 0);
+    BOOST_TEST(*it == 1);
+    BOOST_TEST(*++it == 2);
+    it += 5;
+    BOOST_TEST(*it == 7);
+    it -= 2;
+    BOOST_TEST(*it-- == 5);
+    BOOST_TEST(*--it == 3);
+
+    // Mixed comparisons go through the implicit conversion.
+    const_ra_iter const_first = first;
+    BOOST_TEST(const_first == first);
+    BOOST_TEST(first == const_first);
+    BOOST_TEST(const_first < last);
+    BOOST_TEST(last - const_first == 10);
+}
+
+{
+    std::array<int, 10> ints = {{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}};
+    basic_random_access_iter first(ints.data());
+    basic_random_access_iter last(ints.data() + ints.size());
+
+    BOOST_TEST(std::accumulate(first, last, 0) == 45);
+    BOOST_TEST(first[9] == 9);
+    BOOST_TEST(first + 10 == last);
+    BOOST_TEST(last - 10 == first);
+    BOOST_TEST(first < last);
+    BOOST_TEST(!(last < first));
+
+    std::array<int, 10> reversed;
+    std::copy(
+        boost::stl_interfaces::make_reverse_iterator(last),
+        boost::stl_interfaces::make_reverse_iterator(first),
+        reversed.begin());
+    BOOST_TEST(reversed[0] == 9);
+    BOOST_TEST(reversed[9] == 0);
+}
+
+{
+    std::array<int, 10> ints = {{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}};
+    contiguous_iter first(ints.data());
+    contiguous_iter last(ints.data() + ints.size());
+
+    BOOST_TEST(boost::stl_interfaces::to_address(first) == ints.data());
+    BOOST_TEST(std::to_address(last) == ints.data() + ints.size());
+    BOOST_TEST(std::ranges::equal(first, last, ints.begin(), ints.end()));
+    BOOST_TEST(first + 10 == last);
+    BOOST_TEST(first < last);
+}
+
+{
+    std::array<node, 3> nodes;
+    for (int i = 0; i < 3; ++i) {
+        nodes[i].value = i;
+        nodes[i].prev = i ? &nodes[i - 1] : nullptr;
+        nodes[i].next = i < 2 ? &nodes[i + 1] : nullptr;
+    }
+    bidi_iter first(&nodes[0]);
+    bidi_iter last;
+
+    BOOST_TEST(std::distance(first, last) == 3);
+    BOOST_TEST(std::accumulate(first, last, 0) == 3);
+    bidi_iter it = first;
+    it++;
+    BOOST_TEST(*it == 1);
+    --it;
+    BOOST_TEST(it == first);
+    bidi_iter it2 = ++it;
+    it--;
+    BOOST_TEST(*it2 == 1);
+    BOOST_TEST(it == first);
+}
+
+{
+    std::array<int, 10> ints = {{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}};
+    sized_bidi_iter first(ints.data());
+    sized_bidi_iter last(ints.data() + ints.size());
+
+    // operator-() and operator+=() come from the hooks.
+    BOOST_TEST(last - first == 10);
+    BOOST_TEST(*(first + 3) == 3);
+    sized_bidi_iter it = last;
+    it -= 4;
+    BOOST_TEST(*it == 6);
+    BOOST_TEST(std::distance(first, last) == 10);
+}
+
+{
+    std::array<int, 3> ones = {{0, 1, 2}};
+    std::array<int, 3> twos = {{3, 4, 5}};
+    zip_iter first(ones.data(), twos.data());
+    zip_iter last(ones.data() + 3, twos.data() + 3);
+
+    BOOST_TEST(std::distance(first, last) == 3);
+    BOOST_TEST(std::get<1>(*first) == 3);
+    for (auto it = first; it != last; it++) {
+        std::get<1>(*it) += std::get<0>(*it);
+    }
+    BOOST_TEST(twos[2] == 7);
+}
+
+{
+    std::array<int, 4> ints = {{1, 2, 3, 4}};
+    input_iter first(ints.data());
+    input_iter last(ints.data() + ints.size());
+    BOOST_TEST(std::accumulate(first, last, 0) == 10);
+
+    std::vector<int> copy;
+    std::copy(first, last, back_insert(copy));
+    BOOST_TEST(copy == (std::vector<int>{1, 2, 3, 4}));
+}
+
+#endif
+
+    return boost::report_errors();
+}
@@ -0,0 +1,148 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/mapped_view.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <numeric>
+#include <system_error>
+#include <vector>
+
+
+namespace bsi = boost::stl_interfaces;
+
+struct record
+{
+    std::int32_t id;
+    std::int32_t price;
+};
+
+static_assert(
+    std::is_same<
+        std::iterator_traits<bsi::record_iterator<record>>::iterator_category,
+        std::random_access_iterator_tag>::value,
+    "");
+
+void write_file(char const * path, void const * data, std::size_t size)
+{
+    std::FILE * f = std::fopen(path, "wb");
+    if (size)
+        std::fwrite(data, 1, size, f);
+    std::fclose(f);
+}
+
+
+int main()
+{
+
+{
+    std::vector<record> records;
+    for (std::int32_t i = 0; i < 1000; ++i) {
+        records.push_back(record{i, (i * 37) % 1000});
+    }
+    char const * const path = "mapped_view_records.bin";
+    write_file(path, records.data(), records.size() * sizeof(record));
+
+    bsi::mapped_file file(path, bsi::access_pattern::sequential);
+    BOOST_TEST(file.size() == records.size() * sizeof(record));
+    file.advise(bsi::access_pattern::random);
+
+    bsi::mapped_view<record> v(file);
+    BOOST_TEST(v.size() == 1000u);
+    BOOST_TEST(v.data() == reinterpret_cast<record const *>(file.data()));
+    BOOST_TEST(v[500].id == 500);
+    BOOST_TEST(v.back().price == (999 * 37) % 1000);
+    BOOST_TEST(std::equal(
+        v.begin(),
+        v.end(),
+        records.begin(),
+        [](record const & a, record const & b) {
+            return a.id == b.id && a.price == b.price;
+        }));
+
+    auto const it = std::find_if(
+        v.begin(), v.end(), [](record const & r) { return r.price == 999; });
+    BOOST_TEST(it != v.end());
+    BOOST_TEST(it->id == 27);
+
+    // Offsetting skips a header.
+    bsi::mapped_view<record> tail(file, 10 * sizeof(record));
+    BOOST_TEST(tail.size() == 990u);
+    BOOST_TEST(tail.front().id == 10);
+
+    // Views keep the mapping alive.
+    file = bsi::mapped_file();
+    BOOST_TEST(file.empty());
+    BOOST_TEST(v[999].id == 999);
+
+    // Only the leading fields of each record.
+    bsi::record_view<std::int32_t> ids(v.file(), sizeof(record));
+    BOOST_TEST(ids.size() == 1000u);
+    BOOST_TEST(ids.record_size() == sizeof(record));
+    BOOST_TEST(ids[3] == 3);
+    BOOST_TEST(
+        std::accumulate(ids.begin(), ids.end(), std::int64_t(0)) ==
+        999 * 1000 / 2);
+    BOOST_TEST(std::is_sorted(ids.begin(), ids.end()));
+    BOOST_TEST(*std::lower_bound(ids.begin(), ids.end(), 700) == 700);
+    BOOST_TEST(ids.end() - ids.begin() == 1000);
+    BOOST_TEST(*(ids.end() - 1) == 999);
+
+    // The price field, through an offset.
+    bsi::record_view<std::int32_t> prices(
+        v.file(), sizeof(record), sizeof(std::int32_t));
+    BOOST_TEST(prices.size() == 999u);
+    BOOST_TEST(prices[1] == 37);
+
+    std::remove(path);
+}
+
+{
+    // A trailing partial record is not part of the view.
+    unsigned char bytes[11] = {1, 0, 0, 0, 2, 0, 0, 0, 3, 0, 0};
+    char const * const path = "mapped_view_partial.bin";
+    write_file(path, bytes, sizeof(bytes));
+    bsi::mapped_view<std::uint32_t> v(bsi::mapped_file{path});
+    BOOST_TEST(v.size() == 2u);
+    std::remove(path);
+}
+
+{
+    // An empty file maps to an empty view.
+    char const * const path = "mapped_view_empty.bin";
+    write_file(path, nullptr, 0);
+    bsi::mapped_file file{std::string(path)};
+    BOOST_TEST(file.empty());
+    BOOST_TEST(file.data() == nullptr);
+    bsi::mapped_view<record> v(file);
+    BOOST_TEST(v.empty());
+    bsi::record_view<record> r(file, 16);
+    BOOST_TEST(r.empty());
+    std::remove(path);
+}
+
+{
+    // Views need not own their elements.
+    std::vector<int> const ints = {3, 1, 2};
+    bsi::mapped_view<int> v(ints.data(), ints.data() + ints.size());
+    BOOST_TEST(v.size() == 3u);
+    BOOST_TEST(*std::min_element(v.begin(), v.end()) == 1);
+    BOOST_TEST(v.file().data() == nullptr);
+
+    bsi::mapped_view<int> const empty;
+    BOOST_TEST(empty.empty());
+}
+
+{
+    BOOST_TEST_THROWS(
+        bsi::mapped_file("no/such/mapped_view/file.bin"), std::system_error);
+}
+
+    return boost::report_errors();
+}
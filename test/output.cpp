@@ -3,11 +3,13 @@
 // Distributed under the Boost Software License, Version 1.0. (See
 // accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/algorithm.hpp>
 #include <boost/stl_interfaces/iterator_interface.hpp>
 
 #include <boost/core/lightweight_test.hpp>
 
 #include <array>
+#include <list>
 #include <numeric>
 #include <vector>
 #include <type_traits>
@@ -98,6 +100,51 @@ BOOST_STL_INTERFACES_STATIC_ASSERT_ITERATOR_TRAITS(
     void,
     std::ptrdiff_t)
 
+// Like back_insert_iter, but with a sink() hook that appends a whole range
+// with one insert().
+int sink_calls = 0;
+
+template<typename Container>
+struct sink_insert_iter : boost::stl_interfaces::iterator_interface<
+                              sink_insert_iter<Container>,
+                              std::output_iterator_tag,
+                              typename Container::value_type,
+                              sink_insert_iter<Container> &>
+{
+    sink_insert_iter() : c_(nullptr) {}
+    sink_insert_iter(Container & c) : c_(std::addressof(c)) {}
+
+    sink_insert_iter & operator*() noexcept { return *this; }
+    sink_insert_iter & operator++() noexcept { return *this; }
+
+    sink_insert_iter & operator=(typename Container::value_type const & v)
+    {
+        c_->push_back(v);
+        return *this;
+    }
+
+    using base_type = boost::stl_interfaces::iterator_interface<
+        sink_insert_iter<Container>,
+        std::output_iterator_tag,
+        typename Container::value_type,
+        sink_insert_iter<Container> &>;
+    using base_type::operator++;
+
+private:
+    friend boost::stl_interfaces::access;
+
+    template<typename Iter>
+    void sink(Iter first, Iter last)
+    {
+        ++sink_calls;
+        c_->insert(c_->end(), first, last);
+    }
+
+    Container * c_;
+};
+
+using sink_insert = sink_insert_iter<std::vector<int>>;
+
 
 std::vector<int> ints = {{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}};
 
@@ -126,5 +173,62 @@ int main()
         out++;
 }
 
+
+{
+    // Without a sink() hook, copy() and transform() write element by
+    // element.
+    std::vector<int> ints_copy(ints.size());
+    boost::stl_interfaces::copy(
+        ints.begin(), ints.end(), output(&ints_copy[0]));
+    BOOST_TEST(ints_copy == ints);
+
+    std::vector<int> doubled;
+    boost::stl_interfaces::transform(
+        ints.begin(), ints.end(), back_insert(doubled), [](int x) {
+            return 2 * x;
+        });
+    BOOST_TEST(doubled.size() == ints.size());
+    BOOST_TEST(doubled[9] == 18);
+}
+
+
+{
+    sink_calls = 0;
+    std::vector<int> ints_copy;
+    boost::stl_interfaces::copy(
+        ints.begin(), ints.end(), sink_insert(ints_copy));
+    BOOST_TEST(ints_copy == ints);
+    BOOST_TEST(sink_calls == 1);
+
+    // The std algorithms still see an ordinary output iterator.
+    std::copy(ints.begin(), ints.begin() + 3, sink_insert(ints_copy));
+    BOOST_TEST(ints_copy.size() == 13u);
+    BOOST_TEST(sink_calls == 1);
+
+    std::list<int> const list(ints.begin(), ints.end());
+    std::vector<int> list_copy;
+    boost::stl_interfaces::copy(
+        list.begin(), list.end(), sink_insert(list_copy));
+    BOOST_TEST(list_copy == ints);
+    BOOST_TEST(sink_calls == 2);
+}
+
+
+{
+    sink_calls = 0;
+    int calls = 0;
+    std::vector<int> squares;
+    boost::stl_interfaces::transform(
+        ints.begin(), ints.end(), sink_insert(squares), [&calls](int x) {
+            ++calls;
+            return x * x;
+        });
+    BOOST_TEST(sink_calls == 1);
+    BOOST_TEST(calls == 10);
+    BOOST_TEST(squares.size() == ints.size());
+    BOOST_TEST(squares[3] == 9);
+    BOOST_TEST(squares[9] == 81);
+}
+
     return boost::report_errors();
 }
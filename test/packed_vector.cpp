@@ -0,0 +1,270 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/packed_vector.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <algorithm>
+#include <vector>
+
+
+namespace bsi = boost::stl_interfaces;
+
+using bitset = bsi::packed_vector<1>;
+using nibbles = bsi::packed_vector<4>;
+
+static_assert(std::is_same<bitset::value_type, bool>::value, "");
+static_assert(std::is_same<nibbles::value_type, std::uint8_t>::value, "");
+static_assert(
+    std::is_same<bsi::packed_vector<32>::value_type, std::uint32_t>::value,
+    "");
+static_assert(
+    std::is_same<
+        std::iterator_traits<nibbles::iterator>::iterator_category,
+        std::random_access_iterator_tag>::value,
+    "");
+static_assert(
+    std::is_convertible<nibbles::iterator, nibbles::const_iterator>::value,
+    "");
+static_assert(
+    !std::is_convertible<nibbles::const_iterator, nibbles::iterator>::value,
+    "");
+
+template<std::size_t Bits>
+std::vector<int> to_vector(bsi::packed_vector<Bits> const & v)
+{
+    return std::vector<int>(v.begin(), v.end());
+}
+
+// One more than the largest value the tests put in a field.
+template<std::size_t Bits>
+constexpr int limit()
+{
+    return Bits < 16 ? 1 << Bits : 1 << 16;
+}
+
+// Deterministic values a field can hold, in no particular order.
+template<std::size_t Bits>
+std::vector<int> values(int n)
+{
+    std::vector<int> result;
+    unsigned x = 12345;
+    for (int i = 0; i < n; ++i) {
+        x = x * 1103515245u + 12345u;
+        result.push_back(int((x >> 8) % unsigned(limit<Bits>())));
+    }
+    return result;
+}
+
+// Checks the word-at-a-time algorithms against the std ones over every
+// subrange of v that starts and ends near a word boundary.
+template<std::size_t Bits>
+void check_algorithms(bsi::packed_vector<Bits> & v)
+{
+    auto const ref = to_vector(v);
+    int const n = int(ref.size());
+    std::vector<int> offsets;
+    for (int i : {0, 1, 2, 15, 16, 17, 31, 63, 64, 65, 127, 128, 129}) {
+        if (i <= n)
+            offsets.push_back(i);
+    }
+    offsets.push_back(n);
+    auto const & cv = v;
+    for (int f : offsets) {
+        for (int l : offsets) {
+            if (l < f)
+                continue;
+            for (int x : {0, 1, limit<Bits>() - 1, limit<Bits>(), -1}) {
+                BOOST_TEST(
+                    bsi::count(cv.begin() + f, cv.begin() + l, x) ==
+                    std::count(ref.begin() + f, ref.begin() + l, x));
+                BOOST_TEST(
+                    bsi::count(v.begin() + f, v.begin() + l, x) ==
+                    std::count(ref.begin() + f, ref.begin() + l, x));
+                BOOST_TEST(
+                    bsi::find(cv.begin() + f, cv.begin() + l, x) -
+                        cv.begin() ==
+                    std::find(ref.begin() + f, ref.begin() + l, x) -
+                        ref.begin());
+            }
+        }
+    }
+
+    for (int f : offsets) {
+        for (int l : offsets) {
+            if (l < f)
+                continue;
+            auto copy = v;
+            auto expected = ref;
+            bsi::fill(copy.begin() + f, copy.begin() + l, 1);
+            std::fill(expected.begin() + f, expected.begin() + l, 1);
+            BOOST_TEST(to_vector(copy) == expected);
+
+            // Copying to other offsets, including overlapping ones.
+            for (int d : offsets) {
+                if (n < d + (l - f) || f < d)
+                    continue;
+                auto dest = v;
+                expected = ref;
+                auto const it = bsi::copy(
+                    cv.begin() + f, cv.begin() + l, dest.begin() + d);
+                std::copy(
+                    ref.begin() + f, ref.begin() + l, expected.begin() + d);
+                BOOST_TEST(it - dest.begin() == d + (l - f));
+                BOOST_TEST(to_vector(dest) == expected);
+
+                copy = v;
+                expected = ref;
+                bsi::copy(
+                    copy.begin() + f, copy.begin() + l, copy.begin() + d);
+                std::copy(
+                    expected.begin() + f,
+                    expected.begin() + l,
+                    expected.begin() + d);
+                BOOST_TEST(to_vector(copy) == expected);
+            }
+        }
+    }
+}
+
+template<std::size_t Bits>
+void check_modifiers()
+{
+    auto const ref = values<Bits>(200);
+    bsi::packed_vector<Bits> v(ref.begin(), ref.end());
+    BOOST_TEST(v.size() == 200u);
+    BOOST_TEST(to_vector(v) == ref);
+    check_algorithms(v);
+
+    auto expected = ref;
+    for (int i : {0, 1, 63, 64, 65, 150, 200}) {
+        v.insert(v.begin() + i, 1);
+        expected.insert(expected.begin() + i, 1);
+        BOOST_TEST(to_vector(v) == expected);
+    }
+    auto const more = values<Bits>(70);
+    v.insert(v.begin() + 3, more.begin(), more.end());
+    expected.insert(expected.begin() + 3, more.begin(), more.end());
+    BOOST_TEST(to_vector(v) == expected);
+    v.insert(v.end(), more.begin(), more.end());
+    expected.insert(expected.end(), more.begin(), more.end());
+    BOOST_TEST(to_vector(v) == expected);
+
+    v.erase(v.begin() + 5, v.begin() + 90);
+    expected.erase(expected.begin() + 5, expected.begin() + 90);
+    BOOST_TEST(to_vector(v) == expected);
+    v.erase(v.begin());
+    expected.erase(expected.begin());
+    BOOST_TEST(to_vector(v) == expected);
+
+    v.resize(300, 1);
+    expected.resize(300, 1);
+    BOOST_TEST(to_vector(v) == expected);
+    v.resize(77);
+    expected.resize(77);
+    BOOST_TEST(to_vector(v) == expected);
+    v.resize(140);
+    expected.resize(140);
+    BOOST_TEST(to_vector(v) == expected);
+    check_algorithms(v);
+
+    // Equality compares words, so erased elements must not linger.
+    bsi::packed_vector<Bits> w(expected.begin(), expected.end());
+    BOOST_TEST(v == w);
+    w.back() = 1;
+    BOOST_TEST(v != w);
+}
+
+
+int main()
+{
+
+{
+    bitset b;
+    BOOST_TEST(b.empty());
+    b.push_back(true);
+    b.push_back(false);
+    b.emplace_back(true);
+    BOOST_TEST(b.size() == 3u);
+    BOOST_TEST(b[0]);
+    BOOST_TEST(!b[1]);
+    BOOST_TEST(b.front() && b.back());
+
+    b[1] = true;
+    b[0] = b[1] = false;
+    BOOST_TEST(to_vector(b) == std::vector<int>({0, 0, 1}));
+    bool const x = b.back();
+    BOOST_TEST(x);
+
+    b.pop_back();
+    BOOST_TEST(to_vector(b) == std::vector<int>({0, 0}));
+    b.clear();
+    BOOST_TEST(b.empty());
+
+    bitset c(1000, true);
+    BOOST_TEST(bsi::count(c.begin(), c.end(), true) == 1000);
+    BOOST_TEST(bsi::find(c.begin(), c.end(), false) == c.end());
+    c[700] = false;
+    BOOST_TEST(bsi::find(c.begin(), c.end(), false) - c.begin() == 700);
+    BOOST_TEST(bsi::count(c.begin(), c.end(), false) == 1);
+    bsi::fill(c.begin() + 10, c.end(), false);
+    BOOST_TEST(bsi::count(c.begin(), c.end(), true) == 10);
+}
+
+{
+    nibbles v = {1, 2, 3, 15};
+    BOOST_TEST(to_vector(v) == std::vector<int>({1, 2, 3, 15}));
+
+    // Assignment through the proxy truncates to Bits bits.
+    v[0] = 0x1f;
+    BOOST_TEST(v[0] == 15);
+    BOOST_TEST(v[1] == 2);
+
+    // Proxies swap the values they refer to.
+    std::reverse(v.begin(), v.end());
+    BOOST_TEST(to_vector(v) == std::vector<int>({15, 3, 2, 15}));
+    swap(v[1], v[2]);
+    BOOST_TEST(to_vector(v) == std::vector<int>({15, 2, 3, 15}));
+
+    nibbles const & cv = v;
+    BOOST_TEST(cv.at(2) == 3);
+    BOOST_TEST(std::vector<int>(cv.rbegin(), cv.rend()) ==
+               std::vector<int>({15, 3, 2, 15}));
+    BOOST_TEST(nibbles({1, 2}) < nibbles({1, 3}));
+    BOOST_TEST(bsi::count(cv.begin(), cv.end(), 15) == 2);
+}
+
+{
+    nibbles a(5, 7);
+    nibbles b(a);
+    BOOST_TEST(a == b);
+    nibbles c(std::move(b));
+    BOOST_TEST(b.empty());
+    BOOST_TEST(c == a);
+    b = c;
+    BOOST_TEST(b == a);
+    c = nibbles();
+    BOOST_TEST(c.empty());
+    swap(a, c);
+    BOOST_TEST(a.empty());
+    BOOST_TEST(c == b);
+
+    c.reserve(1000);
+    BOOST_TEST(1000u <= c.capacity());
+    BOOST_TEST(to_vector(c) == std::vector<int>(5, 7));
+    c.shrink_to_fit();
+    BOOST_TEST(c.size() <= c.max_size());
+}
+
+    check_modifiers<1>();
+    check_modifiers<2>();
+    check_modifiers<4>();
+    check_modifiers<8>();
+    check_modifiers<16>();
+    check_modifiers<64>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,230 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/pooled_list.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+namespace bsi = boost::stl_interfaces;
+
+using list_type = bsi::pooled_list<int>;
+
+static_assert(
+    std::is_same<
+        std::iterator_traits<list_type::iterator>::iterator_category,
+        std::bidirectional_iterator_tag>::value,
+    "");
+static_assert(
+    std::is_convertible<list_type::iterator, list_type::const_iterator>::
+        value,
+    "");
+static_assert(
+    !std::is_convertible<list_type::const_iterator, list_type::iterator>::
+        value,
+    "");
+
+std::vector<int> to_vector(list_type const & l)
+{
+    return std::vector<int>(l.begin(), l.end());
+}
+
+struct throws_on_copy
+{
+    throws_on_copy(int x) : value(x) {}
+    throws_on_copy(throws_on_copy const & other) : value(other.value)
+    {
+        if (value < 0)
+            throw std::runtime_error("copy");
+    }
+    int value;
+};
+
+
+int main()
+{
+
+{
+    list_type l;
+    BOOST_TEST(l.empty());
+    BOOST_TEST(l.begin() == l.end());
+
+    l.push_back(2);
+    l.push_front(1);
+    l.emplace_back(4);
+    auto it = l.insert(std::prev(l.end()), 3);
+    BOOST_TEST(*it == 3);
+    BOOST_TEST(l.size() == 4u);
+    BOOST_TEST(to_vector(l) == std::vector<int>({1, 2, 3, 4}));
+    BOOST_TEST(l.front() == 1);
+    BOOST_TEST(l.back() == 4);
+
+    it = l.insert(l.begin(), {-1, 0});
+    BOOST_TEST(*it == -1);
+    l.insert(l.end(), 2, 5);
+    BOOST_TEST(to_vector(l) == std::vector<int>({-1, 0, 1, 2, 3, 4, 5, 5}));
+
+    it = l.erase(std::next(l.begin()));
+    BOOST_TEST(*it == 1);
+    it = l.erase(it, std::next(it, 3));
+    BOOST_TEST(*it == 4);
+    l.pop_front();
+    l.pop_back();
+    BOOST_TEST(to_vector(l) == std::vector<int>({4, 5}));
+
+    list_type const & cl = l;
+    BOOST_TEST(std::vector<int>(cl.rbegin(), cl.rend()) ==
+               std::vector<int>({5, 4}));
+
+    l.resize(4);
+    BOOST_TEST(to_vector(l) == std::vector<int>({4, 5, 0, 0}));
+    l.resize(1);
+    BOOST_TEST(to_vector(l) == std::vector<int>({4}));
+    l.resize(3, 7);
+    BOOST_TEST(to_vector(l) == std::vector<int>({4, 7, 7}));
+    l.clear();
+    BOOST_TEST(l.empty());
+
+    l.assign({1, 2, 3});
+    BOOST_TEST(to_vector(l) == std::vector<int>({1, 2, 3}));
+}
+
+{
+    // Construction and assignment.
+    list_type a(3);
+    BOOST_TEST(to_vector(a) == std::vector<int>({0, 0, 0}));
+    list_type b(2, 9);
+    BOOST_TEST(to_vector(b) == std::vector<int>({9, 9}));
+    std::vector<int> const v = {1, 2, 3, 4};
+    list_type c(v.begin(), v.end());
+    BOOST_TEST(to_vector(c) == v);
+
+    list_type d = c;
+    BOOST_TEST(d == c);
+    d = b;
+    BOOST_TEST(d == b);
+    d = c;
+    BOOST_TEST(d == c);
+    d = list_type();
+    BOOST_TEST(d.empty());
+
+    list_type e(std::move(c));
+    BOOST_TEST(c.empty());
+    BOOST_TEST(to_vector(e) == v);
+    c = std::move(e);
+    BOOST_TEST(to_vector(c) == v);
+    BOOST_TEST(e.empty());
+    e.push_back(1);
+    BOOST_TEST(e.size() == 1u);
+
+    swap(b, c);
+    BOOST_TEST(to_vector(b) == v);
+    BOOST_TEST(to_vector(c) == std::vector<int>({9, 9}));
+    b.swap(c);
+    BOOST_TEST(to_vector(c) == v);
+    BOOST_TEST(c < b);
+}
+
+{
+    // Erased nodes go back to the pool.
+    list_type::pool_type pool;
+    list_type l(pool);
+    for (int i = 0; i < 100; ++i) {
+        l.push_back(i);
+    }
+    auto const capacity = pool.capacity();
+    BOOST_TEST(100u <= capacity);
+    for (int round = 0; round < 10; ++round) {
+        l.erase(l.begin(), std::next(l.begin(), 50));
+        for (int i = 0; i < 50; ++i) {
+            l.push_back(i);
+        }
+    }
+    BOOST_TEST(l.size() == 100u);
+    BOOST_TEST(pool.capacity() == capacity);
+
+    pool.reserve(1000);
+    BOOST_TEST(1000u <= pool.capacity());
+}
+
+{
+    // Lists that share a pool splice in constant time.
+    list_type::pool_type pool;
+    list_type a(pool);
+    list_type b(pool);
+    a.insert(a.end(), {1, 2, 3});
+    b.insert(b.end(), {4, 5, 6});
+    int const * const four = &b.front();
+
+    a.splice(std::next(a.begin()), b);
+    BOOST_TEST(to_vector(a) == std::vector<int>({1, 4, 5, 6, 2, 3}));
+    BOOST_TEST(b.empty());
+    BOOST_TEST(&*std::next(a.begin()) == four);
+
+    b.splice(b.end(), a, std::next(a.begin()));
+    BOOST_TEST(to_vector(b) == std::vector<int>({4}));
+    BOOST_TEST(&b.front() == four);
+    BOOST_TEST(a.size() == 5u);
+
+    b.splice(b.begin(), a, a.begin(), std::next(a.begin(), 2));
+    BOOST_TEST(to_vector(a) == std::vector<int>({6, 2, 3}));
+    BOOST_TEST(to_vector(b) == std::vector<int>({1, 5, 4}));
+
+    a.splice(a.begin(), a, std::prev(a.end()));
+    BOOST_TEST(to_vector(a) == std::vector<int>({3, 6, 2}));
+
+    // A copy of a list that shares a pool shares it too.
+    list_type c = a;
+    c.splice(c.end(), b);
+    BOOST_TEST(to_vector(c) == std::vector<int>({3, 6, 2, 1, 5, 4}));
+
+    // An empty default-constructed list picks up the shared pool.
+    list_type d;
+    d.splice(d.end(), c, c.begin());
+    BOOST_TEST(to_vector(d) == std::vector<int>({3}));
+}
+
+{
+    // Lists with their own pools splice by moving the elements.
+    bsi::pooled_list<std::unique_ptr<int>> a;
+    bsi::pooled_list<std::unique_ptr<int>> b;
+    a.emplace_back(new int(1));
+    b.emplace_back(new int(2));
+    b.emplace_back(new int(3));
+    a.splice(a.end(), b);
+    BOOST_TEST(a.size() == 3u);
+    BOOST_TEST(b.empty());
+    BOOST_TEST(*a.back() == 3);
+    b.splice(b.begin(), a, a.begin());
+    BOOST_TEST(*b.front() == 1);
+    BOOST_TEST(a.size() == 2u);
+}
+
+{
+    // Strong guarantee for range insertion.
+    bsi::pooled_list<throws_on_copy> l;
+    l.emplace_back(1);
+    std::vector<throws_on_copy> v;
+    v.reserve(4);
+    for (int x : {2, 3, -1, 4}) {
+        v.emplace_back(x);
+    }
+    BOOST_TEST_THROWS(
+        l.insert(l.end(), v.begin(), v.end()), std::runtime_error);
+    BOOST_TEST(l.size() == 1u);
+    BOOST_TEST(l.front().value == 1);
+
+    bsi::pooled_list<std::string> strings = {"a", "b"};
+    strings.front() += "c";
+    BOOST_TEST(strings.front() == "ac");
+}
+
+    return boost::report_errors();
+}
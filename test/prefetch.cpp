@@ -0,0 +1,169 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/algorithm.hpp>
+#include <boost/stl_interfaces/iterator_interface.hpp>
+#include <boost/stl_interfaces/views.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <list>
+#include <string>
+#include <vector>
+
+
+namespace stl_interfaces = boost::stl_interfaces;
+
+// A singly-linked list node that also points jump_distance nodes ahead.
+struct node
+{
+    int value_;
+    node * next_;
+    node * jump_;
+};
+
+constexpr int jump_distance = 4;
+
+int prefetches = 0;
+
+struct jump_iterator : stl_interfaces::iterator_interface<
+                           jump_iterator,
+                           std::forward_iterator_tag,
+                           int>
+{
+    jump_iterator() = default;
+    explicit jump_iterator(node * n) : it_(n) {}
+
+    int & operator*() const { return it_->value_; }
+    jump_iterator & operator++()
+    {
+        it_ = it_->next_;
+        return *this;
+    }
+    friend bool operator==(jump_iterator lhs, jump_iterator rhs)
+    {
+        return lhs.it_ == rhs.it_;
+    }
+
+    using base_type = stl_interfaces::
+        iterator_interface<jump_iterator, std::forward_iterator_tag, int>;
+    using base_type::operator++;
+
+private:
+    friend stl_interfaces::access;
+
+    node const * prefetch_address() const
+    {
+        ++prefetches;
+        return it_->jump_;
+    }
+
+    node * it_ = nullptr;
+};
+
+static_assert(stl_interfaces::v1_dtl::prefetch_hook<jump_iterator>::value, "");
+static_assert(
+    !stl_interfaces::v1_dtl::prefetch_hook<std::list<int>::iterator>::value,
+    "");
+
+// The values 0, 1, ... n - 1, linked in that order through nodes that are
+// scattered around the vector.
+std::vector<node> make_list(int n)
+{
+    std::vector<node> result(n);
+    std::vector<node *> order;
+    for (int i = 0; i < n; ++i) {
+        order.push_back(&result[(i * 7) % n]);
+    }
+    for (int i = 0; i < n; ++i) {
+        order[i]->value_ = i;
+        order[i]->next_ = i + 1 < n ? order[i + 1] : nullptr;
+        order[i]->jump_ =
+            i + jump_distance < n ? order[i + jump_distance] : nullptr;
+    }
+    return result;
+}
+
+jump_iterator head(std::vector<node> & nodes)
+{
+    for (auto & n : nodes) {
+        if (n.value_ == 0)
+            return jump_iterator(&n);
+    }
+    return jump_iterator();
+}
+
+
+int main()
+{
+
+{
+    auto nodes = make_list(20);
+    auto const first = head(nodes);
+    jump_iterator const last;
+
+    prefetches = 0;
+    int sum = 0;
+    stl_interfaces::for_each(first, last, [&](int x) { sum += x; });
+    BOOST_TEST(sum == 190);
+    BOOST_TEST(prefetches == 20);
+
+    prefetches = 0;
+    auto const it = stl_interfaces::find(first, last, 12);
+    BOOST_TEST(it != last && *it == 12);
+    BOOST_TEST(std::distance(first, it) == 12);
+    BOOST_TEST(prefetches == 13);
+    BOOST_TEST(stl_interfaces::find(first, last, 20) == last);
+    BOOST_TEST(stl_interfaces::find(last, last, 0) == last);
+
+    prefetches = 0;
+    BOOST_TEST(stl_interfaces::accumulate(first, last, 0) == 190);
+    BOOST_TEST(prefetches == 20);
+    BOOST_TEST(
+        stl_interfaces::accumulate(
+            first, std::next(first, 5), 1, std::multiplies<>()) == 0);
+    BOOST_TEST(
+        stl_interfaces::accumulate(
+            std::next(first), std::next(first, 5), 1, std::multiplies<>()) ==
+        24);
+    BOOST_TEST(stl_interfaces::accumulate(last, last, 7) == 7);
+}
+
+{
+    // Without the hook, or for a segmented iterator.
+    std::list<int> const l = {1, 2, 3};
+    BOOST_TEST(stl_interfaces::accumulate(l.begin(), l.end(), 0) == 6);
+    std::vector<std::string> const strings = {"a", "b", "c"};
+    BOOST_TEST(
+        stl_interfaces::accumulate(
+            strings.begin(), strings.end(), std::string("x")) == "xabc");
+
+    std::vector<int> a = {1, 2, 3};
+    std::vector<int> b;
+    std::vector<int> c = {4, 5};
+    auto cat = stl_interfaces::views::concat(a, b, c);
+    BOOST_TEST(stl_interfaces::accumulate(cat.begin(), cat.end(), 0) == 15);
+    BOOST_TEST(
+        stl_interfaces::accumulate(
+            std::next(cat.begin()),
+            std::next(cat.begin(), 4),
+            std::string(),
+            [](std::string s, int x) { return s + std::to_string(x); }) ==
+        "234");
+
+    // A stateful operation is not copied from segment to segment.
+    int calls = 0;
+    auto counting_plus = [&calls](int x, int y) {
+        ++calls;
+        return x + y;
+    };
+    BOOST_TEST(
+        stl_interfaces::accumulate(
+            cat.begin(), cat.end(), 0, counting_plus) == 15);
+    BOOST_TEST(calls == 5);
+}
+
+    return boost::report_errors();
+}
@@ -44,6 +44,56 @@ private:
     int * it2_;
 };
 
+// A bidirectional iterator that knows its position, like an iterator into an
+// indexed skip list, and so can compute distances and advance in constant
+// time.  Single steps are counted, so the tests can tell that the hooks were
+// used.
+int sized_steps = 0;
+
+struct sized_bidi_iter : boost::stl_interfaces::iterator_interface<
+                             sized_bidi_iter,
+                             std::bidirectional_iterator_tag,
+                             int>
+{
+    sized_bidi_iter() : it_(nullptr) {}
+    sized_bidi_iter(int * it) : it_(it) {}
+
+    int & operator*() const { return *it_; }
+    sized_bidi_iter & operator++()
+    {
+        ++sized_steps;
+        ++it_;
+        return *this;
+    }
+    sized_bidi_iter & operator--()
+    {
+        ++sized_steps;
+        --it_;
+        return *this;
+    }
+    friend bool operator==(sized_bidi_iter lhs, sized_bidi_iter rhs)
+    {
+        return lhs.it_ == rhs.it_;
+    }
+
+    using base_type = boost::stl_interfaces::iterator_interface<
+        sized_bidi_iter,
+        std::bidirectional_iterator_tag,
+        int>;
+    using base_type::operator++;
+    using base_type::operator--;
+
+private:
+    friend boost::stl_interfaces::access;
+    std::ptrdiff_t distance_to(sized_bidi_iter other) const
+    {
+        return other.it_ - it_;
+    }
+    void advance(std::ptrdiff_t n) { it_ += n; }
+
+    int * it_;
+};
+
 
 int main()
 {
@@ -239,5 +289,36 @@ int main()
     }
 }
 
+{
+    std::array<int, 10> ints = {{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}};
+    sized_bidi_iter const first(ints.data());
+    sized_bidi_iter const last(ints.data() + ints.size());
+
+    // iterator_interface provides operator-() and operator+=() in terms of
+    // the hooks.
+    BOOST_TEST(last - first == 10);
+    BOOST_TEST(first - last == -10);
+    sized_bidi_iter it = first;
+    it += 7;
+    BOOST_TEST(*it == 7);
+    it -= 3;
+    BOOST_TEST(*it == 4);
+    BOOST_TEST(*(it + 2) == 6);
+    BOOST_TEST(sized_steps == 0);
+
+    auto rfirst = boost::stl_interfaces::make_reverse_iterator(last);
+    auto rlast = boost::stl_interfaces::make_reverse_iterator(first);
+    BOOST_TEST(rlast - rfirst == 10);
+    BOOST_TEST(rfirst - rlast == -10);
+    auto rit = rfirst;
+    rit += 3;
+    auto rit2 = rit - 2;
+    BOOST_TEST(sized_steps == 0);
+    // Dereferencing a reverse_iterator steps a copy of its base back once.
+    BOOST_TEST(*rit == 6);
+    BOOST_TEST(*rit2 == 8);
+    BOOST_TEST(std::equal(rfirst, rlast, ints.rbegin(), ints.rend()));
+}
+
     return boost::report_errors();
 }
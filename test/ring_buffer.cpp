@@ -0,0 +1,224 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/ring_buffer.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+namespace bsi = boost::stl_interfaces;
+
+using ring_type = bsi::ring_buffer<int, 5>;
+
+static_assert(
+    std::is_same<
+        std::iterator_traits<ring_type::iterator>::iterator_category,
+        std::random_access_iterator_tag>::value,
+    "");
+static_assert(
+    std::is_convertible<ring_type::iterator, ring_type::const_iterator>::
+        value,
+    "");
+static_assert(
+    !std::is_convertible<ring_type::const_iterator, ring_type::iterator>::
+        value,
+    "");
+#if 201703L < __cplusplus && defined(__cpp_lib_concepts)
+static_assert(std::random_access_iterator<ring_type::iterator>);
+static_assert(std::ranges::random_access_range<ring_type>);
+#endif
+
+std::vector<int> to_vector(ring_type const & r)
+{
+    return std::vector<int>(r.begin(), r.end());
+}
+
+
+int main()
+{
+
+{
+    ring_type r;
+    BOOST_TEST(r.empty());
+    BOOST_TEST(r.size() == 0u);
+    BOOST_TEST(r.capacity() == 5u);
+    BOOST_TEST(r.max_size() == 5u);
+    BOOST_TEST(r.begin() == r.end());
+
+    r.push_back(2);
+    r.push_back(3);
+    r.push_front(1);
+    r.push_front(0);
+    BOOST_TEST(r.size() == 4u);
+    BOOST_TEST(r.front() == 0);
+    BOOST_TEST(r.back() == 3);
+    BOOST_TEST(r[2] == 2);
+    BOOST_TEST(r.at(3) == 3);
+    BOOST_TEST_THROWS(r.at(4), std::out_of_range);
+    BOOST_TEST(to_vector(r) == std::vector<int>({0, 1, 2, 3}));
+
+    r.push_back(4);
+    BOOST_TEST(r.full());
+    BOOST_TEST_THROWS(r.push_back(5), std::length_error);
+    BOOST_TEST_THROWS(r.push_front(5), std::length_error);
+    BOOST_TEST(to_vector(r) == std::vector<int>({0, 1, 2, 3, 4}));
+}
+
+{
+    // Use as a FIFO, which walks the elements around the storage.
+    ring_type r;
+    int next_in = 0;
+    int next_out = 0;
+    for (int i = 0; i < 50; ++i) {
+        while (!r.full()) {
+            r.push_back(next_in++);
+        }
+        for (int j = 0; j < 3; ++j) {
+            BOOST_TEST(r.front() == next_out++);
+            r.pop_front();
+        }
+        std::vector<int> expected(r.size());
+        std::iota(expected.begin(), expected.end(), next_out);
+        BOOST_TEST(to_vector(r) == expected);
+        BOOST_TEST(r.end() - r.begin() == std::ptrdiff_t(r.size()));
+    }
+}
+
+{
+    // Random access iteration across the wraparound point.
+    ring_type r = {0, 0, 0};
+    r.pop_front();
+    r.pop_front();
+    r.push_back(5);
+    r.push_back(1);
+    r.push_back(4);
+    r.push_back(2);
+    BOOST_TEST(to_vector(r) == std::vector<int>({0, 5, 1, 4, 2}));
+
+    std::sort(r.begin(), r.end());
+    BOOST_TEST(to_vector(r) == std::vector<int>({0, 1, 2, 4, 5}));
+    BOOST_TEST(std::binary_search(r.begin(), r.end(), 4));
+
+    auto it = r.begin() + 4;
+    BOOST_TEST(*it == 5);
+    BOOST_TEST(it[-3] == 1);
+    BOOST_TEST(r.begin() < it);
+    BOOST_TEST(*--it == 4);
+
+    std::vector<int> reversed(r.rbegin(), r.rend());
+    BOOST_TEST(reversed == std::vector<int>({5, 4, 2, 1, 0}));
+
+    ring_type const & cr = r;
+    ring_type::const_iterator cit = r.begin();
+    BOOST_TEST(cit == cr.begin());
+    BOOST_TEST(cr.end() - cit == 5);
+}
+
+{
+    // Insertion and erasure in the middle.
+    ring_type r = {0, 0, 1, 4};
+    r.pop_front();
+    auto it = r.insert(r.begin() + 2, {2, 3});
+    BOOST_TEST(*it == 2);
+    BOOST_TEST(to_vector(r) == std::vector<int>({0, 1, 2, 3, 4}));
+
+    it = r.erase(r.begin() + 1, r.begin() + 3);
+    BOOST_TEST(*it == 3);
+    BOOST_TEST(to_vector(r) == std::vector<int>({0, 3, 4}));
+
+    it = r.emplace(r.begin() + 1, 2);
+    BOOST_TEST(*it == 2);
+    it = r.emplace(r.begin() + 1, r.back());
+    BOOST_TEST(*it == 4);
+    BOOST_TEST(to_vector(r) == std::vector<int>({0, 4, 2, 3, 4}));
+    BOOST_TEST_THROWS(r.insert(r.begin() + 1, 9), std::length_error);
+    BOOST_TEST(to_vector(r) == std::vector<int>({0, 4, 2, 3, 4}));
+
+    r.erase(r.begin(), r.begin() + 2);
+    BOOST_TEST(to_vector(r) == std::vector<int>({2, 3, 4}));
+    r.erase(r.end() - 1);
+    BOOST_TEST(to_vector(r) == std::vector<int>({2, 3}));
+
+    // An insertion that does not fit leaves the buffer unchanged.
+    std::vector<int> const too_many = {5, 6, 7, 8};
+    BOOST_TEST_THROWS(
+        r.insert(r.begin(), too_many.begin(), too_many.end()),
+        std::length_error);
+    BOOST_TEST(to_vector(r) == std::vector<int>({2, 3}));
+
+    r.resize(4, 9);
+    BOOST_TEST(to_vector(r) == std::vector<int>({2, 3, 9, 9}));
+    r.resize(1);
+    BOOST_TEST(to_vector(r) == std::vector<int>({2}));
+    BOOST_TEST_THROWS(r.resize(6), std::length_error);
+    r.clear();
+    BOOST_TEST(r.empty());
+}
+
+{
+    // Copying, moving, swapping, and comparison.
+    ring_type a = {1, 2, 3};
+    a.pop_front();
+    a.push_back(4);
+    ring_type b = a;
+    BOOST_TEST(b == a);
+    BOOST_TEST(to_vector(b) == std::vector<int>({2, 3, 4}));
+
+    b.push_front(1);
+    BOOST_TEST(!(a < b));
+    BOOST_TEST(b < a);
+    BOOST_TEST(a != b);
+
+    ring_type c = std::move(b);
+    BOOST_TEST(b.empty());
+    BOOST_TEST(to_vector(c) == std::vector<int>({1, 2, 3, 4}));
+
+    swap(a, c);
+    BOOST_TEST(to_vector(a) == std::vector<int>({1, 2, 3, 4}));
+    BOOST_TEST(to_vector(c) == std::vector<int>({2, 3, 4}));
+
+    c = a;
+    BOOST_TEST(c == a);
+    a = {7};
+    BOOST_TEST(to_vector(a) == std::vector<int>({7}));
+    a.assign(2, 8);
+    BOOST_TEST(to_vector(a) == std::vector<int>({8, 8}));
+}
+
+{
+    // Elements are constructed and destroyed exactly once.
+    auto const counter = std::make_shared<int>(0);
+    {
+        bsi::ring_buffer<std::shared_ptr<int>, 3> r;
+        for (int i = 0; i < 10; ++i) {
+            r.push_back(counter);
+            if (r.full())
+                r.pop_front();
+        }
+        BOOST_TEST(counter.use_count() == 3);
+        r.insert(r.begin() + 1, counter);
+        BOOST_TEST(counter.use_count() == 4);
+        r.erase(r.begin() + 1);
+        BOOST_TEST(counter.use_count() == 3);
+    }
+    BOOST_TEST(counter.use_count() == 1);
+
+    bsi::ring_buffer<std::string, 2> strings;
+    strings.emplace_back(3, 'a');
+    strings.emplace_front("b");
+    BOOST_TEST(strings.front() == "b");
+    BOOST_TEST(strings.back() == "aaa");
+    BOOST_TEST(strings.begin()->size() == 1u);
+}
+
+    return boost::report_errors();
+}
@@ -0,0 +1,337 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/algorithm.hpp>
+#include <boost/stl_interfaces/iterator_interface.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <list>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+
+// A log buffer made of a linked list of fixed-size chunks.  Every chunk but
+// the last is full, and the end iterator is the last chunk's local end.
+struct chunk
+{
+    static constexpr int capacity = 4;
+
+    int * begin() { return data; }
+    int * end() { return data + size; }
+
+    int data[capacity];
+    int size = 0;
+    chunk * next = nullptr;
+};
+
+struct chunk_iterator : boost::stl_interfaces::iterator_interface<
+                            chunk_iterator,
+                            std::forward_iterator_tag,
+                            chunk>
+{
+    chunk_iterator() = default;
+    chunk_iterator(chunk * c) : c_(c) {}
+
+    chunk & operator*() const { return *c_; }
+    chunk_iterator & operator++()
+    {
+        c_ = c_->next;
+        return *this;
+    }
+    friend bool operator==(chunk_iterator lhs, chunk_iterator rhs)
+    {
+        return lhs.c_ == rhs.c_;
+    }
+
+    using base_type = boost::stl_interfaces::
+        iterator_interface<chunk_iterator, std::forward_iterator_tag, chunk>;
+    using base_type::operator++;
+
+private:
+    chunk * c_ = nullptr;
+};
+
+// Counts element-wise increments, so the tests can tell whether an algorithm
+// went through the segmented path.
+int log_increments = 0;
+
+struct log_iterator : boost::stl_interfaces::iterator_interface<
+                          log_iterator,
+                          std::forward_iterator_tag,
+                          int>
+{
+    using segment_iterator = chunk_iterator;
+    using local_iterator = int *;
+
+    log_iterator() = default;
+    log_iterator(chunk * c, int * p) : c_(c), p_(p) {}
+
+    int & operator*() const { return *p_; }
+    log_iterator & operator++()
+    {
+        ++log_increments;
+        ++p_;
+        normalize();
+        return *this;
+    }
+    friend bool operator==(log_iterator lhs, log_iterator rhs)
+    {
+        return lhs.p_ == rhs.p_;
+    }
+
+    using base_type = boost::stl_interfaces::
+        iterator_interface<log_iterator, std::forward_iterator_tag, int>;
+    using base_type::operator++;
+
+private:
+    friend boost::stl_interfaces::access;
+
+    void normalize()
+    {
+        if (p_ == c_->end() && c_->next) {
+            c_ = c_->next;
+            p_ = c_->begin();
+        }
+    }
+
+    segment_iterator segment() const { return c_; }
+    local_iterator local() const { return p_; }
+    static local_iterator local_begin(segment_iterator s)
+    {
+        return (*s).begin();
+    }
+    static local_iterator local_end(segment_iterator s) { return (*s).end(); }
+    static log_iterator compose(segment_iterator s, local_iterator p)
+    {
+        log_iterator retval(&*s, p);
+        retval.normalize();
+        return retval;
+    }
+
+    chunk * c_ = nullptr;
+    int * p_ = nullptr;
+};
+
+struct log_buffer
+{
+    log_buffer() { chunks_.push_back(std::make_unique<chunk>()); }
+
+    void push_back(int x)
+    {
+        if (chunks_.back()->size == chunk::capacity) {
+            chunks_.push_back(std::make_unique<chunk>());
+            chunks_[chunks_.size() - 2]->next = chunks_.back().get();
+        }
+        chunk & c = *chunks_.back();
+        c.data[c.size++] = x;
+    }
+
+    log_iterator begin() const
+    {
+        chunk * c = chunks_.front().get();
+        return log_iterator(c, c->begin());
+    }
+    log_iterator end() const
+    {
+        chunk * c = chunks_.back().get();
+        return log_iterator(c, c->end());
+    }
+
+private:
+    std::vector<std::unique_ptr<chunk>> chunks_;
+};
+
+static_assert(
+    boost::stl_interfaces::is_segmented_iterator<log_iterator>::value, "");
+static_assert(
+    !boost::stl_interfaces::is_segmented_iterator<chunk_iterator>::value, "");
+static_assert(!boost::stl_interfaces::is_segmented_iterator<int *>::value, "");
+static_assert(
+    !boost::stl_interfaces::is_segmented_iterator<
+        std::list<int>::iterator>::value,
+    "");
+static_assert(
+    std::is_same<
+        boost::stl_interfaces::segmented_iterator_traits<
+            log_iterator>::local_iterator,
+        int *>::value,
+    "");
+
+
+// A plain random access iterator, with no hooks.
+struct int_iterator : boost::stl_interfaces::iterator_interface<
+                          int_iterator,
+                          std::random_access_iterator_tag,
+                          int>
+{
+    int_iterator() = default;
+    explicit int_iterator(int * it) : it_(it) {}
+
+    int & operator*() const { return *it_; }
+    int_iterator & operator+=(std::ptrdiff_t i)
+    {
+        it_ += i;
+        return *this;
+    }
+    friend std::ptrdiff_t operator-(int_iterator lhs, int_iterator rhs)
+    {
+        return lhs.it_ - rhs.it_;
+    }
+
+private:
+    int * it_ = nullptr;
+};
+
+
+log_buffer make_buffer(int n)
+{
+    log_buffer retval;
+    for (int i = 0; i < n; ++i) {
+        retval.push_back(i);
+    }
+    return retval;
+}
+
+log_iterator nth(log_buffer const & b, int n)
+{
+    auto retval = b.begin();
+    for (int i = 0; i < n; ++i) {
+        ++retval;
+    }
+    return retval;
+}
+
+
+int main()
+{
+
+{
+    log_buffer b = make_buffer(11);
+    std::vector<int> const expected = [] {
+        std::vector<int> retval(11);
+        std::iota(retval.begin(), retval.end(), 0);
+        return retval;
+    }();
+    std::vector<int> const flat(b.begin(), b.end());
+    BOOST_TEST(flat == expected);
+
+    log_increments = 0;
+    std::vector<int> copied;
+    boost::stl_interfaces::copy(
+        b.begin(), b.end(), std::back_inserter(copied));
+    BOOST_TEST(copied == expected);
+    int sum = 0;
+    boost::stl_interfaces::for_each(
+        b.begin(), b.end(), [&](int x) { sum += x; });
+    BOOST_TEST(sum == 55);
+    BOOST_TEST(
+        boost::stl_interfaces::find(b.begin(), b.end(), 9) == nth(b, 9));
+    log_increments = 0;
+    BOOST_TEST(
+        boost::stl_interfaces::find(b.begin(), b.end(), 42) == b.end());
+    boost::stl_interfaces::fill(b.begin(), b.end(), 3);
+    BOOST_TEST(log_increments == 0);
+    BOOST_TEST(
+        std::vector<int>(b.begin(), b.end()) == std::vector<int>(11, 3));
+}
+
+// Every subrange of buffers with zero, one, and several chunks, including
+// ones that start or end on chunk boundaries.
+for (int n : {0, 1, 3, 4, 5, 8, 11}) {
+    for (int i = 0; i <= n; ++i) {
+        for (int j = i; j <= n; ++j) {
+            log_buffer b = make_buffer(n);
+            log_iterator const first = nth(b, i);
+            log_iterator const last = nth(b, j);
+            log_increments = 0;
+
+            std::vector<int> copied;
+            boost::stl_interfaces::copy(
+                first, last, std::back_inserter(copied));
+            std::vector<int> expected(j - i);
+            std::iota(expected.begin(), expected.end(), i);
+            BOOST_TEST(copied == expected);
+
+            std::vector<int> visited;
+            boost::stl_interfaces::for_each(
+                first, last, [&](int x) { visited.push_back(x); });
+            BOOST_TEST(visited == expected);
+
+            for (int x = -1; x <= n; ++x) {
+                log_iterator const it =
+                    boost::stl_interfaces::find(first, last, x);
+                if (i <= x && x < j) {
+                    BOOST_TEST(it == nth(b, x));
+                    BOOST_TEST(*it == x);
+                } else {
+                    BOOST_TEST(it == last);
+                }
+                log_increments = 0;
+            }
+
+            BOOST_TEST(
+                boost::stl_interfaces::count(first, last, i) == (i < j));
+            BOOST_TEST(log_increments == 0);
+
+            boost::stl_interfaces::fill(first, last, -1);
+            BOOST_TEST(log_increments == 0);
+            int k = 0;
+            for (int x : b) {
+                BOOST_TEST(x == (i <= k && k < j ? -1 : k));
+                ++k;
+            }
+        }
+    }
+}
+
+// Non-segmented iterators are forwarded to the std algorithms.
+{
+    std::list<int> l = {1, 2, 3, 4};
+    int sum = 0;
+    boost::stl_interfaces::for_each(
+        l.begin(), l.end(), [&](int x) { sum += x; });
+    BOOST_TEST(sum == 10);
+    BOOST_TEST(
+        boost::stl_interfaces::find(l.begin(), l.end(), 3) ==
+        std::next(l.begin(), 2));
+    BOOST_TEST(boost::stl_interfaces::count(l.begin(), l.end(), 3) == 1);
+
+    int arr[4] = {};
+    boost::stl_interfaces::copy(l.begin(), l.end(), arr);
+    BOOST_TEST(arr[3] == 4);
+    boost::stl_interfaces::fill(arr, arr + 4, 7);
+    BOOST_TEST(arr[0] == 7 && arr[3] == 7);
+}
+
+// The algorithms are not found by argument-dependent lookup, so unqualified
+// calls that mix these iterators with std ones, or that follow a using
+// declaration of the std algorithm, are not ambiguous.
+{
+    using std::count;
+    using std::fill;
+    using std::find;
+
+    int a[] = {1, 2, 3};
+    std::vector<int> v(3);
+    copy(int_iterator(a), int_iterator(a + 3), v.begin());
+    BOOST_TEST(v == (std::vector<int>{1, 2, 3}));
+    fill(int_iterator(a), int_iterator(a + 3), 4);
+    BOOST_TEST(a[0] == 4 && a[2] == 4);
+    BOOST_TEST(
+        find(int_iterator(a), int_iterator(a + 3), 4) == int_iterator(a));
+    BOOST_TEST(count(int_iterator(a), int_iterator(a + 3), 4) == 3);
+
+    log_buffer b = make_buffer(6);
+    std::vector<int> out(6);
+    copy(b.begin(), b.end(), out.begin());
+    BOOST_TEST(out == (std::vector<int>{0, 1, 2, 3, 4, 5}));
+    fill(b.begin(), b.end(), 0);
+    BOOST_TEST(find(b.begin(), b.end(), 1) == b.end());
+}
+
+    return boost::report_errors();
+}
@@ -0,0 +1,289 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/slot_map.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+namespace bsi = boost::stl_interfaces;
+
+using map_type = bsi::slot_map<int>;
+
+static_assert(
+    std::is_same<
+        std::iterator_traits<map_type::iterator>::iterator_category,
+        std::bidirectional_iterator_tag>::value,
+    "");
+static_assert(
+    std::is_convertible<map_type::iterator, map_type::const_iterator>::value,
+    "");
+static_assert(
+    !std::is_convertible<map_type::const_iterator, map_type::iterator>::value,
+    "");
+
+std::vector<int> to_vector(map_type const & m)
+{
+    return std::vector<int>(m.begin(), m.end());
+}
+
+struct counted
+{
+    counted(int x) : value(x) { ++live; }
+    counted(counted const & other) : value(other.value)
+    {
+        if (throw_after && !--throw_after)
+            throw std::runtime_error("copy");
+        ++live;
+    }
+    ~counted() { --live; }
+    int value;
+    static int live;
+    static int throw_after;
+};
+int counted::live = 0;
+int counted::throw_after = 0;
+
+
+int main()
+{
+
+{
+    map_type m;
+    BOOST_TEST(m.empty());
+    BOOST_TEST(m.size() == 0u);
+    BOOST_TEST(m.begin() == m.end());
+    BOOST_TEST(!m.contains(map_type::handle()));
+    BOOST_TEST(m.find(map_type::handle()) == m.end());
+    BOOST_TEST(m.erase(map_type::handle()) == 0u);
+
+    auto const h0 = m.insert(0);
+    auto const h1 = m.emplace(1);
+    auto const h2 = m.insert(2);
+    BOOST_TEST(m.size() == 3u);
+    BOOST_TEST(!m.empty());
+    BOOST_TEST(m[h0] == 0);
+    BOOST_TEST(m[h1] == 1);
+    BOOST_TEST(m.at(h2) == 2);
+    BOOST_TEST(m.front() == 0);
+    BOOST_TEST(m.back() == 2);
+    BOOST_TEST(to_vector(m) == std::vector<int>({0, 1, 2}));
+    BOOST_TEST(*m.find(h1) == 1);
+    BOOST_TEST(m.handle_of(m.find(h1)) == h1);
+
+    BOOST_TEST(m.erase(h1) == 1u);
+    BOOST_TEST(m.erase(h1) == 0u);
+    BOOST_TEST(!m.contains(h1));
+    BOOST_TEST_THROWS(m.at(h1), std::out_of_range);
+    BOOST_TEST(m.contains(h0));
+    BOOST_TEST(m.contains(h2));
+    BOOST_TEST(to_vector(m) == std::vector<int>({0, 2}));
+
+    // The emptied slot is reused, but the old handle stays invalid.
+    auto const h3 = m.insert(3);
+    BOOST_TEST(h3.index == h1.index);
+    BOOST_TEST(h3 != h1);
+    BOOST_TEST(!m.contains(h1));
+    BOOST_TEST(m[h3] == 3);
+    BOOST_TEST(to_vector(m) == std::vector<int>({0, 3, 2}));
+
+    map_type const & cm = m;
+    BOOST_TEST(cm[h0] == 0);
+    BOOST_TEST(cm.at(h2) == 2);
+    BOOST_TEST_THROWS(cm.at(h1), std::out_of_range);
+    BOOST_TEST(*cm.find(h3) == 3);
+    BOOST_TEST(
+        std::vector<int>(cm.rbegin(), cm.rend()) ==
+        std::vector<int>({2, 3, 0}));
+}
+
+{
+    // Handles survive reallocation and arbitrary erasure.
+    map_type m;
+    std::vector<map_type::handle> handles;
+    for (int i = 0; i < 1000; ++i) {
+        handles.push_back(m.insert(i));
+    }
+    BOOST_TEST(1000u <= m.capacity());
+    for (int i = 0; i < 1000; ++i) {
+        if (i % 3 != 0)
+            BOOST_TEST(m.erase(handles[i]) == 1u);
+    }
+    BOOST_TEST(m.size() == 334u);
+    int expected = 0;
+    for (int x : m) {
+        BOOST_TEST(x == expected);
+        expected += 3;
+    }
+    BOOST_TEST(expected == 1002);
+    for (int i = 0; i < 1000; ++i) {
+        BOOST_TEST(m.contains(handles[i]) == (i % 3 == 0));
+    }
+
+    // Iterating backward skips the same holes.
+    std::vector<int> backward;
+    for (auto it = m.end(); it != m.begin();) {
+        backward.push_back(*--it);
+    }
+    BOOST_TEST(backward.size() == 334u);
+    BOOST_TEST(backward.front() == 999);
+    BOOST_TEST(backward.back() == 0);
+
+    // Erase a long run, spanning several bitmap words.
+    for (int i = 0; i < 900; i += 3) {
+        m.erase(handles[i]);
+    }
+    BOOST_TEST(to_vector(m).front() == 900);
+    BOOST_TEST(m.size() == 34u);
+
+    auto const cap = m.capacity();
+    for (int i = 0; i < 966; ++i) {
+        handles.push_back(m.insert(-i));
+    }
+    BOOST_TEST(m.capacity() == cap);
+    BOOST_TEST(m.size() == 1000u);
+    BOOST_TEST(m[handles[999]] == 999);
+    BOOST_TEST(m[handles.back()] == -965);
+}
+
+{
+    // Erasing by iterator.
+    map_type m = {0, 1, 2, 3, 4, 5, 6, 7};
+    auto it = m.erase(std::next(m.begin()));
+    BOOST_TEST(*it == 2);
+    it = m.erase(std::next(it), std::next(it, 4));
+    BOOST_TEST(*it == 6);
+    BOOST_TEST(to_vector(m) == std::vector<int>({0, 2, 6, 7}));
+    it = m.erase(m.begin(), m.end());
+    BOOST_TEST(it == m.end());
+    BOOST_TEST(m.empty());
+
+    m.insert(8);
+    BOOST_TEST(to_vector(m) == std::vector<int>({8}));
+    m.clear();
+    BOOST_TEST(m.empty());
+    BOOST_TEST(m.begin() == m.end());
+}
+
+{
+    // Copies keep handles meaningful; moves keep them valid.
+    map_type m;
+    auto const a = m.insert(1);
+    auto const b = m.insert(2);
+    auto const c = m.insert(3);
+    m.erase(b);
+
+    map_type copy = m;
+    BOOST_TEST(copy == m);
+    BOOST_TEST(copy[a] == 1);
+    BOOST_TEST(copy[c] == 3);
+    BOOST_TEST(!copy.contains(b));
+    auto const d = copy.insert(4);
+    BOOST_TEST(d.index == b.index);
+    BOOST_TEST(copy != m);
+
+    map_type moved = std::move(copy);
+    BOOST_TEST(copy.empty());
+    BOOST_TEST(moved[d] == 4);
+    copy = moved;
+    BOOST_TEST(copy[d] == 4);
+    copy.insert(5);
+    BOOST_TEST(copy.size() == 4u);
+
+    swap(m, moved);
+    BOOST_TEST(m[d] == 4);
+    BOOST_TEST(!moved.contains(d));
+    m.swap(moved);
+    BOOST_TEST(!m.contains(d));
+
+    map_type empty;
+    copy = empty;
+    BOOST_TEST(copy.empty());
+    copy.insert(1);
+    BOOST_TEST(copy.size() == 1u);
+}
+
+{
+    // reserve()
+    map_type m;
+    m.reserve(100);
+    BOOST_TEST(m.capacity() == 100u);
+    BOOST_TEST(m.empty());
+    auto const h = m.insert(42);
+    m.reserve(10);
+    BOOST_TEST(m.capacity() == 100u);
+    m.reserve(1000);
+    BOOST_TEST(m[h] == 42);
+}
+
+{
+    // Inserting an element of the map itself, while reallocating.
+    bsi::slot_map<std::string> m;
+    auto h = m.insert("self");
+    while (m.size() < m.capacity()) {
+        m.insert("filler");
+    }
+    auto const h2 = m.insert(m[h]);
+    BOOST_TEST(m[h2] == "self");
+    BOOST_TEST(m[h] == "self");
+}
+
+{
+    // Move-only elements.
+    bsi::slot_map<std::unique_ptr<int>> m;
+    std::vector<bsi::slot_map_handle> handles;
+    for (int i = 0; i < 20; ++i) {
+        handles.push_back(m.emplace(new int(i)));
+    }
+    BOOST_TEST(*m[handles[13]] == 13);
+    m.erase(m.find(handles[13]));
+    BOOST_TEST(m.size() == 19u);
+}
+
+{
+    // Exception safety and element lifetimes.
+    {
+        bsi::slot_map<counted> m;
+        for (int i = 0; i < 10; ++i) {
+            m.emplace(i);
+        }
+        BOOST_TEST(counted::live == 10);
+        counted::throw_after = 5;
+        BOOST_TEST_THROWS(
+            bsi::slot_map<counted> copy(m), std::runtime_error);
+        counted::throw_after = 0;
+        BOOST_TEST(counted::live == 10);
+        m.erase(m.begin());
+        BOOST_TEST(counted::live == 9);
+    }
+    BOOST_TEST(counted::live == 0);
+}
+
+{
+    // Iteration works with the standard algorithms.
+    map_type m;
+    std::vector<map_type::handle> handles;
+    for (int i = 0; i < 200; ++i) {
+        handles.push_back(m.insert(i));
+    }
+    for (int i = 0; i < 200; i += 2) {
+        m.erase(handles[i]);
+    }
+    BOOST_TEST(std::accumulate(m.begin(), m.end(), 0) == 10000);
+    BOOST_TEST(std::count_if(m.begin(), m.end(), [](int x) {
+                   return x % 2 == 0;
+               }) == 0);
+    BOOST_TEST(*std::find(m.begin(), m.end(), 101) == 101);
+}
+
+    return boost::report_errors();
+}
@@ -0,0 +1,493 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/small_vector.hpp>
+
+#include "ill_formed.hpp"
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+// Instantiate all the members we can.
+template struct boost::stl_interfaces::small_vector<int, 4>;
+
+using vec_type = boost::stl_interfaces::small_vector<int, 4>;
+
+
+// Counts the allocations made through it, so that the tests can tell when
+// small_vector goes to the heap.
+template<typename T>
+struct counting_allocator
+{
+    using value_type = T;
+
+    counting_allocator(int * count) : count_(count) {}
+    template<typename U>
+    counting_allocator(counting_allocator<U> const & other) :
+        count_(other.count_)
+    {}
+
+    T * allocate(std::size_t n)
+    {
+        ++*count_;
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T * p, std::size_t n)
+    {
+        --*count_;
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    friend bool
+    operator==(counting_allocator const & lhs, counting_allocator const & rhs)
+    {
+        return lhs.count_ == rhs.count_;
+    }
+    friend bool
+    operator!=(counting_allocator const & lhs, counting_allocator const & rhs)
+    {
+        return lhs.count_ != rhs.count_;
+    }
+
+    int * count_;
+};
+
+// Throws from its copy constructor after a set number of copies, and has a
+// throwing move constructor, so that small_vector must copy it when
+// reallocating.
+struct throwing_copy
+{
+    throwing_copy(int i) : value_(i) {}
+    throwing_copy(throwing_copy const & other) : value_(other.value_)
+    {
+        if (copies_until_throw == 0)
+            throw std::runtime_error("copy");
+        --copies_until_throw;
+    }
+    throwing_copy & operator=(throwing_copy const & other) = default;
+
+    friend bool operator==(throwing_copy lhs, throwing_copy rhs)
+    {
+        return lhs.value_ == rhs.value_;
+    }
+
+    int value_;
+
+    static int copies_until_throw;
+};
+
+int throwing_copy::copies_until_throw = 1000;
+
+// Counts its live objects, and throws from its assignment operator after a
+// set number of assignments.
+struct throwing_assign
+{
+    throwing_assign(int i) : value_(i) { ++live; }
+    throwing_assign(throwing_assign const & other) : value_(other.value_)
+    {
+        ++live;
+    }
+    ~throwing_assign() { --live; }
+    throwing_assign & operator=(throwing_assign const & other)
+    {
+        if (assignments_until_throw == 0)
+            throw std::runtime_error("assign");
+        --assignments_until_throw;
+        value_ = other.value_;
+        return *this;
+    }
+
+    int value_;
+
+    static int live;
+    static int assignments_until_throw;
+};
+
+int throwing_assign::live = 0;
+int throwing_assign::assignments_until_throw = 1000;
+
+
+void test_default_ctor()
+{
+    vec_type v;
+    BOOST_TEST(v.empty());
+    BOOST_TEST(v.size() == 0u);
+    BOOST_TEST(v.capacity() == 4u);
+    BOOST_TEST(v.is_inline());
+    BOOST_TEST(vec_type::inline_capacity == 4u);
+
+    BOOST_TEST(v == v);
+    BOOST_TEST(v <= v);
+    BOOST_TEST(v >= v);
+
+    BOOST_TEST_THROWS(v.at(0), std::out_of_range);
+
+    vec_type const & cv = v;
+    BOOST_TEST(cv.empty());
+    BOOST_TEST(cv.size() == 0u);
+    BOOST_TEST(cv.begin() == cv.end());
+}
+
+
+void test_other_ctors_assign()
+{
+    {
+        vec_type v(3);
+        BOOST_TEST(v.size() == 3u);
+        BOOST_TEST(v.is_inline());
+        BOOST_TEST(v == vec_type({0, 0, 0}));
+    }
+
+    {
+        vec_type v(6, 4);
+        BOOST_TEST(v.size() == 6u);
+        BOOST_TEST(!v.is_inline());
+        BOOST_TEST(v == vec_type({4, 4, 4, 4, 4, 4}));
+    }
+
+    {
+        std::array<int, 5> a = {{1, 2, 3, 4, 5}};
+        vec_type v(a.begin(), a.end());
+        BOOST_TEST(v.size() == 5u);
+        BOOST_TEST(std::equal(v.begin(), v.end(), a.begin(), a.end()));
+
+        v.assign(3, 7);
+        BOOST_TEST(v == vec_type({7, 7, 7}));
+
+        v.assign({1, 2, 3, 4, 5, 6, 7, 8, 9});
+        BOOST_TEST(v == vec_type({1, 2, 3, 4, 5, 6, 7, 8, 9}));
+
+        v = {1};
+        BOOST_TEST(v == vec_type({1}));
+    }
+}
+
+
+void test_copy_move()
+{
+    // Inline.
+    {
+        vec_type const v = {1, 2, 3};
+
+        vec_type v2(v);
+        BOOST_TEST(v2 == v);
+        BOOST_TEST(v2.is_inline());
+
+        vec_type v3(std::move(v2));
+        BOOST_TEST(v3 == v);
+        BOOST_TEST(v2.empty());
+
+        vec_type v4 = {9, 9, 9, 9, 9, 9};
+        v4 = v3;
+        BOOST_TEST(v4 == v);
+
+        v4 = std::move(v3);
+        BOOST_TEST(v4 == v);
+        BOOST_TEST(v3.empty());
+        BOOST_TEST(v4.is_inline());
+    }
+
+    // Heap.
+    {
+        vec_type const v = {1, 2, 3, 4, 5, 6};
+
+        vec_type v2(v);
+        BOOST_TEST(v2 == v);
+        BOOST_TEST(!v2.is_inline());
+
+        int const * data = v2.data();
+        vec_type v3(std::move(v2));
+        BOOST_TEST(v3 == v);
+        BOOST_TEST(v3.data() == data);
+        BOOST_TEST(v2.empty());
+        BOOST_TEST(v2.is_inline());
+
+        vec_type v4 = {9};
+        v4 = std::move(v3);
+        BOOST_TEST(v4 == v);
+        BOOST_TEST(v4.data() == data);
+        BOOST_TEST(v3.empty());
+
+        v4 = v4;
+        BOOST_TEST(v4 == v);
+    }
+}
+
+
+void test_growth()
+{
+    int allocations = 0;
+    using alloc_type = counting_allocator<std::string>;
+    using string_vec = boost::stl_interfaces::small_vector<std::string, 2, alloc_type>;
+
+    {
+        string_vec v{alloc_type(&allocations)};
+        v.push_back("a");
+        v.push_back("b");
+        BOOST_TEST(allocations == 0);
+        BOOST_TEST(v.is_inline());
+
+        v.push_back("c");
+        BOOST_TEST(allocations == 1);
+        BOOST_TEST(!v.is_inline());
+        BOOST_TEST(v.size() == 3u);
+        BOOST_TEST(v.capacity() == 4u);
+        BOOST_TEST(v[0] == "a");
+        BOOST_TEST(v[1] == "b");
+        BOOST_TEST(v[2] == "c");
+
+        // An argument that refers to an element must survive reallocation.
+        v.push_back(v[0]);
+        v.emplace_back(v[1]);
+        BOOST_TEST(allocations == 1);
+        BOOST_TEST(v.size() == 5u);
+        BOOST_TEST(v[3] == "a");
+        BOOST_TEST(v[4] == "b");
+
+        v.insert(v.begin() + 1, v.back());
+        BOOST_TEST(v.size() == 6u);
+        BOOST_TEST(v[1] == "b");
+        BOOST_TEST(v[2] == "b");
+
+        v.resize(2);
+        v.shrink_to_fit();
+        BOOST_TEST(allocations == 0);
+        BOOST_TEST(v.is_inline());
+        BOOST_TEST(v[0] == "a");
+        BOOST_TEST(v[1] == "b");
+
+        v.reserve(10);
+        BOOST_TEST(allocations == 1);
+        BOOST_TEST(v.capacity() == 10u);
+        BOOST_TEST(v[1] == "b");
+
+        v.resize(12, v[0]);
+        BOOST_TEST(v.size() == 12u);
+        BOOST_TEST(v[11] == "a");
+
+        // resize() grows geometrically, like insert().
+        BOOST_TEST(allocations == 1);
+        BOOST_TEST(v.capacity() == 20u);
+        v.resize(13, v[0]);
+        v.resize(14);
+        BOOST_TEST(allocations == 1);
+        BOOST_TEST(v.capacity() == 20u);
+        v.resize(21);
+        BOOST_TEST(v.capacity() == 40u);
+
+        BOOST_TEST(v.get_allocator() == alloc_type(&allocations));
+    }
+    BOOST_TEST(allocations == 0);
+
+    {
+        vec_type v = {1, 2, 3};
+        v.reserve(2);
+        BOOST_TEST(v.capacity() == 4u);
+        v.shrink_to_fit();
+        BOOST_TEST(v.is_inline());
+        BOOST_TEST(v.max_size() != 0u);
+    }
+}
+
+
+void test_swap()
+{
+    // Inline and inline.
+    {
+        vec_type v1 = {1, 2, 3};
+        vec_type v2 = {4};
+        v1.swap(v2);
+        BOOST_TEST(v1 == vec_type({4}));
+        BOOST_TEST(v2 == vec_type({1, 2, 3}));
+        swap(v1, v2);
+        BOOST_TEST(v1 == vec_type({1, 2, 3}));
+        BOOST_TEST(v2 == vec_type({4}));
+    }
+
+    // Inline and heap.
+    {
+        vec_type v1 = {1, 2, 3};
+        vec_type v2 = {4, 5, 6, 7, 8};
+        int const * data = v2.data();
+        v1.swap(v2);
+        BOOST_TEST(v1 == vec_type({4, 5, 6, 7, 8}));
+        BOOST_TEST(v1.data() == data);
+        BOOST_TEST(v2 == vec_type({1, 2, 3}));
+        BOOST_TEST(v2.is_inline());
+        v1.swap(v2);
+        BOOST_TEST(v1 == vec_type({1, 2, 3}));
+        BOOST_TEST(v2 == vec_type({4, 5, 6, 7, 8}));
+        BOOST_TEST(v2.data() == data);
+    }
+
+    // Heap and heap.
+    {
+        vec_type v1 = {1, 2, 3, 4, 5};
+        vec_type v2 = {6, 7, 8, 9, 10, 11};
+        v1.swap(v2);
+        BOOST_TEST(v1 == vec_type({6, 7, 8, 9, 10, 11}));
+        BOOST_TEST(v2 == vec_type({1, 2, 3, 4, 5}));
+    }
+
+    // Non-trivially relocatable.
+    {
+        using string_vec = boost::stl_interfaces::small_vector<std::string, 2>;
+        string_vec v1 = {"a"};
+        string_vec v2 = {"b", "c", "d"};
+        v1.swap(v2);
+        BOOST_TEST(v1.size() == 3u);
+        BOOST_TEST(v1[2] == "d");
+        BOOST_TEST(v2.size() == 1u);
+        BOOST_TEST(v2[0] == "a");
+        string_vec v3 = {"e", "f"};
+        v2.swap(v3);
+        BOOST_TEST(v2.size() == 2u);
+        BOOST_TEST(v2[1] == "f");
+        BOOST_TEST(v3.size() == 1u);
+        BOOST_TEST(v3[0] == "a");
+    }
+}
+
+
+void test_emplace_insert_erase()
+{
+    {
+        vec_type v = {1, 2};
+        v.emplace(v.begin(), 0);
+        BOOST_TEST(v == vec_type({0, 1, 2}));
+        v.emplace(v.begin() + 2, 9);
+        BOOST_TEST(v == vec_type({0, 1, 9, 2}));
+        v.emplace(v.begin() + 1, 8);
+        BOOST_TEST(v == vec_type({0, 8, 1, 9, 2}));
+        v.emplace(v.end(), v[0]);
+        BOOST_TEST(v == vec_type({0, 8, 1, 9, 2, 0}));
+    }
+
+    {
+        vec_type v = {1, 2};
+        std::array<int, 2> a1 = {{0, 0}};
+        std::array<int, 3> a2 = {{9, 9, 9}};
+
+        auto const it0 = v.insert(v.begin(), a1.begin(), a1.end());
+        BOOST_TEST(v == vec_type({0, 0, 1, 2}));
+        BOOST_TEST(it0 == v.begin());
+        BOOST_TEST(v.is_inline());
+
+        auto const it1 = v.insert(v.begin() + 2, a2.begin(), a2.end());
+        BOOST_TEST(v == vec_type({0, 0, 9, 9, 9, 1, 2}));
+        BOOST_TEST(it1 == v.begin() + 2);
+
+        v.insert(v.end(), 2, 3);
+        BOOST_TEST(v == vec_type({0, 0, 9, 9, 9, 1, 2, 3, 3}));
+
+        v.append_range(a1);
+        BOOST_TEST(v == vec_type({0, 0, 9, 9, 9, 1, 2, 3, 3, 0, 0}));
+
+        v.erase(v.begin() + 2, v.begin() + 5);
+        BOOST_TEST(v == vec_type({0, 0, 1, 2, 3, 3, 0, 0}));
+
+        v.erase(v.begin());
+        BOOST_TEST(v == vec_type({0, 1, 2, 3, 3, 0, 0}));
+
+        v.pop_back();
+        BOOST_TEST(v == vec_type({0, 1, 2, 3, 3, 0}));
+
+        v.clear();
+        BOOST_TEST(v.empty());
+    }
+
+    {
+        using string_vec = boost::stl_interfaces::small_vector<std::string, 3>;
+        std::array<std::string, 2> a = {{"x", "y"}};
+
+        string_vec v = {"a", "b", "c", "d"};
+        v.insert(v.begin() + 1, a.begin(), a.end());
+        BOOST_TEST(v == string_vec({"a", "x", "y", "b", "c", "d"}));
+
+        v.insert(v.begin() + 5, a.begin(), a.end());
+        BOOST_TEST(v == string_vec({"a", "x", "y", "b", "c", "x", "y", "d"}));
+
+        v.emplace(v.begin(), v.back());
+        BOOST_TEST(
+            v == string_vec({"d", "a", "x", "y", "b", "c", "x", "y", "d"}));
+
+        v.erase(v.begin() + 1, v.begin() + 4);
+        BOOST_TEST(v == string_vec({"d", "b", "c", "x", "y", "d"}));
+    }
+}
+
+
+void test_exception_safety()
+{
+    using throwing_vec = boost::stl_interfaces::small_vector<throwing_copy, 2>;
+
+    {
+        throwing_vec v = {1, 2};
+        throwing_copy::copies_until_throw = 1;
+        BOOST_TEST_THROWS(v.push_back(3), std::runtime_error);
+        BOOST_TEST(v.size() == 2u);
+        BOOST_TEST(v.is_inline());
+        BOOST_TEST(v[0].value_ == 1);
+        BOOST_TEST(v[1].value_ == 2);
+        throwing_copy::copies_until_throw = 1000;
+    }
+
+    {
+        throwing_vec v = {1, 2};
+        v.reserve(4);
+        v.push_back(3);
+        v.push_back(4);
+        std::array<throwing_copy, 2> const a = {{5, 6}};
+        throwing_copy::copies_until_throw = 3;
+        BOOST_TEST_THROWS(
+            v.insert(v.begin() + 1, a.begin(), a.end()), std::runtime_error);
+        BOOST_TEST(v.size() == 4u);
+        BOOST_TEST(v[0].value_ == 1);
+        BOOST_TEST(v[1].value_ == 2);
+        BOOST_TEST(v[2].value_ == 3);
+        BOOST_TEST(v[3].value_ == 4);
+        throwing_copy::copies_until_throw = 1000;
+    }
+
+    // Elements constructed past the old end are destroyed with the rest
+    // when a later assignment throws.
+    using assign_vec = boost::stl_interfaces::small_vector<throwing_assign, 8>;
+    std::array<throwing_assign, 3> const a = {{7, 8, 9}};
+    {
+        assign_vec v = {1, 2, 3, 4};
+        throwing_assign::assignments_until_throw = 1;
+        BOOST_TEST_THROWS(
+            v.insert(v.begin() + 1, a.begin(), a.begin() + 2),
+            std::runtime_error);
+        throwing_assign::assignments_until_throw = 1000;
+    }
+    BOOST_TEST(throwing_assign::live == 3);
+    {
+        assign_vec v = {1, 2, 3, 4};
+        throwing_assign::assignments_until_throw = 0;
+        BOOST_TEST_THROWS(
+            v.insert(v.begin() + 3, a.begin(), a.end()), std::runtime_error);
+        throwing_assign::assignments_until_throw = 1000;
+    }
+    BOOST_TEST(throwing_assign::live == 3);
+}
+
+
+int main()
+{
+    test_default_ctor();
+    test_other_ctors_assign();
+    test_copy_move();
+    test_growth();
+    test_swap();
+    test_emplace_insert_erase();
+    test_exception_safety();
+    return boost::report_errors();
+}
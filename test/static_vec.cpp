@@ -275,6 +275,88 @@ void test_comparisons()
 }
 
 
+void test_bytewise_comparisons_assign()
+{
+    using uchar_vec = static_vector<unsigned char, 10>;
+    using char_vec = static_vector<char, 10>;
+    using double_vec = static_vector<double, 10>;
+
+#if !defined(USE_V2)
+    // These traits select the memcmp() and memmove() paths of the v1
+    // interface.
+    namespace dtl = boost::stl_interfaces::v1::v1_dtl;
+    static_assert(dtl::memcmp_equal<vec_type>::value, "");
+    static_assert(dtl::memcmp_equal<uchar_vec>::value, "");
+    static_assert(!dtl::memcmp_equal<double_vec>::value, "");
+    static_assert(!dtl::memcmp_less<vec_type>::value, "");
+    static_assert(dtl::memcmp_less<uchar_vec>::value, "");
+    static_assert(!dtl::memcmp_less<double_vec>::value, "");
+    static_assert(dtl::memmove_assignable<vec_type, int const *>::value, "");
+    static_assert(
+        !dtl::memmove_assignable<vec_type, std::reverse_iterator<int *>>::value,
+        "");
+    static_assert(!dtl::memmove_assignable<vec_type, long *>::value, "");
+#endif
+
+    {
+        uchar_vec const sm = {1, 2, 0xf0};
+        uchar_vec const md = {1, 2, 0xf0, 4};
+        uchar_vec const lg = {1, 2, 0xf1};
+
+        BOOST_TEST(sm == sm);
+        BOOST_TEST(sm != md);
+        BOOST_TEST(sm != lg);
+
+        BOOST_TEST(!(sm < sm));
+        BOOST_TEST(sm < md);
+        BOOST_TEST(sm < lg);
+        BOOST_TEST(md < lg);
+        BOOST_TEST(!(lg < md));
+        BOOST_TEST(uchar_vec() < sm);
+        BOOST_TEST(!(sm < uchar_vec()));
+        BOOST_TEST(uchar_vec() == uchar_vec());
+    }
+
+    {
+        // Plain char may be signed, in which case the comparison must not
+        // be bytewise.
+        char_vec const neg = {'a', char(-1)};
+        char_vec const pos = {'a', char(1)};
+        BOOST_TEST((neg < pos) == (char(-1) < char(1)));
+        BOOST_TEST(neg != pos);
+    }
+
+    {
+        double_vec const zero = {0.0};
+        double_vec const neg_zero = {-0.0};
+        BOOST_TEST(zero == neg_zero);
+        BOOST_TEST(!(zero < neg_zero));
+        BOOST_TEST(!(neg_zero < zero));
+    }
+
+    {
+        std::array<int, 5> const a = {{1, 2, 3, 4, 5}};
+
+        vec_type v = {9, 9, 9};
+        v.assign(a.data(), a.data() + a.size());
+        BOOST_TEST(v == vec_type({1, 2, 3, 4, 5}));
+
+        v.assign(a.data() + 3, a.data() + a.size());
+        BOOST_TEST(v == vec_type({4, 5}));
+
+        v.assign(a.data(), a.data());
+        BOOST_TEST(v.empty());
+
+        v.assign(a.data(), a.data() + 2);
+        BOOST_TEST(v == vec_type({1, 2}));
+
+        v = {1, 2, 3, 4, 5};
+        v.assign(v.data() + 1, v.data() + 4);
+        BOOST_TEST(v == vec_type({2, 3, 4}));
+    }
+}
+
+
 void test_swap()
 {
     {
@@ -591,6 +673,90 @@ void test_emplace_insert()
 }
 
 
+void test_insert_append_assign_range()
+{
+    {
+        vec_type v = {1, 2};
+
+        std::array<int, 2> a1 = {{0, 0}};
+        int a2[1] = {3};
+        std::array<int, 3> const a3 = {{9, 9, 9}};
+
+        static_assert(
+            std::is_same<
+                decltype(v.insert_range(v.begin(), a1)),
+                vec_type::iterator>::value,
+            "");
+        static_assert(std::is_same<decltype(v.append_range(a1)), void>::value, "");
+        static_assert(std::is_same<decltype(v.assign_range(a1)), void>::value, "");
+
+        auto const it0 = v.insert_range(v.begin(), a1);
+        BOOST_TEST(v == vec_type({0, 0, 1, 2}));
+        BOOST_TEST(it0 == v.begin());
+
+        v.append_range(a2);
+        BOOST_TEST(v == vec_type({0, 0, 1, 2, 3}));
+
+        auto const it2 = v.insert_range(v.begin() + 2, a3);
+        BOOST_TEST(v == vec_type({0, 0, 9, 9, 9, 1, 2, 3}));
+        BOOST_TEST(it2 == v.begin() + 2);
+
+        // Fewer insertions than elements after the insertion point.
+        auto const it3 = v.insert_range(v.begin() + 1, a2);
+        BOOST_TEST(v == vec_type({0, 3, 0, 9, 9, 9, 1, 2, 3}));
+        BOOST_TEST(it3 == v.begin() + 1);
+
+        v.assign_range(a3);
+        BOOST_TEST(v == vec_type({9, 9, 9}));
+
+        v.append_range(std::initializer_list<int>{});
+        BOOST_TEST(v == vec_type({9, 9, 9}));
+    }
+
+    {
+        // Inserting must not default-construct, or even require default
+        // construction of, the elements.
+        struct message
+        {
+            explicit message(int id) : id_(id) {}
+            bool operator==(message const & other) const
+            {
+                return id_ == other.id_;
+            }
+            bool operator!=(message const & other) const
+            {
+                return id_ != other.id_;
+            }
+            int id_;
+        };
+        static_assert(!std::is_default_constructible<message>::value, "");
+
+        using message_vec = static_vector<message, 10>;
+        std::array<message, 2> const a1 = {{message(1), message(2)}};
+        std::array<message, 3> const a2 = {
+            {message(3), message(4), message(5)}};
+
+        message_vec v;
+        v.append_range(a1);
+        BOOST_TEST(v.size() == 2u);
+        v.insert_range(v.begin() + 1, a2);
+        BOOST_TEST(v.size() == 5u);
+        BOOST_TEST(v[0] == message(1));
+        BOOST_TEST(v[1] == message(3));
+        BOOST_TEST(v[2] == message(4));
+        BOOST_TEST(v[3] == message(5));
+        BOOST_TEST(v[4] == message(2));
+
+        v.insert(v.begin(), 2, message(0));
+        BOOST_TEST(v.size() == 7u);
+        BOOST_TEST(v[0] == message(0));
+        BOOST_TEST(v[1] == message(0));
+        BOOST_TEST(v[2] == message(1));
+        BOOST_TEST(v[6] == message(2));
+    }
+}
+
+
 void test_erase()
 {
     {
@@ -763,9 +929,11 @@ int main()
     test_resize();
     test_assignment_copy_move_equality();
     test_comparisons();
+    test_bytewise_comparisons_assign();
     test_swap();
     test_iterators();
     test_emplace_insert();
+    test_insert_append_assign_range();
     test_erase();
     test_front_back();
     test_data_index_at();
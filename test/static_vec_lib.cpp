@@ -0,0 +1,292 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/static_vector.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+namespace bsi = boost::stl_interfaces;
+
+// Instantiate all the members we can.
+template struct boost::stl_interfaces::static_vector<int, 8>;
+template struct boost::stl_interfaces::static_vector<std::string, 8>;
+
+using vec_type = bsi::static_vector<int, 8>;
+using string_vec = bsi::static_vector<std::string, 4>;
+
+struct point
+{
+    int x;
+    int y;
+};
+
+#if !defined(BOOST_STL_INTERFACES_CHECKED)
+static_assert(std::is_trivially_copyable<vec_type>::value, "");
+static_assert(
+    std::is_trivially_copyable<bsi::static_vector<point, 4>>::value, "");
+static_assert(
+    std::is_trivially_destructible<bsi::static_vector<point, 4>>::value,
+    "");
+static_assert(
+    sizeof(bsi::static_vector<std::unique_ptr<int>, 4>) ==
+        4 * sizeof(std::unique_ptr<int>) + sizeof(std::size_t),
+    "");
+#endif
+static_assert(!std::is_trivially_copyable<string_vec>::value, "");
+
+// Not default constructible, so that inserting into the middle of a
+// static_vector of these cannot lean on T().
+struct tagged
+{
+    explicit tagged(int x) : value(x) {}
+    tagged(tagged const &) = default;
+    tagged & operator=(tagged const &) = default;
+    ~tagged() { ++destroyed; }
+
+    friend bool operator==(tagged lhs, tagged rhs)
+    {
+        return lhs.value == rhs.value;
+    }
+
+    int value;
+    static int destroyed;
+};
+int tagged::destroyed = 0;
+
+// Counts its live objects, and throws from its assignment operator after a
+// set number of assignments.
+struct throwing_assign
+{
+    throwing_assign(int i) : value(i) { ++live; }
+    throwing_assign(throwing_assign const & other) : value(other.value)
+    {
+        ++live;
+    }
+    ~throwing_assign() { --live; }
+    throwing_assign & operator=(throwing_assign const & other)
+    {
+        if (assignments_until_throw == 0)
+            throw std::runtime_error("assign");
+        --assignments_until_throw;
+        value = other.value;
+        return *this;
+    }
+
+    int value;
+    static int live;
+    static int assignments_until_throw;
+};
+int throwing_assign::live = 0;
+int throwing_assign::assignments_until_throw = 1000;
+
+template<typename Vec>
+std::vector<typename Vec::value_type> to_vector(Vec const & v)
+{
+    return std::vector<typename Vec::value_type>(v.begin(), v.end());
+}
+
+#if defined(__cpp_lib_is_constant_evaluated) && 201907L <= __cpp_constexpr &&  \
+    defined(__cpp_lib_constexpr_algorithms)
+constexpr int constexpr_sum()
+{
+    vec_type v = {4, 1, 3};
+    v.push_back(2);
+    v.insert(v.begin() + 1, 10);
+    v.erase(v.begin());
+    vec_type w = v;
+    w.emplace_back_unchecked(5);
+    swap(v, w);
+    int sum = 0;
+    for (int x : v) {
+        sum += x;
+    }
+    return sum;
+}
+static_assert(constexpr_sum() == 21);
+#endif
+
+
+int main()
+{
+
+{
+    vec_type v;
+    BOOST_TEST(v.empty());
+    BOOST_TEST(v.capacity() == 8u);
+    BOOST_TEST(v.max_size() == 8u);
+
+    v.push_back(1);
+    v.emplace_back(2);
+    v.push_back_unchecked(3);
+    BOOST_TEST(v.emplace_back_unchecked(4) == 4);
+    BOOST_TEST(v == vec_type({1, 2, 3, 4}));
+    BOOST_TEST(v.data() == &v[0]);
+
+    v.insert(v.begin() + 1, {7, 8});
+    BOOST_TEST(v == vec_type({1, 7, 8, 2, 3, 4}));
+    BOOST_TEST(*v.emplace(v.begin(), 0) == 0);
+    v.erase(v.begin() + 2, v.begin() + 4);
+    BOOST_TEST(v == vec_type({0, 1, 2, 3, 4}));
+
+    // An inserted element may alias one that gets shifted.
+    v.insert(v.begin(), v.back());
+    BOOST_TEST(v == vec_type({4, 0, 1, 2, 3, 4}));
+    v.emplace(v.begin() + 1, v[5]);
+    BOOST_TEST(v == vec_type({4, 4, 0, 1, 2, 3, 4}));
+
+    v.resize(3);
+    BOOST_TEST(v == vec_type({4, 4, 0}));
+    v.resize(5, 9);
+    BOOST_TEST(v == vec_type({4, 4, 0, 9, 9}));
+    v.resize(6);
+    BOOST_TEST(v.back() == 0);
+    BOOST_TEST(vec_type({1, 2}) < vec_type({1, 3}));
+
+    vec_type const w(3, 5);
+    BOOST_TEST(w == vec_type({5, 5, 5}));
+    BOOST_TEST(w.at(2) == 5);
+    BOOST_TEST_THROWS(w.at(3), std::out_of_range);
+}
+
+{
+    // Growing past N throws, and leaves the contents alone.
+    vec_type v(8);
+    BOOST_TEST_THROWS(v.push_back(1), std::length_error);
+    BOOST_TEST_THROWS(v.emplace(v.begin(), 1), std::length_error);
+    BOOST_TEST_THROWS(v.insert(v.end(), {1}), std::length_error);
+    vec_type const five(5, 1);
+    v.resize(4);
+    BOOST_TEST_THROWS(v.insert(v.end(), five.begin(), five.end()),
+                      std::length_error);
+    BOOST_TEST_THROWS(v.resize(9), std::length_error);
+    BOOST_TEST_THROWS(v.reserve(9), std::length_error);
+    v.reserve(8);
+    v.shrink_to_fit();
+    BOOST_TEST(v == vec_type(4));
+}
+
+{
+    // Elements constructed past the old end are destroyed with the rest
+    // when a later assignment throws.
+    using assign_vec = bsi::static_vector<throwing_assign, 8>;
+    throwing_assign const a[] = {7, 8, 9};
+    {
+        assign_vec v = {1, 2, 3, 4};
+        throwing_assign::assignments_until_throw = 1;
+        BOOST_TEST_THROWS(
+            v.insert(v.begin() + 1, a, a + 2), std::runtime_error);
+    }
+    BOOST_TEST(throwing_assign::live == 3);
+    {
+        assign_vec v = {1, 2, 3, 4};
+        throwing_assign::assignments_until_throw = 0;
+        BOOST_TEST_THROWS(v.insert(v.end() - 1, a, a + 3), std::runtime_error);
+    }
+    BOOST_TEST(throwing_assign::live == 3);
+    {
+        assign_vec v = {1, 2, 3, 4};
+        throwing_assign::assignments_until_throw = 0;
+        BOOST_TEST_THROWS(v.emplace(v.begin(), 5), std::runtime_error);
+    }
+    BOOST_TEST(throwing_assign::live == 3);
+    throwing_assign::assignments_until_throw = 1000;
+}
+
+{
+    // Whole-object copies and swaps.
+    bsi::static_vector<point, 4> a;
+    a.push_back({1, 2});
+    a.emplace_back_unchecked(point{3, 4});
+    auto b = a;
+    BOOST_TEST(b.size() == 2u);
+    BOOST_TEST(b[1].x == 3 && b[1].y == 4);
+
+    vec_type c = {1, 2, 3};
+    vec_type d = {4};
+    swap(c, d);
+    BOOST_TEST(c == vec_type({4}));
+    BOOST_TEST(d == vec_type({1, 2, 3}));
+    c.swap(c);
+    BOOST_TEST(c == vec_type({4}));
+    d = c;
+    BOOST_TEST(d == vec_type({4}));
+    // A move is a copy, which leaves the source as it was.
+    auto e = std::move(b);
+    BOOST_TEST(e.size() == 2u && b.size() == 2u);
+}
+
+{
+    string_vec v = {"a", "b"};
+    v.push_back("c");
+    v.insert(v.begin(), std::string(40, 'x'));
+    BOOST_TEST(to_vector(v) == std::vector<std::string>(
+                                   {std::string(40, 'x'), "a", "b", "c"}));
+    BOOST_TEST_THROWS(v.push_back("d"), std::length_error);
+
+    v.erase(v.begin() + 1);
+    BOOST_TEST(to_vector(v) ==
+               std::vector<std::string>({std::string(40, 'x'), "b", "c"}));
+    v.emplace(v.begin() + 1, 3, 'y');
+    BOOST_TEST(v[1] == "yyy");
+
+    string_vec copy = v;
+    BOOST_TEST(copy == v);
+    string_vec moved = std::move(copy);
+    BOOST_TEST(moved == v);
+    BOOST_TEST(copy.size() == v.size());
+
+    string_vec other = {"q"};
+    swap(moved, other);
+    BOOST_TEST(to_vector(moved) == std::vector<std::string>({"q"}));
+    BOOST_TEST(other == v);
+    swap(moved, other);
+    BOOST_TEST(moved == v);
+    BOOST_TEST(to_vector(other) == std::vector<std::string>({"q"}));
+
+    other = v;
+    BOOST_TEST(other == v);
+    v.resize(1);
+    other = std::move(v);
+    BOOST_TEST(to_vector(other) ==
+               std::vector<std::string>({std::string(40, 'x')}));
+    other.clear();
+    BOOST_TEST(other.empty());
+}
+
+{
+    // Elements are destroyed exactly once.
+    tagged::destroyed = 0;
+    {
+        bsi::static_vector<tagged, 4> v;
+        v.emplace_back(1);
+        v.emplace_back(3);
+        tagged::destroyed = 0;
+        v.emplace(v.begin() + 1, 2);
+        BOOST_TEST(v == (bsi::static_vector<tagged, 4>{
+                            tagged(1), tagged(2), tagged(3)}));
+        tagged::destroyed = 0;
+        v.erase(v.begin());
+        BOOST_TEST(tagged::destroyed == 1);
+        tagged::destroyed = 0;
+    }
+    BOOST_TEST(tagged::destroyed == 2);
+
+    bsi::static_vector<std::unique_ptr<int>, 4> ptrs;
+    ptrs.push_back(std::make_unique<int>(1));
+    ptrs.emplace(ptrs.begin(), std::make_unique<int>(0));
+    BOOST_TEST(*ptrs[0] == 0 && *ptrs[1] == 1);
+    auto moved = std::move(ptrs);
+    BOOST_TEST(*moved[1] == 1);
+    BOOST_TEST(ptrs.size() == 2u && !ptrs[0]);
+}
+
+    return boost::report_errors();
+}
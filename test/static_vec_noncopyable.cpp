@@ -10,6 +10,7 @@
 #include <boost/core/lightweight_test.hpp>
 
 #include <array>
+#include <memory>
 
 
 struct noncopyable_int
@@ -372,6 +373,177 @@ void test_swap()
     }
 }
 
+struct relocatable_handle
+{
+    explicit relocatable_handle(int i) : value_(new int(i)) { ++constructions; }
+    relocatable_handle(relocatable_handle && other) : value_(other.value_)
+    {
+        other.value_ = nullptr;
+        ++moves;
+    }
+    relocatable_handle & operator=(relocatable_handle && rhs)
+    {
+        std::swap(value_, rhs.value_);
+        ++moves;
+        return *this;
+    }
+    ~relocatable_handle()
+    {
+        delete value_;
+        ++destructions;
+    }
+
+    friend bool
+    operator==(relocatable_handle const & lhs, relocatable_handle const & rhs)
+    {
+        return *lhs.value_ == *rhs.value_;
+    }
+    friend bool
+    operator!=(relocatable_handle const & lhs, relocatable_handle const & rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    static void reset_counts() { constructions = moves = destructions = 0; }
+
+    int * value_;
+
+    static int constructions;
+    static int moves;
+    static int destructions;
+};
+
+int relocatable_handle::constructions = 0;
+int relocatable_handle::moves = 0;
+int relocatable_handle::destructions = 0;
+
+namespace boost { namespace stl_interfaces {
+    template<>
+    struct is_trivially_relocatable<relocatable_handle> : std::true_type
+    {
+    };
+}}
+
+static_assert(
+    boost::stl_interfaces::is_trivially_relocatable<int>::value, "");
+static_assert(
+    boost::stl_interfaces::is_trivially_relocatable<std::unique_ptr<int>>::value,
+    "");
+static_assert(
+    boost::stl_interfaces::is_trivially_relocatable<
+        std::unique_ptr<int[]>>::value,
+    "");
+static_assert(
+    !boost::stl_interfaces::is_trivially_relocatable<noncopyable_int>::value,
+    "");
+
+void test_relocation()
+{
+    using handle_vec = static_vector<relocatable_handle, 10>;
+
+    {
+        handle_vec v1;
+        v1.emplace_back(1);
+        v1.emplace_back(2);
+        v1.emplace_back(3);
+
+        relocatable_handle::reset_counts();
+
+        handle_vec v2(std::move(v1));
+        BOOST_TEST(v1.empty());
+        BOOST_TEST(v2.size() == 3u);
+        BOOST_TEST(*v2[0].value_ == 1);
+        BOOST_TEST(*v2[2].value_ == 3);
+
+        handle_vec v3;
+        v3.emplace_back(4);
+        relocatable_handle::reset_counts();
+
+        v3 = std::move(v2);
+        BOOST_TEST(v2.empty());
+        BOOST_TEST(v3.size() == 3u);
+        BOOST_TEST(*v3[1].value_ == 2);
+        BOOST_TEST(relocatable_handle::destructions == 1);
+        relocatable_handle::reset_counts();
+
+        v2.emplace_back(5);
+        relocatable_handle::reset_counts();
+        v2.swap(v3);
+        BOOST_TEST(v2.size() == 3u);
+        BOOST_TEST(v3.size() == 1u);
+        BOOST_TEST(*v2[0].value_ == 1);
+        BOOST_TEST(*v3[0].value_ == 5);
+
+        BOOST_TEST(relocatable_handle::constructions == 0);
+        BOOST_TEST(relocatable_handle::moves == 0);
+        BOOST_TEST(relocatable_handle::destructions == 0);
+
+        // Emplacing in the middle makes one temporary, and shifts the rest
+        // without any per-element calls.
+        v2.emplace(v2.begin() + 1, 6);
+        BOOST_TEST(v2.size() == 4u);
+        BOOST_TEST(*v2[0].value_ == 1);
+        BOOST_TEST(*v2[1].value_ == 6);
+        BOOST_TEST(*v2[2].value_ == 2);
+        BOOST_TEST(*v2[3].value_ == 3);
+        BOOST_TEST(relocatable_handle::constructions == 1);
+        BOOST_TEST(relocatable_handle::moves == 1);
+        BOOST_TEST(relocatable_handle::destructions == 1);
+        relocatable_handle::reset_counts();
+
+        v2.erase(v2.begin());
+        BOOST_TEST(v2.size() == 3u);
+        BOOST_TEST(*v2[0].value_ == 6);
+        BOOST_TEST(*v2[2].value_ == 3);
+        BOOST_TEST(relocatable_handle::moves == 0);
+        BOOST_TEST(relocatable_handle::destructions == 1);
+    }
+
+    {
+        using ptr_vec = static_vector<std::unique_ptr<int>, 10>;
+
+        ptr_vec v1;
+        v1.emplace_back(new int(1));
+        v1.emplace_back(new int(2));
+        v1.emplace(v1.begin(), new int(0));
+        BOOST_TEST(*v1[0] == 0);
+        BOOST_TEST(*v1[1] == 1);
+        BOOST_TEST(*v1[2] == 2);
+
+        ptr_vec v2(std::move(v1));
+        BOOST_TEST(v1.empty());
+        v2.erase(v2.begin() + 1);
+        BOOST_TEST(v2.size() == 2u);
+        BOOST_TEST(*v2[0] == 0);
+        BOOST_TEST(*v2[1] == 2);
+
+        v1.emplace_back(new int(3));
+        v1.swap(v2);
+        BOOST_TEST(v1.size() == 2u);
+        BOOST_TEST(v2.size() == 1u);
+        BOOST_TEST(*v2[0] == 3);
+    }
+
+    {
+        // Elements that are not trivially relocatable are still moved one
+        // at a time.
+        vec_type v1;
+        v1.push_back(1);
+        v1.push_back(2);
+        v1.emplace(v1.begin() + 1, 3);
+        vec_type v2(std::move(v1));
+        BOOST_TEST(v1.empty());
+        BOOST_TEST(v2.size() == 3u);
+        BOOST_TEST(v2[0] == 1);
+        BOOST_TEST(v2[1] == 3);
+        BOOST_TEST(v2[2] == 2);
+        v2.erase(v2.begin());
+        BOOST_TEST(v2.size() == 2u);
+        BOOST_TEST(v2[0] == 3);
+        BOOST_TEST(v2[1] == 2);
+    }
+}
+
 template<typename Iter>
 using writable_iter_t = decltype(
     *std::declval<Iter>() =
@@ -912,6 +1084,7 @@ int main()
     test_assignment_copy_move_equality();
     test_comparisons();
     test_swap();
+    test_relocation();
     test_iterators();
     test_emplace_insert();
     test_erase();
@@ -0,0 +1,29 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// The static_vec tests, run against a static_vector built on
+// v2::sequence_container_interface.
+#if 201703L < __cplusplus
+#include <version>
+#endif
+
+#if 201703L < __cplusplus && defined(__cpp_lib_concepts)
+#define USE_V2
+#include "static_vec.cpp"
+
+static_assert(std::derived_from<
+              vec_type,
+              boost::stl_interfaces::v2::sequence_container_interface<
+                  vec_type>>);
+static_assert(std::ranges::contiguous_range<vec_type>);
+static_assert(std::ranges::sized_range<vec_type const>);
+static_assert(std::is_same_v<decltype(vec_type().data()), int *>);
+static_assert(std::is_same_v<
+              decltype(vec_type() <=> vec_type()),
+              std::strong_ordering>);
+#else
+int main() {}
+#endif
@@ -0,0 +1,159 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/small_vector.hpp>
+#include "../example/static_vector.hpp"
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+
+namespace bsi = boost::stl_interfaces;
+
+using counted_vec = bsi::small_vector<int, 4>;
+using plain_vec = bsi::small_vector<long, 4>;
+using counted_static_vec = static_vector<int, 4>;
+
+namespace boost { namespace stl_interfaces {
+    template<>
+    struct statistics_policy<counted_vec>
+    {
+        using type = counting_statistics<counted_vec>;
+    };
+    template<>
+    struct statistics_policy<counted_static_vec>
+    {
+        using type = counting_statistics<counted_static_vec>;
+    };
+}}
+
+using counts = bsi::counting_statistics<counted_vec>;
+using static_counts = bsi::counting_statistics<counted_static_vec>;
+
+static_assert(
+    std::is_same<bsi::statistics_policy_t<plain_vec>, bsi::null_statistics>::
+        value,
+    "");
+static_assert(
+    std::is_same<bsi::statistics_policy_t<counted_vec>, counts>::value, "");
+static_assert(std::is_empty<bsi::null_statistics>::value, "");
+
+
+int main()
+{
+
+{
+    counts::reset();
+    counted_vec v;
+    v.push_back(1);
+    v.push_back(2);
+    v.push_back(3);
+    auto s = counts::get();
+    BOOST_TEST(s.inserts == 3u);
+    BOOST_TEST(s.erases == 0u);
+    BOOST_TEST(s.moves == 0u);
+    BOOST_TEST(s.reallocations == 0u);
+    BOOST_TEST(s.peak_size == 3u);
+
+    // Shifts the three existing elements.
+    v.insert(v.begin(), 0);
+    s = counts::get();
+    BOOST_TEST(s.inserts == 4u);
+    BOOST_TEST(s.moves == 3u);
+    BOOST_TEST(s.peak_size == 4u);
+
+    // Goes to the heap, moving all four elements.
+    v.push_back(4);
+    s = counts::get();
+    BOOST_TEST(s.inserts == 5u);
+    BOOST_TEST(s.moves == 7u);
+    BOOST_TEST(s.reallocations == 1u);
+    BOOST_TEST(s.peak_size == 5u);
+
+    // Shifts the three elements after the erased one.
+    v.erase(v.begin() + 1);
+    s = counts::get();
+    BOOST_TEST(s.erases == 1u);
+    BOOST_TEST(s.moves == 10u);
+
+    v.clear();
+    s = counts::get();
+    BOOST_TEST(s.erases == 5u);
+    BOOST_TEST(s.peak_size == 5u);
+
+    BOOST_TEST_THROWS(v.at(0), std::out_of_range);
+    BOOST_TEST(counts::get().out_of_range == 1u);
+
+    counts::reset();
+    s = counts::get();
+    BOOST_TEST(s.inserts == 0u);
+    BOOST_TEST(s.peak_size == 0u);
+}
+
+{
+    counts::reset();
+    counted_vec v(3);
+    BOOST_TEST(counts::get().inserts == 3u);
+    v.resize(6, 7);
+    auto s = counts::get();
+    BOOST_TEST(s.inserts == 6u);
+    BOOST_TEST(s.reallocations == 1u);
+    BOOST_TEST(s.moves == 3u);
+    BOOST_TEST(s.peak_size == 6u);
+
+    v.resize(2);
+    v.shrink_to_fit();
+    s = counts::get();
+    BOOST_TEST(s.erases == 4u);
+    BOOST_TEST(s.reallocations == 2u);
+    BOOST_TEST(s.moves == 5u);
+}
+
+{
+    // The totals are shared by every container of the type, across threads.
+    counts::reset();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([i] {
+            counted_vec v;
+            for (int j = 0; j < 10 * (i + 1); ++j) {
+                v.push_back(j);
+            }
+        });
+    }
+    for (auto & t : threads) {
+        t.join();
+    }
+    auto const s = counts::get();
+    BOOST_TEST(s.inserts == 100u);
+    BOOST_TEST(s.erases == 100u);
+    BOOST_TEST(s.peak_size == 40u);
+}
+
+{
+    // Types without a specialization do not count.
+    counts::reset();
+    plain_vec v = {1, 2, 3};
+    v.push_back(4);
+    BOOST_TEST_THROWS(v.at(4), std::out_of_range);
+    BOOST_TEST(counts::get().inserts == 0u);
+}
+
+{
+    // sequence_container_interface itself reports out-of-range at().
+    static_counts::reset();
+    counted_static_vec v = {1, 2};
+    BOOST_TEST(v.at(1) == 2);
+    counted_static_vec const & cv = v;
+    BOOST_TEST_THROWS(v.at(2), std::out_of_range);
+    BOOST_TEST_THROWS(cv.at(5), std::out_of_range);
+    BOOST_TEST(static_counts::get().out_of_range == 2u);
+}
+
+    return boost::report_errors();
+}
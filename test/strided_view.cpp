@@ -0,0 +1,210 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/strided_view.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+
+namespace bsi = boost::stl_interfaces;
+
+static_assert(
+    std::is_same<
+        std::iterator_traits<bsi::strided_iterator<int>>::iterator_category,
+        std::random_access_iterator_tag>::value,
+    "");
+static_assert(
+    std::is_convertible<
+        bsi::strided_iterator<int>,
+        bsi::strided_iterator<int const>>::value,
+    "");
+static_assert(
+    !std::is_convertible<
+        bsi::strided_iterator<int const>,
+        bsi::strided_iterator<int>>::value,
+    "");
+static_assert(
+    std::is_same<
+        std::iterator_traits<bsi::tiled_view<int>::iterator>::reference,
+        bsi::matrix_view<int>>::value,
+    "");
+
+// The numbers 0, 1, 2, ... in a rows by cols matrix, with pitch - cols
+// unused elements at the end of each row.
+std::vector<int> make_buffer(int rows, int cols, int pitch)
+{
+    std::vector<int> result(rows * pitch, -1);
+    for (int i = 0; i < rows; ++i) {
+        std::iota(
+            result.begin() + i * pitch,
+            result.begin() + i * pitch + cols,
+            i * cols);
+    }
+    return result;
+}
+
+template<typename Range>
+std::vector<int> to_vector(Range const & r)
+{
+    return std::vector<int>(r.begin(), r.end());
+}
+
+
+int main()
+{
+
+{
+    int a[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    bsi::strided_view<int> evens(a, 5, 2);
+    BOOST_TEST(evens.size() == 5);
+    BOOST_TEST(evens.stride() == 2);
+    BOOST_TEST(to_vector(evens) == std::vector<int>({0, 2, 4, 6, 8}));
+    BOOST_TEST(evens[3] == 6);
+    BOOST_TEST(evens.back() == 8);
+
+    auto it = evens.begin();
+    it += 4;
+    BOOST_TEST(it.base() == a + 8);
+    BOOST_TEST(it - evens.begin() == 4);
+    BOOST_TEST(evens.end() - it == 1);
+    BOOST_TEST(*(it - 2) == 4);
+    BOOST_TEST(evens.begin() < it);
+
+    *it = 80;
+    BOOST_TEST(a[8] == 80);
+    std::fill(evens.begin(), evens.end(), -1);
+    BOOST_TEST(std::count(a, a + 10, -1) == 5);
+    BOOST_TEST(a[1] == 1 && a[9] == 9);
+
+    int const b[] = {0, 1, 2, 3, 4, 5, 6};
+    bsi::strided_view<int const> backward(b + 6, 3, -3);
+    BOOST_TEST(to_vector(backward) == std::vector<int>({6, 3, 0}));
+    std::vector<int> reversed(
+        std::make_reverse_iterator(backward.end()),
+        std::make_reverse_iterator(backward.begin()));
+    BOOST_TEST(reversed == std::vector<int>({0, 3, 6}));
+    bsi::strided_view<int const> repeat(b + 2, 3, 0);
+    BOOST_TEST(to_vector(repeat) == std::vector<int>({2, 2, 2}));
+
+    bsi::strided_view<int const> const_evens = evens;
+    BOOST_TEST(const_evens.begin() == evens.begin());
+    BOOST_TEST(const_evens.size() == 5);
+
+    bsi::strided_view<int> empty;
+    BOOST_TEST(empty.empty());
+}
+
+{
+    auto buffer = make_buffer(3, 4, 6);
+    bsi::matrix_view<int> m(buffer.data(), 3, 4, 6);
+    BOOST_TEST(m.rows() == 3);
+    BOOST_TEST(m.cols() == 4);
+    BOOST_TEST(m.size() == 3);
+    BOOST_TEST(m(2, 1) == 9);
+    BOOST_TEST(!m.is_contiguous());
+
+    // Rows are contiguous, and skip the padding at the end of each row.
+    BOOST_TEST(to_vector(m.row(1)) == std::vector<int>({4, 5, 6, 7}));
+    BOOST_TEST(m.row(1).data() == buffer.data() + 6);
+    BOOST_TEST(m[2].data() == buffer.data() + 12);
+    std::vector<int> flat;
+    for (auto row : m) {
+        flat.insert(flat.end(), row.begin(), row.end());
+    }
+    std::vector<int> expected(12);
+    std::iota(expected.begin(), expected.end(), 0);
+    BOOST_TEST(flat == expected);
+    BOOST_TEST((m.end() - 1)->front() == 8);
+
+    // Columns are strided.
+    BOOST_TEST(to_vector(m.column(3)) == std::vector<int>({3, 7, 11}));
+    auto column = m.column(0);
+    std::fill(column.begin(), column.end(), 0);
+    BOOST_TEST(m(1, 0) == 0 && m(2, 0) == 0 && m(1, 1) == 5);
+
+    auto sub = m.submatrix(1, 1, 2, 2);
+    BOOST_TEST(sub.row_stride() == 6);
+    BOOST_TEST(to_vector(sub.row(0)) == std::vector<int>({5, 6}));
+    BOOST_TEST(to_vector(sub.row(1)) == std::vector<int>({9, 10}));
+    BOOST_TEST(sub.submatrix(0, 0, 0, 0).empty());
+
+    // A single row, or rows with no gap between them, are contiguous.
+    BOOST_TEST(m.submatrix(2, 0, 1, 4).is_contiguous());
+    auto dense_buffer = make_buffer(3, 4, 4);
+    bsi::matrix_view<int const> dense(dense_buffer.data(), 3, 4);
+    BOOST_TEST(dense.is_contiguous());
+    BOOST_TEST(to_vector(dense.elements()) == expected);
+    BOOST_TEST(dense.elements().data() == dense_buffer.data());
+
+    bsi::matrix_view<int const> cm = m;
+    BOOST_TEST(&cm(2, 3) == &m(2, 3));
+}
+
+{
+    // A 5 by 7 matrix in 2 by 3 tiles: 3 rows of tiles, 3 columns of tiles,
+    // and partial tiles along the bottom and right edges.
+    auto buffer = make_buffer(5, 7, 8);
+    bsi::matrix_view<int> m(buffer.data(), 5, 7, 8);
+    bsi::tiled_view<int> tiles(m, 2, 3);
+    BOOST_TEST(tiles.tiles_down() == 3);
+    BOOST_TEST(tiles.tiles_across() == 3);
+    BOOST_TEST(tiles.size() == 9);
+
+    BOOST_TEST(tiles[0].rows() == 2 && tiles[0].cols() == 3);
+    BOOST_TEST(to_vector(tiles[0].row(1)) == std::vector<int>({7, 8, 9}));
+    BOOST_TEST(tiles[2].rows() == 2 && tiles[2].cols() == 1);
+    BOOST_TEST(tiles[2](1, 0) == 13);
+    BOOST_TEST(tiles[7].rows() == 1 && tiles[7].cols() == 3);
+    BOOST_TEST(to_vector(tiles[7].row(0)) == std::vector<int>({31, 32, 33}));
+    BOOST_TEST(tiles[8].rows() == 1 && tiles[8].cols() == 1);
+    BOOST_TEST(tiles[8](0, 0) == 34);
+
+    auto it = tiles.begin() + 5;
+    BOOST_TEST(it.tile_row() == 1);
+    BOOST_TEST(it.tile_column() == 2);
+    BOOST_TEST(it - tiles.begin() == 5);
+    BOOST_TEST(tiles.end() - it == 4);
+    BOOST_TEST((*it)(0, 0) == 20);
+    BOOST_TEST(it->cols() == 1);
+
+    // Every element is visited exactly once, tile by tile.
+    std::vector<int> visited;
+    for (auto tile : tiles) {
+        for (auto row : tile) {
+            visited.insert(visited.end(), row.begin(), row.end());
+        }
+    }
+    std::sort(visited.begin(), visited.end());
+    std::vector<int> expected(35);
+    std::iota(expected.begin(), expected.end(), 0);
+    BOOST_TEST(visited == expected);
+
+    // A blocked transpose.
+    std::vector<int> transposed(35);
+    bsi::matrix_view<int> t(transposed.data(), 7, 5);
+    for (auto tile : bsi::tiled_view<int>(m, 4, 4)) {
+        auto const i0 = &tile(0, 0) - buffer.data();
+        for (std::ptrdiff_t i = 0; i < tile.rows(); ++i) {
+            for (std::ptrdiff_t j = 0; j < tile.cols(); ++j) {
+                t(i0 % 8 + j, i0 / 8 + i) = tile(i, j);
+            }
+        }
+    }
+    for (int i = 0; i < 5; ++i) {
+        BOOST_TEST(to_vector(t.column(i)) == to_vector(m.row(i)));
+    }
+
+    bsi::tiled_view<int> none(
+        bsi::matrix_view<int>(buffer.data(), 0, 7), 2, 2);
+    BOOST_TEST(none.empty());
+    BOOST_TEST(bsi::tiled_view<int>().empty());
+}
+
+    return boost::report_errors();
+}
@@ -0,0 +1,285 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/views.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <algorithm>
+#include <array>
+#include <forward_list>
+#include <list>
+#include <numeric>
+#include <string>
+#include <vector>
+
+
+namespace stl_interfaces = boost::stl_interfaces;
+namespace views = boost::stl_interfaces::views;
+
+using vec_iter = std::vector<int>::iterator;
+
+static_assert(
+    std::is_same<
+        views::all_t<std::vector<int> &>,
+        stl_interfaces::ref_view<std::vector<int>>>::value,
+    "");
+static_assert(
+    std::is_same<
+        views::all_t<std::vector<int> const &>,
+        stl_interfaces::ref_view<std::vector<int> const>>::value,
+    "");
+static_assert(
+    std::is_same<
+        views::all_t<std::vector<int>>,
+        stl_interfaces::owning_view<std::vector<int>>>::value,
+    "");
+static_assert(
+    std::is_same<
+        views::all_t<stl_interfaces::subrange<vec_iter> &>,
+        stl_interfaces::subrange<vec_iter>>::value,
+    "");
+
+struct square
+{
+    int operator()(int x) const { return x * x; }
+};
+
+struct is_odd
+{
+    bool operator()(int x) const { return x % 2 != 0; }
+};
+
+using square_view =
+    stl_interfaces::transform_view<views::all_t<std::vector<int> &>, square>;
+static_assert(
+    std::is_same<
+        square_view::iterator::iterator_category,
+        std::random_access_iterator_tag>::value,
+    "");
+static_assert(
+    std::is_same<square_view::iterator::reference, int>::value, "");
+
+using odd_view = stl_interfaces::
+    filter_view<views::all_t<std::vector<int> &>, is_odd>;
+static_assert(
+    std::is_same<
+        odd_view::iterator::iterator_category,
+        std::bidirectional_iterator_tag>::value,
+    "");
+static_assert(std::is_same<odd_view::iterator::reference, int &>::value, "");
+
+static_assert(
+    std::is_same<
+        stl_interfaces::take_view<views::all_t<std::list<int> &>>::iterator::
+            iterator_category,
+        std::forward_iterator_tag>::value,
+    "");
+static_assert(
+    std::is_same<
+        stl_interfaces::chunk_view<views::all_t<std::vector<int> &>>::
+            iterator::reference,
+        stl_interfaces::subrange<vec_iter>>::value,
+    "");
+
+template<typename Range>
+std::vector<int> to_vector(Range && r)
+{
+    std::vector<int> retval;
+    for (auto && x : r) {
+        retval.push_back(x);
+    }
+    return retval;
+}
+
+
+int main()
+{
+
+{
+    std::vector<int> ints = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    auto squares = views::transform(ints, square{});
+    BOOST_TEST(squares.size() == 10);
+    BOOST_TEST(squares[3] == 9);
+    BOOST_TEST(squares.back() == 81);
+    BOOST_TEST((squares.end() - 1).base() == ints.end() - 1);
+
+    std::vector<int> const expected = {0, 1, 4, 9, 16, 25, 36, 49, 64, 81};
+    BOOST_TEST(to_vector(squares) == expected);
+    BOOST_TEST(to_vector(ints | views::transform(square{})) == expected);
+
+    std::vector<int> reversed(squares.size());
+    std::copy(
+        std::make_reverse_iterator(squares.end()),
+        std::make_reverse_iterator(squares.begin()),
+        reversed.begin());
+    BOOST_TEST(std::equal(
+        reversed.rbegin(), reversed.rend(), expected.begin(), expected.end()));
+}
+
+{
+    // Transforming to an lvalue reference gives a writable view.
+    std::vector<std::pair<int, std::string>> pairs = {{1, "one"}, {2, "two"}};
+    auto firsts = pairs | views::transform(
+                              [](std::pair<int, std::string> & p) -> int & {
+                                  return p.first;
+                              });
+    for (auto & x : firsts) {
+        x *= 10;
+    }
+    BOOST_TEST(pairs[0].first == 10);
+    BOOST_TEST(pairs[1].first == 20);
+}
+
+{
+    std::vector<int> ints = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    auto odds = ints | views::filter(is_odd{});
+    BOOST_TEST(!odds.empty());
+    BOOST_TEST(odds.front() == 1);
+    BOOST_TEST(odds.back() == 9);
+    BOOST_TEST(to_vector(odds) == (std::vector<int>{1, 3, 5, 7, 9}));
+    BOOST_TEST(std::distance(odds.begin(), odds.end()) == 5);
+
+    // The filtered elements are the elements of ints.
+    *odds.begin() = 11;
+    BOOST_TEST(ints[1] == 11);
+
+    auto it = odds.end();
+    --it;
+    --it;
+    BOOST_TEST(*it == 7);
+
+    // A copy searches for its own begin().
+    auto copy = odds;
+    BOOST_TEST(copy.begin().base() == ints.begin() + 1);
+
+    auto nothing = ints | views::filter([](int x) { return x < 0; });
+    BOOST_TEST(nothing.empty());
+    BOOST_TEST(nothing.begin() == nothing.end());
+}
+
+{
+    std::vector<int> ints = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    auto first_three = ints | views::take(3);
+    BOOST_TEST(first_three.size() == 3);
+    BOOST_TEST(to_vector(first_three) == (std::vector<int>{0, 1, 2}));
+    BOOST_TEST(first_three.back() == 2);
+
+    BOOST_TEST((ints | views::take(20)).size() == 10);
+    BOOST_TEST((ints | views::take(0)).empty());
+
+    std::list<int> list(ints.begin(), ints.end());
+    BOOST_TEST(
+        to_vector(list | views::take(4)) == (std::vector<int>{0, 1, 2, 3}));
+    BOOST_TEST(to_vector(list | views::take(20)) == ints);
+    BOOST_TEST((list | views::take(0)).empty());
+
+    std::forward_list<int> flist(ints.begin(), ints.end());
+    auto take_two = views::take(flist, 2);
+    BOOST_TEST(std::distance(take_two.begin(), take_two.end()) == 2);
+}
+
+{
+    std::vector<int> ints = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    auto every_third = ints | views::stride(3);
+    BOOST_TEST(every_third.size() == 4);
+    BOOST_TEST(to_vector(every_third) == (std::vector<int>{0, 3, 6, 9}));
+    BOOST_TEST(every_third[2] == 6);
+    BOOST_TEST(every_third.back() == 9);
+    BOOST_TEST(*(every_third.end() - 2) == 6);
+
+    auto every_fourth = ints | views::stride(4);
+    BOOST_TEST(every_fourth.size() == 3);
+    BOOST_TEST(every_fourth.back() == 8);
+    auto it = every_fourth.begin();
+    it += 3;
+    BOOST_TEST(it == every_fourth.end());
+    it -= 2;
+    BOOST_TEST(*it == 4);
+
+    std::list<int> list(ints.begin(), ints.end());
+    BOOST_TEST(
+        to_vector(list | views::stride(4)) == (std::vector<int>{0, 4, 8}));
+}
+
+{
+    std::vector<int> ints = {0, 1, 2, 3, 4, 5, 6, 7};
+
+    auto chunks = ints | views::chunk(3);
+    BOOST_TEST(chunks.size() == 3);
+    BOOST_TEST(to_vector(chunks[0]) == (std::vector<int>{0, 1, 2}));
+    BOOST_TEST(to_vector(chunks[1]) == (std::vector<int>{3, 4, 5}));
+    BOOST_TEST(to_vector(chunks.back()) == (std::vector<int>{6, 7}));
+    BOOST_TEST(chunks.back().size() == 2);
+
+    int sums[3] = {};
+    int * out = sums;
+    for (auto chunk : chunks) {
+        *out++ = std::accumulate(chunk.begin(), chunk.end(), 0);
+    }
+    BOOST_TEST(sums[0] == 3);
+    BOOST_TEST(sums[1] == 12);
+    BOOST_TEST(sums[2] == 13);
+
+    std::forward_list<int> flist(ints.begin(), ints.end());
+    auto flist_chunks = flist | views::chunk(4);
+    BOOST_TEST(std::distance(flist_chunks.begin(), flist_chunks.end()) == 2);
+}
+
+{
+    std::vector<std::vector<int>> nested = {{0, 1}, {}, {2}, {}, {3, 4, 5}};
+    auto joined = nested | views::join();
+    BOOST_TEST(to_vector(joined) == (std::vector<int>{0, 1, 2, 3, 4, 5}));
+    BOOST_TEST(std::distance(joined.begin(), joined.end()) == 6);
+
+    std::vector<std::vector<int>> empties(3);
+    BOOST_TEST((empties | views::join()).empty());
+
+    // Chunking and joining is a round trip.
+    std::vector<int> ints = {0, 1, 2, 3, 4, 5, 6, 7};
+    BOOST_TEST(to_vector(ints | views::chunk(3) | views::join()) == ints);
+}
+
+{
+    std::vector<int> ints = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    // A pipeline is a single pass over ints, with no copies of its
+    // elements.
+    int calls = 0;
+    auto counted_square = [&calls](int x) {
+        ++calls;
+        return x * x;
+    };
+    auto pipeline = ints | views::filter(is_odd{}) |
+                    views::transform(counted_square) | views::take(3);
+    BOOST_TEST(calls == 0);
+    BOOST_TEST(to_vector(pipeline) == (std::vector<int>{1, 9, 25}));
+    BOOST_TEST(calls == 3);
+
+    // Closures compose before being applied.
+    auto odd_squares = views::filter(is_odd{}) | views::transform(square{});
+    BOOST_TEST(
+        to_vector(ints | odd_squares) ==
+        (std::vector<int>{1, 9, 25, 49, 81}));
+    BOOST_TEST(
+        to_vector(ints | (odd_squares | views::stride(2))) ==
+        (std::vector<int>{1, 25, 81}));
+
+    // An rvalue range is moved into the pipeline.
+    auto owned = std::vector<int>{1, 2, 3} | views::transform(square{});
+    BOOST_TEST(to_vector(owned) == (std::vector<int>{1, 4, 9}));
+
+    std::array<int, 4> const array = {{4, 3, 2, 1}};
+    BOOST_TEST(
+        to_vector(array | views::transform(square{}) | views::take(2)) ==
+        (std::vector<int>{16, 9}));
+}
+
+    return boost::report_errors();
+}
@@ -0,0 +1,212 @@
+// Copyright (C) 2019 T. Zachary Laine
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+#include <boost/stl_interfaces/zip_iterator.hpp>
+
+#include <boost/core/lightweight_test.hpp>
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <list>
+#include <numeric>
+#include <string>
+#include <vector>
+#if 201703L < __cplusplus
+#include <version>
+#endif
+
+
+namespace stl_interfaces = boost::stl_interfaces;
+
+using int_zip = stl_interfaces::zip_iterator<int *, int *>;
+
+static_assert(
+    std::is_same<
+        int_zip::iterator_category,
+        std::random_access_iterator_tag>::value,
+    "");
+static_assert(
+    std::is_same<int_zip::value_type, std::tuple<int, int>>::value, "");
+static_assert(
+    std::is_same<
+        int_zip::reference,
+        stl_interfaces::zip_reference<int &, int &>>::value,
+    "");
+static_assert(
+    std::is_same<
+        stl_interfaces::zip_iterator<
+            int *,
+            std::list<int>::iterator>::iterator_category,
+        std::bidirectional_iterator_tag>::value,
+    "");
+static_assert(std::tuple_size<int_zip::reference>::value == 2u, "");
+static_assert(
+    std::is_same<std::tuple_element_t<1, int_zip::reference>, int &>::value,
+    "");
+
+#if 201703L < __cplusplus && defined(__cpp_lib_ranges)
+using mixed_zip = stl_interfaces::zip_iterator<int *, double *>;
+static_assert(std::random_access_iterator<mixed_zip>);
+static_assert(std::indirectly_readable<mixed_zip>);
+static_assert(std::permutable<mixed_zip>);
+static_assert(std::sortable<mixed_zip>);
+static_assert(std::sortable<mixed_zip, std::ranges::greater>);
+#endif
+
+
+int main()
+{
+
+{
+    std::array<int, 10> ints = {{2, 0, 1, 5, 3, 6, 8, 4, 9, 7}};
+    std::array<int, 10> ones = {{1, 1, 1, 1, 1, 1, 1, 1, 1, 1}};
+
+    int_zip first(ints.data(), ones.data());
+    int_zip last(ints.data() + ints.size(), ones.data() + ones.size());
+    BOOST_TEST(last - first == 10);
+    BOOST_TEST(first[3] == std::make_tuple(5, 1));
+    BOOST_TEST(std::get<0>(*(first + 2)) == 1);
+    BOOST_TEST(first < last);
+    BOOST_TEST(first + 10 == last);
+
+    // std::sort needs swap(*it, *it) on rvalue references, and value_type
+    // round-trips through the reference type.
+    std::sort(first, last);
+    BOOST_TEST(std::is_sorted(ints.begin(), ints.end()));
+    BOOST_TEST(std::is_sorted(first, last));
+
+    *first = std::make_tuple(42, 7);
+    BOOST_TEST(ints[0] == 42);
+    BOOST_TEST(ones[0] == 7);
+
+    int_zip::value_type v = first[1];
+    BOOST_TEST(v == std::make_tuple(1, 1));
+}
+
+{
+    // A const zip_reference still assigns through its references.
+    int i = 0;
+    double d = 0.0;
+    auto const ref = *stl_interfaces::make_zip_iterator(&i, &d);
+    ref = std::make_tuple(1, 2.0);
+    BOOST_TEST(i == 1);
+    BOOST_TEST(d == 2.0);
+    std::tuple<int, double> t(3, 4.0);
+    ref = t;
+    BOOST_TEST(i == 3);
+    BOOST_TEST(d == 4.0);
+}
+
+#if 201703L < __cplusplus && defined(__cpp_lib_ranges)
+{
+    std::vector<int> keys = {3, 1, 2, 0};
+    std::vector<double> values = {3.5, 1.5, 2.5, 0.5};
+    auto first =
+        stl_interfaces::make_zip_iterator(keys.data(), values.data());
+    auto last = first + 4;
+    std::ranges::sort(first, last);
+    BOOST_TEST(keys == (std::vector<int>{0, 1, 2, 3}));
+    BOOST_TEST(values == (std::vector<double>{0.5, 1.5, 2.5, 3.5}));
+
+    std::ranges::sort(first, last, std::ranges::greater{});
+    BOOST_TEST(keys == (std::vector<int>{3, 2, 1, 0}));
+    BOOST_TEST(values == (std::vector<double>{3.5, 2.5, 1.5, 0.5}));
+
+    std::ranges::sort(first, last, {}, [](auto const & row) {
+        return std::get<1>(row);
+    });
+    BOOST_TEST(keys == (std::vector<int>{0, 1, 2, 3}));
+}
+#endif
+
+{
+    // Sorting by one column permutes the others with it.
+    std::vector<int> keys = {3, 1, 2, 0};
+    std::vector<std::string> names = {"three", "one", "two", "zero"};
+    auto first =
+        stl_interfaces::make_zip_iterator(keys.begin(), names.begin());
+    auto last = stl_interfaces::make_zip_iterator(keys.end(), names.end());
+    std::sort(first, last, [](auto const & lhs, auto const & rhs) {
+        return std::get<0>(lhs) < std::get<0>(rhs);
+    });
+    BOOST_TEST(keys == (std::vector<int>{0, 1, 2, 3}));
+    BOOST_TEST(
+        names == (std::vector<std::string>{"zero", "one", "two", "three"}));
+
+    // iter_move() moves out of each column.
+    std::tuple<int &&, std::string &&> moved = iter_move(first);
+    std::string s = std::move(std::get<1>(moved));
+    BOOST_TEST(s == "zero");
+    BOOST_TEST(names[0].empty());
+
+    iter_swap(first, first + 3);
+    BOOST_TEST(keys[0] == 3);
+    BOOST_TEST(names[0] == "three");
+    BOOST_TEST(names[3].empty());
+
+    std::reverse(first, last);
+    BOOST_TEST(keys == (std::vector<int>{0, 2, 1, 3}));
+    BOOST_TEST(names[3] == "three");
+
+    swap(*first, *(first + 1));
+    BOOST_TEST(keys == (std::vector<int>{2, 0, 1, 3}));
+
+#if 201402L < __cplusplus
+    auto && [key, name] = *(first + 3);
+    BOOST_TEST(key == 3);
+    BOOST_TEST(name == "three");
+#endif
+}
+
+{
+    // Bidirectional.
+    std::list<int> l = {1, 2, 3};
+    std::array<char, 3> chars = {{'a', 'b', 'c'}};
+    auto first = stl_interfaces::make_zip_iterator(l.begin(), chars.begin());
+    auto last = stl_interfaces::make_zip_iterator(l.end(), chars.end());
+    BOOST_TEST(std::distance(first, last) == 3);
+    auto it = last;
+    --it;
+    BOOST_TEST(*it == std::make_tuple(3, 'c'));
+    it--;
+    BOOST_TEST(std::get<1>(*it) == 'b');
+    std::reverse(first, last);
+    BOOST_TEST((l == std::list<int>{3, 2, 1}));
+    BOOST_TEST(chars[0] == 'c');
+}
+
+{
+    std::vector<float> xs = {3.f, 1.f, 2.f};
+    std::vector<float> ys = {30.f, 10.f, 20.f};
+    std::array<int, 3> ids = {{3, 1, 2}};
+    auto soa = stl_interfaces::make_soa_view(xs, ys, ids);
+    BOOST_TEST(soa.size() == 3u);
+    BOOST_TEST(!soa.empty());
+    BOOST_TEST(soa.column<0>() == xs.data());
+    BOOST_TEST(soa.column<2>() == ids.data());
+    BOOST_TEST(soa[1] == std::make_tuple(1.f, 10.f, 1));
+    BOOST_TEST(soa.back() == std::make_tuple(2.f, 20.f, 2));
+
+    std::sort(soa.begin(), soa.end());
+    BOOST_TEST(xs == (std::vector<float>{1.f, 2.f, 3.f}));
+    BOOST_TEST(ys == (std::vector<float>{10.f, 20.f, 30.f}));
+    BOOST_TEST(ids[2] == 3);
+
+    // A per-column loop is a loop over a plain array.
+    float * x = soa.column<0>();
+    float const * y = soa.column<1>();
+    for (std::size_t i = 0; i < soa.size(); ++i) {
+        x[i] += y[i];
+    }
+    BOOST_TEST(xs == (std::vector<float>{11.f, 22.f, 33.f}));
+
+    stl_interfaces::soa_view<float> const empty;
+    BOOST_TEST(empty.empty());
+    BOOST_TEST(empty.begin() == empty.end());
+}
+
+    return boost::report_errors();
+}